@@ -20,6 +20,11 @@
  * $Id$
  *
  *
+ *      AG 2026-10-16: Dataset sizes cached by tau_initMarshall()
+ *      AG 2026-10-16: Field accessors into marshalled data, tau_initFieldAccess(), tau_readField...()
+ *      AG 2026-10-16: Specialised (generated) marshalling functions, tau_registerMarshallFuncs()
+ *      AG 2026-10-16: Marshalling database per tau_initMarshall() call, tau_deInitMarshall()
+ *      AG 2026-10-16: Compiled marshalling plans, tau_enableMarshallPlans()
  *      BL 2015-12-14: Ticket #33: source size check for marshalling
  */
 
@@ -53,6 +58,45 @@ extern "C" {
 
 /** Types for marshalling / unmarshalling    */
 
+/** Specialised conversion of one fixed-layout dataset between its host structure and the wire.
+    Buffer sizes and the alignment of the host structure are checked by the caller.   */
+typedef void (*TAU_MARSHALL_FUNC_T)(
+    const UINT8 *pSrc,
+    UINT8       *pDest);
+
+/** Specialised functions of one dataset, e.g. generated by trdp-marshall-gen */
+typedef struct
+{
+    UINT32              datasetId;      /**< dataset the functions are made for      */
+    UINT32              wireSize;       /**< size of the marshalled dataset          */
+    UINT32              hostSize;       /**< size of the host structure              */
+    TAU_MARSHALL_FUNC_T pfMarshall;     /**< host structure to wire                  */
+    TAU_MARSHALL_FUNC_T pfUnmarshall;   /**< wire to host structure                  */
+} TAU_MARSHALL_FUNCS_T;
+
+/** One step of the path from a dataset to one of its (nested) elements */
+typedef struct
+{
+    const TRDP_DATASET_T    *pDataset;  /**< dataset containing the element              */
+    UINT32                  element;    /**< index of the element in the dataset         */
+    UINT32                  item;       /**< index of the item, if the element is an array   */
+} TAU_FIELD_STEP_T;
+
+/** Precomputed access to one element of marshalled data, set up by tau_initFieldAccess().
+    Items are stored on the wire in network byte order (big endian) without padding.   */
+typedef struct
+{
+    void                *pRefCon;       /**< marshalling database the path was resolved in  */
+    UINT32              datasetId;      /**< dataset of the marshalled data              */
+    UINT32              type;           /**< TRDP_DATA_TYPE_T of the element             */
+    UINT32              noOfItems;      /**< array size, TRDP_VAR_SIZE if given by the element in front  */
+    UINT32              itemSize;       /**< size of one item on the wire                */
+    UINT32              wireOffset;     /**< offset of the addressed item, if fixedOffset    */
+    BOOL8               fixedOffset;    /**< FALSE: variable sized elements in front, the offset is scanned for */
+    UINT32              depth;          /**< number of path steps                        */
+    TAU_FIELD_STEP_T    step[TAU_MAX_DS_LEVEL]; /**< path from the dataset to the element    */
+} TAU_FIELD_T;
+
 /***********************************************************************************************************************
  * PROTOTYPES
  */
@@ -63,16 +107,22 @@ extern "C" {
 
 /**********************************************************************************************************************/
 /**    Function to initialise the marshalling/unmarshalling.
- *
+ *    The configuration is indexed into a marshalling database which is returned in ppRefCon. Pass it as
+ *    pRefCon to the marshalling functions (e.g. in TRDP_MARSHALL_CONFIG_T) to use several configurations at the
+ *    same time; a NULL pRefCon, or one which is not a live database, selects the last initialised database.
+ *    Calling it again with the same ppRefCon (e.g. on reconfiguration) replaces and releases the database
+ *    *ppRefCon refers to. A database is otherwise kept until tau_deInitMarshall().
  *
  *  @param[in,out]  ppRefCon         Returns a pointer to be used for the reference context of marshalling/unmarshalling
+ *                                   If it refers to a database already, that one is replaced; initialise it to NULL
+ *                                   If NULL, the database replaces the one of the previous call without ppRefCon
  *  @param[in]      numComId         Number of datasets found in the configuration
  *  @param[in]      pComIdDsIdMap    Pointer to an array of structures of type TRDP_DATASET_T
  *  @param[in]      numDataSet       Number of datasets found in the configuration
  *  @param[in]      pDataset         Pointer to an array of pointers to structures of type TRDP_DATASET_T
  *
  *  @retval         TRDP_NO_ERR      no error
- *  @retval         TRDP_MEM_ERR     provided buffer to small
+ *  @retval         TRDP_MEM_ERR     out of memory
  *  @retval         TRDP_PARAM_ERR   Parameter error
  *
  */
@@ -85,11 +135,28 @@ EXT_DECL TRDP_ERR_T tau_initMarshall(
     TRDP_DATASET_T         * pDataset[]);
 
 
+/**********************************************************************************************************************/
+/**    Function to release a marshalling database.
+ *    Should be called before tlc_terminate(), as the database is allocated from the VOS memory. Databases not
+ *    released are forgotten when the VOS memory is deleted.
+ *
+ *  @param[in]      pRefCon          Reference context returned by tau_initMarshall(),
+ *                                   NULL for the database initialised without ppRefCon
+ *
+ *  @retval         TRDP_NO_ERR      no error
+ *  @retval         TRDP_PARAM_ERR   not a marshalling database
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_deInitMarshall(
+    void *pRefCon);
+
+
 
 /**********************************************************************************************************************/
 /**    marshall function.
  *
- *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      comId           ComId to identify the structure out of a configuration
  *  @param[in]      pSrc            pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -119,7 +186,7 @@ EXT_DECL TRDP_ERR_T tau_marshall (
 /**********************************************************************************************************************/
 /**    marshall data set function.
  *
- *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      dsId            Data set id to identify the structure out of a configuration
  *  @param[in]      pSrc            pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -149,7 +216,7 @@ EXT_DECL TRDP_ERR_T tau_marshallDs (
 /**********************************************************************************************************************/
 /**    unmarshall function.
  *
- *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      comId           ComId to identify the structure out of a configuration
  *  @param[in]      pSrc            pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -178,7 +245,7 @@ EXT_DECL TRDP_ERR_T tau_unmarshall (
 /**********************************************************************************************************************/
 /**    unmarshall data set function.
  *
- *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      dsId            Data set id to identify the structure out of a configuration
  *  @param[in]      pSrc            pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -206,8 +273,10 @@ EXT_DECL TRDP_ERR_T tau_unmarshallDs (
 
 /**********************************************************************************************************************/
 /**    Calculate data set size by given data set id.
+ *  The unmarshalled size of a fixed-layout dataset is known from tau_initMarshall(), variable datasets are only
+ *  scanned from their first variable sized element on.
  *
- *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      dsId            Dataset id to identify the structure out of a configuration
  *  @param[in]      pSrc            Pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -233,7 +302,7 @@ EXT_DECL TRDP_ERR_T tau_calcDatasetSize (
 /**********************************************************************************************************************/
 /**    Calculate data set size by given ComId.
  *
- *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      comId           ComId id to identify the structure out of a configuration
  *  @param[in]      pSrc            Pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -255,6 +324,172 @@ EXT_DECL TRDP_ERR_T tau_calcDatasetSizeByComId (
     UINT32          *pDestSize,
     TRDP_DATASET_T  * *ppDSPointer);
 
+/**********************************************************************************************************************/
+/**    Register specialised marshalling functions with a marshalling database.
+ *  The functions replace the compiled plans of their datasets. An entry is only accepted for a fixed-layout dataset
+ *  of the database whose wire and host sizes match, i.e. which was generated from the same configuration.
+ *  The table must exist as long as the database.
+ *
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
+ *  @param[in]      numFuncs        Number of table entries
+ *  @param[in]      pFuncs          Table of specialised functions
+ *
+ *  @retval         TRDP_NO_ERR     all entries registered
+ *  @retval         TRDP_INIT_ERR   marshalling not initialised
+ *  @retval         TRDP_PARAM_ERR  parameter error or an entry does not match its dataset (others are registered)
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_registerMarshallFuncs (
+    void                        *pRefCon,
+    UINT32                      numFuncs,
+    const TAU_MARSHALL_FUNCS_T  *pFuncs);
+
+/**********************************************************************************************************************/
+/**    Enable or disable the use of compiled marshalling plans.
+ *  Datasets without variable sized elements are compiled into flat copy/swap plans by tau_initMarshall().
+ *  Plans and registered specialised functions are used by default; disabling them forces the generic dataset
+ *  interpreter (for diagnostics and comparisons). The marshalled data is identical in both cases.
+ *
+ *  @param[in]      enable          TRUE to use plans (default), FALSE to interpret the datasets
+ *
+ *  @retval         none
+ *
+ */
+
+EXT_DECL void tau_enableMarshallPlans (
+    BOOL8 enable);
+
+/**********************************************************************************************************************/
+/*    Field access                                                                                                    */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/**    Resolve the path of one element of a dataset into an accessor.
+ *  Single signals can then be read from received, still marshalled data (e.g. from tlp_get() without
+ *  TRDP_FLAGS_MARSHALL) without unmarshalling the whole dataset.
+ *  The path consists of element names or element numbers (starting with 1) separated by '.', nested datasets are
+ *  entered by further steps. An element which is an array of datasets needs the index of the item, e.g.
+ *  "position[2].lat". An index given for the last element is added to the index of the read functions.
+ *  The offset of an element behind variable sized elements is not constant, it is found by a scan of the
+ *  marshalled data in front of it on each access.
+ *  The accessor refers to the configuration and is valid as long as the marshalling database.
+ *
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
+ *  @param[in]      dsId            Dataset id of the marshalled data
+ *  @param[in]      pPath           Path of the element
+ *  @param[out]     pField          Accessor to initialise
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_INIT_ERR   marshalling not initialised
+ *  @retval         TRDP_COMID_ERR  dataset or nested dataset unknown
+ *  @retval         TRDP_PARAM_ERR  parameter error, path not found or too deep
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_initFieldAccess (
+    void                *pRefCon,
+    UINT32              dsId,
+    const CHAR8         *pPath,
+    TAU_FIELD_T         *pField);
+
+/**********************************************************************************************************************/
+/**    Locate an element in marshalled data.
+ *  For raw access to an element, e.g. to copy a CHAR8 array.
+ *
+ *  @param[in]      pField          Accessor from tau_initFieldAccess()
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[out]     pOffset         Offset of the addressed item in the marshalled data
+ *  @param[out]     pNoOfItems      Number of items from the addressed item up to the end of the element, may be NULL
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          parameter error, item index out of range
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_locateField (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              *pOffset,
+    UINT32              *pNoOfItems);
+
+/**********************************************************************************************************************/
+/**    Read one item of an element from marshalled data as unsigned value.
+ *  Any type is returned as its unsigned wire value, TIMEDATE48 as seconds << 16 | ticks,
+ *  TIMEDATE64 as seconds << 32 | microseconds.
+ *
+ *  @param[in]      pField          Accessor from tau_initFieldAccess()
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[in]      index           Index of the item, 0 if the element is not an array
+ *  @param[out]     pValue          Value of the item
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          parameter error, item index out of range, element is a dataset
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_readFieldUInt (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              index,
+    UINT64              *pValue);
+
+/**********************************************************************************************************************/
+/**    Read one item of an element from marshalled data as signed value.
+ *  INT8 ... INT64 are sign extended, all other types are read as by tau_readFieldUInt().
+ *
+ *  @param[in]      pField          Accessor from tau_initFieldAccess()
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[in]      index           Index of the item, 0 if the element is not an array
+ *  @param[out]     pValue          Value of the item
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          parameter error, item index out of range, element is a dataset
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_readFieldInt (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              index,
+    INT64               *pValue);
+
+/**********************************************************************************************************************/
+/**    Read one item of an element from marshalled data as floating point value.
+ *  REAL32 and REAL64 are decoded, integer types converted.
+ *
+ *  @param[in]      pField          Accessor from tau_initFieldAccess()
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[in]      index           Index of the item, 0 if the element is not an array
+ *  @param[out]     pValue          Value of the item
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          parameter error, item index out of range, element is a dataset or TIMEDATE48/64
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_readFieldReal (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              index,
+    REAL64              *pValue);
+
 
 #ifdef __cplusplus
 }
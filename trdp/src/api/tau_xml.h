@@ -19,6 +19,8 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: Binary configuration cache (tau_loadXmlCache, tau_readXmlCache...)
+ *      AG 2026-10-16: XML documents are mapped into memory and indexed once
  *      AR 2020-05-08: Added attribute 'name' to event, method, field and instance structures used for service oriented interface
  *      SB 2020-01-27: Added parsing for dummyService flag to Service definitions and MD option for events
  *     CKH 2019-10-11: Ticket #2: TRDPXML: Support of mapped devices missing (XLS #64)
@@ -248,6 +250,10 @@ typedef struct
     struct XML_HANDLE *pXmlDocument;           /**< XML document context */
 } TRDP_XML_DOC_HANDLE_T;
 
+/** Binary cache of an XML configuration, see tau_loadXmlCache
+ */
+typedef struct TAU_XML_CACHE TAU_XML_CACHE_T;
+
 
 /***********************************************************************************************************************
  * PROTOTYPES
@@ -262,6 +268,8 @@ typedef struct
 /**********************************************************************************************************************/
 /**    Load XML file into DOM tree, prepare XPath context.
  *
+ *  The file is mapped into memory and its elements are indexed in one pass, the tau_readXml... functions
+ *  work on this index.
  *
  *  @param[in]      pFileName         Path and filename of the xml configuration file
  *  @param[out]     pDocHnd           Handle of the parsed XML file
@@ -491,6 +499,116 @@ EXT_DECL TRDP_ERR_T tau_readXmlMappedInterfaceConfig(
     UINT32                      *pNumExchgPar,
     TRDP_EXCHG_PAR_T            * *ppExchgPar);
 
+/**********************************************************************************************************************/
+/*    Binary configuration cache
+                                                                                                   */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/**    Load the binary cache of an XML configuration file, build it if missing or outdated.
+ *
+ *  The device, interface and dataset configuration is read once by the tau_readXml... functions and stored as
+ *  a relocatable image in the cache file. Later calls map the cache file into memory instead of parsing the XML file.
+ *  The cache is rebuilt whenever the XML file changes (size and CRC are compared). If the cache file cannot be
+ *  written, the image is kept in memory only.
+ *  Memory is taken from the heap (not from the VOS memory area), the cache may be loaded before vos_memInit.
+ *
+ *  @param[in]      pFileName         Path and filename of the xml configuration file
+ *  @param[in]      pCacheName        Path and filename of the cache, NULL: XML file name with ".cache" appended
+ *  @param[out]     ppCache           Pointer to the loaded cache
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_MEM_ERR      out of memory
+ *  @retval         TRDP_PARAM_ERR    File does not exist or cannot be parsed
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_loadXmlCache (
+    const CHAR8         *pFileName,
+    const CHAR8         *pCacheName,
+    TAU_XML_CACHE_T     * *ppCache);
+
+/**********************************************************************************************************************/
+/**    Release a cache loaded by tau_loadXmlCache, including all configuration arrays returned from it.
+ *
+ *  @param[in]      pCache            Cache
+ *
+ */
+EXT_DECL void tau_freeXmlCache (
+    TAU_XML_CACHE_T *pCache);
+
+/**********************************************************************************************************************/
+/**    Device configuration from the cache, see tau_readXmlDeviceConfig.
+ *  The arrays are owned by the cache and must not be freed.
+ *
+ *  @param[in]      pCache            Cache loaded by tau_loadXmlCache
+ *  @param[out]     pMemConfig        Memory configuration
+ *  @param[out]     pDbgConfig        Debug printout configuration for application use
+ *  @param[out]     pNumComPar        Number of configured com parameters
+ *  @param[out]     ppComPar          Pointer to array of com parameters
+ *  @param[out]     pNumIfConfig      Number of configured interfaces
+ *  @param[out]     ppIfConfig        Pointer to an array of interface parameter sets
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readXmlCacheDeviceConfig (
+    const TAU_XML_CACHE_T   *pCache,
+    TRDP_MEM_CONFIG_T       *pMemConfig,
+    TRDP_DBG_CONFIG_T       *pDbgConfig,
+    UINT32                  *pNumComPar,
+    TRDP_COM_PAR_T          * *ppComPar,
+    UINT32                  *pNumIfConfig,
+    TRDP_IF_CONFIG_T        * *ppIfConfig);
+
+/**********************************************************************************************************************/
+/**    Interface configuration from the cache, see tau_readXmlInterfaceConfig.
+ *  The telegram array is owned by the cache and must not be freed with tau_freeTelegrams.
+ *  Unlike tau_readXmlInterfaceConfig, an interface which is not configured is reported as error.
+ *
+ *  @param[in]      pCache            Cache loaded by tau_loadXmlCache
+ *  @param[in]      pIfName           Interface name, empty for the first interface
+ *  @param[out]     pProcessConfig    TRDP process (session) configuration for the interface
+ *  @param[out]     pPdConfig         PD default configuration for the interface
+ *  @param[out]     pMdConfig         MD default configuration for the interface
+ *  @param[out]     pNumExchgPar      Number of configured telegrams
+ *  @param[out]     ppExchgPar        Pointer to array of telegram configurations
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error or interface not configured
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readXmlCacheInterfaceConfig (
+    const TAU_XML_CACHE_T   *pCache,
+    const CHAR8             *pIfName,
+    TRDP_PROCESS_CONFIG_T   *pProcessConfig,
+    TRDP_PD_CONFIG_T        *pPdConfig,
+    TRDP_MD_CONFIG_T        *pMdConfig,
+    UINT32                  *pNumExchgPar,
+    TRDP_EXCHG_PAR_T        * *ppExchgPar);
+
+/**********************************************************************************************************************/
+/**    Dataset configuration from the cache, see tau_readXmlDatasetConfig.
+ *  The arrays are owned by the cache and must not be freed with tau_freeXmlDatasetConfig. They are already sorted,
+ *  tau_initMarshall uses them without sorting.
+ *
+ *  @param[in]      pCache            Cache loaded by tau_loadXmlCache
+ *  @param[out]     pNumComId         Pointer to the number of entries in the ComId DatasetId mapping list
+ *  @param[out]     ppComIdDsIdMap    Pointer to an array of a structures of type TRDP_COMID_DSID_MAP_T
+ *  @param[out]     pNumDataset       Pointer to the number of datasets found in the configuration
+ *  @param[out]     papDataset        Pointer to an array of pointers to a structures of type TRDP_DATASET_T
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readXmlCacheDatasetConfig (
+    const TAU_XML_CACHE_T   *pCache,
+    UINT32                  *pNumComId,
+    TRDP_COMID_DSID_MAP_T   * *ppComIdDsIdMap,
+    UINT32                  *pNumDataset,
+    papTRDP_DATASET_T       papDataset);
+
 #ifdef __cplusplus
 }
 #endif
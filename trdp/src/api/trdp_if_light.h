@@ -17,6 +17,13 @@
 /*
 * $Id$
 *
+*      AG 2026-10-16: tlm_preConnect(), tlc_getTcpPoolStatistics() added
+*      AG 2026-10-16: tlp_putMany(), tlp_getMany() added
+*      AG 2026-10-16: tlp_reserve(), tlp_commit() added
+*      AG 2026-10-16: tlp_getRef(), tlp_release() added
+*      AG 2026-10-16: tlc_processEvents() added
+*      AG 2026-10-16: tlc_getSubsSeqStatistics() added
+*      AG 2026-10-16: tlc_getPdBatchStatistics() added
 *      A 2023-01-13: Ticket #412 Added tlp_republishService
 *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced
 *      BL 2020-09-08: Ticket #343 userStatus parameter size in tlm_reply and tlm_replyQuery
@@ -131,6 +138,10 @@ EXT_DECL TRDP_ERR_T tlc_process (
     TRDP_FDS_T          *pRfds,
     INT32               *pCount);
 
+EXT_DECL TRDP_ERR_T tlc_processEvents (
+    TRDP_APP_SESSION_T  appHandle,
+    const TRDP_TIME_T   *pMaxWait);
+
 EXT_DECL TRDP_IP_ADDR_T tlc_getOwnIpAddress (
     TRDP_APP_SESSION_T appHandle);
 
@@ -203,6 +214,22 @@ EXT_DECL TRDP_ERR_T tlp_putImmediate (
     UINT32              dataSize,
     VOS_TIMEVAL_T       *pTxTime);
 
+EXT_DECL TRDP_ERR_T tlp_putMany (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_PUT_ENTRY_T    *pEntries,
+    UINT32              noOfEntries);
+
+EXT_DECL TRDP_ERR_T tlp_reserve (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_PUB_T          pubHandle,
+    UINT32              dataSize,
+    UINT8               * *ppData);
+
+EXT_DECL TRDP_ERR_T tlp_commit (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_PUB_T          pubHandle,
+    UINT32              dataSize);
+
 EXT_DECL TRDP_ERR_T tlp_setRedundant (
     TRDP_APP_SESSION_T  appHandle,
     UINT32              redId,
@@ -272,6 +299,23 @@ EXT_DECL TRDP_ERR_T tlp_get (
     UINT8               *pData,
     UINT32              *pDataSize);
 
+EXT_DECL TRDP_ERR_T tlp_getMany (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_GET_ENTRY_T    *pEntries,
+    UINT32              noOfEntries);
+
+EXT_DECL TRDP_ERR_T tlp_getRef (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    TRDP_PD_INFO_T      *pPdInfo,
+    const UINT8         * *ppData,
+    UINT32              *pDataSize);
+
+EXT_DECL TRDP_ERR_T tlp_release (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    const UINT8         *pData);
+
 #if MD_SUPPORT
 
 EXT_DECL TRDP_ERR_T tlm_process (
@@ -329,6 +373,13 @@ EXT_DECL TRDP_ERR_T tlm_confirm (
     const TRDP_SEND_PARAM_T *pSendParam);
 
 
+EXT_DECL TRDP_ERR_T tlm_preConnect (
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          destIpAddr);
+
+
 EXT_DECL TRDP_ERR_T tlm_abortSession (
     TRDP_APP_SESSION_T  appHandle,
     const TRDP_UUID_T   *pSessionId);
@@ -401,6 +452,11 @@ EXT_DECL TRDP_ERR_T tlc_getSubsStatistics (
     UINT16                  *pNumSubs,
     TRDP_SUBS_STATISTICS_T  *pStatistics);
 
+EXT_DECL TRDP_ERR_T tlc_getSubsSeqStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    UINT16                      *pNumSubs,
+    TRDP_SUBS_SEQ_STATISTICS_T  *pStatistics);
+
 EXT_DECL TRDP_ERR_T tlc_getPubStatistics (
     TRDP_APP_SESSION_T      appHandle,
     UINT16                  *pNumPub,
@@ -418,6 +474,10 @@ EXT_DECL TRDP_ERR_T tlc_getTcpListStatistics (
     UINT16                  *pNumList,
     TRDP_LIST_STATISTICS_T  *pStatistics);
 
+EXT_DECL TRDP_ERR_T tlc_getTcpPoolStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    TRDP_TCP_POOL_STATISTICS_T  *pStatistics);
+
 #endif /* MD_SUPPORT    */
 
 EXT_DECL TRDP_ERR_T tlc_getRedStatistics (
@@ -430,6 +490,10 @@ EXT_DECL TRDP_ERR_T tlc_getJoinStatistics (
     UINT16              *pNumJoin,
     UINT32              *pIpAddr);
 
+EXT_DECL TRDP_ERR_T tlc_getPdBatchStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    TRDP_PD_BATCH_STATISTICS_T  *pStatistics);
+
 EXT_DECL TRDP_ERR_T tlc_resetStatistics (
     TRDP_APP_SESSION_T appHandle);
 
@@ -17,6 +17,12 @@
 /*
  * $Id$
  *
+ *      AG 2026-10-16: stream of TRDP_MD_CONFIG_T, streamSize and streamOffset of TRDP_MD_INFO_T for chunked TCP MD reception
+ *      AG 2026-10-16: TRDP_TCP_POOL_STATISTICS_T for the pooled TCP connections of MD callers
+ *      AG 2026-10-16: TRDP_PUT_ENTRY_T, TRDP_GET_ENTRY_T for tlp_putMany(), tlp_getMany()
+ *      AG 2026-10-16: TRDP_SUBS_SEQ_STATISTICS_T for the sequence counter tables of the subscriptions
+ *      AG 2026-10-16: TRDP_PD_BATCH_STATISTICS_T extended by transmit counters
+ *      AG 2026-10-16: TRDP_PD_BATCH_STATISTICS_T for batched PD reception
  *     CWE 2023-02-14: Ticket #419 PDTestFastBase2 failed - Comments adapted for base 2 cycle time support
  *     AHW 2023-01-11: Lint warnigs
  *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
@@ -317,6 +323,8 @@ typedef struct
     UINT32              numReplies;         /**< actual number of replies for the request   */
     void                *pUserRef;          /**< User reference given with the local call   */
     TRDP_ERR_T          resultCode;         /**< error code                                 */
+    UINT32              streamSize;         /**< message delivered in chunks: dataset size, else 0  */
+    UINT32              streamOffset;       /**< message delivered in chunks: position of the chunk */
 } TRDP_MD_INFO_T;
 
 
@@ -487,6 +495,33 @@ typedef struct
     TRDP_MD_STATISTICS_T    tcpMd;        /**< TCP md statistics */
 } GNU_PACKED TRDP_STATISTICS_T;
 
+/** Statistics of batched PD reception and transmission (not part of the IEC 61375-2-3 statistics telegram). */
+typedef struct
+{
+    UINT32  numRxBatches;     /**< number of receive calls which returned PD packets */
+    UINT32  numRxPackets;     /**< number of PD packets returned by these calls */
+    UINT32  maxRxBatchSize;   /**< maximum number of PD packets returned by one call */
+    UINT32  avgRxBatchSize;   /**< average number of PD packets per receive call in 1/100 (computed on request) */
+    UINT32  numTxBatches;     /**< number of batched send calls */
+    UINT32  numTxPackets;     /**< number of PD packets sent by these calls */
+    UINT32  maxTxBatchSize;   /**< maximum number of PD packets passed to one call */
+    UINT32  avgTxBatchSize;   /**< average number of PD packets per send call in 1/100 (computed on request) */
+} TRDP_PD_BATCH_STATISTICS_T;
+
+/** Statistics of the pooled TCP connections of MD callers (not part of the IEC 61375-2-3 statistics telegram). */
+typedef struct
+{
+    UINT32  numOpen;          /**< number of open caller connections (computed on request) */
+    UINT32  numIdle;          /**< number of idle connections kept for reuse (computed on request) */
+    UINT32  numHits;          /**< number of sessions which reused an idle connection */
+    UINT32  numMisses;        /**< number of sessions which needed a new connection */
+    UINT32  numPreConnects;   /**< number of connections opened in advance by tlm_preConnect() */
+    UINT32  numIdleClosed;    /**< number of idle connections closed after the connect timeout */
+    UINT32  numConnects;      /**< number of connections established while a session waited for them */
+    UINT32  avgConnectTime;   /**< average time these connections took in us (computed on request) */
+    UINT32  maxConnectTime;   /**< maximum time one of these connections took in us */
+} TRDP_TCP_POOL_STATISTICS_T;
+
 /** Table containing particular PD subscription information. */
 typedef struct
 {
@@ -503,6 +538,19 @@ typedef struct
     UINT32                  numMissed; /**< number of packets skipped for this subscription */
 } GNU_PACKED TRDP_SUBS_STATISTICS_T;
 
+/** Sequence counter table of a PD subscription (not part of the IEC 61375-2-3 statistics telegram). */
+typedef struct
+{
+    UINT32                  comId;          /**< Subscribed ComId */
+    TRDP_IP_ADDR_T          filterAddr;     /**< Filter IP address, as in TRDP_SUBS_STATISTICS_T */
+    UINT32                  numSenders;     /**< Number of senders (source IP / message type) currently tracked */
+    UINT32                  peakSenders;    /**< Highest number of senders tracked at the same time */
+    UINT32                  tableSize;      /**< Number of slots of the hash table, 0 if nothing received yet */
+    UINT32                  numDuplicates;  /**< Number of packets dropped as duplicate or old */
+    UINT32                  numAged;        /**< Number of senders dropped after being silent */
+    UINT32                  numGrown;       /**< Number of times the hash table was enlarged */
+} TRDP_SUBS_SEQ_STATISTICS_T;
+
 /** Table containing particular PD publishing information. */
 typedef struct
 {
@@ -546,6 +594,25 @@ typedef struct PD_ELE *TRDP_PUB_T;
 typedef struct PD_ELE *TRDP_SUB_T;
 typedef struct MD_LIS_ELE *TRDP_LIS_T;
 
+/** Entry of tlp_putMany()    */
+typedef struct
+{
+    TRDP_PUB_T      pubHandle;      /**< handle returned by tlp_publish                 */
+    const UINT8     *pData;         /**< pointer to application's data buffer           */
+    UINT32          dataSize;       /**< size of data                                   */
+    TRDP_ERR_T      result;         /**< out: result of the put                         */
+} TRDP_PUT_ENTRY_T;
+
+/** Entry of tlp_getMany()    */
+typedef struct
+{
+    TRDP_SUB_T      subHandle;      /**< handle returned by tlp_subscribe               */
+    TRDP_PD_INFO_T  *pPdInfo;       /**< pointer to application's info buffer or NULL   */
+    UINT8           *pData;         /**< pointer to application's data buffer           */
+    UINT32          dataSize;       /**< in: size of buffer, out: size of data          */
+    TRDP_ERR_T      result;         /**< out: result of the get                         */
+} TRDP_GET_ENTRY_T;
+
 
 
 /**********************************************************************************************************************/
@@ -698,6 +765,8 @@ typedef struct
     UINT16              udpPort;                /**< Port to be used for UDP MD communication (default: 17225)  */
     UINT16              tcpPort;                /**< Port to be used for TCP MD communication (default: 17225)  */
     UINT32              maxNumSessions;         /**< Maximal number of replier sessions         */
+    BOOL8               stream;                 /**< Deliver TCP messages larger than TRDP_MD_STREAM_CHUNK_SIZE
+                                                     in chunks, see streamSize of TRDP_MD_INFO_T */
 } TRDP_MD_CONFIG_T;
 
 
@@ -17,6 +17,13 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: tau_initMarshall() does not sort tables which are already sorted (binary configuration cache)
+ *      AG 2026-10-16: Dataset sizes from the compiled plans, variable datasets scanned from their first variable element
+ *      AG 2026-10-16: Field accessors read single elements from marshalled data, prefix scan behind variable elements
+ *      AG 2026-10-16: Registered specialised functions take precedence over compiled plans
+ *      AG 2026-10-16: Marshalling database per tau_initMarshall() call, referenced by pRefCon, hashed lookups
+ *      AG 2026-10-16: Arrays of 16/32/64 bit items converted by vos_copyNetOrderXX()
+ *      AG 2026-10-16: Fixed-layout datasets are compiled into flat copy/swap plans by tau_initMarshall()
  *      SB 2021-08-09: Lint warnings
  *      BL 2020-08-12: Warning output moved (to before aligning source pointer on return from possible recursion)
  *      SB 2019-08-15: Compiler warning (pointer compared to integer)
@@ -55,16 +62,6 @@
  * TYPEDEFS
  */
 
-/** Marshalling info, used to and from wire */
-typedef struct
-{
-    INT32       level;          /**< track recursive level   */
-    const UINT8 *pSrc;          /**< source pointer          */
-    const UINT8 *pSrcEnd;       /**< last source             */
-    UINT8       *pDst;          /**< destination pointer     */
-    UINT8       *pDstEnd;       /**< last destination        */
-} TAU_MARSHALL_INFO_T;
-
 /* structure type definitions for alignment calculation */
 typedef struct
 {
@@ -82,16 +79,97 @@ typedef struct
     TIMEDATE64 a;
 } TIMEDATE64_STRUCT_T;
 
+/** Operations of a compiled marshalling plan */
+typedef enum
+{
+    TAU_OP_COPY     = 0u,       /**< copy bytes unchanged                */
+    TAU_OP_SWAP16   = 1u,       /**< 16 bit items, network byte order    */
+    TAU_OP_SWAP32   = 2u,       /**< 32 bit items, network byte order    */
+    TAU_OP_SWAP64   = 3u        /**< 64 bit items, network byte order    */
+} TAU_OP_KIND_T;
+
+/** One operation of a plan, covering a run of items contiguous on the wire and in host memory */
+typedef struct
+{
+    UINT32  kind;               /**< TAU_OP_KIND_T                       */
+    UINT32  wireOffset;         /**< offset into the marshalled data     */
+    UINT32  hostOffset;         /**< offset into the host structure      */
+    UINT32  noOfItems;          /**< number of items of this kind        */
+} TAU_MARSHALL_OP_T;
+
+/** Constant part of a dataset in front of its first variable sized element */
+typedef struct
+{
+    UINT32  element;            /**< index of the first variable element, 0 if none in front */
+    UINT32  wireOffset;         /**< its offset in the marshalled data   */
+    UINT32  hostOffset;         /**< its offset in the host structure, before alignment */
+    UINT32  varSizeOffset;      /**< offset of the element giving the size of a variable array */
+    UINT32  varSizeBytes;       /**< item size of that element, 0 if none */
+} TAU_MARSHALL_PREFIX_T;
+
+/** Compiled plan of a dataset without variable sized elements */
+typedef struct
+{
+    BOOL8   fixedSize;          /**< dataset has a fixed size and could be compiled */
+    UINT32  align;              /**< alignment of the host structure     */
+    UINT32  wireSize;           /**< size of the marshalled data         */
+    UINT32  hostSize;           /**< size of the host structure          */
+    UINT32  firstOp;            /**< index into pPlanOps                 */
+    UINT32  noOfOps;            /**< number of operations                */
+    const TAU_MARSHALL_FUNCS_T  *pFuncs;    /**< registered functions, replace the operations */
+    TAU_MARSHALL_PREFIX_T       prefix;     /**< fixed part of a variable dataset, for size calculation */
+} TAU_MARSHALL_PLAN_T;
+
+/** Open addressing hash table entry */
+typedef struct
+{
+    UINT32  key;                /**< comId or dataset id                 */
+    UINT32  index;              /**< index into pDataSets + 1, 0 = empty */
+} TAU_HASH_ENTRY_T;
+
+/** Marshalling database, one per tau_initMarshall() call, referenced by pRefCon */
+typedef struct TAU_MARSHALL_DB
+{
+    struct TAU_MARSHALL_DB  *pNext;         /**< next live database                  */
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap; /**< comId/dataset id map, sorted        */
+    UINT32                  numComId;       /**< number of map entries               */
+    TRDP_DATASET_T          * *pDataSets;   /**< datasets, sorted by id              */
+    UINT32                  numDataSet;     /**< number of datasets                  */
+    UINT32                  hashShift;      /**< 32 - log2(hash table size)          */
+    TAU_HASH_ENTRY_T        *pComIdHash;    /**< comId to dataset                    */
+    TAU_HASH_ENTRY_T        *pDsIdHash;     /**< dataset id to dataset               */
+    TAU_MARSHALL_PLAN_T     *pPlans;        /**< parallel to pDataSets               */
+    TAU_MARSHALL_OP_T       *pPlanOps;      /**< operations of all plans             */
+    UINT32                  numPlanOps;     /**< used operations                     */
+    UINT32                  maxPlanOps;     /**< allocated operations                */
+} TAU_MARSHALL_DB_T;
+
+/** Marshalling info, used to and from wire */
+typedef struct
+{
+    const TAU_MARSHALL_DB_T *pDb;   /**< dataset database    */
+    INT32       level;          /**< track recursive level   */
+    const UINT8 *pSrc;          /**< source pointer          */
+    const UINT8 *pSrcEnd;       /**< last source             */
+    UINT8       *pDst;          /**< destination pointer     */
+    UINT8       *pDstEnd;       /**< last destination        */
+} TAU_MARSHALL_INFO_T;
+
+
 
 /***********************************************************************************************************************
  * LOCALS
  */
 
-static TRDP_COMID_DSID_MAP_T    *sComIdDsIdMap = NULL;
-static UINT32                   sNumComId = 0u;
+#define TAU_HASH_MIN_BITS       4u
+
+static TAU_MARSHALL_DB_T        *sDbList = NULL;        /* live databases */
+static UINT32                   sDbGeneration = 0u;     /* VOS memory area the databases are allocated from */
+static TAU_MARSHALL_DB_T        *sDefaultDb = NULL;     /* last initialised, used if pRefCon is NULL */
+static TAU_MARSHALL_DB_T        *sOwnDb = NULL;         /* initialised without ppRefCon */
+static BOOL8                    sPlansEnabled = TRUE;
 
-static TRDP_DATASET_T           * *sDataSets = NULL;
-static UINT32                   sNumEntries = 0u;
+static const UINT32             cOpItemSize[] = {1u, 2u, 4u, 8u};   /* indexed by TAU_OP_KIND_T */
 
 /***********************************************************************************************************************
  * LOCAL FUNCTIONS
@@ -134,35 +212,14 @@ static INLINE void unpackedCopy64 (
     const UINT8 * *ppSrc,
     UINT8   * *ppDst,
     UINT32  noOfItems)
-
-#ifdef B_ENDIAN
 {
     UINT32  size    = noOfItems * sizeof(UINT64);
     UINT8   *pDst8  = alignPtr(*ppDst, ALIGNOF(UINT64));
-    memcpy(pDst8, *ppSrc, size);
+
+    vos_copyNetOrder64(pDst8, *ppSrc, noOfItems);
     *ppSrc  = *ppSrc + size;
     *ppDst  =  pDst8 + size;
 }
-#else
-{
-    UINT8       *pDst8  = alignPtr(*ppDst, ALIGNOF(UINT64));
-    const UINT8 *pSrc8  = *ppSrc;
-    while (noOfItems--)
-    {
-        *pDst8++    = *(pSrc8 + 7u);
-        *pDst8++    = *(pSrc8 + 6u);
-        *pDst8++    = *(pSrc8 + 5u);
-        *pDst8++    = *(pSrc8 + 4u);
-        *pDst8++    = *(pSrc8 + 3u);
-        *pDst8++    = *(pSrc8 + 2u);
-        *pDst8++    = *(pSrc8 + 1u);
-        *pDst8++    = *pSrc8;
-        pSrc8       += 8u;
-    }
-    *ppSrc  = pSrc8;
-    *ppDst  = pDst8;
-}
-#endif
 
 /**********************************************************************************************************************/
 /**    Copy a variable from its natural address.
@@ -180,20 +237,12 @@ static INLINE void packedCopy64 (
     UINT8   * *ppDst,
     UINT32  noOfItems)
 {
-    const UINT64 *pSrc64 = (const UINT64 *) alignConstPtr(*ppSrc, ALIGNOF(UINT64));
-    while (noOfItems--)
-    {
-        *(*ppDst)++ = (UINT8) (*pSrc64 >> 56u);
-        *(*ppDst)++ = (UINT8) (*pSrc64 >> 48u);
-        *(*ppDst)++ = (UINT8) (*pSrc64 >> 40u);
-        *(*ppDst)++ = (UINT8) (*pSrc64 >> 32u);
-        *(*ppDst)++ = (UINT8) (*pSrc64 >> 24u);
-        *(*ppDst)++ = (UINT8) (*pSrc64 >> 16u);
-        *(*ppDst)++ = (UINT8) (*pSrc64 >> 8u);
-        *(*ppDst)++ = (UINT8) (*pSrc64 & 0xFFu);
-        pSrc64++;
-    }
-    *ppSrc = (const UINT8 *) pSrc64;
+    UINT32      size    = noOfItems * sizeof(UINT64);
+    const UINT8 *pSrc8  = alignConstPtr(*ppSrc, ALIGNOF(UINT64));
+
+    vos_copyNetOrder64(*ppDst, pSrc8, noOfItems);
+    *ppSrc  = pSrc8 + size;
+    *ppDst  = *ppDst + size;
 }
 
 /**********************************************************************************************************************/
@@ -228,27 +277,24 @@ static int compareDataset (
 }
 
 /**********************************************************************************************************************/
-/**    Dataset compare function
+/**    ComId/dataset mapping compare function
  *
- *  @param[in]      pArg1        Pointer to key
- *  @param[in]      pArg2        Pointer to array element
+ *  @param[in]      pArg1        Pointer to first element
+ *  @param[in]      pArg2        Pointer to second element
  *
  *  @retval         -1 if arg1 < arg2
  *  @retval          0 if arg1 == arg2
  *  @retval          1 if arg1 > arg2
  */
-static int compareDatasetDeref (
+static int compareComId (
     const void  *pArg1,
     const void  *pArg2)
 {
-    const TRDP_DATASET_T  *p1 = (const TRDP_DATASET_T *)pArg1;
-    const TRDP_DATASET_T  *p2 = *(TRDP_DATASET_T * const *)pArg2;
-
-    if (p1->id < p2->id)
+    if ((((const TRDP_COMID_DSID_MAP_T *)pArg1)->comId) < (((const TRDP_COMID_DSID_MAP_T *)pArg2)->comId))
     {
         return -1;
     }
-    else if (p1->id > p2->id)
+    else if ((((const TRDP_COMID_DSID_MAP_T *)pArg1)->comId) > (((const TRDP_COMID_DSID_MAP_T *)pArg2)->comId))
     {
         return 1;
     }
@@ -259,72 +305,176 @@ static int compareDatasetDeref (
 }
 
 /**********************************************************************************************************************/
-/**    ComId/dataset mapping compare function
+/**    Sort a table, unless it is already sorted (e.g. taken from the binary configuration cache)
  *
- *  @param[in]      pArg1        Pointer to first element
- *  @param[in]      pArg2        Pointer to second element
+ *  @param[in,out]  pBase           Pointer to the table
+ *  @param[in]      num             Number of entries
+ *  @param[in]      size            Size of one entry
+ *  @param[in]      compare         Compare function
+ */
+static void sortTable (
+    void    *pBase,
+    UINT32  num,
+    UINT32  size,
+    int     (*compare)(const void *, const void *))
+{
+    UINT32 i;
+
+    for (i = 1u; i < num; i++)
+    {
+        if (compare((UINT8 *) pBase + (i - 1u) * size, (UINT8 *) pBase + i * size) > 0)
+        {
+            vos_qsort(pBase, num, size, compare);
+            return;
+        }
+    }
+}
+
+
+/**********************************************************************************************************************/
+/**    Hash a comId or dataset id into a table slot.
  *
- *  @retval         -1 if arg1 < arg2
- *  @retval          0 if arg1 == arg2
- *  @retval          1 if arg1 > arg2
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      key             comId or dataset id
+ *
+ *  @retval         slot index
  */
-static int compareComId (
-    const void  *pArg1,
-    const void  *pArg2)
+static INLINE UINT32 hashSlot (
+    const TAU_MARSHALL_DB_T *pDb,
+    UINT32                  key)
 {
-    if ((((const TRDP_COMID_DSID_MAP_T *)pArg1)->comId) < (((const TRDP_COMID_DSID_MAP_T *)pArg2)->comId))
+    return (key * 0x9E3779B1u) >> pDb->hashShift;
+}
+
+/**********************************************************************************************************************/
+/**    Enter a key into a hash table. The first entry of duplicate keys is kept.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in,out]  pTable          Hash table
+ *  @param[in]      key             comId or dataset id
+ *  @param[in]      index           Index into pDataSets
+ *
+ *  @retval         none
+ */
+static void hashInsert (
+    const TAU_MARSHALL_DB_T *pDb,
+    TAU_HASH_ENTRY_T        *pTable,
+    UINT32                  key,
+    UINT32                  index)
+{
+    UINT32 mask = 0xFFFFFFFFu >> pDb->hashShift;
+    UINT32 slot = hashSlot(pDb, key);
+
+    while (pTable[slot].index != 0u)
     {
-        return -1;
+        if (pTable[slot].key == key)
+        {
+            return;
+        }
+        slot = (slot + 1u) & mask;
     }
-    else if ((((const TRDP_COMID_DSID_MAP_T *)pArg1)->comId) > (((const TRDP_COMID_DSID_MAP_T *)pArg2)->comId))
+    pTable[slot].key    = key;
+    pTable[slot].index  = index + 1u;
+}
+
+/**********************************************************************************************************************/
+/**    Look up a key in a hash table.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      pTable          Hash table
+ *  @param[in]      key             comId or dataset id
+ *
+ *  @retval         index into pDataSets + 1
+ *  @retval         0 if not found
+ */
+static UINT32 hashFind (
+    const TAU_MARSHALL_DB_T *pDb,
+    const TAU_HASH_ENTRY_T  *pTable,
+    UINT32                  key)
+{
+    UINT32 mask = 0xFFFFFFFFu >> pDb->hashShift;
+    UINT32 slot = hashSlot(pDb, key);
+
+    while (pTable[slot].index != 0u)
     {
-        return 1;
+        if (pTable[slot].key == key)
+        {
+            return pTable[slot].index;
+        }
+        slot = (slot + 1u) & mask;
     }
-    else
+    return 0u;
+}
+
+/**********************************************************************************************************************/
+/**    Return the live marshalling database referenced by a user context.
+ *    The databases are forgotten once the VOS memory they were allocated from has been deleted (tlc_terminate()).
+ *    pRefCon is only compared with the live databases, it is never dereferenced.
+ *
+ *  @param[in]      pRefCon         Reference context returned by tau_initMarshall()
+ *
+ *  @retval         the referenced database, NULL if pRefCon is not a live database
+ */
+static TAU_MARSHALL_DB_T *findDb (
+    const void *pRefCon)
+{
+    TAU_MARSHALL_DB_T *pDb;
+
+    if (sDbGeneration != vos_memGeneration())
     {
-        return 0;
+        /* the memory area was deleted, the blocks are gone */
+        sDbList         = NULL;
+        sDefaultDb      = NULL;
+        sOwnDb          = NULL;
+        sDbGeneration   = vos_memGeneration();
+        return NULL;
+    }
+    for (pDb = sDbList; pDb != NULL; pDb = pDb->pNext)
+    {
+        if (pDb == pRefCon)
+        {
+            break;
+        }
     }
+    return pDb;
 }
 
+/**********************************************************************************************************************/
+/**    Return the marshalling database referenced by a user context.
+ *
+ *  @param[in]      pRefCon         Reference context returned by tau_initMarshall()
+ *
+ *  @retval         the referenced database, the last initialised one if pRefCon is NULL or not a live database
+ */
+static const TAU_MARSHALL_DB_T *getDb (
+    const void *pRefCon)
+{
+    const TAU_MARSHALL_DB_T *pDb = findDb(pRefCon);
+
+    return (NULL == pDb) ? sDefaultDb : pDb;
+}
 
 /**********************************************************************************************************************/
 /**    Return the dataset for the comID
  *
  *
+ *  @param[in]      pDb         Marshalling database
  *  @param[in]      comId       ComId to find
  *
  *  @retval         NULL if not found
  *  @retval         pointer to dataset
  */
 static TRDP_DATASET_T *findDSFromComId (
-    UINT32 comId)
+    const TAU_MARSHALL_DB_T *pDb,
+    UINT32                  comId)
 {
-    TRDP_COMID_DSID_MAP_T   key1;
-    TRDP_DATASET_T          * *key3;
-    TRDP_COMID_DSID_MAP_T   *key2;
-
-    key1.comId      = comId;
-    key1.datasetId  = 0u;
-
-    key2 = (TRDP_COMID_DSID_MAP_T *) vos_bsearch(&key1,
-                                                 sComIdDsIdMap,
-                                                 sNumComId,
-                                                 sizeof(TRDP_COMID_DSID_MAP_T),
-                                                 compareComId);
-
-    if (key2 != NULL)
-    {
-        TRDP_DATASET_T key22 = {0u, 0u, 0u};
-
-        key22.id    = key2->datasetId;
-        key3        = (TRDP_DATASET_T * *) vos_bsearch(&key22,
-                                                       sDataSets,
-                                                       sNumEntries,
-                                                       sizeof(TRDP_DATASET_T *),
-                                                       compareDatasetDeref);
-        if (key3 != NULL)
+    if (pDb != NULL)
+    {
+        UINT32 index = hashFind(pDb, pDb->pComIdHash, comId);
+
+        if (index != 0u)
         {
-            return *key3;
+            return pDb->pDataSets[index - 1u];
         }
     }
 
@@ -335,28 +485,23 @@ static TRDP_DATASET_T *findDSFromComId (
 /**    Return the dataset for the datasetID
  *
  *
+ *  @param[in]      pDb                     Marshalling database
  *  @param[in]      datasetId               dataset ID to find
  *
  *  @retval         NULL if not found
  *  @retval         pointer to dataset
  */
 static TRDP_DATASET_T *findDs (
-    UINT32 datasetId)
+    const TAU_MARSHALL_DB_T *pDb,
+    UINT32                  datasetId)
 {
-    if ((sDataSets != NULL) && (sNumEntries != 0u))
-    {
-        TRDP_DATASET_T  key2 = {0u, 0u, 0u};
-        TRDP_DATASET_T  * *key3;
-
-        key2.id = datasetId;
-        key3    = (TRDP_DATASET_T * *) vos_bsearch(&key2,
-                                                   sDataSets,
-                                                   sNumEntries,
-                                                   sizeof(TRDP_DATASET_T *),
-                                                   compareDatasetDeref);
-        if (key3 != NULL)
+    if (pDb != NULL)
+    {
+        UINT32 index = hashFind(pDb, pDb->pDsIdHash, datasetId);
+
+        if (index != 0u)
         {
-            return *key3;
+            return pDb->pDataSets[index - 1u];
         }
     }
 
@@ -366,13 +511,15 @@ static TRDP_DATASET_T *findDs (
 /**********************************************************************************************************************/
 /**    Return the size of the largest member of this dataset.
  *
+ *  @param[in]      pDb             Marshalling database
  *  @param[in]      pDataset        Pointer to one dataset
  *
  *  @retval         1,2,4,8
  *
  */
 static UINT8 maxAlignOfDSMember (
-    TRDP_DATASET_T *pDataset)
+    const TAU_MARSHALL_DB_T *pDb,
+    TRDP_DATASET_T          *pDataset)
 {
     UINT16  lIndex;
     UINT8   maxSize = 1;
@@ -433,7 +580,7 @@ static UINT8 maxAlignOfDSMember (
             }
             else    /* recurse if nested dataset */
             {
-                elemSize = maxAlignOfDSMember(findDs(pDataset->pElement[lIndex].type));
+                elemSize = maxAlignOfDSMember(pDb, findDs(pDb, pDataset->pElement[lIndex].type));
             }
             if (maxSize < elemSize)
             {
@@ -480,7 +627,7 @@ static TRDP_ERR_T marshallDs (
             "A struct is always aligned to the largest types alignment requirements"
         Only, at this point we do need to know the size of the largest member to follow! */
 
-    pSrc = alignConstPtr(pInfo->pSrc, maxAlignOfDSMember(pDataset));
+    pSrc = alignConstPtr(pInfo->pSrc, maxAlignOfDSMember(pInfo->pDb, pDataset));
 
     /*    Loop over all datasets in the array    */
     for (lIndex = 0u; (lIndex < pDataset->numElement) && (pInfo->pSrcEnd > pInfo->pSrc); ++lIndex)
@@ -503,7 +650,7 @@ static TRDP_ERR_T marshallDs (
                 if (NULL == pDataset->pElement[lIndex].pCachedDS)
                 {
                     /* Look for it   */
-                    pDataset->pElement[lIndex].pCachedDS = findDs(pDataset->pElement[lIndex].type);
+                    pDataset->pElement[lIndex].pCachedDS = findDs(pInfo->pDb, pDataset->pElement[lIndex].type);
                 }
 
                 if (NULL == pDataset->pElement[lIndex].pCachedDS)      /* Not in our DB    */
@@ -558,13 +705,9 @@ static TRDP_ERR_T marshallDs (
                        return TRDP_PARAM_ERR;
                    }
 
-                   while (noOfItems-- > 0u)
-                   {
-                       *pDst++  = (UINT8) (*pSrc16 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc16 & 0xFFu);
-                       pSrc16++;
-                   }
-                   pSrc = (const UINT8 *) pSrc16;
+                   vos_copyNetOrder16(pDst, (const UINT8 *) pSrc16, noOfItems);
+                   pDst += noOfItems * 2u;
+                   pSrc = (const UINT8 *) (pSrc16 + noOfItems);
                    break;
                }
                case TRDP_INT32:
@@ -582,15 +725,9 @@ static TRDP_ERR_T marshallDs (
                        return TRDP_PARAM_ERR;
                    }
 
-                   while (noOfItems-- > 0u)
-                   {
-                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
-                       pSrc32++;
-                   }
-                   pSrc = (const UINT8 *) pSrc32;
+                   vos_copyNetOrder32(pDst, (const UINT8 *) pSrc32, noOfItems);
+                   pDst += noOfItems * 4u;
+                   pSrc = (const UINT8 *) (pSrc32 + noOfItems);
                    break;
                }
                case TRDP_TIMEDATE64:
@@ -602,20 +739,10 @@ static TRDP_ERR_T marshallDs (
                        return TRDP_PARAM_ERR;
                    }
 
-                   while (noOfItems-- > 0u)
-                   {
-                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
-                       pSrc32++;
-                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
-                       pSrc32++;
-                   }
-                   pSrc = (const UINT8 *) pSrc32;
+                   /*    seconds and microseconds are contiguous 32 bit items    */
+                   vos_copyNetOrder32(pDst, (const UINT8 *) pSrc32, noOfItems * 2u);
+                   pDst += noOfItems * 8u;
+                   pSrc = (const UINT8 *) (pSrc32 + noOfItems * 2u);
                    break;
                }
                case TRDP_TIMEDATE48:
@@ -666,7 +793,7 @@ static TRDP_ERR_T marshallDs (
         }
     }
 
-    pInfo->pSrc = alignConstPtr(pInfo->pSrc, maxAlignOfDSMember(pDataset));
+    pInfo->pSrc = alignConstPtr(pInfo->pSrc, maxAlignOfDSMember(pInfo->pDb, pDataset));
 
     if (pInfo->pSrc > pInfo->pSrcEnd ) /* Maybe one alignement bejond - do not erratically issue error! */
     {
@@ -710,7 +837,7 @@ static TRDP_ERR_T unmarshallDs (
         return TRDP_STATE_ERR;
     }
 
-    pDst = alignPtr(pInfo->pDst, maxAlignOfDSMember(pDataset));
+    pDst = alignPtr(pInfo->pDst, maxAlignOfDSMember(pInfo->pDb, pDataset));
 
     /*    Loop over all datasets in the array    */
     for (lIndex = 0u; (lIndex < pDataset->numElement) && (pInfo->pSrcEnd > pInfo->pSrc); ++lIndex)
@@ -731,7 +858,7 @@ static TRDP_ERR_T unmarshallDs (
                 if (NULL == pDataset->pElement[lIndex].pCachedDS)
                 {
                     /* Look for it   */
-                    pDataset->pElement[lIndex].pCachedDS = findDs(pDataset->pElement[lIndex].type);
+                    pDataset->pElement[lIndex].pCachedDS = findDs(pInfo->pDb, pDataset->pElement[lIndex].type);
                 }
 
                 if (NULL == pDataset->pElement[lIndex].pCachedDS)      /* Not in our DB    */
@@ -781,13 +908,13 @@ static TRDP_ERR_T unmarshallDs (
                        return TRDP_PARAM_ERR;
                    }
 
-                   while (noOfItems-- > 0u)
+                   if (noOfItems > 0u)
                    {
-                       *pDst16  = (UINT16) (*pSrc++ << 8u);
-                       *pDst16  += *pSrc++;
+                       vos_copyNetOrder16((UINT8 *) pDst16, pSrc, noOfItems);
+                       pSrc     += noOfItems * 2u;
+                       pDst16   += noOfItems;
                        /*    possible variable source size    */
-                       var_size = *pDst16;
-                       pDst16++;
+                       var_size = *(pDst16 - 1);
                    }
                    pDst = (UINT8 *) pDst16;
                    break;
@@ -804,14 +931,12 @@ static TRDP_ERR_T unmarshallDs (
                        return TRDP_PARAM_ERR;
                    }
 
-                   while (noOfItems-- > 0)
+                   if (noOfItems > 0u)
                    {
-                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
-                       *pDst32  += *pSrc++;
-                       var_size = *pDst32;
-                       pDst32++;
+                       vos_copyNetOrder32((UINT8 *) pDst32, pSrc, noOfItems);
+                       pSrc     += noOfItems * 4u;
+                       pDst32   += noOfItems;
+                       var_size = *(pDst32 - 1);
                    }
                    pDst = (UINT8 *) pDst32;
                    break;
@@ -853,21 +978,13 @@ static TRDP_ERR_T unmarshallDs (
                        return TRDP_PARAM_ERR;
                    }
 
-                   while (noOfItems-- > 0u)
+                   /*    seconds and microseconds are contiguous 32 bit items    */
+                   if (noOfItems > 0u)
                    {
-                       pDst32   = (UINT32 *) alignPtr(pDst, ALIGNOF(TIMEDATE64_STRUCT_T));
-                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
-                       *pDst32  += *pSrc++;
-                       pDst32++;
-                       pDst32   = (UINT32 *) alignPtr((UINT8 *)pDst32, ALIGNOF(UINT32));
-                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
-                       *pDst32  += *pSrc++;
-                       pDst32++;
-                       pDst = (UINT8 *) pDst32;
+                       pDst32 = (UINT32 *) alignPtr(pDst, ALIGNOF(TIMEDATE64_STRUCT_T));
+                       vos_copyNetOrder32((UINT8 *) pDst32, pSrc, noOfItems * 2u);
+                       pSrc += noOfItems * 8u;
+                       pDst = (UINT8 *) (pDst32 + noOfItems * 2u);
                    }
                    break;
                }
@@ -891,7 +1008,7 @@ static TRDP_ERR_T unmarshallDs (
         }
     }
 
-    pInfo->pDst = alignPtr(pInfo->pDst, maxAlignOfDSMember(pDataset));
+    pInfo->pDst = alignPtr(pInfo->pDst, maxAlignOfDSMember(pInfo->pDb, pDataset));
 
     if (pInfo->pSrc > pInfo->pSrcEnd)
     {
@@ -906,9 +1023,13 @@ static TRDP_ERR_T unmarshallDs (
 
 /**********************************************************************************************************************/
 /**    Compute unmarshalled size of one dataset.
+ *  The computation may be resumed at an element behind the constant part of the dataset, pInfo then points to
+ *  that element in the source and the host structure.
  *
  *  @param[in,out]  pInfo           Pointer with src & dest info
  *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      lStart          Index of the first element to compute, 0 for the whole dataset
+ *  @param[in]      varSize         Size of a variable sized element at lStart
  *
  *  @retval         TRDP_NO_ERR             no error
  *  @retval         TRDP_MEM_ERR            provided buffer to small
@@ -920,11 +1041,13 @@ static TRDP_ERR_T unmarshallDs (
 
 static TRDP_ERR_T size_unmarshall (
     TAU_MARSHALL_INFO_T *pInfo,
-    TRDP_DATASET_T      *pDataset)
+    TRDP_DATASET_T      *pDataset,
+    UINT16              lStart,
+    UINT32              varSize)
 {
     TRDP_ERR_T  err;
     UINT16      lIndex;
-    UINT32      var_size    = 0u;
+    UINT32      var_size    = varSize;
     const UINT8 *pSrc       = pInfo->pSrc;
     UINT8       *pDst;
 
@@ -935,10 +1058,10 @@ static TRDP_ERR_T size_unmarshall (
         return TRDP_STATE_ERR;
     }
 
-    pDst = alignPtr(pInfo->pDst, maxAlignOfDSMember(pDataset));
+    pDst = (lStart == 0u) ? alignPtr(pInfo->pDst, maxAlignOfDSMember(pInfo->pDb, pDataset)) : pInfo->pDst;
 
     /*    Loop over all datasets in the array    */
-    for (lIndex = 0u; (lIndex < pDataset->numElement) && (pInfo->pSrcEnd > pInfo->pSrc); ++lIndex)
+    for (lIndex = lStart; (lIndex < pDataset->numElement) && (pInfo->pSrcEnd > pInfo->pSrc); ++lIndex)
     {
         UINT32 noOfItems = pDataset->pElement[lIndex].size;
 
@@ -957,7 +1080,7 @@ static TRDP_ERR_T size_unmarshall (
                 if (NULL == pDataset->pElement[lIndex].pCachedDS)
                 {
                     /* Look for it   */
-                    pDataset->pElement[lIndex].pCachedDS = findDs(pDataset->pElement[lIndex].type);
+                    pDataset->pElement[lIndex].pCachedDS = findDs(pInfo->pDb, pDataset->pElement[lIndex].type);
                 }
 
                 if (NULL == pDataset->pElement[lIndex].pCachedDS)      /* Not in our DB    */
@@ -966,7 +1089,7 @@ static TRDP_ERR_T size_unmarshall (
                     return TRDP_COMID_ERR;
                 }
 
-                err = size_unmarshall(pInfo, pDataset->pElement[lIndex].pCachedDS);
+                err = size_unmarshall(pInfo, pDataset->pElement[lIndex].pCachedDS, 0u, 0u);
                 if (err != TRDP_NO_ERR)
                 {
                     return err;
@@ -1083,7 +1206,7 @@ static TRDP_ERR_T size_unmarshall (
         }
     }
 
-    pInfo->pDst = alignPtr(pDst, maxAlignOfDSMember(pDataset));
+    pInfo->pDst = alignPtr(pDst, maxAlignOfDSMember(pInfo->pDb, pDataset));
 
     if (pInfo->pSrc > pInfo->pSrcEnd)
     {
@@ -1096,120 +1219,1103 @@ static TRDP_ERR_T size_unmarshall (
     return TRDP_NO_ERR;
 }
 
-/**********************************************************************************************************************
- * GLOBAL FUNCTIONS
+/**********************************************************************************************************************/
+/**    Size of one item of a base type on the wire.
+ *
+ *  @param[in]      type            TRDP_DATA_TYPE_T
+ *
+ *  @retval         size in bytes, 0 for datasets
  */
+static UINT32 wireSizeOfItem (
+    UINT32 type)
+{
+    switch (type)
+    {
+       case TRDP_BOOL8:
+       case TRDP_CHAR8:
+       case TRDP_INT8:
+       case TRDP_UINT8:
+           return 1u;
+       case TRDP_UTF16:
+       case TRDP_INT16:
+       case TRDP_UINT16:
+           return 2u;
+       case TRDP_INT32:
+       case TRDP_UINT32:
+       case TRDP_REAL32:
+       case TRDP_TIMEDATE32:
+           return 4u;
+       case TRDP_TIMEDATE48:
+           return 6u;
+       case TRDP_TIMEDATE64:
+       case TRDP_INT64:
+       case TRDP_UINT64:
+       case TRDP_REAL64:
+           return 8u;
+       default:
+           return 0u;
+    }
+}
 
 /**********************************************************************************************************************/
-/**    Function to initialise the marshalling/unmarshalling.
- *    The supplied array must be sorted by ComIds. The array must exist during the use of the marshalling
- *    functions (until tlc_terminate()).
- *
- *  @param[in,out]  ppRefCon         Returns a pointer to be used for the reference context of marshalling/unmarshalling
- *  @param[in]      numComId         Number of datasets found in the configuration
- *  @param[in]      pComIdDsIdMap    Pointer to an array of structures of type TRDP_DATASET_T
- *  @param[in]      numDataSet       Number of datasets found in the configuration
- *  @param[in]      pDataset         Pointer to an array of pointers to structures of type TRDP_DATASET_T
+/**    Align an offset relative to an aligned base.
  *
- *  @retval         TRDP_NO_ERR      no error
- *  @retval         TRDP_MEM_ERR     provided buffer to small
- *  @retval         TRDP_PARAM_ERR   Parameter error
+ *  @param[in]      offset          Offset to align
+ *  @param[in]      alignment       1, 2, 4, 8
  *
+ *  @retval         aligned offset
  */
+static INLINE UINT32 alignOffset (
+    UINT32  offset,
+    UINT32  alignment)
+{
+    return (offset + (alignment - 1u)) & ~(alignment - 1u);
+}
 
-EXT_DECL TRDP_ERR_T tau_initMarshall (
-    void                    * *ppRefCon,
-    UINT32                  numComId,
-    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap,
-    UINT32                  numDataSet,
-    TRDP_DATASET_T          *pDataset[])
+/**********************************************************************************************************************/
+/**    Append an operation to a plan, merging it with the previous one if both runs are contiguous.
+ *
+ *  @param[in,out]  pDb             Marshalling database holding the operations
+ *  @param[in,out]  pPlan           Plan under construction
+ *  @param[in]      kind            TAU_OP_KIND_T
+ *  @param[in]      wireOffset      Offset into the marshalled data
+ *  @param[in]      hostOffset      Offset into the host structure
+ *  @param[in]      noOfItems       Number of items
+ *
+ *  @retval         TRUE            operation added or merged
+ *  @retval         FALSE           out of memory
+ */
+static BOOL8 planEmit (
+    TAU_MARSHALL_DB_T   *pDb,
+    TAU_MARSHALL_PLAN_T *pPlan,
+    UINT32              kind,
+    UINT32              wireOffset,
+    UINT32              hostOffset,
+    UINT32              noOfItems)
 {
-    UINT32 i, j;
+    TAU_MARSHALL_OP_T *pOp;
 
-    (void)ppRefCon;
+#ifdef B_ENDIAN
+    /*  Host order is network order: every run is a plain copy  */
+    noOfItems   *= cOpItemSize[kind];
+    kind        = TAU_OP_COPY;
+#endif
 
-    if ((pDataset == NULL) || (numDataSet == 0u) || (numComId == 0u) || (pComIdDsIdMap == NULL))
+    if (pPlan->noOfOps > 0u)
     {
-        return TRDP_PARAM_ERR;
+        pOp = &pDb->pPlanOps[pPlan->firstOp + pPlan->noOfOps - 1u];
+        if ((pOp->kind == kind) &&
+            ((pOp->wireOffset + pOp->noOfItems * cOpItemSize[kind]) == wireOffset) &&
+            ((pOp->hostOffset + pOp->noOfItems * cOpItemSize[kind]) == hostOffset))
+        {
+            pOp->noOfItems += noOfItems;
+            return TRUE;
+        }
     }
 
-    /*    Save the pointer to the comId mapping table    */
-    sComIdDsIdMap   = pComIdDsIdMap;
-    sNumComId       = numComId;
-
-    /* sort the table    */
-    vos_qsort(pComIdDsIdMap, numComId, sizeof(TRDP_COMID_DSID_MAP_T), compareComId);
-
-    /*    Save the pointer to the table    */
-    sDataSets   = pDataset;
-    sNumEntries = numDataSet;
-
-    /* invalidate the cache */
-    for (i = 0u; i < numDataSet; i++)
+    if (pDb->numPlanOps >= pDb->maxPlanOps)
     {
-        for (j = 0u; j < pDataset[i]->numElement; j++)
+        UINT32              maxPlanOps  = (pDb->maxPlanOps == 0u) ? 64u : pDb->maxPlanOps * 2u;
+        TAU_MARSHALL_OP_T   *pPlanOps   = (TAU_MARSHALL_OP_T *) vos_memAlloc(maxPlanOps * sizeof(TAU_MARSHALL_OP_T));
+
+        if (NULL == pPlanOps)
         {
-            pDataset[i]->pElement[j].pCachedDS = NULL;
+            return FALSE;
         }
+        if (pDb->pPlanOps != NULL)
+        {
+            memcpy(pPlanOps, pDb->pPlanOps, pDb->numPlanOps * sizeof(TAU_MARSHALL_OP_T));
+            vos_memFree(pDb->pPlanOps);
+        }
+        pDb->pPlanOps   = pPlanOps;
+        pDb->maxPlanOps = maxPlanOps;
     }
-    /* sort the table    */
-    vos_qsort(pDataset, numDataSet, sizeof(TRDP_DATASET_T *), compareDataset);
 
-    return TRDP_NO_ERR;
+    pOp = &pDb->pPlanOps[pDb->numPlanOps++];
+    pOp->kind       = kind;
+    pOp->wireOffset = wireOffset;
+    pOp->hostOffset = hostOffset;
+    pOp->noOfItems  = noOfItems;
+    pPlan->noOfOps++;
+
+    return TRUE;
 }
 
 /**********************************************************************************************************************/
-/**    marshall function.
- *
- *  @param[in]      pRefCon         pointer to user context
- *  @param[in]      comId           ComId to identify the structure out of a configuration
- *  @param[in]      pSrc            pointer to received original message
- *  @param[in]      srcSize         size of the source buffer
- *  @param[in]      pDest           pointer to a buffer for the treated message
- *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
- *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
- *                                  set NULL if not used, set content NULL if unknown
+/**    Compile one dataset into a plan.
+ *  Walks the dataset exactly like marshallDs()/unmarshallDs() do, but on offsets relative to a host structure aligned
+ *  to the dataset's largest member. Datasets containing variable sized elements cannot be compiled.
  *
- *  @retval         TRDP_NO_ERR             no error
- *  @retval         TRDP_MEM_ERR            provided buffer to small
- *  @retval         TRDP_PARAM_ERR          Parameter error
- *  @retval         TRDP_STATE_ERR          Too deep recursion
- *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *  @param[in,out]  pDb             Marshalling database
+ *  @param[in,out]  pPlan           Plan under construction
+ *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in,out]  pWire           Current offset into the marshalled data
+ *  @param[in,out]  pHost           Current offset into the host structure
+ *  @param[out]     pPrefix         Constant part in front of the element which could not be compiled, NULL if nested
+ *  @param[in]      level           Recursion level
  *
+ *  @retval         TRUE            dataset compiled
+ *  @retval         FALSE           dataset must be interpreted
  */
-
-EXT_DECL TRDP_ERR_T tau_marshall (
-    void            *pRefCon,
-    UINT32          comId,
-    const UINT8     *pSrc,
-    UINT32          srcSize,
-    UINT8           *pDest,
-    UINT32          *pDestSize,
-    TRDP_DATASET_T  * *ppDSPointer)
+static BOOL8 compileDs (
+    TAU_MARSHALL_DB_T       *pDb,
+    TAU_MARSHALL_PLAN_T     *pPlan,
+    TRDP_DATASET_T          *pDataset,
+    UINT32                  *pWire,
+    UINT32                  *pHost,
+    TAU_MARSHALL_PREFIX_T   *pPrefix,
+    INT32                   level)
 {
-    TRDP_ERR_T          err;
-    TRDP_DATASET_T      *pDataset;
-    TAU_MARSHALL_INFO_T info;
-
-    (void)pRefCon;
+    UINT16  lIndex;
+    UINT32  align;
+    UINT32  host;
+    BOOL8   ok = TRUE;
 
-    if ((0u == comId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    if ((NULL == pDataset) || (level > TAU_MAX_DS_LEVEL))
     {
-        return TRDP_PARAM_ERR;
+        return FALSE;
     }
 
-    /* Can we use the formerly cached value? */
+    align   = maxAlignOfDSMember(pDb, pDataset);
+    host    = alignOffset(*pHost, align);
+
+    for (lIndex = 0u; (lIndex < pDataset->numElement) && (ok == TRUE); ++lIndex)
+    {
+        UINT32 noOfItems = pDataset->pElement[lIndex].size;
+
+        if (pPrefix != NULL)
+        {
+            pPrefix->element    = lIndex;
+            pPrefix->wireOffset = *pWire;
+            pPrefix->hostOffset = host;
+        }
+
+        if (TRDP_VAR_SIZE == noOfItems)
+        {
+            return FALSE;
+        }
+
+        if (pDataset->pElement[lIndex].type > (UINT32) TRDP_TYPE_MAX)
+        {
+            if (NULL == pDataset->pElement[lIndex].pCachedDS)
+            {
+                pDataset->pElement[lIndex].pCachedDS = findDs(pDb, pDataset->pElement[lIndex].type);
+            }
+
+            /*  Like the interpreter, a nested dataset starts at the unaligned current offset  */
+            while ((noOfItems-- > 0u) && (ok == TRUE))
+            {
+                ok = compileDs(pDb, pPlan, pDataset->pElement[lIndex].pCachedDS, pWire, pHost, NULL, level + 1);
+            }
+            host = *pHost;
+        }
+        else
+        {
+            switch (pDataset->pElement[lIndex].type)
+            {
+               case TRDP_BOOL8:
+               case TRDP_CHAR8:
+               case TRDP_INT8:
+               case TRDP_UINT8:
+                   ok      = planEmit(pDb, pPlan, TAU_OP_COPY, *pWire, host, noOfItems);
+                   *pWire  += noOfItems;
+                   host    += noOfItems;
+                   break;
+               case TRDP_UTF16:
+               case TRDP_INT16:
+               case TRDP_UINT16:
+                   host    = alignOffset(host, ALIGNOF(UINT16));
+                   ok      = planEmit(pDb, pPlan, TAU_OP_SWAP16, *pWire, host, noOfItems);
+                   *pWire  += noOfItems * 2u;
+                   host    += noOfItems * 2u;
+                   break;
+               case TRDP_INT32:
+               case TRDP_UINT32:
+               case TRDP_REAL32:
+               case TRDP_TIMEDATE32:
+                   host    = alignOffset(host, ALIGNOF(UINT32));
+                   ok      = planEmit(pDb, pPlan, TAU_OP_SWAP32, *pWire, host, noOfItems);
+                   *pWire  += noOfItems * 4u;
+                   host    += noOfItems * 4u;
+                   break;
+               case TRDP_TIMEDATE48:
+                   while ((noOfItems-- > 0u) && (ok == TRUE))
+                   {
+                       host    = alignOffset(host, ALIGNOF(TIMEDATE48_STRUCT_T));
+                       ok      = planEmit(pDb, pPlan, TAU_OP_SWAP32, *pWire, host, 1u);
+                       *pWire  += 4u;
+                       host    = alignOffset(host + 4u, ALIGNOF(UINT16));
+                       ok      = (ok == TRUE) ? planEmit(pDb, pPlan, TAU_OP_SWAP16, *pWire, host, 1u) : FALSE;
+                       *pWire  += 2u;
+                       host    = alignOffset(host + 2u, ALIGNOF(TIMEDATE48_STRUCT_T));
+                   }
+                   break;
+               case TRDP_TIMEDATE64:
+                   while ((noOfItems-- > 0u) && (ok == TRUE))
+                   {
+                       host    = alignOffset(host, ALIGNOF(TIMEDATE64_STRUCT_T));
+                       ok      = planEmit(pDb, pPlan, TAU_OP_SWAP32, *pWire, host, 1u);
+                       *pWire  += 4u;
+                       host    = alignOffset(host + 4u, ALIGNOF(UINT32));
+                       ok      = (ok == TRUE) ? planEmit(pDb, pPlan, TAU_OP_SWAP32, *pWire, host, 1u) : FALSE;
+                       *pWire  += 4u;
+                       host    += 4u;
+                   }
+                   break;
+               case TRDP_INT64:
+               case TRDP_UINT64:
+               case TRDP_REAL64:
+                   host    = alignOffset(host, ALIGNOF(UINT64));
+                   ok      = planEmit(pDb, pPlan, TAU_OP_SWAP64, *pWire, host, noOfItems);
+                   *pWire  += noOfItems * 8u;
+                   host    += noOfItems * 8u;
+                   break;
+               default:
+                   break;
+            }
+            *pHost = host;
+
+            /*    The first item of the last element up to 32 bits sizes a following variable element    */
+            if ((pPrefix != NULL) &&
+                (wireSizeOfItem(pDataset->pElement[lIndex].type) > 0u) &&
+                (wireSizeOfItem(pDataset->pElement[lIndex].type) <= 4u))
+            {
+                pPrefix->varSizeOffset  = pPrefix->wireOffset;
+                pPrefix->varSizeBytes   = wireSizeOfItem(pDataset->pElement[lIndex].type);
+            }
+        }
+    }
+
+    *pHost = alignOffset(*pHost, align);
+
+    return ok;
+}
+
+/**********************************************************************************************************************/
+/**    Compile all datasets of a database into plans.
+ *  Datasets which cannot be compiled (variable size, unknown nested datasets, too deep nesting, out of memory)
+ *  are left to the interpreter. For their size calculation, the constant part in front of the first element which
+ *  could not be compiled is kept.
+ *
+ *  @param[in,out]  pDb             Marshalling database
+ *
+ *  @retval         none
+ */
+static void compilePlans (
+    TAU_MARSHALL_DB_T *pDb)
+{
+    UINT32 i;
+
+    for (i = 0u; i < pDb->numDataSet; i++)
+    {
+        TAU_MARSHALL_PLAN_T *pPlan  = &pDb->pPlans[i];
+        UINT32              wire    = 0u;
+        UINT32              host    = 0u;
+
+        pPlan->firstOp      = pDb->numPlanOps;
+        pPlan->noOfOps      = 0u;
+        pPlan->pFuncs       = NULL;
+        memset(&pPlan->prefix, 0, sizeof(pPlan->prefix));
+        pPlan->align        = maxAlignOfDSMember(pDb, pDb->pDataSets[i]);
+        pPlan->fixedSize    = compileDs(pDb, pPlan, pDb->pDataSets[i], &wire, &host, &pPlan->prefix, 1);
+        pPlan->wireSize     = wire;
+        pPlan->hostSize     = host;
+
+        if (pPlan->fixedSize == FALSE)
+        {
+            pDb->numPlanOps = pPlan->firstOp;   /* drop partial plan */
+            pPlan->noOfOps  = 0u;
+        }
+        else
+        {
+            pPlan->prefix.element = 0u;         /* sizes are constant */
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/**    Return the plan of a dataset, fixed or variable.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      pDataset        Pointer to one dataset
+ *
+ *  @retval         NULL if the dataset is not part of the database
+ *  @retval         pointer to plan
+ */
+static const TAU_MARSHALL_PLAN_T *findDsPlan (
+    const TAU_MARSHALL_DB_T *pDb,
+    const TRDP_DATASET_T    *pDataset)
+{
+    UINT32 index = hashFind(pDb, pDb->pDsIdHash, pDataset->id);
+
+    /* the dataset may have been cached from another database */
+    if ((index != 0u) && (pDb->pDataSets[index - 1u] == pDataset))
+    {
+        return &pDb->pPlans[index - 1u];
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/**    Return the layout (plan) of a fixed-layout dataset, independent of the use of plans.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      pDataset        Pointer to one dataset
+ *
+ *  @retval         NULL if the dataset has variable sized elements
+ *  @retval         pointer to plan
+ */
+static const TAU_MARSHALL_PLAN_T *findLayout (
+    const TAU_MARSHALL_DB_T *pDb,
+    const TRDP_DATASET_T    *pDataset)
+{
+    const TAU_MARSHALL_PLAN_T *pPlan = findDsPlan(pDb, pDataset);
+
+    return ((pPlan != NULL) && (pPlan->fixedSize == TRUE)) ? pPlan : NULL;
+}
+
+/**********************************************************************************************************************/
+/**    Return the compiled plan of a dataset, if plans are enabled.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      pDataset        Pointer to one dataset
+ *
+ *  @retval         NULL if the dataset must be interpreted
+ *  @retval         pointer to plan
+ */
+static const TAU_MARSHALL_PLAN_T *findPlan (
+    const TAU_MARSHALL_DB_T *pDb,
+    const TRDP_DATASET_T    *pDataset)
+{
+    if ((sPlansEnabled == TRUE) && (pDb != NULL))
+    {
+        return findLayout(pDb, pDataset);
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/**    Marshall one dataset by its plan.
+ *  The plan is only taken if the interpreter would walk the complete dataset without hitting a buffer limit,
+ *  otherwise the interpreter is left to produce its (partial) result and error code.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      pSrc            Pointer to host structure
+ *  @param[in]      srcSize         Size of the host structure
+ *  @param[in]      pDest           Pointer to marshalled data
+ *  @param[in,out]  pDestSize       Size of the destination buffer / size of the marshalled data
+ *
+ *  @retval         TRUE            dataset marshalled
+ *  @retval         FALSE           dataset must be interpreted
+ */
+static BOOL8 marshallPlan (
+    const TAU_MARSHALL_DB_T *pDb,
+    const TRDP_DATASET_T    *pDataset,
+    const UINT8             *pSrc,
+    UINT32                  srcSize,
+    UINT8                   *pDest,
+    UINT32                  *pDestSize)
+{
+    const TAU_MARSHALL_PLAN_T   *pPlan = findPlan(pDb, pDataset);
+    const TAU_MARSHALL_OP_T     *pOp;
+    const TAU_MARSHALL_OP_T     *pOpEnd;
+
+    if ((NULL == pPlan) ||
+        (srcSize < pPlan->hostSize) ||
+        (*pDestSize < pPlan->wireSize) ||
+        (alignConstPtr(pSrc, pPlan->align) != pSrc))
+    {
+        return FALSE;
+    }
+
+    if (pPlan->pFuncs != NULL)
+    {
+        pPlan->pFuncs->pfMarshall(pSrc, pDest);
+        *pDestSize = pPlan->wireSize;
+        return TRUE;
+    }
+
+    pOpEnd = &pDb->pPlanOps[pPlan->firstOp + pPlan->noOfOps];
+    for (pOp = &pDb->pPlanOps[pPlan->firstOp]; pOp < pOpEnd; pOp++)
+    {
+        const UINT8 *pS = pSrc + pOp->hostOffset;
+        UINT8       *pD = pDest + pOp->wireOffset;
+        UINT32      noOfItems = pOp->noOfItems;
+
+        switch (pOp->kind)
+        {
+           case TAU_OP_COPY:
+               memcpy(pD, pS, noOfItems);
+               break;
+           case TAU_OP_SWAP16:
+               vos_copyNetOrder16(pD, pS, noOfItems);
+               break;
+           case TAU_OP_SWAP32:
+               vos_copyNetOrder32(pD, pS, noOfItems);
+               break;
+           default:
+               vos_copyNetOrder64(pD, pS, noOfItems);
+               break;
+        }
+    }
+
+    *pDestSize = pPlan->wireSize;
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/**    Unmarshall one dataset by its plan.
+ *  The plan is only taken if the interpreter would walk the complete dataset without hitting a buffer limit,
+ *  otherwise the interpreter is left to produce its (partial) result and error code.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      pSrc            Pointer to marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[in]      pDest           Pointer to host structure
+ *  @param[in,out]  pDestSize       Size of the destination buffer / size of the host structure
+ *
+ *  @retval         TRUE            dataset unmarshalled
+ *  @retval         FALSE           dataset must be interpreted
+ */
+static BOOL8 unmarshallPlan (
+    const TAU_MARSHALL_DB_T *pDb,
+    const TRDP_DATASET_T    *pDataset,
+    const UINT8             *pSrc,
+    UINT32                  srcSize,
+    UINT8                   *pDest,
+    UINT32                  *pDestSize)
+{
+    const TAU_MARSHALL_PLAN_T   *pPlan = findPlan(pDb, pDataset);
+    const TAU_MARSHALL_OP_T     *pOp;
+    const TAU_MARSHALL_OP_T     *pOpEnd;
+
+    if ((NULL == pPlan) ||
+        (srcSize < pPlan->wireSize) ||
+        (*pDestSize < pPlan->hostSize) ||
+        (alignPtr(pDest, pPlan->align) != pDest))
+    {
+        return FALSE;
+    }
+
+    if (pPlan->pFuncs != NULL)
+    {
+        pPlan->pFuncs->pfUnmarshall(pSrc, pDest);
+        *pDestSize = pPlan->hostSize;
+        return TRUE;
+    }
+
+    pOpEnd = &pDb->pPlanOps[pPlan->firstOp + pPlan->noOfOps];
+    for (pOp = &pDb->pPlanOps[pPlan->firstOp]; pOp < pOpEnd; pOp++)
+    {
+        const UINT8 *pS = pSrc + pOp->wireOffset;
+        UINT8       *pD = pDest + pOp->hostOffset;
+        UINT32      noOfItems = pOp->noOfItems;
+
+        switch (pOp->kind)
+        {
+           case TAU_OP_COPY:
+               memcpy(pD, pS, noOfItems);
+               break;
+           case TAU_OP_SWAP16:
+               vos_copyNetOrder16(pD, pS, noOfItems);
+               break;
+           case TAU_OP_SWAP32:
+               vos_copyNetOrder32(pD, pS, noOfItems);
+               break;
+           default:
+               vos_copyNetOrder64(pD, pS, noOfItems);
+               break;
+        }
+    }
+
+    *pDestSize = pPlan->hostSize;
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/**    Read an unsigned big endian value of up to 8 bytes.
+ *
+ *  @param[in]      pSrc            Pointer to the value
+ *  @param[in]      size            Size of the value
+ *
+ *  @retval         value
+ */
+static UINT64 readNetOrder (
+    const UINT8 *pSrc,
+    UINT32      size)
+{
+    UINT64 value = 0u;
+
+    while (size-- > 0u)
+    {
+        value = (value << 8u) | *pSrc++;
+    }
+    return value;
+}
+
+static TRDP_ERR_T skipElements (
+    const TAU_MARSHALL_DB_T *pDb,
+    const TRDP_DATASET_T    *pDataset,
+    UINT32                  numElement,
+    const UINT8             * *ppSrc,
+    const UINT8             *pSrcEnd,
+    UINT32                  *pVarSize,
+    INT32                   level);
+
+/**********************************************************************************************************************/
+/**    Skip items of a nested dataset in marshalled data.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      pDataset        Nested dataset
+ *  @param[in]      noOfItems       Number of items to skip
+ *  @param[in,out]  ppSrc           Position in the marshalled data
+ *  @param[in]      pSrcEnd         End of the marshalled data
+ *  @param[in]      level           Recursion level
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_COMID_ERR          nested dataset unknown
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ */
+static TRDP_ERR_T skipDatasets (
+    const TAU_MARSHALL_DB_T *pDb,
+    const TRDP_DATASET_T    *pDataset,
+    UINT32                  noOfItems,
+    const UINT8             * *ppSrc,
+    const UINT8             *pSrcEnd,
+    INT32                   level)
+{
+    const TAU_MARSHALL_PLAN_T   *pLayout = findLayout(pDb, pDataset);
+    TRDP_ERR_T                  err = TRDP_NO_ERR;
+
+    if (pLayout != NULL)
+    {
+        /*  fixed-layout datasets are skipped in one step  */
+        if ((pLayout->wireSize > 0u) && (((UINT32) (pSrcEnd - *ppSrc) / pLayout->wireSize) < noOfItems))
+        {
+            return TRDP_MARSHALLING_ERR;
+        }
+        *ppSrc += noOfItems * pLayout->wireSize;
+    }
+    else
+    {
+        while ((noOfItems-- > 0u) && (err == TRDP_NO_ERR))
+        {
+            UINT32 varSize = 0u;
+
+            err = skipElements(pDb, pDataset, pDataset->numElement, ppSrc, pSrcEnd, &varSize, level);
+        }
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    Skip the first elements of a dataset in marshalled data.
+ *  Sizes of variable sized elements are taken from the element in front, exactly like unmarshallDs() does.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      pDataset        Dataset
+ *  @param[in]      numElement      Number of elements to skip
+ *  @param[in,out]  ppSrc           Position in the marshalled data
+ *  @param[in]      pSrcEnd         End of the marshalled data
+ *  @param[in,out]  pVarSize        Size of a variable sized element following the skipped ones
+ *  @param[in]      level           Recursion level
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_COMID_ERR          nested dataset unknown
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ */
+static TRDP_ERR_T skipElements (
+    const TAU_MARSHALL_DB_T *pDb,
+    const TRDP_DATASET_T    *pDataset,
+    UINT32                  numElement,
+    const UINT8             * *ppSrc,
+    const UINT8             *pSrcEnd,
+    UINT32                  *pVarSize,
+    INT32                   level)
+{
+    TRDP_ERR_T  err = TRDP_NO_ERR;
+    UINT32      lIndex;
+
+    if (level > TAU_MAX_DS_LEVEL)
+    {
+        return TRDP_STATE_ERR;
+    }
+
+    for (lIndex = 0u; (lIndex < numElement) && (err == TRDP_NO_ERR); ++lIndex)
+    {
+        const TRDP_DATASET_ELEMENT_T    *pElement   = &pDataset->pElement[lIndex];
+        UINT32                          noOfItems   = (TRDP_VAR_SIZE == pElement->size) ? *pVarSize : pElement->size;
+
+        if (pElement->type > (UINT32) TRDP_TYPE_MAX)
+        {
+            const TRDP_DATASET_T *pNested = (pElement->pCachedDS != NULL) ?
+                pElement->pCachedDS : findDs(pDb, pElement->type);
+
+            err = (NULL == pNested) ? TRDP_COMID_ERR :
+                skipDatasets(pDb, pNested, noOfItems, ppSrc, pSrcEnd, level + 1);
+        }
+        else
+        {
+            UINT32 itemSize = wireSizeOfItem(pElement->type);
+
+            if ((itemSize > 0u) && (((UINT32) (pSrcEnd - *ppSrc) / itemSize) < noOfItems))
+            {
+                err = TRDP_MARSHALLING_ERR;
+            }
+            else
+            {
+                *ppSrc += noOfItems * itemSize;
+
+                /*    the last item of up to 32 bits may give the size of the next element    */
+                if ((noOfItems > 0u) && (itemSize > 0u) && (itemSize <= 4u))
+                {
+                    *pVarSize = (UINT32) readNetOrder(*ppSrc - itemSize, itemSize);
+                }
+            }
+        }
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    Find an item of an element in marshalled data.
+ *  The offset is taken from the accessor for fixed-layout data, otherwise the marshalled data in front of the
+ *  element is scanned along the path.
+ *
+ *  @param[in]      pField          Accessor
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[in]      index           Index of the item, relative to the index of the path
+ *  @param[out]     pOffset         Offset of the item, not checked against srcSize
+ *  @param[out]     pNoOfItems      Number of items from the addressed one up to the end of the element
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          item index out of range
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ */
+static TRDP_ERR_T locateItem (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              index,
+    UINT32              *pOffset,
+    UINT32              *pNoOfItems)
+{
+    const TAU_MARSHALL_DB_T *pDb     = findDb(pField->pRefCon);
+    const TAU_FIELD_STEP_T  *pLast   = &pField->step[pField->depth - 1u];
+    const UINT8             *pCur    = pSrc;
+    const UINT8             *pSrcEnd = pSrc + srcSize;
+    TRDP_ERR_T              err = TRDP_NO_ERR;
+    UINT32                  s;
+
+    if (NULL == pDb)
+    {
+        return TRDP_INIT_ERR;
+    }
+
+    if (pField->fixedOffset == TRUE)
+    {
+        if (index >= (pField->noOfItems - pLast->item))
+        {
+            return TRDP_PARAM_ERR;
+        }
+        *pOffset    = pField->wireOffset + index * pField->itemSize;
+        *pNoOfItems = pField->noOfItems - pLast->item - index;
+        return TRDP_NO_ERR;
+    }
+
+    /*    Prefix scan along the path    */
+    for (s = 0u; (s < pField->depth) && (err == TRDP_NO_ERR); s++)
+    {
+        const TAU_FIELD_STEP_T          *pStep      = &pField->step[s];
+        const TRDP_DATASET_ELEMENT_T    *pElement   = &pStep->pDataset->pElement[pStep->element];
+        UINT32                          varSize     = 0u;
+        UINT32                          noOfItems;
+        UINT32                          item        = (pStep == pLast) ? (pStep->item + index) : pStep->item;
+
+        err = skipElements(pDb, pStep->pDataset, pStep->element, &pCur, pSrcEnd, &varSize, (INT32) s + 1);
+        noOfItems = (TRDP_VAR_SIZE == pElement->size) ? varSize : pElement->size;
+        if ((err == TRDP_NO_ERR) && ((item < pStep->item) || (item >= noOfItems)))
+        {
+            err = TRDP_PARAM_ERR;
+        }
+        if (err == TRDP_NO_ERR)
+        {
+            if (pElement->type > (UINT32) TRDP_TYPE_MAX)
+            {
+                const TRDP_DATASET_T *pNested = (pStep != pLast) ? pField->step[s + 1u].pDataset :
+                    findDs(pDb, pElement->type);
+
+                err = (NULL == pNested) ? TRDP_COMID_ERR :
+                    skipDatasets(pDb, pNested, item, &pCur, pSrcEnd, (INT32) s + 2);
+            }
+            else if ((pField->itemSize > 0u) && (((UINT32) (pSrcEnd - pCur) / pField->itemSize) < item))
+            {
+                err = TRDP_MARSHALLING_ERR;
+            }
+            else
+            {
+                pCur += item * pField->itemSize;
+            }
+            *pNoOfItems = noOfItems - item;
+        }
+    }
+    *pOffset = (UINT32) (pCur - pSrc);
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    Read the wire value of one item of a base type.
+ *
+ *  @param[in]      pField          Accessor
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[in]      index           Index of the item
+ *  @param[out]     pValue          Unsigned wire value
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          parameter error
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ */
+static TRDP_ERR_T readItem (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              index,
+    UINT64              *pValue)
+{
+    TRDP_ERR_T  err;
+    UINT32      offset      = 0u;
+    UINT32      noOfItems   = 0u;
+
+    if ((NULL == pField) || (NULL == pSrc) || (NULL == pValue) || (pField->depth == 0u) ||
+        (pField->type > (UINT32) TRDP_TYPE_MAX) || (pField->itemSize == 0u))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    err = locateItem(pField, pSrc, srcSize, index, &offset, &noOfItems);
+    if (err == TRDP_NO_ERR)
+    {
+        if ((offset > srcSize) || ((srcSize - offset) < pField->itemSize))
+        {
+            err = TRDP_MARSHALLING_ERR;
+        }
+        else
+        {
+            *pValue = readNetOrder(pSrc + offset, pField->itemSize);
+        }
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    Compute the unmarshalled size of a dataset.
+ *  Fixed-layout datasets take their size from the plan, variable datasets are only scanned from their first
+ *  variable element on. The interpreter computes the size if plans are disabled, the source is not aligned like
+ *  the host structure or too short for the constant part.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[out]     pDestSize       Size of the host structure
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ */
+static TRDP_ERR_T calcSize (
+    const TAU_MARSHALL_DB_T *pDb,
+    TRDP_DATASET_T          *pDataset,
+    UINT8                   *pSrc,
+    UINT32                  srcSize,
+    UINT32                  *pDestSize)
+{
+    TRDP_ERR_T                  err;
+    TAU_MARSHALL_INFO_T         info;
+    const TAU_MARSHALL_PLAN_T   *pPlan = ((sPlansEnabled == TRUE) && (pDb != NULL)) ? findDsPlan(pDb, pDataset) : NULL;
+    UINT16                      lStart = 0u;
+    UINT32                      varSize = 0u;
+
+    info.pDb        = pDb;
+    info.level      = 0u;
+    info.pSrc       = pSrc;
+    info.pSrcEnd    = pSrc + srcSize;
+    info.pDst       = pSrc;
+
+    if ((pPlan != NULL) && (alignPtr(pSrc, pPlan->align) == pSrc))
+    {
+        if ((pPlan->fixedSize == TRUE) && (srcSize >= pPlan->wireSize))
+        {
+            *pDestSize = pPlan->hostSize;
+            return TRDP_NO_ERR;
+        }
+        if ((pPlan->prefix.element > 0u) && (srcSize > pPlan->prefix.wireOffset))
+        {
+            lStart      = (UINT16) pPlan->prefix.element;
+            varSize     = (UINT32) readNetOrder(pSrc + pPlan->prefix.varSizeOffset, pPlan->prefix.varSizeBytes);
+            info.pSrc   = pSrc + pPlan->prefix.wireOffset;
+            info.pDst   = pSrc + pPlan->prefix.hostOffset;
+        }
+    }
+
+    err = size_unmarshall(&info, pDataset, lStart, varSize);
+
+    *pDestSize = (UINT32) (info.pDst - pSrc);
+
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    Release a marshalling database.
+ *
+ *  @param[in]      pDb             Marshalling database
+ *
+ *  @retval         none
+ */
+static void freeDb (
+    TAU_MARSHALL_DB_T *pDb)
+{
+    TAU_MARSHALL_DB_T * *ppIter;
+
+    for (ppIter = &sDbList; *ppIter != NULL; ppIter = &(*ppIter)->pNext)
+    {
+        if (*ppIter == pDb)
+        {
+            *ppIter = pDb->pNext;
+            break;
+        }
+    }
+    if (sDefaultDb == pDb)
+    {
+        sDefaultDb = NULL;
+    }
+    if (sOwnDb == pDb)
+    {
+        sOwnDb = NULL;
+    }
+    if (pDb->pPlanOps != NULL)
+    {
+        vos_memFree(pDb->pPlanOps);
+    }
+    vos_memFree(pDb);
+}
+
+/**********************************************************************************************************************
+ * GLOBAL FUNCTIONS
+ */
+
+/**********************************************************************************************************************/
+/**    Function to initialise the marshalling/unmarshalling.
+ *    The supplied arrays are sorted and indexed into a new marshalling database. They must exist during the use
+ *    of the marshalling functions. The database is returned in ppRefCon and must be passed as pRefCon (e.g. in
+ *    TRDP_MARSHALL_CONFIG_T) to the marshalling functions; a NULL pRefCon selects the last initialised database.
+ *    Several databases with different configurations may be used at the same time, they are not modified
+ *    after initialisation. Release a database by tau_deInitMarshall() before tlc_terminate(); databases not
+ *    released are forgotten when the VOS memory is deleted, tau_initMarshall() must then be called again.
+ *    Re-initialising with the same ppRefCon replaces (and releases) the database it refers to.
+ *
+ *  @param[in,out]  ppRefCon         Returns a pointer to be used for the reference context of marshalling/unmarshalling
+ *                                   If it refers to a database already, that one is replaced; initialise it to NULL
+ *                                   If NULL, the database replaces the one of the previous call without ppRefCon
+ *  @param[in]      numComId         Number of datasets found in the configuration
+ *  @param[in]      pComIdDsIdMap    Pointer to an array of structures of type TRDP_DATASET_T
+ *  @param[in]      numDataSet       Number of datasets found in the configuration
+ *  @param[in]      pDataset         Pointer to an array of pointers to structures of type TRDP_DATASET_T
+ *
+ *  @retval         TRDP_NO_ERR      no error
+ *  @retval         TRDP_MEM_ERR     out of memory
+ *  @retval         TRDP_PARAM_ERR   Parameter error
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_initMarshall (
+    void                    * *ppRefCon,
+    UINT32                  numComId,
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap,
+    UINT32                  numDataSet,
+    TRDP_DATASET_T          *pDataset[])
+{
+    TAU_MARSHALL_DB_T   *pDb;
+    TAU_MARSHALL_DB_T   *pOldDb;
+    UINT32              i, j, index;
+    UINT32              hashBits = TAU_HASH_MIN_BITS;
+    UINT32              hashSize;
+
+    if ((pDataset == NULL) || (numDataSet == 0u) || (numComId == 0u) || (pComIdDsIdMap == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /*    Hash tables are kept at most half full    */
+    while ((hashBits < 30u) && ((1u << hashBits) < 2u * ((numComId > numDataSet) ? numComId : numDataSet)))
+    {
+        hashBits++;
+    }
+    hashSize = 1u << hashBits;
+
+    /* drop the databases of a deleted memory area before allocating from the current one */
+    (void) findDb(NULL);
+
+    /* the database to be replaced, released only after the new one was built */
+    pOldDb = (ppRefCon != NULL) ? findDb(*ppRefCon) : sOwnDb;
+
+    pDb = (TAU_MARSHALL_DB_T *) vos_memAlloc(sizeof(TAU_MARSHALL_DB_T) +
+                                             2u * hashSize * sizeof(TAU_HASH_ENTRY_T) +
+                                             numDataSet * sizeof(TAU_MARSHALL_PLAN_T));
+    if (NULL == pDb)
+    {
+        return TRDP_MEM_ERR;
+    }
+    pDb->hashShift  = 32u - hashBits;
+    pDb->pComIdHash = (TAU_HASH_ENTRY_T *) (pDb + 1);
+    pDb->pDsIdHash  = pDb->pComIdHash + hashSize;
+    pDb->pPlans     = (TAU_MARSHALL_PLAN_T *) (pDb->pDsIdHash + hashSize);
+
+    /* sort the tables    */
+    sortTable(pComIdDsIdMap, numComId, sizeof(TRDP_COMID_DSID_MAP_T), compareComId);
+    sortTable(pDataset, numDataSet, sizeof(TRDP_DATASET_T *), compareDataset);
+
+    /*    Save the pointers to the tables    */
+    pDb->pComIdDsIdMap  = pComIdDsIdMap;
+    pDb->numComId       = numComId;
+    pDb->pDataSets      = pDataset;
+    pDb->numDataSet     = numDataSet;
+
+    /*    Index the datasets, then the comIds by their resolved dataset    */
+    for (i = 0u; i < numDataSet; i++)
+    {
+        hashInsert(pDb, pDb->pDsIdHash, pDataset[i]->id, i);
+    }
+    for (i = 0u; i < numComId; i++)
+    {
+        index = hashFind(pDb, pDb->pDsIdHash, pComIdDsIdMap[i].datasetId);
+        if (index != 0u)
+        {
+            hashInsert(pDb, pDb->pComIdHash, pComIdDsIdMap[i].comId, index - 1u);
+        }
+    }
+
+    /* resolve the nested datasets, marshalling does not need to write to the configuration any more */
+    for (i = 0u; i < numDataSet; i++)
+    {
+        for (j = 0u; j < pDataset[i]->numElement; j++)
+        {
+            pDataset[i]->pElement[j].pCachedDS = (pDataset[i]->pElement[j].type > (UINT32) TRDP_TYPE_MAX) ?
+                findDs(pDb, pDataset[i]->pElement[j].type) : NULL;
+        }
+    }
+
+    /* compile the fixed-layout datasets */
+    compilePlans(pDb);
+
+    pDb->pNext  = sDbList;
+    sDbList     = pDb;
+
+    if (pOldDb != NULL)
+    {
+        freeDb(pOldDb);
+    }
+    if (ppRefCon != NULL)
+    {
+        *ppRefCon = pDb;
+    }
+    else
+    {
+        sOwnDb = pDb;
+    }
+    sDefaultDb = pDb;
+
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Function to release a marshalling database.
+ *
+ *  @param[in]      pRefCon          Reference context returned by tau_initMarshall(),
+ *                                   NULL for the database initialised without ppRefCon
+ *
+ *  @retval         TRDP_NO_ERR      no error
+ *  @retval         TRDP_PARAM_ERR   not a marshalling database
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_deInitMarshall (
+    void *pRefCon)
+{
+    TAU_MARSHALL_DB_T *pDb = findDb(pRefCon);
+
+    if (NULL == pRefCon)
+    {
+        pDb = sOwnDb;
+    }
+    if (NULL == pDb)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    freeDb(pDb);
+
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    marshall function.
+ *
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
+ *  @param[in]      comId           ComId to identify the structure out of a configuration
+ *  @param[in]      pSrc            pointer to received original message
+ *  @param[in]      srcSize         size of the source buffer
+ *  @param[in]      pDest           pointer to a buffer for the treated message
+ *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
+ *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
+ *                                  set NULL if not used, set content NULL if unknown
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MEM_ERR            provided buffer to small
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_marshall (
+    void            *pRefCon,
+    UINT32          comId,
+    const UINT8     *pSrc,
+    UINT32          srcSize,
+    UINT8           *pDest,
+    UINT32          *pDestSize,
+    TRDP_DATASET_T  * *ppDSPointer)
+{
+    TRDP_ERR_T          err;
+    TRDP_DATASET_T      *pDataset;
+    TAU_MARSHALL_INFO_T info;
+    const TAU_MARSHALL_DB_T *pDb = getDb(pRefCon);
+
+    if ((0u == comId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /* Can we use the formerly cached value? */
     if (NULL != ppDSPointer)
     {
         if (NULL == *ppDSPointer)
         {
-            *ppDSPointer = findDSFromComId(comId);
+            *ppDSPointer = findDSFromComId(pDb, comId);
         }
         pDataset = *ppDSPointer;
     }
     else
     {
-        pDataset = findDSFromComId(comId);
+        pDataset = findDSFromComId(pDb, comId);
     }
 
     if (NULL == pDataset)   /* Not in our DB    */
@@ -1218,6 +2324,12 @@ EXT_DECL TRDP_ERR_T tau_marshall (
         return TRDP_COMID_ERR;
     }
 
+    if (marshallPlan(pDb, pDataset, pSrc, srcSize, pDest, pDestSize) == TRUE)
+    {
+        return TRDP_NO_ERR;
+    }
+
+    info.pDb        = pDb;
     info.level      = 0u;
     info.pSrc       = pSrc;
     info.pSrcEnd    = pSrc + srcSize;
@@ -1234,7 +2346,7 @@ EXT_DECL TRDP_ERR_T tau_marshall (
 /**********************************************************************************************************************/
 /**    unmarshall function.
  *
- *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      comId           ComId to identify the structure out of a configuration
  *  @param[in]      pSrc            pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -1265,8 +2377,7 @@ EXT_DECL TRDP_ERR_T tau_unmarshall (
     TRDP_ERR_T          err;
     TRDP_DATASET_T      *pDataset;
     TAU_MARSHALL_INFO_T info;
-
-    (void)pRefCon;
+    const TAU_MARSHALL_DB_T *pDb = getDb(pRefCon);
 
     if ((0u == comId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
     {
@@ -1278,13 +2389,13 @@ EXT_DECL TRDP_ERR_T tau_unmarshall (
     {
         if (NULL == *ppDSPointer)
         {
-            *ppDSPointer = findDSFromComId(comId);
+            *ppDSPointer = findDSFromComId(pDb, comId);
         }
         pDataset = *ppDSPointer;
     }
     else
     {
-        pDataset = findDSFromComId(comId);
+        pDataset = findDSFromComId(pDb, comId);
     }
 
     if (NULL == pDataset)   /* Not in our DB    */
@@ -1293,6 +2404,12 @@ EXT_DECL TRDP_ERR_T tau_unmarshall (
         return TRDP_COMID_ERR;
     }
 
+    if (unmarshallPlan(pDb, pDataset, pSrc, srcSize, pDest, pDestSize) == TRUE)
+    {
+        return TRDP_NO_ERR;
+    }
+
+    info.pDb        = pDb;
     info.level      = 0u;
     info.pSrc       = pSrc;
     info.pSrcEnd    = pSrc + srcSize;
@@ -1310,7 +2427,7 @@ EXT_DECL TRDP_ERR_T tau_unmarshall (
 /**********************************************************************************************************************/
 /**    marshall data set function.
  *
- *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      dsId            Data set id to identify the structure out of a configuration
  *  @param[in]      pSrc            pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -1341,8 +2458,7 @@ EXT_DECL TRDP_ERR_T tau_marshallDs (
     TRDP_ERR_T          err;
     TRDP_DATASET_T      *pDataset;
     TAU_MARSHALL_INFO_T info;
-
-    (void)pRefCon;
+    const TAU_MARSHALL_DB_T *pDb = getDb(pRefCon);
 
     if ((0u == dsId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
     {
@@ -1354,13 +2470,13 @@ EXT_DECL TRDP_ERR_T tau_marshallDs (
     {
         if (NULL == *ppDSPointer)
         {
-            *ppDSPointer = findDs(dsId);
+            *ppDSPointer = findDs(pDb, dsId);
         }
         pDataset = *ppDSPointer;
     }
     else
     {
-        pDataset = findDs(dsId);
+        pDataset = findDs(pDb, dsId);
     }
 
     if (NULL == pDataset)   /* Not in our DB    */
@@ -1369,6 +2485,12 @@ EXT_DECL TRDP_ERR_T tau_marshallDs (
         return TRDP_COMID_ERR;
     }
 
+    if (marshallPlan(pDb, pDataset, pSrc, srcSize, pDest, pDestSize) == TRUE)
+    {
+        return TRDP_NO_ERR;
+    }
+
+    info.pDb        = pDb;
     info.level      = 0u;
     info.pSrc       = pSrc;
     info.pSrcEnd    = pSrc + srcSize;
@@ -1385,7 +2507,7 @@ EXT_DECL TRDP_ERR_T tau_marshallDs (
 /**********************************************************************************************************************/
 /**    unmarshall data set function.
  *
- *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      dsId            Data set id to identify the structure out of a configuration
  *  @param[in]      pSrc            pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -1416,8 +2538,7 @@ EXT_DECL TRDP_ERR_T tau_unmarshallDs (
     TRDP_ERR_T          err;
     TRDP_DATASET_T      *pDataset;
     TAU_MARSHALL_INFO_T info;
-
-    (void)pRefCon;
+    const TAU_MARSHALL_DB_T *pDb = getDb(pRefCon);
 
     if ((0u == dsId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
     {
@@ -1429,13 +2550,13 @@ EXT_DECL TRDP_ERR_T tau_unmarshallDs (
     {
         if (NULL == *ppDSPointer)
         {
-            *ppDSPointer = findDs(dsId);
+            *ppDSPointer = findDs(pDb, dsId);
         }
         pDataset = *ppDSPointer;
     }
     else
     {
-        pDataset = findDs(dsId);
+        pDataset = findDs(pDb, dsId);
     }
 
     if (NULL == pDataset)   /* Not in our DB    */
@@ -1444,6 +2565,12 @@ EXT_DECL TRDP_ERR_T tau_unmarshallDs (
         return TRDP_COMID_ERR;
     }
 
+    if (unmarshallPlan(pDb, pDataset, pSrc, srcSize, pDest, pDestSize) == TRUE)
+    {
+        return TRDP_NO_ERR;
+    }
+
+    info.pDb        = pDb;
     info.level      = 0u;
     info.pSrc       = pSrc;
     info.pSrcEnd    = pSrc + srcSize;
@@ -1461,7 +2588,7 @@ EXT_DECL TRDP_ERR_T tau_unmarshallDs (
 /**********************************************************************************************************************/
 /**    Calculate data set size by given data set id.
  *
- *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      dsId            Dataset id to identify the structure out of a configuration
  *  @param[in]      pSrc            Pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -1487,11 +2614,8 @@ EXT_DECL TRDP_ERR_T tau_calcDatasetSize (
     UINT32          *pDestSize,
     TRDP_DATASET_T  * *ppDSPointer)
 {
-    TRDP_ERR_T          err;
     TRDP_DATASET_T      *pDataset;
-    TAU_MARSHALL_INFO_T info;
-
-    (void)pRefCon;
+    const TAU_MARSHALL_DB_T *pDb = getDb(pRefCon);
 
     if ((0u == dsId) || (NULL == pSrc) || (NULL == pDestSize))
     {
@@ -1503,13 +2627,13 @@ EXT_DECL TRDP_ERR_T tau_calcDatasetSize (
     {
         if (NULL == *ppDSPointer)
         {
-            *ppDSPointer = findDs(dsId);
+            *ppDSPointer = findDs(pDb, dsId);
         }
         pDataset = *ppDSPointer;
     }
     else
     {
-        pDataset = findDs(dsId);
+        pDataset = findDs(pDb, dsId);
     }
 
     if (NULL == pDataset)   /* Not in our DB    */
@@ -1518,22 +2642,13 @@ EXT_DECL TRDP_ERR_T tau_calcDatasetSize (
         return TRDP_COMID_ERR;
     }
 
-    info.level      = 0u;
-    info.pSrc       = pSrc;
-    info.pSrcEnd    = pSrc + srcSize;
-    info.pDst       = pSrc;
-
-    err = size_unmarshall(&info, pDataset);
-
-    *pDestSize = (UINT32) (info.pDst-pSrc);
-
-    return err;
+    return calcSize(pDb, pDataset, pSrc, srcSize, pDestSize);
 }
 
 /**********************************************************************************************************************/
 /**    Calculate data set size by given ComId.
  *
- *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
  *  @param[in]      comId           ComId id to identify the structure out of a configuration
  *  @param[in]      pSrc            Pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
@@ -1559,11 +2674,8 @@ EXT_DECL TRDP_ERR_T tau_calcDatasetSizeByComId (
     UINT32          *pDestSize,
     TRDP_DATASET_T  * *ppDSPointer)
 {
-    TRDP_ERR_T          err;
     TRDP_DATASET_T      *pDataset;
-    TAU_MARSHALL_INFO_T info;
-
-    (void)pRefCon;
+    const TAU_MARSHALL_DB_T *pDb = getDb(pRefCon);
 
     if ((0u == comId) || (NULL == pSrc) || (NULL == pDestSize))
     {
@@ -1575,13 +2687,13 @@ EXT_DECL TRDP_ERR_T tau_calcDatasetSizeByComId (
     {
         if (NULL == *ppDSPointer)
         {
-            *ppDSPointer = findDSFromComId(comId);
+            *ppDSPointer = findDSFromComId(pDb, comId);
         }
         pDataset = *ppDSPointer;
     }
     else
     {
-        pDataset = findDSFromComId(comId);
+        pDataset = findDSFromComId(pDb, comId);
     }
 
     if (NULL == pDataset)   /* Not in our DB    */
@@ -1590,14 +2702,478 @@ EXT_DECL TRDP_ERR_T tau_calcDatasetSizeByComId (
         return TRDP_COMID_ERR;
     }
 
-    info.level      = 0u;
-    info.pSrc       = pSrc;
-    info.pSrcEnd    = pSrc + srcSize;
-    info.pDst       = pSrc;
+    return calcSize(pDb, pDataset, pSrc, srcSize, pDestSize);
+}
+
+/**********************************************************************************************************************/
+/**    Register specialised marshalling functions with a marshalling database.
+ *
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
+ *  @param[in]      numFuncs        Number of table entries
+ *  @param[in]      pFuncs          Table of specialised functions
+ *
+ *  @retval         TRDP_NO_ERR     all entries registered
+ *  @retval         TRDP_INIT_ERR   marshalling not initialised
+ *  @retval         TRDP_PARAM_ERR  parameter error or an entry does not match its dataset (others are registered)
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_registerMarshallFuncs (
+    void                        *pRefCon,
+    UINT32                      numFuncs,
+    const TAU_MARSHALL_FUNCS_T  *pFuncs)
+{
+    TAU_MARSHALL_DB_T   *pDb = (TAU_MARSHALL_DB_T *) getDb(pRefCon);
+    TRDP_ERR_T          err = TRDP_NO_ERR;
+    UINT32              i;
+
+    if (NULL == pDb)
+    {
+        return TRDP_INIT_ERR;
+    }
+    if ((NULL == pFuncs) && (numFuncs != 0u))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    for (i = 0u; i < numFuncs; i++)
+    {
+        UINT32              index   = hashFind(pDb, pDb->pDsIdHash, pFuncs[i].datasetId);
+        TAU_MARSHALL_PLAN_T *pPlan  = (index != 0u) ? &pDb->pPlans[index - 1u] : NULL;
+
+        if ((NULL == pPlan) ||
+            (pPlan->fixedSize == FALSE) ||
+            (pPlan->wireSize != pFuncs[i].wireSize) ||
+            (pPlan->hostSize != pFuncs[i].hostSize) ||
+            (NULL == pFuncs[i].pfMarshall) ||
+            (NULL == pFuncs[i].pfUnmarshall))
+        {
+            vos_printLog(VOS_LOG_WARNING, "Marshalling functions for dataset %u do not match the configuration\n",
+                         pFuncs[i].datasetId);
+            err = TRDP_PARAM_ERR;
+        }
+        else
+        {
+            pPlan->pFuncs = &pFuncs[i];
+        }
+    }
+
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    Enable or disable the use of compiled marshalling plans.
+ *
+ *  @param[in]      enable          TRUE to use plans (default), FALSE to interpret the datasets
+ *
+ *  @retval         none
+ *
+ */
+
+EXT_DECL void tau_enableMarshallPlans (
+    BOOL8 enable)
+{
+    sPlansEnabled = enable;
+}
+
+/**********************************************************************************************************************/
+/**    Resolve the path of one element of a dataset into an accessor.
+ *
+ *  @param[in]      pRefCon         Marshalling database from tau_initMarshall(), NULL for the last one
+ *  @param[in]      dsId            Dataset id of the marshalled data
+ *  @param[in]      pPath           Path of the element, e.g. "position[2].lat" or "3.1"
+ *  @param[out]     pField          Accessor to initialise
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_INIT_ERR   marshalling not initialised
+ *  @retval         TRDP_COMID_ERR  dataset or nested dataset unknown
+ *  @retval         TRDP_PARAM_ERR  parameter error, path not found or too deep
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_initFieldAccess (
+    void                *pRefCon,
+    UINT32              dsId,
+    const CHAR8         *pPath,
+    TAU_FIELD_T         *pField)
+{
+    const TAU_MARSHALL_DB_T *pDb = getDb(pRefCon);
+    const TRDP_DATASET_T    *pDataset;
+    const CHAR8             *pName = pPath;
+    TRDP_ERR_T              err = TRDP_NO_ERR;
+    BOOL8                   last = FALSE;
+
+    if (NULL == pDb)
+    {
+        return TRDP_INIT_ERR;
+    }
+    if ((NULL == pPath) || (NULL == pField))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    pDataset = findDs(pDb, dsId);
+    if (NULL == pDataset)
+    {
+        return TRDP_COMID_ERR;
+    }
+
+    memset(pField, 0, sizeof(TAU_FIELD_T));
+    pField->pRefCon     = (void *) pDb;
+    pField->datasetId   = dsId;
+    pField->fixedOffset = TRUE;
+
+    while ((err == TRDP_NO_ERR) && (last == FALSE))
+    {
+        const TRDP_DATASET_ELEMENT_T    *pElement = NULL;
+        const TRDP_DATASET_T            *pNested = NULL;
+        UINT32                          len = 0u;
+        UINT32                          number = 0u;
+        UINT32                          item = 0u;
+        UINT32                          lIndex;
+        UINT32                          elementIndex = 0u;
+        BOOL8                           isNumber = TRUE;
+
+        /*    Element name or number    */
+        while ((pName[len] != '\0') && (pName[len] != '.') && (pName[len] != '['))
+        {
+            if ((pName[len] >= '0') && (pName[len] <= '9'))
+            {
+                number = number * 10u + (UINT32) (pName[len] - '0');
+            }
+            else
+            {
+                isNumber = FALSE;
+            }
+            len++;
+        }
+        for (lIndex = 0u; (len > 0u) && (lIndex < pDataset->numElement) && (NULL == pElement); lIndex++)
+        {
+            const CHAR8 *pElementName = pDataset->pElement[lIndex].name;
+
+            if (((isNumber == TRUE) && (number == (lIndex + 1u))) ||
+                ((isNumber == FALSE) && (pElementName != NULL) && (vos_strnicmp(pElementName, pName, len) == 0) &&
+                 (pElementName[len] == '\0')))
+            {
+                pElement        = &pDataset->pElement[lIndex];
+                elementIndex    = lIndex;
+            }
+        }
+        pName += len;
+
+        /*    Optional item index    */
+        if (*pName == '[')
+        {
+            pName++;
+            while ((*pName >= '0') && (*pName <= '9'))
+            {
+                item = item * 10u + (UINT32) (*pName++ - '0');
+            }
+            if (*pName == ']')
+            {
+                pName++;
+            }
+            else
+            {
+                pElement = NULL;
+            }
+        }
+        if (*pName == '\0')
+        {
+            last = TRUE;
+        }
+        else if (*pName == '.')
+        {
+            pName++;
+        }
+        else
+        {
+            pElement = NULL;
+            last = TRUE;
+        }
+
+        if ((NULL == pElement) || (pField->depth >= (UINT32) TAU_MAX_DS_LEVEL))
+        {
+            err = TRDP_PARAM_ERR;
+        }
+        else
+        {
+            pField->step[pField->depth].pDataset    = pDataset;
+            pField->step[pField->depth].element     = elementIndex;
+            pField->step[pField->depth].item        = item;
+            pField->depth++;
+
+            /*    Elements in front of this one    */
+            for (lIndex = 0u; (lIndex < elementIndex) && (pField->fixedOffset == TRUE); lIndex++)
+            {
+                const TRDP_DATASET_ELEMENT_T *pFront = &pDataset->pElement[lIndex];
+
+                if (TRDP_VAR_SIZE == pFront->size)
+                {
+                    pField->fixedOffset = FALSE;
+                }
+                else if (pFront->type > (UINT32) TRDP_TYPE_MAX)
+                {
+                    const TRDP_DATASET_T        *pFrontDs = findDs(pDb, pFront->type);
+                    const TAU_MARSHALL_PLAN_T   *pLayout = (pFrontDs != NULL) ? findLayout(pDb, pFrontDs) : NULL;
+
+                    if (NULL == pLayout)
+                    {
+                        pField->fixedOffset = FALSE;
+                    }
+                    else
+                    {
+                        pField->wireOffset += pFront->size * pLayout->wireSize;
+                    }
+                }
+                else
+                {
+                    pField->wireOffset += pFront->size * wireSizeOfItem(pFront->type);
+                }
+            }
+
+            /*    The element itself    */
+            if (TRDP_VAR_SIZE == pElement->size)
+            {
+                pField->fixedOffset = FALSE;
+            }
+            else if (item >= pElement->size)
+            {
+                err = TRDP_PARAM_ERR;
+            }
+
+            if (pElement->type > (UINT32) TRDP_TYPE_MAX)
+            {
+                const TAU_MARSHALL_PLAN_T *pLayout;
+
+                pNested = findDs(pDb, pElement->type);
+                pLayout = (pNested != NULL) ? findLayout(pDb, pNested) : NULL;
+                if (NULL == pNested)
+                {
+                    err = TRDP_COMID_ERR;
+                }
+                else if (NULL == pLayout)
+                {
+                    pField->itemSize = 0u;
+                    if (item > 0u)
+                    {
+                        pField->fixedOffset = FALSE;
+                    }
+                }
+                else
+                {
+                    pField->itemSize = pLayout->wireSize;
+                }
+            }
+            else if (last == FALSE)
+            {
+                err = TRDP_PARAM_ERR;       /* not a dataset */
+            }
+            else
+            {
+                pField->itemSize = wireSizeOfItem(pElement->type);
+            }
+            pField->wireOffset  += item * pField->itemSize;
+            pField->type        = pElement->type;
+            pField->noOfItems   = pElement->size;
+            pDataset            = pNested;
+        }
+    }
+
+    if (err != TRDP_NO_ERR)
+    {
+        pField->depth = 0u;
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    Locate an element in marshalled data.
+ *
+ *  @param[in]      pField          Accessor from tau_initFieldAccess()
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[out]     pOffset         Offset of the addressed item in the marshalled data
+ *  @param[out]     pNoOfItems      Number of items from the addressed item up to the end of the element, may be NULL
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          parameter error, item index out of range
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_locateField (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              *pOffset,
+    UINT32              *pNoOfItems)
+{
+    TRDP_ERR_T  err;
+    UINT32      noOfItems = 0u;
+
+    if ((NULL == pField) || (NULL == pSrc) || (NULL == pOffset) || (pField->depth == 0u))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    err = locateItem(pField, pSrc, srcSize, 0u, pOffset, &noOfItems);
+    if ((err == TRDP_NO_ERR) &&
+        ((*pOffset > srcSize) ||
+         ((pField->itemSize > 0u) && (((srcSize - *pOffset) / pField->itemSize) < noOfItems))))
+    {
+        err = TRDP_MARSHALLING_ERR;
+    }
+    if ((err == TRDP_NO_ERR) && (pNoOfItems != NULL))
+    {
+        *pNoOfItems = noOfItems;
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    Read one item of an element from marshalled data as unsigned value.
+ *
+ *  @param[in]      pField          Accessor from tau_initFieldAccess()
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[in]      index           Index of the item, 0 if the element is not an array
+ *  @param[out]     pValue          Value of the item
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          parameter error, item index out of range, element is a dataset
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_readFieldUInt (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              index,
+    UINT64              *pValue)
+{
+    return readItem(pField, pSrc, srcSize, index, pValue);
+}
+
+/**********************************************************************************************************************/
+/**    Read one item of an element from marshalled data as signed value.
+ *
+ *  @param[in]      pField          Accessor from tau_initFieldAccess()
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[in]      index           Index of the item, 0 if the element is not an array
+ *  @param[out]     pValue          Value of the item
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          parameter error, item index out of range, element is a dataset
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ *
+ */
 
-    err = size_unmarshall(&info, pDataset);
+EXT_DECL TRDP_ERR_T tau_readFieldInt (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              index,
+    INT64               *pValue)
+{
+    UINT64      value = 0u;
+    TRDP_ERR_T  err;
+
+    if (NULL == pValue)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    err = readItem(pField, pSrc, srcSize, index, &value);
+    if (err == TRDP_NO_ERR)
+    {
+        switch (pField->type)
+        {
+           case TRDP_INT8:
+           case TRDP_INT16:
+           case TRDP_INT32:
+               if ((value & ((UINT64) 1u << (pField->itemSize * 8u - 1u))) != 0u)
+               {
+                   value |= ~(((UINT64) 1u << (pField->itemSize * 8u)) - 1u);     /* sign extension */
+               }
+               break;
+           default:
+               break;
+        }
+        *pValue = (INT64) value;
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    Read one item of an element from marshalled data as floating point value.
+ *
+ *  @param[in]      pField          Accessor from tau_initFieldAccess()
+ *  @param[in]      pSrc            Pointer to the marshalled data
+ *  @param[in]      srcSize         Size of the marshalled data
+ *  @param[in]      index           Index of the item, 0 if the element is not an array
+ *  @param[out]     pValue          Value of the item
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_INIT_ERR           marshalling database released
+ *  @retval         TRDP_PARAM_ERR          parameter error, item index out of range, element is a dataset or TIMEDATE48/64
+ *  @retval         TRDP_MARSHALLING_ERR    marshalled data too short
+ *
+ */
 
-    *pDestSize = (UINT32) (info.pDst-pSrc);
+EXT_DECL TRDP_ERR_T tau_readFieldReal (
+    const TAU_FIELD_T   *pField,
+    const UINT8         *pSrc,
+    UINT32              srcSize,
+    UINT32              index,
+    REAL64              *pValue)
+{
+    INT64       value = 0;
+    TRDP_ERR_T  err;
 
+    if ((NULL == pField) || (NULL == pValue) ||
+        (pField->type == TRDP_TIMEDATE48) || (pField->type == TRDP_TIMEDATE64))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    err = tau_readFieldInt(pField, pSrc, srcSize, index, &value);
+    if (err == TRDP_NO_ERR)
+    {
+        switch (pField->type)
+        {
+           case TRDP_REAL32:
+           {
+               union
+               {
+                   UINT32  bits;
+                   REAL32  real;
+               } conv;
+               conv.bits   = (UINT32) value;
+               *pValue     = (REAL64) conv.real;
+               break;
+           }
+           case TRDP_REAL64:
+           {
+               union
+               {
+                   UINT64  bits;
+                   REAL64  real;
+               } conv;
+               conv.bits   = (UINT64) value;
+               *pValue     = conv.real;
+               break;
+           }
+           case TRDP_UINT64:
+               *pValue = (REAL64) (UINT64) value;
+               break;
+           default:
+               *pValue = (REAL64) value;
+               break;
+        }
+    }
     return err;
 }
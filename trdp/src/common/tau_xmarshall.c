@@ -317,6 +317,19 @@ static TRDP_ERR_T marshallDs(TAU_MARSHALL_INFO_T *pInfo, TRDP_DATASET_T *pDatase
 				}
 			}
 
+			/* arrays of natively sized items are converted in one go */
+			if ((m == w) && (w != 0u) && (t < TRDP_TIMEDATE48) && (noOfItems > 1u)) {
+				switch (w) {
+				case 2:  vos_copyNetOrder16(pDst, pSrc, noOfItems); break;
+				case 4:  vos_copyNetOrder32(pDst, pSrc, noOfItems); break;
+				case 8:  vos_copyNetOrder64(pDst, pSrc, noOfItems); break;
+				default: memcpy(pDst, pSrc, noOfItems * w);
+				}
+				pDst += noOfItems * w;
+				pSrc += noOfItems * m;
+				noOfItems = 0u;
+			}
+
 			while (noOfItems-- > 0u) {
 				UINT64 ui=0; /* temporaries */
 				INT64  si=0;
@@ -482,7 +495,25 @@ static TRDP_ERR_T unmarshallDs(TAU_MARSHALL_INFO_T *pInfo, TRDP_DATASET_T *pData
 			}
 
 			UINT64 u=0;
-			if (t < TRDP_TIMEDATE48) {
+			/* arrays of natively sized items are converted in one go */
+			if ((m == w) && (w != 0u) && (t < TRDP_TIMEDATE48) && (noOfItems > 1u) && (pInfo->pDstEnd != SIZE_DRYRUN)) {
+				const UINT8 *pLast = pDst + (noOfItems - 1u) * m;
+				switch (w) {
+				case 2:  vos_copyNetOrder16(pDst, pSrc, noOfItems);
+				         var_size = (t == TRDP_INT16) ? (UINT32)(INT32)*(const INT16 *)pLast : *(const UINT16 *)pLast;
+				         break;
+				case 4:  vos_copyNetOrder32(pDst, pSrc, noOfItems);
+				         var_size = *(const UINT32 *)pLast;
+				         break;
+				case 8:  vos_copyNetOrder64(pDst, pSrc, noOfItems);
+				         var_size = (UINT32)*(const UINT64 *)pLast;
+				         break;
+				default: memcpy(pDst, pSrc, noOfItems * w);
+				         var_size = (t == TRDP_INT8) ? (UINT32)(INT32)*(const INT8 *)pLast : *pLast;
+				}
+				pDst += noOfItems * m;
+				pSrc += noOfItems * w;
+			} else if (t < TRDP_TIMEDATE48) {
 				while (noOfItems-- > 0u) {
 					u = *pSrc++;
 					/* sign extend */
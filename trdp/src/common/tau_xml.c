@@ -221,6 +221,7 @@ static void setDefaultInterfaceValues (
         pMdConfig->tcpPort              = TRDP_MD_TCP_PORT;
         pMdConfig->udpPort              = TRDP_MD_UDP_PORT;
         pMdConfig->maxNumSessions       = TRDP_MD_MAX_NUM_SESSIONS;
+        pMdConfig->stream               = FALSE;
     }
 }
 
@@ -0,0 +1,1071 @@
+/**********************************************************************************************************************/
+/**
+ * @file            tau_xml_cache.c
+ *
+ * @brief           Binary cache of the XML configuration
+ *
+ * @details         The device, interface and dataset configuration read by the tau_readXml... functions is stored in
+ *                  one contiguous image next to the XML file. Pointers inside the image are stored as image offsets
+ *                  and listed in a relocation table. On later starts the image is mapped into memory (private,
+ *                  copy on write), checked and relocated in place, the XML file is not parsed again.
+ *
+ *                  Image layout (all values in host byte order, 8 byte aligned):
+ *                  - header: magic, version, pointer size, structure layout, image size and CRC, XML size and CRC
+ *                  - device configuration: memory and debug configuration, com parameters, interfaces
+ *                  - per interface: process, PD and MD configuration and the telegram array with its parameters
+ *                  - comId/dataset map and datasets, both sorted as expected by tau_initMarshall
+ *                  - relocation table
+ *
+ *                  The image is rebuilt if the size or the CRC of the XML file, the library version or the layout of
+ *                  the configuration structures differ.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          TCNOpen
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ *      AG 2026-10-16: Created
+ *
+ */
+
+/***********************************************************************************************************************
+ * INCLUDES
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "tau_xml.h"
+#include "trdp_xml.h"
+#include "vos_mem.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINES
+ */
+
+#define CACHE_MAGIC         0x58445254u     /* "TRDX" in little endian order, differs on big endian hosts */
+#define CACHE_VERSION       2u              /* Increment on any change of the image layout */
+#define CACHE_ALIGN         8u              /* Alignment of all objects in the image */
+#define CACHE_INITIAL_SIZE  4096u           /* Initial size of the image while building, doubled as needed */
+#define CACHE_INITIAL_RELOC 256u            /* Initial size of the relocation table, doubled as needed */
+#define CACHE_SUFFIX        ".cache"        /* Default cache file name: XML file name + suffix */
+
+/***********************************************************************************************************************
+ * TYPEDEFS
+ */
+
+/** Image header */
+typedef struct
+{
+    UINT32  magic;              /**< CACHE_MAGIC                                        */
+    UINT16  version;            /**< CACHE_VERSION                                      */
+    UINT16  pointerSize;        /**< sizeof(void *) of the writer                       */
+    UINT32  layout;             /**< CRC over the sizes of the cached structures        */
+    UINT32  imageSize;          /**< Size of the complete image including the header    */
+    UINT32  imageCrc;           /**< CRC of the image following the header              */
+    UINT32  xmlSize;            /**< Size of the XML file the image was built from      */
+    UINT32  xmlCrc;             /**< CRC of the XML file the image was built from       */
+    UINT32  relocOffset;        /**< Offset of the relocation table                     */
+    UINT32  noOfRelocs;         /**< Number of pointers to relocate                     */
+    UINT32  configOffset;       /**< Offset of the CACHE_CONFIG_T                       */
+} CACHE_HEADER_T;
+
+/** Configuration of one interface */
+typedef struct
+{
+    TRDP_LABEL_T            ifName;         /**< Interface name                 */
+    TRDP_PROCESS_CONFIG_T   processConfig;  /**< Process (session) configuration */
+    TRDP_PD_CONFIG_T        pdConfig;       /**< PD default configuration       */
+    TRDP_MD_CONFIG_T        mdConfig;       /**< MD default configuration       */
+    UINT32                  numExchgPar;    /**< Number of telegrams            */
+    TRDP_EXCHG_PAR_T        *pExchgPar;     /**< Telegram configurations        */
+} CACHE_INTERFACE_T;
+
+/** Root of the cached configuration */
+typedef struct
+{
+    TRDP_MEM_CONFIG_T       memConfig;      /**< Memory configuration           */
+    TRDP_DBG_CONFIG_T       dbgConfig;      /**< Debug configuration            */
+    UINT32                  numComPar;      /**< Number of com parameters       */
+    TRDP_COM_PAR_T          *pComPar;       /**< Com parameters                 */
+    UINT32                  numIfConfig;    /**< Number of interfaces           */
+    TRDP_IF_CONFIG_T        *pIfConfig;     /**< Interface parameters           */
+    CACHE_INTERFACE_T       *pInterface;    /**< Per interface configuration    */
+    UINT32                  numComId;       /**< Number of comId/dataset pairs  */
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap; /**< comId/dataset map, sorted      */
+    UINT32                  numDataset;     /**< Number of datasets             */
+    apTRDP_DATASET_T        apDataset;      /**< Datasets, sorted by id         */
+} CACHE_CONFIG_T;
+
+/** Image under construction */
+typedef struct
+{
+    UINT8       *pBuf;              /**< Image                                      */
+    UINT32      size;               /**< Used size of the image                     */
+    UINT32      capacity;           /**< Allocated size of the image                */
+    UINT32      *pRelocs;           /**< Offsets of the pointers in the image       */
+    UINT32      noOfRelocs;         /**< Used entries of the relocation table       */
+    UINT32      maxRelocs;          /**< Allocated entries of the relocation table  */
+    UINT32      config;             /**< Offset of the CACHE_CONFIG_T               */
+    TRDP_ERR_T  err;                /**< First error while building                 */
+} CACHE_BUILDER_T;
+
+/** Loaded cache */
+struct TAU_XML_CACHE
+{
+    UINT8                   *pImage;        /**< Relocated image                    */
+    UINT32                  imageSize;      /**< Size of the image                  */
+    int                     mapped;         /**< pImage is a private file mapping   */
+    const CACHE_CONFIG_T    *pConfig;       /**< Root of the configuration          */
+};
+
+/***********************************************************************************************************************
+ *   Locals
+ */
+
+/**********************************************************************************************************************/
+/** CRC over the sizes of the cached structures, detects images written by an incompatible build.
+ *
+ *  @retval         layout value
+ */
+static UINT32 cacheLayout (void)
+{
+    const UINT32 sizes[] =
+    {
+        sizeof(CACHE_HEADER_T), sizeof(CACHE_CONFIG_T), sizeof(CACHE_INTERFACE_T),
+        sizeof(TRDP_MEM_CONFIG_T), sizeof(TRDP_DBG_CONFIG_T), sizeof(TRDP_COM_PAR_T), sizeof(TRDP_IF_CONFIG_T),
+        sizeof(TRDP_PROCESS_CONFIG_T), sizeof(TRDP_PD_CONFIG_T), sizeof(TRDP_MD_CONFIG_T),
+        sizeof(TRDP_EXCHG_PAR_T), sizeof(TRDP_PD_PAR_T), sizeof(TRDP_MD_PAR_T), sizeof(TRDP_DEST_T),
+        sizeof(TRDP_SRC_T), sizeof(TRDP_SDT_PAR_T), sizeof(TRDP_URI_USER_T),
+        sizeof(TRDP_COMID_DSID_MAP_T), sizeof(TRDP_DATASET_T), sizeof(TRDP_DATASET_ELEMENT_T)
+    };
+
+    return vos_crc32(INITFCS, (const UINT8 *) sizes, (UINT32) sizeof(sizes));
+}
+
+/**********************************************************************************************************************/
+/** Append an object to the image.
+ *
+ *  @param[in]      pB          Image under construction
+ *  @param[in]      pData       Object to copy, NULL to append zeroes
+ *  @param[in]      size        Size of the object
+ *
+ *  @retval         offset of the object in the image, 0 on error
+ */
+static UINT32 cacheAppend (
+    CACHE_BUILDER_T *pB,
+    const void      *pData,
+    UINT32          size)
+{
+    UINT32 offset = (pB->size + CACHE_ALIGN - 1u) & ~(CACHE_ALIGN - 1u);
+
+    if (pB->err != TRDP_NO_ERR)
+    {
+        return 0u;
+    }
+
+    if (offset + size > pB->capacity)
+    {
+        UINT32  capacity = (pB->capacity == 0u) ? CACHE_INITIAL_SIZE : pB->capacity;
+        UINT8   *pBuf;
+
+        while (offset + size > capacity)
+        {
+            capacity *= 2u;
+        }
+        pBuf = (UINT8 *) realloc(pB->pBuf, capacity);
+        if (pBuf == NULL)
+        {
+            pB->err = TRDP_MEM_ERR;
+            return 0u;
+        }
+        pB->pBuf        = pBuf;
+        pB->capacity    = capacity;
+    }
+
+    memset(pB->pBuf + pB->size, 0, offset - pB->size);
+    if (pData != NULL)
+    {
+        memcpy(pB->pBuf + offset, pData, size);
+    }
+    else
+    {
+        memset(pB->pBuf + offset, 0, size);
+    }
+    pB->size = offset + size;
+    return offset;
+}
+
+/**********************************************************************************************************************/
+/** Let a pointer in the image refer to another object in the image.
+ *
+ *  @param[in]      pB          Image under construction
+ *  @param[in]      field       Offset of the pointer
+ *  @param[in]      target      Offset of the object, 0 for NULL
+ */
+static void cacheRef (
+    CACHE_BUILDER_T *pB,
+    UINT32          field,
+    UINT32          target)
+{
+    size_t value = target;
+
+    if (pB->err != TRDP_NO_ERR)
+    {
+        return;
+    }
+
+    if (target != 0u)
+    {
+        if (pB->noOfRelocs == pB->maxRelocs)
+        {
+            UINT32  maxRelocs   = (pB->maxRelocs == 0u) ? CACHE_INITIAL_RELOC : 2u * pB->maxRelocs;
+            UINT32  *pRelocs    = (UINT32 *) realloc(pB->pRelocs, maxRelocs * sizeof(UINT32));
+
+            if (pRelocs == NULL)
+            {
+                pB->err = TRDP_MEM_ERR;
+                return;
+            }
+            pB->pRelocs     = pRelocs;
+            pB->maxRelocs   = maxRelocs;
+        }
+        pB->pRelocs[pB->noOfRelocs++] = field;
+    }
+    memcpy(pB->pBuf + field, &value, sizeof(void *));
+}
+
+/**********************************************************************************************************************/
+/** Append a string to the image.
+ *
+ *  @param[in]      pB          Image under construction
+ *  @param[in]      pStr        String, may be NULL
+ *  @param[in]      minSize     Minimum size reserved for the string (e.g. size of a URI user part)
+ *
+ *  @retval         offset of the string in the image, 0 for NULL or on error
+ */
+static UINT32 cacheAppendString (
+    CACHE_BUILDER_T *pB,
+    const CHAR8     *pStr,
+    UINT32          minSize)
+{
+    UINT32  len;
+    UINT32  offset;
+
+    if (pStr == NULL)
+    {
+        return 0u;
+    }
+    len     = (UINT32) strlen(pStr) + 1u;
+    offset  = cacheAppend(pB, NULL, (len > minSize) ? len : minSize);
+    if (offset != 0u)
+    {
+        memcpy(pB->pBuf + offset, pStr, len);
+    }
+    return offset;
+}
+
+/**********************************************************************************************************************/
+/** Append an optional parameter block to the image and refer to it.
+ *
+ *  @param[in]      pB          Image under construction
+ *  @param[in]      field       Offset of the pointer to the block
+ *  @param[in]      pData       Parameter block, may be NULL
+ *  @param[in]      size        Size of the block
+ */
+static void cacheAppendRef (
+    CACHE_BUILDER_T *pB,
+    UINT32          field,
+    const void      *pData,
+    UINT32          size)
+{
+    cacheRef(pB, field, (pData != NULL) ? cacheAppend(pB, pData, size) : 0u);
+}
+
+/**********************************************************************************************************************/
+/** Append the telegram configurations of an interface to the image.
+ *
+ *  @param[in]      pB          Image under construction
+ *  @param[in]      numExchgPar Number of telegrams
+ *  @param[in]      pExchgPar   Telegram configurations read by tau_readXmlInterfaceConfig
+ *
+ *  @retval         offset of the telegram array in the image, 0 if empty or on error
+ */
+static UINT32 cacheAppendTelegrams (
+    CACHE_BUILDER_T         *pB,
+    UINT32                  numExchgPar,
+    const TRDP_EXCHG_PAR_T  *pExchgPar)
+{
+    UINT32  array, i, j;
+
+    if ((numExchgPar == 0u) || (pExchgPar == NULL))
+    {
+        return 0u;
+    }
+
+    array = cacheAppend(pB, pExchgPar, numExchgPar * (UINT32) sizeof(TRDP_EXCHG_PAR_T));
+    for (i = 0u; (i < numExchgPar) && (pB->err == TRDP_NO_ERR); i++)
+    {
+        const TRDP_EXCHG_PAR_T  *pPar   = &pExchgPar[i];
+        UINT32                  entry   = array + i * (UINT32) sizeof(TRDP_EXCHG_PAR_T);
+        UINT32                  dest    = 0u;
+        UINT32                  src     = 0u;
+
+        cacheAppendRef(pB, entry + offsetof(TRDP_EXCHG_PAR_T, pMdPar), pPar->pMdPar, sizeof(TRDP_MD_PAR_T));
+        cacheAppendRef(pB, entry + offsetof(TRDP_EXCHG_PAR_T, pPdPar), pPar->pPdPar, sizeof(TRDP_PD_PAR_T));
+
+        if ((pPar->destCnt > 0u) && (pPar->pDest != NULL))
+        {
+            dest = cacheAppend(pB, pPar->pDest, pPar->destCnt * (UINT32) sizeof(TRDP_DEST_T));
+            for (j = 0u; j < pPar->destCnt; j++)
+            {
+                const TRDP_DEST_T   *pDest  = &pPar->pDest[j];
+                UINT32              elem    = dest + j * (UINT32) sizeof(TRDP_DEST_T);
+
+                cacheAppendRef(pB, elem + offsetof(TRDP_DEST_T, pSdtPar), pDest->pSdtPar, sizeof(TRDP_SDT_PAR_T));
+                cacheRef(pB, elem + offsetof(TRDP_DEST_T, pUriUser),
+                         cacheAppendString(pB, (const CHAR8 *) pDest->pUriUser, sizeof(TRDP_URI_USER_T)));
+                cacheRef(pB, elem + offsetof(TRDP_DEST_T, pUriHost),
+                         cacheAppendString(pB, (const CHAR8 *) pDest->pUriHost, 0u));
+            }
+        }
+        cacheRef(pB, entry + offsetof(TRDP_EXCHG_PAR_T, pDest), dest);
+
+        if ((pPar->srcCnt > 0u) && (pPar->pSrc != NULL))
+        {
+            src = cacheAppend(pB, pPar->pSrc, pPar->srcCnt * (UINT32) sizeof(TRDP_SRC_T));
+            for (j = 0u; j < pPar->srcCnt; j++)
+            {
+                const TRDP_SRC_T    *pSrc   = &pPar->pSrc[j];
+                UINT32              elem    = src + j * (UINT32) sizeof(TRDP_SRC_T);
+
+                cacheAppendRef(pB, elem + offsetof(TRDP_SRC_T, pSdtPar), pSrc->pSdtPar, sizeof(TRDP_SDT_PAR_T));
+                cacheRef(pB, elem + offsetof(TRDP_SRC_T, pUriUser),
+                         cacheAppendString(pB, (const CHAR8 *) pSrc->pUriUser, sizeof(TRDP_URI_USER_T)));
+                cacheRef(pB, elem + offsetof(TRDP_SRC_T, pUriHost1),
+                         cacheAppendString(pB, (const CHAR8 *) pSrc->pUriHost1, 0u));
+                cacheRef(pB, elem + offsetof(TRDP_SRC_T, pUriHost2),
+                         cacheAppendString(pB, (const CHAR8 *) pSrc->pUriHost2, 0u));
+            }
+        }
+        cacheRef(pB, entry + offsetof(TRDP_EXCHG_PAR_T, pSrc), src);
+    }
+    return array;
+}
+
+/**********************************************************************************************************************/
+/** Compare datasets by id (order of tau_initMarshall) */
+static int cacheCompareDataset (
+    const void  *pArg1,
+    const void  *pArg2)
+{
+    const TRDP_DATASET_T    *p1 = *(TRDP_DATASET_T * const *) pArg1;
+    const TRDP_DATASET_T    *p2 = *(TRDP_DATASET_T * const *) pArg2;
+
+    return (p1->id < p2->id) ? -1 : ((p1->id > p2->id) ? 1 : 0);
+}
+
+/**********************************************************************************************************************/
+/** Compare comId/dataset pairs by comId (order of tau_initMarshall) */
+static int cacheCompareComId (
+    const void  *pArg1,
+    const void  *pArg2)
+{
+    const TRDP_COMID_DSID_MAP_T *p1 = (const TRDP_COMID_DSID_MAP_T *) pArg1;
+    const TRDP_COMID_DSID_MAP_T *p2 = (const TRDP_COMID_DSID_MAP_T *) pArg2;
+
+    return (p1->comId < p2->comId) ? -1 : ((p1->comId > p2->comId) ? 1 : 0);
+}
+
+/**********************************************************************************************************************/
+/** Append the sorted dataset configuration to the image.
+ *
+ *  @param[in]      pB          Image under construction
+ *  @param[in]      pDocHnd     XML document
+ *  @param[in,out]  pConfig     Configuration root, numComId and numDataset are set
+ *  @param[out]     pMap        Offset of the comId/dataset map
+ *  @param[out]     pDatasets   Offset of the dataset pointer array
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         other           error of tau_readXmlDatasetConfig
+ */
+static TRDP_ERR_T cacheAppendDatasets (
+    CACHE_BUILDER_T             *pB,
+    const TRDP_XML_DOC_HANDLE_T *pDocHnd,
+    CACHE_CONFIG_T              *pConfig,
+    UINT32                      *pMap,
+    UINT32                      *pDatasets)
+{
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap  = NULL;
+    apTRDP_DATASET_T        apDataset       = NULL;
+    UINT32                  i, j;
+    TRDP_ERR_T              err;
+
+    err = tau_readXmlDatasetConfig(pDocHnd, &pConfig->numComId, &pComIdDsIdMap, &pConfig->numDataset, &apDataset);
+    if (err != TRDP_NO_ERR)
+    {
+        return err;
+    }
+
+    *pMap       = 0u;
+    *pDatasets  = 0u;
+    if ((pConfig->numComId > 0u) && (pComIdDsIdMap != NULL))
+    {
+        vos_qsort(pComIdDsIdMap, pConfig->numComId, sizeof(TRDP_COMID_DSID_MAP_T), cacheCompareComId);
+        *pMap = cacheAppend(pB, pComIdDsIdMap, pConfig->numComId * (UINT32) sizeof(TRDP_COMID_DSID_MAP_T));
+    }
+    if ((pConfig->numDataset > 0u) && (apDataset != NULL))
+    {
+        vos_qsort(apDataset, pConfig->numDataset, sizeof(TRDP_DATASET_T *), cacheCompareDataset);
+        *pDatasets = cacheAppend(pB, NULL, pConfig->numDataset * (UINT32) sizeof(TRDP_DATASET_T *));
+        for (i = 0u; (i < pConfig->numDataset) && (pB->err == TRDP_NO_ERR); i++)
+        {
+            const TRDP_DATASET_T    *pDs    = apDataset[i];
+            UINT32                  ds      = cacheAppend(pB, pDs, (UINT32) (sizeof(TRDP_DATASET_T) +
+                                                                             pDs->numElement *
+                                                                             sizeof(TRDP_DATASET_ELEMENT_T)));
+
+            cacheRef(pB, *pDatasets + i * (UINT32) sizeof(TRDP_DATASET_T *), ds);
+            for (j = 0u; j < pDs->numElement; j++)
+            {
+                UINT32 elem = ds + (UINT32) (offsetof(TRDP_DATASET_T, pElement) + j * sizeof(TRDP_DATASET_ELEMENT_T));
+
+                cacheRef(pB, elem + offsetof(TRDP_DATASET_ELEMENT_T, name),
+                         cacheAppendString(pB, pDs->pElement[j].name, 0u));
+                cacheRef(pB, elem + offsetof(TRDP_DATASET_ELEMENT_T, unit),
+                         cacheAppendString(pB, pDs->pElement[j].unit, 0u));
+                cacheRef(pB, elem + offsetof(TRDP_DATASET_ELEMENT_T, pCachedDS), 0u);
+            }
+        }
+    }
+
+    tau_freeXmlDatasetConfig(pConfig->numComId, pComIdDsIdMap, pConfig->numDataset, apDataset);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Build the image from an indexed XML document using the tau_readXml... functions.
+ *
+ *  @param[in]      pB          Image under construction, empty
+ *  @param[in]      pDocHnd     XML document
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory
+ *  @retval         other           error of the tau_readXml... functions
+ */
+static TRDP_ERR_T cacheBuild (
+    CACHE_BUILDER_T             *pB,
+    const TRDP_XML_DOC_HANDLE_T *pDocHnd)
+{
+    CACHE_CONFIG_T      config;
+    TRDP_COM_PAR_T      *pComPar    = NULL;
+    TRDP_IF_CONFIG_T    *pIfConfig  = NULL;
+    UINT32              root, comPar = 0u, ifConfig = 0u, interfaces = 0u, map = 0u, datasets = 0u;
+    UINT32              i;
+    TRDP_ERR_T          err;
+
+    memset(&config, 0, sizeof(config));
+    (void) cacheAppend(pB, NULL, sizeof(CACHE_HEADER_T));
+    root        = cacheAppend(pB, NULL, sizeof(CACHE_CONFIG_T));
+    pB->config  = root;
+
+    err = tau_readXmlDeviceConfig(pDocHnd, &config.memConfig, &config.dbgConfig, &config.numComPar, &pComPar,
+                                  &config.numIfConfig, &pIfConfig);
+    if (err == TRDP_NO_ERR)
+    {
+        config.memConfig.p = NULL;
+        if ((config.numComPar > 0u) && (pComPar != NULL))
+        {
+            comPar = cacheAppend(pB, pComPar, config.numComPar * (UINT32) sizeof(TRDP_COM_PAR_T));
+        }
+        if ((config.numIfConfig > 0u) && (pIfConfig != NULL))
+        {
+            ifConfig    = cacheAppend(pB, pIfConfig, config.numIfConfig * (UINT32) sizeof(TRDP_IF_CONFIG_T));
+            interfaces  = cacheAppend(pB, NULL, config.numIfConfig * (UINT32) sizeof(CACHE_INTERFACE_T));
+        }
+    }
+
+    for (i = 0u; (err == TRDP_NO_ERR) && (pB->err == TRDP_NO_ERR) && (i < config.numIfConfig); i++)
+    {
+        CACHE_INTERFACE_T   ifEntry;
+        TRDP_EXCHG_PAR_T    *pExchgPar = NULL;
+        UINT32              entry = interfaces + i * (UINT32) sizeof(CACHE_INTERFACE_T);
+
+        memset(&ifEntry, 0, sizeof(ifEntry));
+        vos_strncpy(ifEntry.ifName, pIfConfig[i].ifName, TRDP_MAX_LABEL_LEN);
+        err = tau_readXmlInterfaceConfig(pDocHnd, pIfConfig[i].ifName, &ifEntry.processConfig,
+                                         &ifEntry.pdConfig, &ifEntry.mdConfig, &ifEntry.numExchgPar,
+                                         &pExchgPar);
+        if (err == TRDP_NO_ERR)
+        {
+            UINT32 telegrams = cacheAppendTelegrams(pB, ifEntry.numExchgPar, pExchgPar);
+
+            /* Callbacks and reference pointers are set by the application */
+            ifEntry.pdConfig.pfCbFunction = NULL;
+            ifEntry.pdConfig.pRefCon      = NULL;
+            ifEntry.mdConfig.pfCbFunction = NULL;
+            ifEntry.mdConfig.pRefCon      = NULL;
+            ifEntry.pExchgPar = NULL;
+            if (pB->err == TRDP_NO_ERR)
+            {
+                memcpy(pB->pBuf + entry, &ifEntry, sizeof(ifEntry));
+            }
+            cacheRef(pB, entry + offsetof(CACHE_INTERFACE_T, pExchgPar), telegrams);
+            tau_freeTelegrams(ifEntry.numExchgPar, pExchgPar);
+        }
+    }
+
+    if ((err == TRDP_NO_ERR) && (pB->err == TRDP_NO_ERR))
+    {
+        err = cacheAppendDatasets(pB, pDocHnd, &config, &map, &datasets);
+    }
+
+    if (pComPar != NULL)
+    {
+        vos_memFree(pComPar);
+    }
+    if (pIfConfig != NULL)
+    {
+        vos_memFree(pIfConfig);
+    }
+
+    if ((err == TRDP_NO_ERR) && (pB->err == TRDP_NO_ERR))
+    {
+        memcpy(pB->pBuf + root, &config, sizeof(config));
+        cacheRef(pB, root + offsetof(CACHE_CONFIG_T, pComPar), comPar);
+        cacheRef(pB, root + offsetof(CACHE_CONFIG_T, pIfConfig), ifConfig);
+        cacheRef(pB, root + offsetof(CACHE_CONFIG_T, pInterface), interfaces);
+        cacheRef(pB, root + offsetof(CACHE_CONFIG_T, pComIdDsIdMap), map);
+        cacheRef(pB, root + offsetof(CACHE_CONFIG_T, apDataset), datasets);
+    }
+    return (err != TRDP_NO_ERR) ? err : pB->err;
+}
+
+/**********************************************************************************************************************/
+/** Append the relocation table and complete the header.
+ *
+ *  @param[in]      pB          Image under construction
+ *  @param[in]      xmlSize     Size of the XML file
+ *  @param[in]      xmlCrc      CRC of the XML file
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory
+ */
+static TRDP_ERR_T cacheFinish (
+    CACHE_BUILDER_T *pB,
+    UINT32          xmlSize,
+    UINT32          xmlCrc)
+{
+    CACHE_HEADER_T  *pHeader;
+    UINT32          relocs = cacheAppend(pB, pB->pRelocs, pB->noOfRelocs * (UINT32) sizeof(UINT32));
+
+    if (pB->err != TRDP_NO_ERR)
+    {
+        return pB->err;
+    }
+
+    pHeader                 = (CACHE_HEADER_T *) pB->pBuf;
+    pHeader->magic          = CACHE_MAGIC;
+    pHeader->version        = CACHE_VERSION;
+    pHeader->pointerSize    = (UINT16) sizeof(void *);
+    pHeader->layout         = cacheLayout();
+    pHeader->imageSize      = pB->size;
+    pHeader->xmlSize        = xmlSize;
+    pHeader->xmlCrc         = xmlCrc;
+    pHeader->relocOffset    = relocs;
+    pHeader->noOfRelocs     = pB->noOfRelocs;
+    pHeader->configOffset   = pB->config;
+    pHeader->imageCrc       = vos_crc32(INITFCS, pB->pBuf + sizeof(CACHE_HEADER_T),
+                                        pB->size - (UINT32) sizeof(CACHE_HEADER_T));
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Check an image read from the cache file.
+ *
+ *  @param[in]      pImage      Image
+ *  @param[in]      size        Size of the image file
+ *  @param[in]      xmlSize     Size of the XML file
+ *  @param[in]      xmlCrc      CRC of the XML file
+ *
+ *  @retval         TRUE        image is valid for this XML file and this build
+ */
+static BOOL8 cacheValid (
+    const UINT8 *pImage,
+    UINT32      size,
+    UINT32      xmlSize,
+    UINT32      xmlCrc)
+{
+    const CACHE_HEADER_T *pHeader = (const CACHE_HEADER_T *) pImage;
+
+    return (size >= sizeof(CACHE_HEADER_T)) &&
+           (pHeader->magic == CACHE_MAGIC) &&
+           (pHeader->version == CACHE_VERSION) &&
+           (pHeader->pointerSize == sizeof(void *)) &&
+           (pHeader->layout == cacheLayout()) &&
+           (pHeader->imageSize == size) &&
+           (pHeader->xmlSize == xmlSize) &&
+           (pHeader->xmlCrc == xmlCrc) &&
+           (pHeader->configOffset >= sizeof(CACHE_HEADER_T)) &&
+           ((pHeader->configOffset % CACHE_ALIGN) == 0u) &&
+           (pHeader->configOffset + sizeof(CACHE_CONFIG_T) <= pHeader->relocOffset) &&
+           ((pHeader->relocOffset % sizeof(UINT32)) == 0u) &&
+           (pHeader->relocOffset <= size) &&
+           (pHeader->noOfRelocs <= (size - pHeader->relocOffset) / sizeof(UINT32)) &&
+           (vos_crc32(INITFCS, pImage + sizeof(CACHE_HEADER_T), size - (UINT32) sizeof(CACHE_HEADER_T)) ==
+            pHeader->imageCrc);
+}
+
+/**********************************************************************************************************************/
+/** Convert the offsets in the image into pointers.
+ *
+ *  @param[in]      pImage      Image, writable
+ *
+ *  @retval         TRUE        all pointers relocated
+ *  @retval         FALSE       relocation entry out of range
+ */
+static BOOL8 cacheRelocate (
+    UINT8 *pImage)
+{
+    const CACHE_HEADER_T    *pHeader    = (const CACHE_HEADER_T *) pImage;
+    const UINT32            *pRelocs    = (const UINT32 *) (pImage + pHeader->relocOffset);
+    UINT32                  i;
+
+    for (i = 0u; i < pHeader->noOfRelocs; i++)
+    {
+        size_t  target;
+        UINT8   *pTarget;
+
+        if ((pRelocs[i] < sizeof(CACHE_HEADER_T)) || (pRelocs[i] > pHeader->relocOffset - sizeof(void *)) ||
+            ((pRelocs[i] % sizeof(void *)) != 0u))
+        {
+            return FALSE;
+        }
+        memcpy(&target, pImage + pRelocs[i], sizeof(void *));
+        if ((target < sizeof(CACHE_HEADER_T)) || (target >= pHeader->relocOffset))
+        {
+            return FALSE;
+        }
+        pTarget = pImage + target;
+        memcpy(pImage + pRelocs[i], &pTarget, sizeof(void *));
+    }
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Map the cache file into memory, private and writable.
+ *
+ *  @param[in]      pCache      Cache, pImage and imageSize are set on success
+ *  @param[in]      pCacheName  Cache file name
+ *
+ *  @retval         TRUE        file mapped
+ */
+static BOOL8 cacheMap (
+    TAU_XML_CACHE_T *pCache,
+    const CHAR8     *pCacheName)
+{
+#ifdef POSIX
+    struct stat st;
+    int         fd = open(pCacheName, O_RDONLY);
+
+    if (fd == -1)
+    {
+        return FALSE;
+    }
+    if ((fstat(fd, &st) == 0) && (st.st_size > 0) && ((unsigned long long) st.st_size < 0xFFFFFFFFu))
+    {
+        void *pMap = mmap(NULL, (size_t) st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (pMap != MAP_FAILED)
+        {
+            pCache->pImage      = (UINT8 *) pMap;
+            pCache->imageSize   = (UINT32) st.st_size;
+            pCache->mapped      = 1;
+        }
+    }
+    (void) close(fd);
+#else
+    FILE *pFile = fopen(pCacheName, "rb");
+    long size;
+
+    if (pFile == NULL)
+    {
+        return FALSE;
+    }
+    if ((fseek(pFile, 0, SEEK_END) == 0) && ((size = ftell(pFile)) > 0) && (fseek(pFile, 0, SEEK_SET) == 0))
+    {
+        pCache->pImage = (UINT8 *) malloc((size_t) size);
+        if ((pCache->pImage != NULL) && (fread(pCache->pImage, 1u, (size_t) size, pFile) == (size_t) size))
+        {
+            pCache->imageSize = (UINT32) size;
+        }
+        else
+        {
+            free(pCache->pImage);
+            pCache->pImage = NULL;
+        }
+    }
+    (void) fclose(pFile);
+#endif
+    return (pCache->pImage != NULL) ? TRUE : FALSE;
+}
+
+/**********************************************************************************************************************/
+/** Release the image of the cache.
+ *
+ *  @param[in]      pCache      Cache
+ */
+static void cacheUnmap (
+    TAU_XML_CACHE_T *pCache)
+{
+#ifdef POSIX
+    if (pCache->mapped)
+    {
+        (void) munmap(pCache->pImage, pCache->imageSize);
+    }
+    else
+#endif
+    {
+        free(pCache->pImage);
+    }
+    pCache->pImage      = NULL;
+    pCache->imageSize   = 0u;
+    pCache->mapped      = 0;
+}
+
+/**********************************************************************************************************************/
+/** Write the image to the cache file.
+ *    The image is written to a temporary file first, which then replaces the cache file.
+ *
+ *  @param[in]      pCacheName  Cache file name
+ *  @param[in]      pImage      Image, not relocated
+ *  @param[in]      size        Size of the image
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory
+ *  @retval         TRDP_IO_ERR     file could not be written
+ */
+static TRDP_ERR_T cacheWrite (
+    const CHAR8 *pCacheName,
+    const UINT8 *pImage,
+    UINT32      size)
+{
+    size_t      len         = strlen(pCacheName);
+    CHAR8       *pTempName  = (CHAR8 *) malloc(len + sizeof(".tmp"));
+    FILE        *pFile;
+    TRDP_ERR_T  err         = TRDP_IO_ERR;
+
+    if (pTempName == NULL)
+    {
+        return TRDP_MEM_ERR;
+    }
+    memcpy(pTempName, pCacheName, len);
+    memcpy(pTempName + len, ".tmp", sizeof(".tmp"));
+
+    pFile = fopen(pTempName, "wb");
+    if (pFile != NULL)
+    {
+        BOOL8 written = (fwrite(pImage, 1u, size, pFile) == size) ? TRUE : FALSE;
+
+        if ((fclose(pFile) == 0) && written)
+        {
+            /* rename does not replace an existing file on every platform */
+            if ((rename(pTempName, pCacheName) == 0) ||
+                ((remove(pCacheName) == 0) && (rename(pTempName, pCacheName) == 0)))
+            {
+                err = TRDP_NO_ERR;
+            }
+        }
+        if (err != TRDP_NO_ERR)
+        {
+            (void) remove(pTempName);
+        }
+    }
+    free(pTempName);
+    return err;
+}
+
+/***********************************************************************************************************************
+ *   Globals
+ */
+
+/**********************************************************************************************************************/
+/**    Load the binary cache of an XML configuration file, build it if missing or outdated.
+ *
+ *  @param[in]      pFileName         Path and filename of the xml configuration file
+ *  @param[in]      pCacheName        Path and filename of the cache, NULL: XML file name with ".cache" appended
+ *  @param[out]     ppCache           Pointer to the loaded cache
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_MEM_ERR      out of memory
+ *  @retval         TRDP_PARAM_ERR    File does not exist or cannot be parsed
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_loadXmlCache (
+    const CHAR8         *pFileName,
+    const CHAR8         *pCacheName,
+    TAU_XML_CACHE_T     * *ppCache)
+{
+    XML_HANDLE_T            xml;
+    TRDP_XML_DOC_HANDLE_T   docHnd;
+    CACHE_BUILDER_T         builder;
+    TAU_XML_CACHE_T         *pCache;
+    CHAR8                   *pDefaultName = NULL;
+    UINT32                  xmlCrc;
+    TRDP_ERR_T              err = TRDP_NO_ERR;
+
+    if ((pFileName == NULL) || (strlen(pFileName) == 0u) || (ppCache == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    *ppCache = NULL;
+
+    if (trdp_XMLLoad(&xml, pFileName) != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "Load XML cache: failed to open XML file %s\n", pFileName);
+        return TRDP_PARAM_ERR;
+    }
+    xmlCrc = vos_crc32(INITFCS, (const UINT8 *) xml.pDoc, xml.docSize);
+
+    pCache = (TAU_XML_CACHE_T *) malloc(sizeof(TAU_XML_CACHE_T));
+    if (pCache == NULL)
+    {
+        trdp_XMLClose(&xml);
+        return TRDP_MEM_ERR;
+    }
+    memset(pCache, 0, sizeof(TAU_XML_CACHE_T));
+
+    if (pCacheName == NULL)
+    {
+        size_t len = strlen(pFileName);
+
+        pDefaultName = (CHAR8 *) malloc(len + sizeof(CACHE_SUFFIX));
+        if (pDefaultName == NULL)
+        {
+            free(pCache);
+            trdp_XMLClose(&xml);
+            return TRDP_MEM_ERR;
+        }
+        memcpy(pDefaultName, pFileName, len);
+        memcpy(pDefaultName + len, CACHE_SUFFIX, sizeof(CACHE_SUFFIX));
+        pCacheName = pDefaultName;
+    }
+
+    /*  Use the cache file if it was built from this XML file   */
+    if (cacheMap(pCache, pCacheName) &&
+        (!cacheValid(pCache->pImage, pCache->imageSize, xml.docSize, xmlCrc) || !cacheRelocate(pCache->pImage)))
+    {
+        cacheUnmap(pCache);
+    }
+
+    /*  Otherwise parse the XML file and rebuild the cache  */
+    if (pCache->pImage == NULL)
+    {
+        memset(&builder, 0, sizeof(builder));
+        docHnd.pXmlDocument = &xml;
+
+        if (trdp_XMLIndex(&xml) != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_ERROR, "Load XML cache: failed to parse XML file %s\n", pFileName);
+            err = TRDP_PARAM_ERR;
+        }
+        else
+        {
+            err = cacheBuild(&builder, &docHnd);
+            if (err == TRDP_NO_ERR)
+            {
+                err = cacheFinish(&builder, xml.docSize, xmlCrc);
+            }
+            if ((err == TRDP_NO_ERR) && (cacheWrite(pCacheName, builder.pBuf, builder.size) != TRDP_NO_ERR))
+            {
+                vos_printLog(VOS_LOG_WARNING, "Load XML cache: failed to write %s, using the cache in memory\n",
+                             pCacheName);
+            }
+        }
+        free(builder.pRelocs);
+
+        if ((err == TRDP_NO_ERR) && cacheRelocate(builder.pBuf))
+        {
+            pCache->pImage      = builder.pBuf;
+            pCache->imageSize   = builder.size;
+        }
+        else
+        {
+            free(builder.pBuf);
+            err = (err != TRDP_NO_ERR) ? err : TRDP_MEM_ERR;
+        }
+    }
+
+    trdp_XMLClose(&xml);
+    free(pDefaultName);
+
+    if (err != TRDP_NO_ERR)
+    {
+        free(pCache);
+        return err;
+    }
+    pCache->pConfig = (const CACHE_CONFIG_T *) (pCache->pImage +
+                                                ((const CACHE_HEADER_T *) pCache->pImage)->configOffset);
+    *ppCache = pCache;
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Release a cache loaded by tau_loadXmlCache
+ *
+ *  @param[in]      pCache            Cache
+ *
+ */
+EXT_DECL void tau_freeXmlCache (
+    TAU_XML_CACHE_T *pCache)
+{
+    if (pCache != NULL)
+    {
+        cacheUnmap(pCache);
+        free(pCache);
+    }
+}
+
+/**********************************************************************************************************************/
+/**    Device configuration from the cache, see tau_readXmlDeviceConfig.
+ *
+ *  @param[in]      pCache            Cache loaded by tau_loadXmlCache
+ *  @param[out]     pMemConfig        Memory configuration
+ *  @param[out]     pDbgConfig        Debug printout configuration for application use
+ *  @param[out]     pNumComPar        Number of configured com parameters
+ *  @param[out]     ppComPar          Pointer to array of com parameters, owned by the cache
+ *  @param[out]     pNumIfConfig      Number of configured interfaces
+ *  @param[out]     ppIfConfig        Pointer to an array of interface parameter sets, owned by the cache
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readXmlCacheDeviceConfig (
+    const TAU_XML_CACHE_T   *pCache,
+    TRDP_MEM_CONFIG_T       *pMemConfig,
+    TRDP_DBG_CONFIG_T       *pDbgConfig,
+    UINT32                  *pNumComPar,
+    TRDP_COM_PAR_T          * *ppComPar,
+    UINT32                  *pNumIfConfig,
+    TRDP_IF_CONFIG_T        * *ppIfConfig)
+{
+    if ((pCache == NULL) || (pMemConfig == NULL) || (pDbgConfig == NULL) || (pNumComPar == NULL) ||
+        (ppComPar == NULL) || (pNumIfConfig == NULL) || (ppIfConfig == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    *pMemConfig     = pCache->pConfig->memConfig;
+    *pDbgConfig     = pCache->pConfig->dbgConfig;
+    *pNumComPar     = pCache->pConfig->numComPar;
+    *ppComPar       = pCache->pConfig->pComPar;
+    *pNumIfConfig   = pCache->pConfig->numIfConfig;
+    *ppIfConfig     = pCache->pConfig->pIfConfig;
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Interface configuration from the cache, see tau_readXmlInterfaceConfig.
+ *
+ *  @param[in]      pCache            Cache loaded by tau_loadXmlCache
+ *  @param[in]      pIfName           Interface name, empty for the first interface
+ *  @param[out]     pProcessConfig    TRDP process (session) configuration for the interface
+ *  @param[out]     pPdConfig         PD default configuration for the interface
+ *  @param[out]     pMdConfig         MD default configuration for the interface
+ *  @param[out]     pNumExchgPar      Number of configured telegrams
+ *  @param[out]     ppExchgPar        Pointer to array of telegram configurations, owned by the cache
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error or interface not configured
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readXmlCacheInterfaceConfig (
+    const TAU_XML_CACHE_T   *pCache,
+    const CHAR8             *pIfName,
+    TRDP_PROCESS_CONFIG_T   *pProcessConfig,
+    TRDP_PD_CONFIG_T        *pPdConfig,
+    TRDP_MD_CONFIG_T        *pMdConfig,
+    UINT32                  *pNumExchgPar,
+    TRDP_EXCHG_PAR_T        * *ppExchgPar)
+{
+    const CACHE_INTERFACE_T *pInterface = NULL;
+    UINT32                  i;
+
+    if ((pCache == NULL) || (pIfName == NULL) || (pPdConfig == NULL) || (pMdConfig == NULL) ||
+        (pNumExchgPar == NULL) || (ppExchgPar == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    for (i = 0u; (i < pCache->pConfig->numIfConfig) && (pInterface == NULL); i++)
+    {
+        if ((strlen(pIfName) == 0u) ||
+            (vos_strnicmp(pIfName, pCache->pConfig->pInterface[i].ifName, TRDP_MAX_LABEL_LEN) == 0))
+        {
+            pInterface = &pCache->pConfig->pInterface[i];
+        }
+    }
+    if (pInterface == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (pProcessConfig != NULL)
+    {
+        *pProcessConfig = pInterface->processConfig;
+    }
+    *pPdConfig      = pInterface->pdConfig;
+    *pMdConfig      = pInterface->mdConfig;
+    *pNumExchgPar   = pInterface->numExchgPar;
+    *ppExchgPar     = pInterface->pExchgPar;
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Dataset configuration from the cache, see tau_readXmlDatasetConfig.
+ *    Both arrays are sorted as needed by tau_initMarshall.
+ *
+ *  @param[in]      pCache            Cache loaded by tau_loadXmlCache
+ *  @param[out]     pNumComId         Pointer to the number of entries in the ComId DatasetId mapping list
+ *  @param[out]     ppComIdDsIdMap    Pointer to the ComId DatasetId mapping list, owned by the cache
+ *  @param[out]     pNumDataset       Pointer to the number of datasets found in the configuration
+ *  @param[out]     papDataset        Pointer to the array of pointers to the datasets, owned by the cache
+ *
+ *  @retval         TRDP_NO_ERR       no error
+ *  @retval         TRDP_PARAM_ERR    parameter error
+ *
+ */
+EXT_DECL TRDP_ERR_T tau_readXmlCacheDatasetConfig (
+    const TAU_XML_CACHE_T   *pCache,
+    UINT32                  *pNumComId,
+    TRDP_COMID_DSID_MAP_T   * *ppComIdDsIdMap,
+    UINT32                  *pNumDataset,
+    papTRDP_DATASET_T       papDataset)
+{
+    if ((pCache == NULL) || (pNumComId == NULL) || (ppComIdDsIdMap == NULL) || (pNumDataset == NULL) ||
+        (papDataset == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    *pNumComId      = pCache->pConfig->numComId;
+    *ppComIdDsIdMap = pCache->pConfig->pComIdDsIdMap;
+    *pNumDataset    = pCache->pConfig->numDataset;
+    *papDataset     = pCache->pConfig->apDataset;
+    return TRDP_NO_ERR;
+}
@@ -22,6 +22,8 @@
  *          Copyright 2019 University of Rostock
  *
  * $Id$
+ *
+ *      AG 2026-10-16: Configuration files are loaded through the binary configuration cache
  */
 
 #include "tau_xsession.h"
@@ -47,6 +49,7 @@ static struct xsession_common {
 	UINT32                 numComPar;
 	TRDP_COM_PAR_T         comPar[MAX_COMPAR];
 	TRDP_XML_DOC_HANDLE_T  devDocHnd;
+	TAU_XML_CACHE_T       *pCache;   /* configuration from a file, instead of devDocHnd */
 	TRDP_MEM_CONFIG_T      memConfig;
 
 /*  Log configuration   */
@@ -185,10 +188,12 @@ static void dbgOut (void *pRefCon, TRDP_LOG_T category, const CHAR8 *pTime, cons
 static TRDP_ERR_T initMarshalling(const TRDP_XML_DOC_HANDLE_T * pDocHnd, const UINT8 *pXTypeMap) {
 	TRDP_ERR_T result;
 
-	if ( !pDocHnd ) return TRDP_PARAM_ERR;
+	if ( !pDocHnd && !_.pCache ) return TRDP_PARAM_ERR;
 
-	/*  Read dataset configuration  */
-	result = tau_readXmlDatasetConfig(pDocHnd, &_.numComId, &_.pComIdDsIdMap, &_.numDataset, &_.apDataset);
+	/*  Read dataset configuration, the cached one is sorted already and owned by the cache  */
+	result = _.pCache
+			? tau_readXmlCacheDatasetConfig(_.pCache, &_.numComId, &_.pComIdDsIdMap, &_.numDataset, &_.apDataset)
+			: tau_readXmlDatasetConfig(pDocHnd, &_.numComId, &_.pComIdDsIdMap, &_.numDataset, &_.apDataset);
 	if (result != TRDP_NO_ERR) {
 		vos_printLog(VOS_LOG_ERROR, "Failed to read dataset configuration: ""%s", tau_getResultString(result));
 		return result;
@@ -207,11 +212,11 @@ static TRDP_ERR_T initMarshalling(const TRDP_XML_DOC_HANDLE_T * pDocHnd, const U
 		result = tau_xinitMarshall(NULL /*cur. a nop*/, _.numComId, _.pComIdDsIdMap, _.numDataset, _.apDataset, pXTypeMap);
 		vos_printLogStr(VOS_LOG_INFO, "Using EXTENDED marshalling.");
 	} else {
-		result = tau_initMarshall( NULL /*cur. a nop*/, _.numComId, _.pComIdDsIdMap, _.numDataset, _.apDataset);
+		result = tau_initMarshall(&_.marshallCfg.pRefCon, _.numComId, _.pComIdDsIdMap, _.numDataset, _.apDataset);
 		vos_printLogStr(VOS_LOG_INFO, "Using default marshalling.");
 	}
 	if (result != TRDP_NO_ERR) {
-		tau_freeXmlDatasetConfig(_.numComId, _.pComIdDsIdMap, _.numDataset, _.apDataset);
+		if (!_.pCache) tau_freeXmlDatasetConfig(_.numComId, _.pComIdDsIdMap, _.numDataset, _.apDataset);
 		_.numComId = 0;
 		_.pComIdDsIdMap = NULL;
 		_.numDataset = 0;
@@ -223,7 +228,7 @@ static TRDP_ERR_T initMarshalling(const TRDP_XML_DOC_HANDLE_T * pDocHnd, const U
 	/*  Strore pointers to marshalling functions    */
 	_.marshallCfg.pfCbMarshall   = xmap_valid ? tau_xmarshall : tau_marshall;
 	_.marshallCfg.pfCbUnmarshall = xmap_valid ? tau_xunmarshall : tau_unmarshall;
-	_.marshallCfg.pRefCon = NULL; /* if we overwrite with own functions, pRefCon may be set to @our or something like it */
+	if (xmap_valid) _.marshallCfg.pRefCon = NULL; /* if we overwrite with own functions, pRefCon may be set to @our or something like it */
 
 	vos_printLog(VOS_LOG_INFO, "Initialized %cmarshalling for %u datasets, %u ComId to Dataset Id relations",
 			xmap_valid?'x':' ',	_.numDataset, _.numComId);
@@ -474,7 +479,13 @@ static TRDP_ERR_T configureSession(TAU_XSESSION_T *our, TRDP_XML_DOC_HANDLE_T *p
 
 	vos_printLog(VOS_LOG_INFO, "Configuring session for interface %s", our->pIfConfig->ifName);
 	/*  Read telegrams configured for the interface */
-	result = tau_readXmlInterfaceConfig(
+	result = _.pCache
+		? tau_readXmlCacheInterfaceConfig(
+			_.pCache, our->pIfConfig->ifName,
+			&our->processConfig,
+			&our->pdConfig, &our->mdConfig,
+			&our->numExchgPar, &our->pExchgPar)
+		: tau_readXmlInterfaceConfig(
 			pDocHnd, our->pIfConfig->ifName,
 			&our->processConfig,
 			&our->pdConfig, &our->mdConfig,
@@ -498,7 +509,7 @@ static TRDP_ERR_T configureSession(TAU_XSESSION_T *our, TRDP_XML_DOC_HANDLE_T *p
 				our->pIfConfig->ifName, tau_getResultString(result));
 		/* some clean up */
 		/*  Free allocated memory - parsed telegram configuration */
-		tau_freeTelegrams(our->numExchgPar, our->pExchgPar);
+		if (!_.pCache) tau_freeTelegrams(our->numExchgPar, our->pExchgPar);
 		our->numExchgPar = 0;
 		our->pExchgPar = NULL;
 
@@ -513,7 +524,7 @@ static TRDP_ERR_T configureSession(TAU_XSESSION_T *our, TRDP_XML_DOC_HANDLE_T *p
 TRDP_ERR_T tau_xsession_load(const char *xml, size_t length, TAU_XSESSION_PRINT dbg_print, const UINT8 *pXTypeMap) {
 	TRDP_ERR_T result;
 
-	if (_.devDocHnd.pXmlDocument || _.use >= 0) return TRDP_INIT_ERR; /* must close first */
+	if (_.devDocHnd.pXmlDocument || _.pCache || _.use >= 0) return TRDP_INIT_ERR; /* must close first */
 	/*  Dataset configuration from xml configuration file */
 
 	_.numComId = 0u;
@@ -534,14 +545,19 @@ TRDP_ERR_T tau_xsession_load(const char *xml, size_t length, TAU_XSESSION_PRINT
 	 /* as of 2019, memInit has some weird default behaviour and really needs a refactor, fall-through to mallox */
 	result = vos_memInit(NULL, 0, NULL);
 	if (result == TRDP_NO_ERR) {
-		/*  Prepare XML document    */
-		result = length ? tau_prepareXmlMem(xml,  length,  &_.devDocHnd) : tau_prepareXmlDoc(xml, &_.devDocHnd);
+		/*  Prepare XML document, files are read through the binary cache (heap memory, survives vos_memDelete)  */
+		result = length ? tau_prepareXmlMem(xml,  length,  &_.devDocHnd) : tau_loadXmlCache(xml, NULL, &_.pCache);
 		if (result != TRDP_NO_ERR) {
 			vos_printLog(VOS_LOG_ERROR, "Failed to prepare XML document (%s/%zu): %s", xml, length, tau_getResultString(result));
 		} else {
 
 			/*  Read general parameters from XML configuration*/
-			result = tau_readXmlDeviceConfig( &_.devDocHnd,
+			result = _.pCache
+				? tau_readXmlCacheDeviceConfig( _.pCache,
+					&_.memConfig, &_.dbgConfig,
+					&_.numComPar, &pTempComPar,
+					&_.numIfConfig, &pTempIfConfig)
+				: tau_readXmlDeviceConfig( &_.devDocHnd,
 					&_.memConfig, &_.dbgConfig,
 					&_.numComPar, &pTempComPar,
 					&_.numIfConfig, &pTempIfConfig);
@@ -563,10 +579,14 @@ TRDP_ERR_T tau_xsession_load(const char *xml, size_t length, TAU_XSESSION_PRINT
 				} else {
 					if (pTempIfConfig && _.numIfConfig) memcpy(_.ifConfig, pTempIfConfig, sizeof(TRDP_IF_CONFIG_T)*_.numIfConfig); else _.numIfConfig = 0;
 					if (pTempComPar   && _.numComPar  ) memcpy(_.comPar,   pTempComPar,   sizeof(TRDP_COM_PAR_T)*_.numComPar); else _.numComPar = 0;
-					tempXML = *_.devDocHnd.pXmlDocument;
+					if (!_.pCache) tempXML = *_.devDocHnd.pXmlDocument;
 				}
 			}
-			if (result != TRDP_NO_ERR) tau_freeXmlDoc(&_.devDocHnd);
+			if (result != TRDP_NO_ERR) {
+				if (_.devDocHnd.pXmlDocument) tau_freeXmlDoc(&_.devDocHnd);
+				tau_freeXmlCache(_.pCache);
+				_.pCache = NULL;
+			}
 		}
 		vos_memDelete(NULL); /* free above allocated memArea, as tlc_init will create a new one :/ */
 	}
@@ -589,17 +609,23 @@ TRDP_ERR_T tau_xsession_load(const char *xml, size_t length, TAU_XSESSION_PRINT
 	result = tlc_init(dbgOut, &_.dbgConfig, &_.memConfig);
 	if (result != TRDP_NO_ERR) {
 //		free(_.memConfig.p);
+		tau_freeXmlCache(_.pCache);
+		_.pCache = NULL;
 		vos_printLog(VOS_LOG_ERROR, "Failed to initialize TRDP stack: ""%s", tau_getResultString(result));
 	} else {
 		/* restore XML holder */
-		_.devDocHnd.pXmlDocument = (XML_HANDLE_T *) vos_memAlloc(sizeof(XML_HANDLE_T));
-		if (_.devDocHnd.pXmlDocument == NULL) return TRDP_MEM_ERR;
-		*_.devDocHnd.pXmlDocument = tempXML;
+		if (!_.pCache) {
+			_.devDocHnd.pXmlDocument = (XML_HANDLE_T *) vos_memAlloc(sizeof(XML_HANDLE_T));
+			if (_.devDocHnd.pXmlDocument == NULL) return TRDP_MEM_ERR;
+			*_.devDocHnd.pXmlDocument = tempXML;
+		}
 
 		/*  Read dataset configuration, initialize marshalling  */
 		result = initMarshalling(&_.devDocHnd, pXTypeMap);
 		if (result != TRDP_NO_ERR) {
-			tau_freeXmlDoc(&_.devDocHnd);
+			if (_.devDocHnd.pXmlDocument) tau_freeXmlDoc(&_.devDocHnd);
+			tau_freeXmlCache(_.pCache);
+			_.pCache = NULL;
 			tlc_terminate();
 //			free(_.memConfig.p);
 			_.use = -1;
@@ -613,7 +639,7 @@ TRDP_ERR_T tau_xsession_init(TAU_XSESSION_T **our, const char *busInterfaceName,
 	TRDP_ERR_T result = TRDP_INIT_ERR;
 
 	/*  Log configuration   */
-	if (!_.devDocHnd.pXmlDocument || _.use < 0) {
+	if ((!_.devDocHnd.pXmlDocument && !_.pCache) || _.use < 0) {
 		vos_printLogStr(VOS_LOG_ERROR, "XML device configuration not available.");
 		return result;
 	}
@@ -973,7 +999,7 @@ TRDP_ERR_T tau_xsession_delete(TAU_XSESSION_T *our) {
 		tlc_closeSession(s->sessionhandle);
 
 		/*  Free allocated memory - parsed telegram configuration */
-		tau_freeTelegrams(s->numExchgPar, s->pExchgPar);
+		if (!_.pCache) tau_freeTelegrams(s->numExchgPar, s->pExchgPar);
 		s->numExchgPar = 0;
 		s->pExchgPar = NULL;
 		_.use--;
@@ -983,13 +1009,17 @@ TRDP_ERR_T tau_xsession_delete(TAU_XSESSION_T *our) {
 	}
 
 	if (!_.use) {
-		tau_freeXmlDatasetConfig(_.numComId, _.pComIdDsIdMap, _.numDataset, _.apDataset);
+		if (_.marshallCfg.pRefCon) tau_deInitMarshall(_.marshallCfg.pRefCon);
+		_.marshallCfg.pRefCon = NULL;
+		if (!_.pCache) tau_freeXmlDatasetConfig(_.numComId, _.pComIdDsIdMap, _.numDataset, _.apDataset);
 		_.session = NULL;
 		_.numComId = 0;
 		_.pComIdDsIdMap = NULL;
 		_.numDataset = 0;
 		_.apDataset = NULL;
-		tau_freeXmlDoc(&_.devDocHnd);
+		if (_.devDocHnd.pXmlDocument) tau_freeXmlDoc(&_.devDocHnd);
+		tau_freeXmlCache(_.pCache);
+		_.pCache = NULL;
 		tlc_terminate();
 		_.use--;
 	}
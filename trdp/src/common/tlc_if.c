@@ -17,6 +17,17 @@
 /*
 * $Id$
 *
+*      AG 2026-10-16: tlc_getInterval() and tlc_processEvents() read the timeout heap with mutexRxPD held
+*      AG 2026-10-16: tlc_updateSession() empties the send heap of the set-up phase (indexed builds)
+*      AG 2026-10-16: Free the states of the MD messages received in chunks on tlc_closeSession()
+*      AG 2026-10-16: tlc_getInterval() and tlc_processEvents() wait for the next MD deadline, free the MD deadline heap
+*      AG 2026-10-16: Free the MD listener index on tlc_closeSession()
+*      AG 2026-10-16: Free the MD session hash indexes on tlc_closeSession()
+*      AG 2026-10-16: Free the frames lent by tlp_getRef() or reserved by tlp_reserve() on tlc_closeSession()
+*      AG 2026-10-16: tlc_processEvents() added, waits on a socket event set instead of select()
+*      AG 2026-10-16: Free the timeout heap on tlc_closeSession()
+*      AG 2026-10-16: Free the subscription hash index on tlc_closeSession()
+*      AG 2026-10-16: Allocate a batch of receive frames per session (trdp_freeRcvFrames added)
 *     CWE 2023-01-27: Log compile-options and vos-version upon tlc_init()
 *     AHW 2023-01-11: Lint warnigs
 *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
@@ -141,6 +152,15 @@ BOOL8               trdp_isValidSession (TRDP_APP_SESSION_T pSessionHandle);
 TRDP_APP_SESSION_T  *trdp_sessionQueue (void);
 TRDP_ERR_T          trdp_getAccess (TRDP_APP_SESSION_T  pSessionHandle, int force);
 void                trdp_releaseAccess (TRDP_APP_SESSION_T pSessionHandle);
+static void         trdp_freeRcvFrames (TRDP_SESSION_PT pSession);
+#ifndef HIGH_PERF_INDEXED
+static void         tlc_syncEvents (TRDP_SESSION_PT appHandle);
+#if MD_SUPPORT
+static void         tlc_mdNextJob (TRDP_SESSION_PT appHandle);
+#endif
+static TRDP_ERR_T   tlc_processSession (TRDP_SESSION_PT appHandle, TRDP_FDS_T *pRfds, INT32 *pCount,
+                                        const UINT32 *pTags, UINT32 noOfTags);
+#endif
 
 /***********************************************************************************************************************
  * GLOBAL FUNCTIONS
@@ -275,6 +295,159 @@ void  trdp_releaseAccess (TRDP_APP_SESSION_T appHandle)
     }
 }
 
+/**********************************************************************************************************************/
+/** Free the PD receive frames of a session
+ *
+ *  @param[in]      pSession            session owning the frames
+ */
+static void trdp_freeRcvFrames (TRDP_SESSION_PT pSession)
+{
+    UINT32 idx;
+
+    for (idx = 0u; idx < TRDP_PD_RCV_BATCH_SIZE; idx++)
+    {
+        if (pSession->pNewFrame[idx] != NULL)
+        {
+            vos_memFree(pSession->pNewFrame[idx]);
+            pSession->pNewFrame[idx] = NULL;
+        }
+    }
+}
+
+#ifndef HIGH_PERF_INDEXED
+#if MD_SUPPORT
+/**********************************************************************************************************************/
+/** Advance the next job time of a session to the next MD deadline, if it is earlier
+ *
+ *  @param[in]      appHandle           session pointer, session mutex must be held
+ */
+static void tlc_mdNextJob (TRDP_SESSION_PT appHandle)
+{
+    TRDP_TIME_T mdJob;
+
+    if (vos_mutexLock(appHandle->mutexMD) == VOS_NO_ERR)
+    {
+        if ((trdp_mdNextJob(appHandle, &mdJob) == TRUE) &&
+            (!timerisset(&appHandle->nextJob) || timercmp(&mdJob, &appHandle->nextJob, <)))
+        {
+            appHandle->nextJob = mdJob;
+        }
+        if (vos_mutexUnlock(appHandle->mutexMD) != VOS_NO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
+    }
+}
+#endif
+
+/**********************************************************************************************************************/
+/** Register the receiving sockets of a session in its event set
+ *  The sockets are registered once. The set is only rebuilt if a socket was opened, replaced or closed since
+ *  the last call. If the target does not support event sets, the session is marked and nothing is registered.
+ *
+ *  @param[in]      appHandle           session pointer, session mutex must be held
+ */
+static void tlc_syncEvents (TRDP_SESSION_PT appHandle)
+{
+    TRDP_EVENTS_T   *pEvents    = &appHandle->events;
+    BOOL8           changed     = (pEvents->handle == NULL) || (pEvents->closeCnt != trdp_getSocketCloseCnt());
+    VOS_SOCK_T      pd[TRDP_MAX_PD_SOCKET_CNT];
+    UINT32          idx;
+#if MD_SUPPORT
+    VOS_SOCK_T      md[TRDP_MAX_MD_SOCKET_CNT];
+    VOS_SOCK_T      listen = appHandle->tcpFd.listen_sd;
+#endif
+
+    if (pEvents->unsupported)
+    {
+        return;
+    }
+
+    /*  Collect the sockets which have to be watched, the same ones trdp_pdCheckPending/trdp_mdCheckPending
+        would add to the descriptor set */
+    for (idx = 0u; idx < TRDP_MAX_PD_SOCKET_CNT; idx++)
+    {
+        pd[idx] = VOS_INVALID_SOCKET;
+        if ((idx < (UINT32) trdp_getCurrentMaxSocketCnt(TRDP_SOCK_PD)) &&
+            (appHandle->ifacePD[idx].sock != VOS_INVALID_SOCKET) &&
+            (appHandle->ifacePD[idx].rcvMostly == TRUE))
+        {
+            pd[idx] = appHandle->ifacePD[idx].sock;
+        }
+        if (pd[idx] != pEvents->pd[idx])
+        {
+            changed = TRUE;
+        }
+    }
+#if MD_SUPPORT
+    for (idx = 0u; idx < TRDP_MAX_MD_SOCKET_CNT; idx++)
+    {
+        md[idx] = VOS_INVALID_SOCKET;
+        if ((idx < (UINT32) trdp_getCurrentMaxSocketCnt(TRDP_SOCK_MD_UDP)) &&
+            (appHandle->ifaceMD[idx].sock != VOS_INVALID_SOCKET) &&
+            (appHandle->ifaceMD[idx].type != TRDP_SOCK_PD) &&
+            ((appHandle->ifaceMD[idx].type != TRDP_SOCK_MD_TCP) ||
+             (appHandle->ifaceMD[idx].tcpParams.addFileDesc == TRUE)))
+        {
+            md[idx] = appHandle->ifaceMD[idx].sock;
+        }
+        if (md[idx] != pEvents->md[idx])
+        {
+            changed = TRUE;
+        }
+    }
+    if (listen != pEvents->listen)
+    {
+        changed = TRUE;
+    }
+#endif
+
+    if (!changed)
+    {
+        return;
+    }
+
+    /*  Closed descriptors have left the set silently and may have been reused, start from scratch   */
+    vos_sockEventsDelete(pEvents->handle);
+    pEvents->handle = NULL;
+    if (vos_sockEventsCreate(&pEvents->handle) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "Socket event sets not supported, tlc_processEvents() uses select()\n");
+        pEvents->handle         = NULL;
+        pEvents->unsupported    = TRUE;
+        return;
+    }
+    pEvents->closeCnt = trdp_getSocketCloseCnt();
+
+    for (idx = 0u; idx < TRDP_MAX_PD_SOCKET_CNT; idx++)
+    {
+        pEvents->pd[idx] = pd[idx];
+        if ((pd[idx] != VOS_INVALID_SOCKET) &&
+            (vos_sockEventsAdd(pEvents->handle, pd[idx], TRDP_EVENT_TAG_PD | idx) != VOS_NO_ERR))
+        {
+            vos_printLog(VOS_LOG_ERROR, "vos_sockEventsAdd() failed (Socket: %d)\n", vos_sockId(pd[idx]));
+        }
+    }
+#if MD_SUPPORT
+    for (idx = 0u; idx < TRDP_MAX_MD_SOCKET_CNT; idx++)
+    {
+        pEvents->md[idx] = md[idx];
+        if ((md[idx] != VOS_INVALID_SOCKET) &&
+            (vos_sockEventsAdd(pEvents->handle, md[idx], TRDP_EVENT_TAG_MD | idx) != VOS_NO_ERR))
+        {
+            vos_printLog(VOS_LOG_ERROR, "vos_sockEventsAdd() failed (Socket: %d)\n", vos_sockId(md[idx]));
+        }
+    }
+    pEvents->listen = listen;
+    if ((listen != VOS_INVALID_SOCKET) &&
+        (vos_sockEventsAdd(pEvents->handle, listen, TRDP_EVENT_TAG_LISTEN) != VOS_NO_ERR))
+    {
+        vos_printLog(VOS_LOG_ERROR, "vos_sockEventsAdd() failed (Socket: %d)\n", vos_sockId(listen));
+    }
+#endif
+}
+#endif
+
 /**********************************************************************************************************************/
 /** Get the interface address
  *
@@ -465,6 +638,7 @@ EXT_DECL TRDP_ERR_T tlc_openSession (
     TRDP_SESSION_PT pSession    = NULL;
     TRDP_PUB_T      dummyPubHndl    = NULL;
     TRDP_SUB_T      dummySubHandle  = NULL;
+    UINT32          idx;
 
     if (pAppHandle == NULL)
     {
@@ -522,6 +696,7 @@ EXT_DECL TRDP_ERR_T tlc_openSession (
     pSession->mdDefault.sendParam.ttl       = TRDP_MD_DEFAULT_TTL;
     pSession->mdDefault.sendParam.retries   = TRDP_MD_DEFAULT_RETRIES;
     pSession->mdDefault.maxNumSessions      = TRDP_MD_MAX_NUM_SESSIONS;
+    pSession->mdDefault.stream              = FALSE;
     pSession->tcpFd.listen_sd               = VOS_INVALID_SOCKET;
 
 #endif
@@ -565,13 +740,17 @@ EXT_DECL TRDP_ERR_T tlc_openSession (
     pSession->stats.ownIpAddr       = ownIpAddr;
     pSession->stats.leaderIpAddr    = leaderIpAddr;
 
-    /*  Get a buffer to receive PD   */
-    pSession->pNewFrame = (PD_PACKET_T *) vos_memAlloc(TRDP_MAX_PD_PACKET_SIZE);
-    if (pSession->pNewFrame == NULL)
+    /*  Get the buffers to receive PD   */
+    for (idx = 0u; idx < TRDP_PD_RCV_BATCH_SIZE; idx++)
     {
-        vos_memFree(pSession);
-        vos_printLogStr(VOS_LOG_ERROR, "Out of meory!\n");
-        return TRDP_MEM_ERR;
+        pSession->pNewFrame[idx] = (PD_PACKET_T *) vos_memAlloc(TRDP_MAX_PD_PACKET_SIZE);
+        if (pSession->pNewFrame[idx] == NULL)
+        {
+            trdp_freeRcvFrames(pSession);
+            vos_memFree(pSession);
+            vos_printLogStr(VOS_LOG_ERROR, "Out of meory!\n");
+            return TRDP_MEM_ERR;
+        }
     }
 
     /*    Queue the session in    */
@@ -579,7 +758,7 @@ EXT_DECL TRDP_ERR_T tlc_openSession (
 
     if (ret != TRDP_NO_ERR)
     {
-        vos_memFree(pSession->pNewFrame);
+        trdp_freeRcvFrames(pSession);
         vos_memFree(pSession);
         vos_printLog(VOS_LOG_ERROR, "vos_mutexLock() failed (Err: %d)\n", ret);
     }
@@ -859,6 +1038,8 @@ EXT_DECL TRDP_ERR_T tlc_configSession (
             pSession->mdDefault.maxNumSessions = pMdDefault->maxNumSessions;
         }
 
+        pSession->mdDefault.stream = (pMdDefault->stream == TRUE) ? TRUE : FALSE;
+
     }
 
     /* Set some statistic defaults here */
@@ -907,6 +1088,8 @@ EXT_DECL TRDP_ERR_T tlc_updateSession (
         ret = trdp_indexCreatePubTables(appHandle);
         if (ret == TRDP_NO_ERR)
         {
+            /* the index tables take over sending: empty the send heap of the set-up phase */
+            trdp_pdRescheduleSend(appHandle);
             ret = trdp_indexCreateSubTables(appHandle);
         }
         trdp_releaseAccess(appHandle);
@@ -1052,7 +1235,7 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                 trdp_indexDeInit(pSession);
 #endif
                 /*    Release all allocated sockets and memory    */
-                vos_memFree(pSession->pNewFrame);
+                trdp_freeRcvFrames(pSession);
 
                 while (pSession->pSndQueue != NULL)
                 {
@@ -1065,6 +1248,7 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     {
                         vos_memFree(pSession->pSndQueue->pSeqCntList);
                     }
+                    trdp_pdFreeLent(pSession->pSndQueue);
                     vos_memFree(pSession->pSndQueue->pFrame);
 
                     /*    Only close socket if not used anymore    */
@@ -1085,6 +1269,7 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     {
                         vos_memFree(pSession->pRcvQueue->pSeqCntList);
                     }
+                    trdp_pdFreeLent(pSession->pRcvQueue);
                     if (pSession->pRcvQueue->pFrame != NULL)
                     {
                         vos_memFree(pSession->pRcvQueue->pFrame);
@@ -1092,6 +1277,8 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     vos_memFree(pSession->pRcvQueue);
                     pSession->pRcvQueue = pNext;
                 }
+                trdp_subHashFree(pSession);
+                trdp_pdFreeTimeouts(pSession);
 
 #if MD_SUPPORT
                 if (pSession->pMDRcvEle != NULL)
@@ -1118,6 +1305,7 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     trdp_mdFreeSession(pSession->pMDSndQueue);
                     pSession->pMDSndQueue = pNext;
                 }
+                trdp_MDhashFree(&pSession->mdSndHash);
                 /*    Release all allocated sockets and memory    */
                 while (pSession->pMDRcvQueue != NULL)
                 {
@@ -1132,6 +1320,9 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     trdp_mdFreeSession(pSession->pMDRcvQueue);
                     pSession->pMDRcvQueue = pNext;
                 }
+                trdp_MDhashFree(&pSession->mdRcvHash);
+                trdp_mdFreeSchedule(pSession);
+                trdp_mdFreeStreams(pSession);
                 /*    Release all allocated sockets and memory    */
                 while (pSession->pMDListenQueue != NULL)
                 {
@@ -1149,6 +1340,7 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     vos_memFree(pSession->pMDListenQueue);
                     pSession->pMDListenQueue = pNext;
                 }
+                trdp_MDlisIndexFree(&pSession->mdLisIndex);
                 /* Ticket #137: close TCP listener socket */
                 if (pSession->tcpFd.listen_sd != VOS_INVALID_SOCKET)
                 {
@@ -1158,6 +1350,7 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
 #endif
                 trdp_releaseAccess(pSession);
 
+                vos_sockEventsDelete(pSession->events.handle);
                 vos_mutexDelete(pSession->mutex);
                 vos_mutexDelete(pSession->mutexTxPD);
                 vos_mutexDelete(pSession->mutexRxPD);
@@ -1343,10 +1536,20 @@ EXT_DECL TRDP_ERR_T tlc_getInterval (
                 vos_getTime(&now);
                 vos_clearTime(&appHandle->nextJob);
 
-                trdp_pdCheckPending(appHandle, pFileDesc, pNoDesc, TRUE);
+                /*    The timeout heap may be changed by tlp_subscribe() on another thread    */
+                if (vos_mutexLock(appHandle->mutexRxPD) == VOS_NO_ERR)
+                {
+                    trdp_pdCheckPending(appHandle, pFileDesc, pNoDesc, TRUE);
+
+                    if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+                    {
+                        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+                    }
+                }
 
 #if MD_SUPPORT
                 trdp_mdCheckPending(appHandle, pFileDesc, pNoDesc);
+                tlc_mdNextJob(appHandle);
 #endif
 
                 /*    if next job time is known, return the time-out value to the caller   */
@@ -1414,9 +1617,33 @@ EXT_DECL TRDP_ERR_T tlc_process (
     TRDP_APP_SESSION_T  appHandle,
     TRDP_FDS_T          *pRfds,
     INT32               *pCount)
+{
+    return tlc_processSession(appHandle, pRfds, pCount, NULL, 0u);
+}
+
+/**********************************************************************************************************************/
+/** Work loop of tlc_process() and tlc_processEvents()
+ *    The ready sockets are either given as descriptor set (select) or as list of event tags (event set).
+ *
+ *  @param[in]      appHandle          The handle returned by tlc_openSession
+ *  @param[in]      pRfds              pointer to set of ready descriptors
+ *  @param[in,out]  pCount             pointer to number of ready descriptors
+ *  @param[in]      pTags              tags of the ready sockets or NULL if pRfds is used
+ *  @param[in]      noOfTags           number of tags
+ *
+ *  @retval         TRDP_NO_ERR        no error
+ *  @retval         TRDP_NOINIT_ERR    handle invalid
+ */
+static TRDP_ERR_T tlc_processSession (
+    TRDP_SESSION_PT appHandle,
+    TRDP_FDS_T      *pRfds,
+    INT32           *pCount,
+    const UINT32    *pTags,
+    UINT32          noOfTags)
 {
     TRDP_ERR_T  result = TRDP_NO_ERR;
     TRDP_ERR_T  err;
+    UINT32      i;
 
     if (!trdp_isValidSession(appHandle))
     {
@@ -1462,11 +1689,34 @@ EXT_DECL TRDP_ERR_T tlc_process (
             /******************************************************
              Find packets which are to be received
              ******************************************************/
-            err = trdp_pdCheckListenSocks(appHandle, pRfds, pCount);
-            if (err != TRDP_NO_ERR)
+            if (pTags == NULL)
             {
-                /*  We do not break here */
-                result = err;
+                err = trdp_pdCheckListenSocks(appHandle, pRfds, pCount);
+                if (err != TRDP_NO_ERR)
+                {
+                    /*  We do not break here */
+                    result = err;
+                }
+            }
+            else
+            {
+                for (i = 0u; i < noOfTags; i++)
+                {
+                    UINT32 idx = pTags[i] & TRDP_EVENT_TAG_INDEX;
+
+                    /*  Skip sockets which were released meanwhile  */
+                    if (((pTags[i] & TRDP_EVENT_TAG_KIND) == TRDP_EVENT_TAG_PD) &&
+                        (idx < TRDP_MAX_PD_SOCKET_CNT) &&
+                        (appHandle->ifacePD[idx].sock == appHandle->events.pd[idx]))
+                    {
+                        err = trdp_pdReceiveSocket(appHandle, idx);
+                        if (err != TRDP_NO_ERR)
+                        {
+                            /*  We do not break here */
+                            result = err;
+                        }
+                    }
+                }
             }
 
             if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
@@ -1494,7 +1744,35 @@ EXT_DECL TRDP_ERR_T tlc_process (
                 }
             }
 
-            trdp_mdCheckListenSocks(appHandle, pRfds, pCount);
+            if (pTags == NULL)
+            {
+                trdp_mdCheckListenSocks(appHandle, pRfds, pCount);
+            }
+            else
+            {
+                BOOL8 accept = FALSE;
+
+                /*  Receive first, accepting may replace sockets reported ready */
+                for (i = 0u; i < noOfTags; i++)
+                {
+                    UINT32 idx = pTags[i] & TRDP_EVENT_TAG_INDEX;
+
+                    if ((pTags[i] & TRDP_EVENT_TAG_KIND) == TRDP_EVENT_TAG_LISTEN)
+                    {
+                        accept = TRUE;
+                    }
+                    else if (((pTags[i] & TRDP_EVENT_TAG_KIND) == TRDP_EVENT_TAG_MD) &&
+                             (idx < TRDP_MAX_MD_SOCKET_CNT) &&
+                             (appHandle->ifaceMD[idx].sock == appHandle->events.md[idx]))
+                    {
+                        trdp_mdReceiveSocket(appHandle, (INT32) idx);
+                    }
+                }
+                if (accept)
+                {
+                    trdp_mdAcceptConnections(appHandle, NULL, NULL);
+                }
+            }
 
             trdp_mdCheckTimeouts(appHandle);
 
@@ -1515,6 +1793,136 @@ EXT_DECL TRDP_ERR_T tlc_process (
 }
 #endif
 
+/**********************************************************************************************************************/
+/** Wait for and process the TRDP events of a session.
+ *    Combines tlc_getInterval(), the wait for ready sockets and tlc_process() in one call. The receiving
+ *    PD, MD and TCP sockets are registered once in a socket event set (epoll on Linux) and only re-registered
+ *    if sockets were opened or closed, instead of rebuilding a descriptor set for every call of select().
+ *    On targets without event set support, tlc_getInterval(), vos_select() and tlc_process() are used.
+ *
+ *  Note:
+ *      Do not mix tlc_processEvents() with tlc_process(), tlp_process*() or tlm_process() for the same session.
+ *      Sockets of the application cannot be added; use tlc_getInterval()/tlc_process() if needed.
+ *
+ *  @param[in]      appHandle          The handle returned by tlc_openSession
+ *  @param[in]      pMaxWait           maximum time to wait for events, NULL to wait until the next PD/MD job
+ *
+ *  @retval         TRDP_NO_ERR        no error
+ *  @retval         TRDP_NOINIT_ERR    handle invalid
+ *  @retval         TRDP_SOCK_ERR      waiting for the sockets failed
+ */
+#ifdef HIGH_PERF_INDEXED
+EXT_DECL TRDP_ERR_T tlc_processEvents (
+    TRDP_APP_SESSION_T  appHandle __unused,
+    const TRDP_TIME_T   *pMaxWait __unused)
+{
+    vos_printLogStr(VOS_LOG_ERROR, "####   tlc_processEvents() is not supported when using HIGH_PERF_INDEXED!  ####\n");
+    vos_printLogStr(VOS_LOG_ERROR, "####   Use tlp_processSend/tlp_processReceive()/tlm_process() instead!     ####\n");
+    return TRDP_NOINIT_ERR;
+}
+#else
+EXT_DECL TRDP_ERR_T tlc_processEvents (
+    TRDP_APP_SESSION_T  appHandle,
+    const TRDP_TIME_T   *pMaxWait)
+{
+    UINT32      tags[VOS_MAX_SOCK_EVENTS];
+    UINT32      noOfTags = VOS_MAX_SOCK_EVENTS;
+    TRDP_TIME_T interval;
+    TRDP_TIME_T now;
+    BOOL8       unsupported;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutex) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    tlc_syncEvents(appHandle);
+    unsupported = appHandle->events.unsupported;
+
+    if (!unsupported)
+    {
+        /*    Compute the wait time the same way as tlc_getInterval()    */
+        vos_getTime(&now);
+        vos_clearTime(&appHandle->nextJob);
+        if (vos_mutexLock(appHandle->mutexRxPD) == VOS_NO_ERR)
+        {
+            trdp_pdNextJob(appHandle, TRUE);
+
+            if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+            {
+                vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+            }
+        }
+#if MD_SUPPORT
+        {
+            TRDP_FDS_T  rfds;
+            TRDP_SOCK_T noDesc = VOS_INVALID_SOCKET;
+
+            VOS_FD_ZERO((VOS_FDS_T *) &rfds);
+            trdp_mdCheckPending(appHandle, &rfds, &noDesc);
+            tlc_mdNextJob(appHandle);
+        }
+#endif
+        if (timerisset(&appHandle->nextJob) &&
+            timercmp(&now, &appHandle->nextJob, <))
+        {
+            interval = appHandle->nextJob;
+            vos_subTime(&interval, &now);
+        }
+        else if (timerisset(&appHandle->nextJob))
+        {
+            interval.tv_sec     = 0u;                               /* 0ms if time is over (were we delayed?) */
+            interval.tv_usec    = 0;
+        }
+        else
+        {
+            interval.tv_sec     = 1u;                               /* 1000ms if no timeout is set      */
+            interval.tv_usec    = 0;
+        }
+    }
+
+    if (vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+
+    if (unsupported)
+    {
+        TRDP_FDS_T  rfds;
+        INT32       noDesc = 0;
+        INT32       rv;
+
+        VOS_FD_ZERO((VOS_FDS_T *) &rfds);
+        (void) tlc_getInterval(appHandle, &interval, &rfds, &noDesc);
+        if ((pMaxWait != NULL) && (vos_cmpTime(&interval, (TRDP_TIME_T *) pMaxWait) > 0))
+        {
+            interval = *pMaxWait;
+        }
+        rv = vos_select(noDesc, &rfds, NULL, NULL, &interval);
+        return tlc_process(appHandle, &rfds, &rv);
+    }
+
+    if ((pMaxWait != NULL) && (vos_cmpTime(&interval, (TRDP_TIME_T *) pMaxWait) > 0))
+    {
+        interval = *pMaxWait;
+    }
+
+    /*    The event set is only rebuilt by tlc_syncEvents() above, i.e. by the thread calling us    */
+    if (vos_sockEventsWait(appHandle->events.handle, &interval, tags, &noOfTags) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "vos_sockEventsWait() failed\n");
+        return TRDP_SOCK_ERR;
+    }
+
+    return tlc_processSession(appHandle, NULL, NULL, tags, noOfTags);
+}
+#endif
+
 /**********************************************************************************************************************/
 /** Return a human readable version representation.
  *    Return string in the form 'v.r.u.b'
@@ -17,6 +17,9 @@
 /*
 * $Id$
 *
+*      AG 2026-10-16: tlm_preConnect() added
+*      AG 2026-10-16: tlm_getInterval returns the time to the next MD deadline
+*      AG 2026-10-16: Listeners are kept in the comId / destination URI index of the session
 *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
 *     AHW 2021-05-26: Ticket #370 Number of Listeners in MD statistics not counted correctly
 *      BL 2020-09-08: Ticket #343 userStatus parameter size in tlm_reply and tlm_replyQuery
@@ -74,6 +77,8 @@ extern "C" {
 /** Get the lowest time interval for MDs.
  *  Return the maximum time interval suitable for 'select()' so that we
  *    can report time outs to the higher layer.
+ *  The interval ends at the next MD deadline (send, retry or time out), it is limited to
+ *    TRDP_MD_MAN_CYCLE_TIME for the supervision of the TCP connections.
  *
  *  @param[in]      appHandle          The handle returned by tlc_openSession
  *  @param[out]     pInterval          pointer to needed interval
@@ -109,12 +114,32 @@ EXT_DECL TRDP_ERR_T tlm_getInterval (
             }
             else
             {
+                TRDP_TIME_T now, nextJob;
+
                 trdp_mdCheckPending(appHandle, pFileDesc, pNoDesc);
 
                 /*  Return a time-out value to the caller   */
                 pInterval->tv_sec   = 0u;                       /* if no timeout is set             */
                 pInterval->tv_usec  = TRDP_MD_MAN_CYCLE_TIME;   /* Application should limit this    */
 
+                if (trdp_mdNextJob(appHandle, &nextJob) == TRUE)
+                {
+                    vos_getTime(&now);
+                    if (timercmp(&nextJob, &now, <=))
+                    {
+                        /* a session is due already */
+                        vos_clearTime(pInterval);
+                    }
+                    else
+                    {
+                        vos_subTime(&nextJob, &now);
+                        if (timercmp(&nextJob, pInterval, <))
+                        {
+                            *pInterval = nextJob;
+                        }
+                    }
+                }
+
                 if (vos_mutexUnlock(appHandle->mutexMD) != VOS_NO_ERR)
                 {
                     vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
@@ -527,6 +552,7 @@ EXT_DECL TRDP_ERR_T  tlm_addListener (
                     /* Insert into list */
                     pNewElement->pNext          = appHandle->pMDListenQueue;
                     appHandle->pMDListenQueue   = pNewElement;
+                    trdp_MDlisIndexInsert(appHandle->pMDListenQueue, &appHandle->mdLisIndex, pNewElement);
 
                     /* Statistics */
                     if ((pNewElement->pktFlags & TRDP_FLAGS_TCP) != 0)
@@ -622,6 +648,8 @@ EXT_DECL TRDP_ERR_T tlm_delListener (
 
         if (TRUE == dequeued)
         {
+            trdp_MDlisIndexRemove(&appHandle->mdLisIndex, pDelete);
+
             /* cleanup instance */
             if (pDelete->socketIdx != -1)
             {
@@ -757,6 +785,7 @@ EXT_DECL TRDP_ERR_T tlm_readdListener (
         }
         if (ret == TRDP_NO_ERR)
         {
+            /* comId and destination URI are kept, the listener stays in the listener index */
             pListener->addr.etbTopoCnt      = etbTopoCnt;
             pListener->addr.opTrnTopoCnt    = opTrnTopoCnt;
             pListener->addr.mcGroup         = mcDestIpAddr;
@@ -928,6 +957,35 @@ EXT_DECL TRDP_ERR_T tlm_confirm (
     return trdp_mdConfirm(appHandle, pSessionId, userStatus, pSendParam);
 }
 
+/**********************************************************************************************************************/
+/** Open a TCP connection to a replier in advance.
+ *  Connections to a replier which are not used by a session are kept open until the connect timeout of the session
+ *  expires and are reused by the next TCP requests and notifications to the same replier. This function opens such
+ *  an idle connection, if there is none yet, so the first request to a known replier does not wait for the connection.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pSendParam          Pointer to send parameters of the later requests, NULL for default parameters
+ *  @param[in]      srcIpAddr           own IP address, 0 - srcIP will be set by the stack
+ *  @param[in]      destIpAddr          IP address of the replier
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_SOCK_ERR       no more sockets or connection refused
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlm_preConnect (
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          destIpAddr)
+{
+    if ( !trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    return trdp_mdPreConnect(appHandle, pSendParam, srcIpAddr, destIpAddr);
+}
+
 /**********************************************************************************************************************/
 /** Cancel an open session.
  *  Abort an open session; any pending messages will be dropped
@@ -17,6 +17,12 @@
 /*
 * $Id$*
 *
+*      AG 2026-10-16: tlp_putMany() and tlp_getMany() for many telegrams under one lock
+*      AG 2026-10-16: tlp_reserve() and tlp_commit() for publishing without copy
+*      AG 2026-10-16: tlp_getRef() and tlp_release() for zero copy access to received data
+*      AG 2026-10-16: Publishers and requests are scheduled by the send heap (trdp_pdScheduleSend)
+*      AG 2026-10-16: Subscriptions are timeout supervised by the deadline heap (trdp_pdArmTimeout), one timeout pass for both modes
+*      AG 2026-10-16: Subscriptions are indexed by the subscription hash (trdp_subHashInsert/Remove)
 *      A 2023-01-13: Ticket #412 Added tlp_republishService
 *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
 *     AHW 2022-03-24: Ticket #391 Allow PD request without reply
@@ -212,20 +218,7 @@ EXT_DECL TRDP_ERR_T tlp_processReceive (
          Find packets which are pending/overdue
          ******************************************************/
 
-#ifdef HIGH_PERF_INDEXED
-        if ((appHandle->pSlot != NULL) &&
-            (appHandle->pSlot->pRcvTableTimeOut != NULL))
-        {
-            /* if available, use faster access */
-            trdp_pdHandleTimeOutsIndexed(appHandle);
-        }
-        else
-        {
-            trdp_pdHandleTimeOuts(appHandle);
-        }
-#else
         trdp_pdHandleTimeOuts(appHandle);
-#endif
         if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
         {
             vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
@@ -685,6 +678,7 @@ EXT_DECL TRDP_ERR_T tlp_publish (
             /*    Insert at front    */
             trdp_queueInsFirst(&appHandle->pSndQueue, pNewElement);
 #endif
+            ret = trdp_pdScheduleSend(appHandle, pNewElement);
 
             *pPubHandle = (TRDP_PUB_T) pNewElement;
 
@@ -705,6 +699,7 @@ EXT_DECL TRDP_ERR_T tlp_publish (
                 if ((ret == TRDP_NO_ERR) && (appHandle->option & TRDP_OPTION_TRAFFIC_SHAPING))
                 {
                     ret = trdp_pdDistribute(appHandle->pSndQueue);
+                    trdp_pdRescheduleSend(appHandle);
                 }
 #endif
             }
@@ -904,6 +899,7 @@ EXT_DECL TRDP_ERR_T  tlp_unpublish (
     if (ret == TRDP_NO_ERR)
     {
         /*    Remove from queue?    */
+        trdp_pdUnscheduleSend(appHandle, pElement);
         trdp_queueDelElement(&appHandle->pSndQueue, pElement);
         trdp_releaseSocket(appHandle->ifacePD, pElement->socketIdx, 0u, FALSE, VOS_INADDR_ANY);
         pElement->magic = 0u;
@@ -911,6 +907,7 @@ EXT_DECL TRDP_ERR_T  tlp_unpublish (
         {
             vos_memFree(pElement->pSeqCntList);
         }
+        trdp_pdFreeLent(pElement);
         vos_memFree(pElement->pFrame);
         vos_memFree(pElement);
 
@@ -919,6 +916,7 @@ EXT_DECL TRDP_ERR_T  tlp_unpublish (
         if (appHandle->option & TRDP_OPTION_TRAFFIC_SHAPING)
         {
             ret = trdp_pdDistribute(appHandle->pSndQueue);
+            trdp_pdRescheduleSend(appHandle);
         }
 #else
         /* We must check if this publisher is listed in our indexed arrays */
@@ -1004,6 +1002,204 @@ EXT_DECL TRDP_ERR_T tlp_put (
     return ret;
 }
 
+/**********************************************************************************************************************/
+/** Update the data of many publishers at once.
+ *  Same as calling tlp_put() for each entry, but the session is validated and mutexTxPD is taken once only.
+ *  The result of each put is returned in the entry.
+ *
+ *  @param[in]      appHandle          the handle returned by tlc_openSession
+ *  @param[in,out]  pEntries           array of publisher handles and data, results
+ *  @param[in]      noOfEntries        number of entries
+ *
+ *  @retval         TRDP_NO_ERR        no error, all entries succeeded
+ *  @retval         TRDP_PARAM_ERR     parameter error
+ *  @retval         TRDP_NOINIT_ERR    handle invalid
+ *  @retval         other              result of the first failed entry
+ */
+EXT_DECL TRDP_ERR_T tlp_putMany (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_PUT_ENTRY_T    *pEntries,
+    UINT32              noOfEntries)
+{
+    TRDP_ERR_T  ret = TRDP_NO_ERR;
+    UINT32      i;
+
+    if ((pEntries == NULL) && (noOfEntries != 0u))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*    Reserve mutual access    */
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutexTxPD);
+    if ( ret == TRDP_NO_ERR )
+    {
+        for (i = 0u; i < noOfEntries; i++)
+        {
+            PD_ELE_T *pElement = (PD_ELE_T *) pEntries[i].pubHandle;
+
+            if (pElement == NULL)
+            {
+                pEntries[i].result = TRDP_PARAM_ERR;
+            }
+            else if (pElement->magic != TRDP_MAGIC_PUB_HNDL_VALUE)
+            {
+                pEntries[i].result = TRDP_NOPUB_ERR;
+            }
+#ifdef TSN_SUPPORT
+            else if ((pElement->pktFlags & TRDP_FLAGS_TSN) ||
+                     (pElement->pktFlags & TRDP_FLAGS_TSN_SDT) ||
+                     (pElement->pktFlags & TRDP_FLAGS_TSN_MSDT))
+            {
+                pEntries[i].result = TRDP_PARAM_ERR;
+            }
+#endif
+            else
+            {
+                pEntries[i].result = trdp_pdPut(pElement,
+                                                appHandle->marshall.pfCbMarshall,
+                                                appHandle->marshall.pRefCon,
+                                                pEntries[i].pData,
+                                                pEntries[i].dataSize);
+            }
+            if ((ret == TRDP_NO_ERR) && (pEntries[i].result != TRDP_NO_ERR))
+            {
+                ret = pEntries[i].result;
+            }
+        }
+
+        if ( vos_mutexUnlock(appHandle->mutexTxPD) != VOS_NO_ERR )
+        {
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Reserve a frame for writing process data in place.
+ *  Returns a pointer into a second frame buffer of the publisher. The application writes the data (in network
+ *  representation, no marshalling is applied) and publishes it by tlp_commit(). Until then, the former data is sent.
+ *  The content of the reserved buffer is undefined. Not applicable to TSN telegrams.
+ *
+ *  @param[in]      appHandle          the handle returned by tlc_openSession
+ *  @param[in]      pubHandle          the handle returned by publish
+ *  @param[in]      dataSize           maximum size of data to be written
+ *  @param[out]     ppData             pointer to the data area to be written
+ *
+ *  @retval         TRDP_NO_ERR        no error
+ *  @retval         TRDP_PARAM_ERR     parameter error
+ *  @retval         TRDP_NOPUB_ERR     not published
+ *  @retval         TRDP_NOINIT_ERR    handle invalid
+ *  @retval         TRDP_MEM_ERR       out of memory
+ */
+EXT_DECL TRDP_ERR_T tlp_reserve (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_PUB_T          pubHandle,
+    UINT32              dataSize,
+    UINT8               * *ppData)
+{
+    PD_ELE_T    *pElement   = (PD_ELE_T *)pubHandle;
+    TRDP_ERR_T  ret         = TRDP_NO_ERR;
+
+    if ((pElement == NULL) || (ppData == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    *ppData = NULL;
+
+    if (pElement->magic != TRDP_MAGIC_PUB_HNDL_VALUE)
+    {
+        return TRDP_NOPUB_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+#ifdef TSN_SUPPORT
+    if ((pElement->pktFlags & TRDP_FLAGS_TSN) ||
+        (pElement->pktFlags & TRDP_FLAGS_TSN_SDT) ||
+        (pElement->pktFlags & TRDP_FLAGS_TSN_MSDT))
+    {
+        return TRDP_PARAM_ERR;
+    }
+#endif
+
+    /*    Reserve mutual access    */
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutexTxPD);
+    if ( ret == TRDP_NO_ERR )
+    {
+        ret = trdp_pdReserve(pElement, dataSize, ppData);
+
+        if ( vos_mutexUnlock(appHandle->mutexTxPD) != VOS_NO_ERR )
+        {
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Publish the data written into the frame reserved by tlp_reserve().
+ *  The reserved frame becomes the published one and is sent from now on, the data is marked valid.
+ *  The former frame becomes the buffer of the next tlp_reserve().
+ *
+ *  @param[in]      appHandle          the handle returned by tlc_openSession
+ *  @param[in]      pubHandle          the handle returned by publish
+ *  @param[in]      dataSize           size of data written, not larger than reserved
+ *
+ *  @retval         TRDP_NO_ERR        no error
+ *  @retval         TRDP_PARAM_ERR     parameter error, nothing reserved
+ *  @retval         TRDP_NOPUB_ERR     not published
+ *  @retval         TRDP_NOINIT_ERR    handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlp_commit (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_PUB_T          pubHandle,
+    UINT32              dataSize)
+{
+    PD_ELE_T    *pElement   = (PD_ELE_T *)pubHandle;
+    TRDP_ERR_T  ret         = TRDP_NO_ERR;
+
+    if (pElement == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (pElement->magic != TRDP_MAGIC_PUB_HNDL_VALUE)
+    {
+        return TRDP_NOPUB_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*    Reserve mutual access    */
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutexTxPD);
+    if ( ret == TRDP_NO_ERR )
+    {
+        ret = trdp_pdCommit(pElement, dataSize);
+
+        if ( vos_mutexUnlock(appHandle->mutexTxPD) != VOS_NO_ERR )
+        {
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
+    }
+
+    return ret;
+}
+
 /**********************************************************************************************************************/
 /** Update and send process data.
  *  Update previously published data. The new telegram will be sent immediatly or at txTime, if txTime != 0 and TSN == 1
@@ -1290,6 +1486,10 @@ EXT_DECL TRDP_ERR_T tlp_request (
             }
             /*  This flag triggers sending in tlc_process (one shot)  */
             pReqElement->privFlags |= TRDP_REQ_2B_SENT;
+            if (trdp_pdScheduleSend(appHandle, pReqElement) != TRDP_NO_ERR)
+            {
+                ret = TRDP_MEM_ERR;
+            }
 
             if (pSubPD != NULL)   /* #391 only if reply requested */
             {
@@ -1307,6 +1507,17 @@ EXT_DECL TRDP_ERR_T tlp_request (
         {
             vos_printLogStr(VOS_LOG_ERROR, "vos_mutexUnlock() failed\n");
         }
+
+        /*  The timeout heap belongs to the receiver, restart the supervision outside of mutexTxPD  */
+        if ((ret == TRDP_NO_ERR) && (pSubPD != NULL) && timerisset(&pSubPD->interval) &&
+            (vos_mutexLock(appHandle->mutexRxPD) == VOS_NO_ERR))
+        {
+            (void) trdp_pdArmTimeout(appHandle, pSubPD);
+            if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+            {
+                vos_printLogStr(VOS_LOG_ERROR, "vos_mutexUnlock() failed\n");
+            }
+        }
     }
 
     return ret;
@@ -1510,6 +1721,15 @@ EXT_DECL TRDP_ERR_T tlp_subscribe (
                     /*  append this subscription to our receive queue */
                     trdp_queueAppLast(&appHandle->pRcvQueue, newPD);
 
+                    /*  and index it for trdp_pdReceive; without index, the receive queue will be searched */
+                    if (trdp_subHashInsert(appHandle, newPD) != TRDP_NO_ERR)
+                    {
+                        vos_printLogStr(VOS_LOG_WARNING, "Subscription not indexed, out of memory\n");
+                    }
+
+                    /*  start the timeout supervision */
+                    (void) trdp_pdArmTimeout(appHandle, newPD);
+
                     *pSubHandle = (TRDP_SUB_T) newPD;
                 }
             }
@@ -1564,6 +1784,8 @@ EXT_DECL TRDP_ERR_T tlp_unsubscribe (
     {
         TRDP_IP_ADDR_T mcGroup = pElement->addr.mcGroup;
         /*    Remove from queue?    */
+        trdp_subHashRemove(appHandle, pElement);
+        trdp_pdDisarmTimeout(appHandle, pElement);
         trdp_queueDelElement(&appHandle->pRcvQueue, pElement);
         /*    if we subscribed to an MC-group, check if anyone else did too: */
         if (mcGroup != VOS_INADDR_ANY)
@@ -1572,6 +1794,7 @@ EXT_DECL TRDP_ERR_T tlp_unsubscribe (
         }
         trdp_releaseSocket(appHandle->ifacePD, pElement->socketIdx, 0u, FALSE, mcGroup);
         pElement->magic = 0u;
+        trdp_pdFreeLent(pElement);
         if (pElement->pFrame != NULL)
         {
             vos_memFree(pElement->pFrame);
@@ -1645,7 +1868,8 @@ EXT_DECL TRDP_ERR_T tlp_resubscribe (
         return TRDP_NOINIT_ERR;
     }
 
-    /*  Change the addressing item   */
+    /*  Change the addressing item, the hash key changes as well   */
+    trdp_subHashRemove(appHandle, subHandle);
     subHandle->addr.srcIpAddr   = srcIpAddr1;
     subHandle->addr.srcIpAddr2  = srcIpAddr2;
     subHandle->addr.destIpAddr  = destIpAddr;
@@ -1693,6 +1917,11 @@ EXT_DECL TRDP_ERR_T tlp_resubscribe (
         subHandle->addr.mcGroup = 0u;
     }
 
+    if ((ret == TRDP_NO_ERR) && (trdp_subHashInsert(appHandle, subHandle) != TRDP_NO_ERR))
+    {
+        vos_printLogStr(VOS_LOG_WARNING, "Subscription not indexed, out of memory\n");
+    }
+
     if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
     {
         vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
@@ -1702,6 +1931,132 @@ EXT_DECL TRDP_ERR_T tlp_resubscribe (
 }
 
 
+/**********************************************************************************************************************/
+/** Read all pending PD messages of a subscription's socket if we are in non blocking mode.
+ *  Must be called with mutexRxPD held.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pElement            subscription
+ */
+static void tlp_receivePending (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    if (!(appHandle->option & TRDP_OPTION_BLOCK))
+    {
+        TRDP_ERR_T  err;
+        /* read all you can get, return value checked for recoverable errors (Ticket #304) */
+        do
+        {
+            err = trdp_pdReceive(appHandle, appHandle->ifacePD[pElement->socketIdx].sock);
+
+            switch (err)
+            {
+                case TRDP_NO_ERR:
+                case TRDP_NOSUB_ERR:         /* missing subscription should not lead to extensive error output */
+                case TRDP_NODATA_ERR:
+                case TRDP_BLOCK_ERR:
+                    break;
+                case TRDP_PARAM_ERR:
+                    vos_printLog(VOS_LOG_ERROR, "trdp_pdReceive() failed (Err: %d)\n", err);
+                    break;
+                case TRDP_WIRE_ERR:
+                case TRDP_CRC_ERR:
+                case TRDP_MEM_ERR:
+                default:
+                    vos_printLog(VOS_LOG_WARNING, "trdp_pdReceive() failed (Err: %d)\n", err);
+                    break;
+            }
+        }
+        while ((err != TRDP_NODATA_ERR) && (err != TRDP_BLOCK_ERR)); /* as long as there are messages or a timeout is received */
+    }
+}
+
+/**********************************************************************************************************************/
+/** Fill the PD info of the subscription's current frame.
+ *
+ *  @param[in]      pElement            subscription
+ *  @param[in,out]  pPdInfo             pointer to application's info buffer or NULL
+ *  @param[in]      resultCode          result to report
+ */
+static void tlp_pdInfo (
+    const PD_ELE_T  *pElement,
+    TRDP_PD_INFO_T  *pPdInfo,
+    TRDP_ERR_T      resultCode)
+{
+    if (pPdInfo != NULL)
+    {
+        pPdInfo->comId          = pElement->addr.comId;
+        pPdInfo->srcIpAddr      = pElement->lastSrcIP;
+        pPdInfo->destIpAddr     = pElement->addr.destIpAddr;
+        pPdInfo->etbTopoCnt     = vos_ntohl(pElement->pFrame->frameHead.etbTopoCnt);
+        pPdInfo->opTrnTopoCnt   = vos_ntohl(pElement->pFrame->frameHead.opTrnTopoCnt);
+        pPdInfo->msgType        = (TRDP_MSG_T) vos_ntohs(pElement->pFrame->frameHead.msgType);
+        pPdInfo->seqCount       = pElement->curSeqCnt;
+        pPdInfo->protVersion    = vos_ntohs(pElement->pFrame->frameHead.protocolVersion);
+        pPdInfo->replyComId     = vos_ntohl(pElement->pFrame->frameHead.replyComId);
+        pPdInfo->replyIpAddr    = vos_ntohl(pElement->pFrame->frameHead.replyIpAddress);
+        pPdInfo->pUserRef       = pElement->pUserRef;
+        pPdInfo->resultCode     = resultCode;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Get the data of a subscription, check its time out.
+ *  Must be called with mutexRxPD held.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pElement            subscription
+ *  @param[in]      pNow                current time
+ *  @param[in,out]  pPdInfo             pointer to application's info buffer or NULL
+ *  @param[in,out]  pData               pointer to application's data buffer
+ *  @param[in,out]  pDataSize           in: size of buffer, out: size of data
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_TIMEOUT_ERR    packet timed out
+ *  @retval         TRDP_NODATA_ERR     no data received yet
+ *  @retval         TRDP_PARAM_ERR      buffer too small
+ *  @retval         TRDP_COMID_ERR      ComID not found when marshalling
+ */
+static TRDP_ERR_T tlp_getElement (
+    TRDP_SESSION_PT     appHandle,
+    PD_ELE_T            *pElement,
+    const TRDP_TIME_T   *pNow,
+    TRDP_PD_INFO_T      *pPdInfo,
+    UINT8               *pData,
+    UINT32              *pDataSize)
+{
+    TRDP_ERR_T ret;
+
+    /*    Check time out    */
+    if (timerisset(&pElement->interval) &&
+        timercmp(&pElement->timeToGo, pNow, <))
+    {
+        /*    Packet is late    */
+        if (pElement->toBehavior == TRDP_TO_SET_TO_ZERO &&
+            pData != NULL && pDataSize != NULL)
+        {
+            memset(pData, 0, *pDataSize);
+        }
+        else /* TRDP_TO_KEEP_LAST_VALUE */
+        {
+            ;
+        }
+        ret = TRDP_TIMEOUT_ERR;
+    }
+    else
+    {
+        ret = trdp_pdGet(pElement,
+                         appHandle->marshall.pfCbUnmarshall,
+                         appHandle->marshall.pRefCon,
+                         pData,
+                         pDataSize);
+    }
+
+    tlp_pdInfo(pElement, pPdInfo, ret);
+    return ret;
+}
+
 /**********************************************************************************************************************/
 /** Get the last valid PD message.
  *  This allows polling of PDs instead of event driven handling by callbacks
@@ -1750,78 +2105,232 @@ EXT_DECL TRDP_ERR_T tlp_get (
     if (ret == TRDP_NO_ERR)
     {
         /*    Call the receive function if we are in non blocking mode    */
-        if (!(appHandle->option & TRDP_OPTION_BLOCK))
+        tlp_receivePending(appHandle, pElement);
+
+        /*    Get the current time    */
+        vos_getTime(&now);
+
+        ret = tlp_getElement(appHandle, pElement, &now, pPdInfo, pData, pDataSize);
+
+        if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
         {
-            TRDP_ERR_T  err;
-            /* read all you can get, return value checked for recoverable errors (Ticket #304) */
-            do
-            {
-                err = trdp_pdReceive(appHandle, appHandle->ifacePD[pElement->socketIdx].sock);
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
+    }
 
-                switch (err)
-                {
-                    case TRDP_NO_ERR:
-                    case TRDP_NOSUB_ERR:         /* missing subscription should not lead to extensive error output */
-                    case TRDP_NODATA_ERR:
-                    case TRDP_BLOCK_ERR:
-                        break;
-                    case TRDP_PARAM_ERR:
-                        vos_printLog(VOS_LOG_ERROR, "trdp_pdReceive() failed (Err: %d)\n", err);
-                        break;
-                    case TRDP_WIRE_ERR:
-                    case TRDP_CRC_ERR:
-                    case TRDP_MEM_ERR:
-                    default:
-                        vos_printLog(VOS_LOG_WARNING, "trdp_pdReceive() failed (Err: %d)\n", err);
-                        break;
-                 }
-             }
-            while ((err != TRDP_NODATA_ERR) && (err != TRDP_BLOCK_ERR)); /* as long as there are messages or a timeout is received */
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Get the last valid PD messages of many subscriptions at once.
+ *  Same as calling tlp_get() for each entry, but the session is validated, mutexRxPD is taken and the time is read
+ *  once only. In non blocking mode, each socket is read once. The result of each get is returned in the entry.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in,out]  pEntries            array of subscription handles and buffers, results
+ *  @param[in]      noOfEntries         number of entries
+ *
+ *  @retval         TRDP_NO_ERR         no error, all entries succeeded
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         other               result of the first failed entry
+ */
+EXT_DECL TRDP_ERR_T tlp_getMany (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_GET_ENTRY_T    *pEntries,
+    UINT32              noOfEntries)
+{
+    TRDP_ERR_T  ret = TRDP_NO_ERR;
+    TRDP_TIME_T now;
+    BOOL8       received[TRDP_MAX_PD_SOCKET_CNT];
+    UINT32      i;
+
+    if ((pEntries == NULL) && (noOfEntries != 0u))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    memset(received, 0, sizeof(received));
+
+    /*    Reserve mutual access    */
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutexRxPD);
+    if (ret == TRDP_NO_ERR)
+    {
+        /*    Call the receive function once per socket if we are in non blocking mode    */
+        for (i = 0u; i < noOfEntries; i++)
+        {
+            PD_ELE_T *pElement = (PD_ELE_T *) pEntries[i].subHandle;
+
+            if ((pElement != NULL) &&
+                (pElement->magic == TRDP_MAGIC_SUB_HNDL_VALUE) &&
+                (pElement->socketIdx >= 0) &&
+                (pElement->socketIdx < (INT32) TRDP_MAX_PD_SOCKET_CNT) &&
+                (received[pElement->socketIdx] == FALSE))
+            {
+                received[pElement->socketIdx] = TRUE;
+                tlp_receivePending(appHandle, pElement);
+            }
         }
 
         /*    Get the current time    */
         vos_getTime(&now);
 
-        /*    Check time out    */
-        if (timerisset(&pElement->interval) &&
-            timercmp(&pElement->timeToGo, &now, <))
+        for (i = 0u; i < noOfEntries; i++)
         {
-            /*    Packet is late    */
-            if (pElement->toBehavior == TRDP_TO_SET_TO_ZERO &&
-                pData != NULL && pDataSize != NULL)
+            PD_ELE_T *pElement = (PD_ELE_T *) pEntries[i].subHandle;
+
+            if (pElement == NULL)
+            {
+                pEntries[i].result = TRDP_PARAM_ERR;
+            }
+            else if (pElement->magic != TRDP_MAGIC_SUB_HNDL_VALUE)
             {
-                memset(pData, 0, *pDataSize);
+                pEntries[i].result = TRDP_NOSUB_ERR;
             }
-            else /* TRDP_TO_KEEP_LAST_VALUE */
+            else
             {
-                ;
+                pEntries[i].result = tlp_getElement(appHandle, pElement, &now, pEntries[i].pPdInfo,
+                                                    pEntries[i].pData, &pEntries[i].dataSize);
             }
+            if ((ret == TRDP_NO_ERR) && (pEntries[i].result != TRDP_NO_ERR))
+            {
+                ret = pEntries[i].result;
+            }
+        }
+
+        if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Get a reference to the last valid PD message.
+ *  Zero copy alternative to tlp_get(): The returned pointer refers to the received frame and stays valid until it
+ *  is handed back by tlp_release(). Newer telegrams are received meanwhile, the referenced data is not changed.
+ *  The data is not unmarshalled. References must be released before the subscription is removed.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[in,out]  pPdInfo             pointer to application's info buffer
+ *  @param[out]     ppData              pointer to the received data, NULL on error
+ *  @param[out]     pDataSize           size of the received data
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_NODATA_ERR     no data received yet
+ *  @retval         TRDP_TIMEOUT_ERR    packet timed out
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_BLOCK_ERR      an older message of this subscription is still referenced
+ *  @retval         TRDP_MEM_ERR        out of memory
+ */
+EXT_DECL TRDP_ERR_T tlp_getRef (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    TRDP_PD_INFO_T      *pPdInfo,
+    const UINT8         * *ppData,
+    UINT32              *pDataSize)
+{
+    PD_ELE_T    *pElement   = (PD_ELE_T *) subHandle;
+    TRDP_ERR_T  ret         = TRDP_NOSUB_ERR;
+    TRDP_TIME_T now;
+
+    if ((pElement == NULL) || (ppData == NULL) || (pDataSize == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    *ppData = NULL;
+
+    if (pElement->magic != TRDP_MAGIC_SUB_HNDL_VALUE)
+    {
+        return TRDP_NOSUB_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*    Reserve mutual access    */
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutexRxPD);
+    if (ret == TRDP_NO_ERR)
+    {
+        tlp_receivePending(appHandle, pElement);
+
+        /*    Get the current time    */
+        vos_getTime(&now);
+
+        /*    Check time out    */
+        if (timerisset(&pElement->interval) &&
+            timercmp(&pElement->timeToGo, &now, <))
+        {
             ret = TRDP_TIMEOUT_ERR;
         }
         else
         {
-            ret = trdp_pdGet(pElement,
-                             appHandle->marshall.pfCbUnmarshall,
-                             appHandle->marshall.pRefCon,
-                             pData,
-                             pDataSize);
+            ret = trdp_pdLend(pElement, ppData, pDataSize);
         }
 
-        if (pPdInfo != NULL)
+        tlp_pdInfo(pElement, pPdInfo, ret);
+
+        if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
         {
-            pPdInfo->comId          = pElement->addr.comId;
-            pPdInfo->srcIpAddr      = pElement->lastSrcIP;
-            pPdInfo->destIpAddr     = pElement->addr.destIpAddr;
-            pPdInfo->etbTopoCnt     = vos_ntohl(pElement->pFrame->frameHead.etbTopoCnt);
-            pPdInfo->opTrnTopoCnt   = vos_ntohl(pElement->pFrame->frameHead.opTrnTopoCnt);
-            pPdInfo->msgType        = (TRDP_MSG_T) vos_ntohs(pElement->pFrame->frameHead.msgType);
-            pPdInfo->seqCount       = pElement->curSeqCnt;
-            pPdInfo->protVersion    = vos_ntohs(pElement->pFrame->frameHead.protocolVersion);
-            pPdInfo->replyComId     = vos_ntohl(pElement->pFrame->frameHead.replyComId);
-            pPdInfo->replyIpAddr    = vos_ntohl(pElement->pFrame->frameHead.replyIpAddress);
-            pPdInfo->pUserRef       = pElement->pUserRef;
-            pPdInfo->resultCode     = ret;
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
         }
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Release a reference obtained by tlp_getRef().
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[in]      pData               the data pointer returned by tlp_getRef()
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error, pData is not referenced
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlp_release (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_SUB_T          subHandle,
+    const UINT8         *pData)
+{
+    PD_ELE_T    *pElement   = (PD_ELE_T *) subHandle;
+    TRDP_ERR_T  ret         = TRDP_NOSUB_ERR;
+
+    if ((pElement == NULL) || (pData == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (pElement->magic != TRDP_MAGIC_SUB_HNDL_VALUE)
+    {
+        return TRDP_NOSUB_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutexRxPD);
+    if (ret == TRDP_NO_ERR)
+    {
+        ret = trdp_pdReturn(pElement, pData);
 
         if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
         {
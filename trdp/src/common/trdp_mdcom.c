@@ -20,6 +20,13 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: Large TCP messages are delivered in chunks to listeners and callers if the session streams MD
+ *      AG 2026-10-16: Callers reuse idle TCP connections to the replier (pool), trdp_mdPreConnect() added
+ *      AG 2026-10-16: Ready list and deadline heap: trdp_mdSend() and trdp_mdCheckTimeouts() only visit due sessions
+ *      AG 2026-10-16: Listeners for requests and notifications are found through the listener index
+ *      AG 2026-10-16: Replies, confirms and repeated requests are matched by the session ID hash of the MD queues
+ *      AG 2026-10-16: TCP receive buffers are not cleared (vos_memAllocNoInit)
+ *      AG 2026-10-16: trdp_mdAcceptConnections() and trdp_mdReceiveSocket() split off trdp_mdCheckListenSocks()
  *     AHW 2023-01-11: Lint warnigs and Ticket #409 In updateTCNDNSentry(), the parameter noDesc of vos_select() is uninitialized if tlc_getInterval() fails
  *     CWE 2023-01-09: Ticket #393 Incorrect behaviour if MD timeout occurs
  *     CWE 2022-12-21: Ticket #404 Fix compile error - Test does not need to run, it is only used to verify bugfixes. It requires a special network-setup to run
@@ -92,6 +99,7 @@
 #define CHECK_HEADER_ONLY   TRUE
 #define CHECK_DATA_TOO      FALSE
 
+
 /***********************************************************************************************************************
  * TYPEDEFS
  */
@@ -115,19 +123,30 @@ static void         trdp_mdManageSessionId (TRDP_UUID_T pSessionId,
                                             MD_ELE_T    *pMdElement);
 
 static TRDP_ERR_T   trdp_mdLookupElement (MD_ELE_T                  *pinitialMdElement,
+                                          const TRDP_MD_HASH_T      *pHash,
                                           const TRDP_MD_ELE_ST_T    elementState,
                                           const TRDP_UUID_T         pSessionId,
                                           MD_ELE_T                  * *pretrievedMdElement);
 
 static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
                                    const TRDP_SESSION_PT    appHandle,
-                                   const TRDP_ERR_T         resultCode);
+                                   const TRDP_ERR_T         resultCode,
+                                   const TRDP_MD_STREAM_T   *pStream);
 static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T          *pElement,
                                           TRDP_SESSION_PT   appHandle,
                                           TRDP_ERR_T        *pResult);
 static MD_ELE_T     *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T  appHandle,
                                                 MD_HEADER_T         *pMdItemHeader);
 
+static BOOL8        trdp_mdListenerAccepts (TRDP_SESSION_PT     appHandle,
+                                            const MD_LIS_ELE_T  *pListener,
+                                            BOOL8               isTCP,
+                                            const MD_HEADER_T   *pH);
+
+static MD_LIS_ELE_T *trdp_mdFindListener (TRDP_SESSION_PT   appHandle,
+                                          BOOL8             isTCP,
+                                          const MD_HEADER_T *pH);
+
 static TRDP_ERR_T   trdp_mdHandleRequest (TRDP_SESSION_PT   appHandle,
                                           BOOL8             isTCP,
                                           UINT32            sockIndex,
@@ -140,6 +159,12 @@ static void trdp_mdCloseSessions (TRDP_SESSION_PT   appHandle,
                                   VOS_SOCK_T        newSocket,
                                   BOOL8             checkAllSockets);
 static void trdp_mdSetSessionTimeout (MD_ELE_T *pMDSession);
+static void trdp_mdSchedule (TRDP_SESSION_PT    appHandle,
+                             MD_ELE_T           *pElement);
+static void trdp_mdUnschedule (TRDP_SESSION_PT  appHandle,
+                               MD_ELE_T         *pElement);
+static void trdp_mdRetry (TRDP_SESSION_PT   appHandle,
+                          MD_ELE_T          *pElement);
 static TRDP_ERR_T   trdp_mdCheck (TRDP_SESSION_PT   appHandle,
                                   MD_HEADER_T       *pPacket,
                                   UINT32            packetSize,
@@ -149,7 +174,19 @@ static TRDP_ERR_T   trdp_mdSendPacket (VOS_SOCK_T mdSock,
                                        MD_ELE_T *pElement);
 static TRDP_ERR_T   trdp_mdRecvTCPPacket (TRDP_SESSION_PT   appHandle,
                                           VOS_SOCK_T        mdSock,
-                                          MD_ELE_T          *pElement);
+                                          MD_ELE_T          *pElement,
+                                          BOOL8             *pStreamed);
+static BOOL8        trdp_mdStreamWanted (TRDP_SESSION_PT    appHandle,
+                                         const MD_HEADER_T  *pH);
+static BOOL8        trdp_mdStreamStart (TRDP_SESSION_PT appHandle,
+                                        UINT32          socketIndex,
+                                        MD_ELE_T        *pElement);
+static MD_ELE_T     *trdp_mdStreamSession (TRDP_SESSION_PT          appHandle,
+                                           const TRDP_MD_STREAM_T   *pStream);
+static void         trdp_mdStreamEnd (TRDP_SESSION_PT   appHandle,
+                                      UINT32            socketIndex);
+static TRDP_ERR_T   trdp_mdRecvStream (TRDP_SESSION_PT  appHandle,
+                                       UINT32           sockIndex);
 static TRDP_ERR_T   trdp_mdRecvUDPPacket (TRDP_SESSION_PT   appHandle,
                                           VOS_SOCK_T        mdSock,
                                           MD_ELE_T          *pElement);
@@ -182,6 +219,15 @@ static TRDP_ERR_T   trdp_mdConnectSocket (TRDP_APP_SESSION_T        appHandle,
                                           BOOL8                     newSession,
                                           MD_ELE_T                  *pSenderElement);
 
+static INT32        trdp_mdPoolFind (TRDP_SESSION_PT            appHandle,
+                                     const TRDP_SEND_PARAM_T    *pSendParam,
+                                     TRDP_IP_ADDR_T             srcIpAddr,
+                                     TRDP_IP_ADDR_T             destIpAddr,
+                                     UINT32                     *pNumIdle);
+
+static void         trdp_mdPoolConnected (TRDP_SESSION_PT   appHandle,
+                                          INT32             socketIdx);
+
 /**********************************************************************************************************************/
 /** Set the statEle property to next state
  *  Prior transmission the next state for the MD_ELE_T has to be set.
@@ -270,6 +316,7 @@ static void trdp_mdManageSessionId (TRDP_UUID_T pSessionId, MD_ELE_T *pMdElement
  *  within a list starting with pinitialMdElement.*
  *
  *  @param[in]      pinitialMdElement   start element within a list of element
+ *  @param[in]      pHash               session hash index of the list
  *  @param[in]      elementState        element state to look for
  *  @param[in]      pSessionId          element session to look for
  *  @param[out]     pretrievedMdElement pointer to looked up element
@@ -278,6 +325,7 @@ static void trdp_mdManageSessionId (TRDP_UUID_T pSessionId, MD_ELE_T *pMdElement
  *  @retval         TRDP_NOSESSION_ERR    no match found error
  */
 static TRDP_ERR_T trdp_mdLookupElement (MD_ELE_T                *pinitialMdElement,
+                                        const TRDP_MD_HASH_T    *pHash,
                                         const TRDP_MD_ELE_ST_T  elementState,
                                         const TRDP_UUID_T       pSessionId,
                                         MD_ELE_T                * *pretrievedMdElement)
@@ -288,12 +336,12 @@ static TRDP_ERR_T trdp_mdLookupElement (MD_ELE_T                *pinitialMdEleme
         (pSessionId != NULL))
     {
         MD_ELE_T *iterMD;
-        /* start iteration through receive or send list */
-        for (iterMD = pinitialMdElement; iterMD != NULL; iterMD = iterMD->pNext)
+        /* iterate through the elements of the receive or send list with this session */
+        for (iterMD = trdp_MDhashFind(pinitialMdElement, pHash, pSessionId);
+             iterMD != NULL;
+             iterMD = trdp_MDhashNext(pHash, iterMD))
         {
-            if ((elementState == iterMD->stateEle)
-                &&
-                (0 == memcmp(iterMD->sessionID, pSessionId, TRDP_SESS_ID_SIZE)))
+            if (elementState == iterMD->stateEle)
             {
                 *pretrievedMdElement = iterMD;
                 errv = TRDP_NO_ERR;
@@ -316,11 +364,13 @@ static TRDP_ERR_T trdp_mdLookupElement (MD_ELE_T                *pinitialMdEleme
  *  @param[in]     pMdItem        pointer to MD_ELE_T to get handled
  *  @param[in]     appHandle      pointer to application session
  *  @param[in]     resultCode         pointer to qualified result code
+ *  @param[in]     pStream            chunk of a message delivered in chunks, NULL for a complete message
  *
  */
 static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
                                    const TRDP_SESSION_PT    appHandle,
-                                   const TRDP_ERR_T         resultCode)
+                                   const TRDP_ERR_T         resultCode,
+                                   const TRDP_MD_STREAM_T   *pStream)
 {
     INT32 replyStatus = 0;
     TRDP_MD_INFO_T theMessage = cTrdp_md_info_default;
@@ -383,12 +433,36 @@ static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
         theMessage.etbTopoCnt   = vos_ntohl(pMdItem->pPacket->frameHead.etbTopoCnt);
         theMessage.opTrnTopoCnt = vos_ntohl(pMdItem->pPacket->frameHead.opTrnTopoCnt);
         theMessage.srcIpAddr    = pMdItem->addr.srcIpAddr;
-        pMdItem->pfCbFunction(
-            appHandle->mdDefault.pRefCon,
-            appHandle,
-            &theMessage,
-            (UINT8 *)(pMdItem->pPacket->data),
-            vos_ntohl(pMdItem->pPacket->frameHead.datasetLength));
+        if (pStream != NULL)
+        {
+            theMessage.streamSize   = pStream->dataSize;
+            theMessage.streamOffset = pStream->offset;
+            pMdItem->pfCbFunction(
+                appHandle->mdDefault.pRefCon,
+                appHandle,
+                &theMessage,
+                (UINT8 *)pStream->chunk,
+                pStream->fill);
+        }
+        else if (pMdItem->grossSize < trdp_packetSizeMD(vos_ntohl(pMdItem->pPacket->frameHead.datasetLength)))
+        {
+            /* the data of a message delivered in chunks is not kept */
+            pMdItem->pfCbFunction(
+                appHandle->mdDefault.pRefCon,
+                appHandle,
+                &theMessage,
+                (UINT8 *)NULL,
+                0u);
+        }
+        else
+        {
+            pMdItem->pfCbFunction(
+                appHandle->mdDefault.pRefCon,
+                appHandle,
+                &theMessage,
+                (UINT8 *)(pMdItem->pPacket->data),
+                vos_ntohl(pMdItem->pPacket->frameHead.datasetLength));
+        }
     }
     else
     {
@@ -582,13 +656,15 @@ static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T *pElement, TRDP_SESSION_PT ap
  */
 static MD_ELE_T *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T appHandle, MD_HEADER_T *pMdItemHeader)
 {
-    MD_ELE_T    *iterMD         = NULL;
-    MD_ELE_T    *startElement   = NULL;
+    MD_ELE_T        *iterMD         = NULL;
+    MD_ELE_T        *startElement   = NULL;
+    TRDP_MD_HASH_T  *pHash          = NULL;
     /* determine the queue to look for the recevd pMdItemHeader */
     if ((vos_ntohs(pMdItemHeader->msgType) == TRDP_MSG_MC)
         )
     {
-        startElement = appHandle->pMDRcvQueue;
+        startElement    = appHandle->pMDRcvQueue;
+        pHash           = &appHandle->mdRcvHash;
     }
     else
     {
@@ -598,15 +674,22 @@ static MD_ELE_T *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T appHandle, MD_HEA
             ||
             (vos_ntohs(pMdItemHeader->msgType) == TRDP_MSG_ME))
         {
-            startElement = appHandle->pMDSndQueue;
+            startElement    = appHandle->pMDSndQueue;
+            pHash           = &appHandle->mdSndHash;
         }
         /* having no else here will render the startElement to be NULL  */
         /* this will sufficiently skip the for loop below, getting NULL */
         /* as function return value - which also will get correctly     */
         /* handled by trdp_mdRecv                                       */
     }
-    /* iterate through the receive queue */
-    for (iterMD = startElement; iterMD != NULL; iterMD = iterMD->pNext)
+    if (pHash == NULL)
+    {
+        return NULL;
+    }
+    /* iterate through the sessions of the queue with the received session ID */
+    for (iterMD = trdp_MDhashFind(startElement, pHash, pMdItemHeader->sessionID);
+         iterMD != NULL;
+         iterMD = trdp_MDhashNext(pHash, iterMD))
     {
         /* accept only local communication or matching topo counters */
         if (((pMdItemHeader->etbTopoCnt != 0u) || (pMdItemHeader->opTrnTopoCnt != 0u))
@@ -707,6 +790,10 @@ static MD_ELE_T *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T appHandle, MD_HEA
             }
         } /* end of session matching comparison */
     } /* end of for loop */
+    if (iterMD != NULL)
+    {
+        trdp_mdSchedule(appHandle, iterMD);
+    }
       /* NULL will get returned in case no matching session can be found */
       /* for the given pMdItemHeader */
     return iterMD;
@@ -728,7 +815,18 @@ static void trdp_mdCloseSessions (
     BOOL8           checkAllSockets)
 {
 
-    MD_ELE_T *iterMD;
+    MD_ELE_T    *iterMD;
+    UINT32      lIndex;
+
+    /* Messages received in chunks on connections to be closed or replaced are incomplete */
+    for (lIndex = 0u; lIndex < TRDP_MAX_MD_SOCKET_CNT; lIndex++)
+    {
+        if ((appHandle->pMDStream[lIndex] != NULL)
+            && ((appHandle->ifaceMD[lIndex].tcpParams.morituri == TRUE) || ((INT32) lIndex == socketIndex)))
+        {
+            trdp_mdStreamEnd(appHandle, lIndex);
+        }
+    }
 
     /* Check all the sockets */
     if (checkAllSockets == TRUE)
@@ -744,7 +842,8 @@ static void trdp_mdCloseSessions (
         {
             trdp_releaseSocket(appHandle->ifaceMD, iterMD->socketIdx, appHandle->mdDefault.connectTimeout,
                                FALSE, VOS_INADDR_ANY);
-            trdp_MDqueueDelElement(&appHandle->pMDSndQueue, iterMD);
+            trdp_mdUnschedule(appHandle, iterMD);
+            trdp_MDqueueDelElement(&appHandle->pMDSndQueue, &appHandle->mdSndHash, iterMD);
             vos_printLog(VOS_LOG_INFO, "Freeing %s MD caller session '%02x%02x%02x%02x%02x%02x%02x%02x'\n",
                          iterMD->pktFlags & TRDP_FLAGS_TCP ? "TCP" : "UDP",
                          iterMD->sessionID[0], iterMD->sessionID[1], iterMD->sessionID[2], iterMD->sessionID[3],
@@ -770,7 +869,8 @@ static void trdp_mdCloseSessions (
                 trdp_releaseSocket(appHandle->ifaceMD, iterMD->socketIdx, appHandle->mdDefault.connectTimeout,
                                    FALSE, VOS_INADDR_ANY);
             }
-            trdp_MDqueueDelElement(&appHandle->pMDRcvQueue, iterMD);
+            trdp_mdUnschedule(appHandle, iterMD);
+            trdp_MDqueueDelElement(&appHandle->pMDRcvQueue, &appHandle->mdRcvHash, iterMD);
             vos_printLog(VOS_LOG_INFO, "Freeing MD %s replier session '%02x%02x%02x%02x%02x%02x%02x%02x'\n",
                          iterMD->pktFlags & TRDP_FLAGS_TCP ? "TCP" : "UDP",
                          iterMD->sessionID[0], iterMD->sessionID[1], iterMD->sessionID[2], iterMD->sessionID[3],
@@ -834,6 +934,198 @@ static void trdp_mdSetSessionTimeout (
     }
 }
 
+/**********************************************************************************************************************/
+/** Schedule a queued MD session after its state or timeout changed
+ *  Sessions in one of the ARM states are appended to the ready list for trdp_mdSend(), sessions in a state handled
+ *  by trdp_mdTimeOutStateHandler() with a finite timeout are (re-)inserted into the deadline heap with their
+ *  timeToGo. Other sessions are removed from the heap, the ready list is cleaned up by trdp_mdSend().
+ *  Must be called whenever the state or the timeToGo of a queued session was set.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        MD session
+ */
+static void trdp_mdSchedule (
+    TRDP_SESSION_PT appHandle,
+    MD_ELE_T        *pElement)
+{
+    BOOL8 timed = FALSE;
+
+    pElement->retry = FALSE;
+    if (pElement->morituri == TRUE)
+    {
+        trdp_timerRemove(&appHandle->mdTimers, &pElement->timerIdx);
+        return;
+    }
+
+    switch (pElement->stateEle)
+    {
+       case TRDP_ST_TX_NOTIFY_ARM:
+       case TRDP_ST_TX_REQUEST_ARM:
+       case TRDP_ST_TX_REPLY_ARM:
+       case TRDP_ST_TX_REPLYQUERY_ARM:
+       case TRDP_ST_TX_CONFIRM_ARM:
+           if (pElement->ready == FALSE)
+           {
+               pElement->ready      = TRUE;
+               pElement->pReadyNext = NULL;
+               if (appHandle->pMDReadyLast == NULL)
+               {
+                   appHandle->pMDReadyFirst = pElement;
+               }
+               else
+               {
+                   appHandle->pMDReadyLast->pReadyNext = pElement;
+               }
+               appHandle->pMDReadyLast = pElement;
+           }
+           break;
+       case TRDP_ST_RX_REQ_W4AP_REPLY:
+       case TRDP_ST_TX_REQ_W4AP_CONFIRM:
+       case TRDP_ST_TX_REQUEST_W4REPLY:
+       case TRDP_ST_RX_REPLYQUERY_W4C:
+       case TRDP_ST_TX_REPLY_RECEIVED:
+           timed = ((pElement->interval.tv_sec != TRDP_MD_INFINITE_TIME) ||
+                    (pElement->interval.tv_usec != TRDP_MD_INFINITE_USEC_TIME)) ? TRUE : FALSE;
+           break;
+       default:
+           break;
+    }
+
+    if (timed == FALSE)
+    {
+        trdp_timerRemove(&appHandle->mdTimers, &pElement->timerIdx);
+    }
+    else if (trdp_timerInsert(&appHandle->mdTimers, pElement, &pElement->timerIdx, &pElement->timeToGo) != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "No timeout supervision for MD comId %u, out of memory\n", pElement->addr.comId);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Schedule an armed MD session which could not be sent
+ *  The session is inserted into the deadline heap to be sent again after TRDP_MD_MAN_CYCLE_TIME, not put back on
+ *  the ready list: that would make the next MD job due immediately while the socket is not ready.
+ *  trdp_mdCheckTimeouts() moves it to the ready list when the time has come.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        MD session
+ */
+static void trdp_mdRetry (
+    TRDP_SESSION_PT appHandle,
+    MD_ELE_T        *pElement)
+{
+    TRDP_TIME_T due;
+    TRDP_TIME_T delay = {0, TRDP_MD_MAN_CYCLE_TIME};
+
+    vos_getTime(&due);
+    vos_addTime(&due, &delay);
+    if (trdp_timerInsert(&appHandle->mdTimers, pElement, &pElement->timerIdx, &due) == TRDP_NO_ERR)
+    {
+        pElement->retry = TRUE;
+    }
+    else
+    {
+        vos_printLog(VOS_LOG_ERROR, "No retry delay for MD comId %u, out of memory\n", pElement->addr.comId);
+        trdp_mdSchedule(appHandle, pElement);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Remove an MD session from the deadline heap and the ready list
+ *  Must be called before the session is freed.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        MD session
+ */
+static void trdp_mdUnschedule (
+    TRDP_SESSION_PT appHandle,
+    MD_ELE_T        *pElement)
+{
+    trdp_timerRemove(&appHandle->mdTimers, &pElement->timerIdx);
+    pElement->retry = FALSE;
+
+    if (pElement->ready == TRUE)
+    {
+        MD_ELE_T    **ppIter    = &appHandle->pMDReadyFirst;
+        MD_ELE_T    *pPrev      = NULL;
+
+        while (*ppIter != NULL)
+        {
+            if (*ppIter == pElement)
+            {
+                *ppIter = pElement->pReadyNext;
+                if (appHandle->pMDReadyLast == pElement)
+                {
+                    appHandle->pMDReadyLast = pPrev;
+                }
+                break;
+            }
+            pPrev   = *ppIter;
+            ppIter  = &(*ppIter)->pReadyNext;
+        }
+        pElement->ready         = FALSE;
+        pElement->pReadyNext    = NULL;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Return the time of the next MD job
+ *  Sessions waiting in the ready list are due now, sessions to be sent again are due at their retry time. Heap
+ *  entries left behind by a later timeToGo or by closed sessions are re-keyed or dropped first, so the returned
+ *  deadline is exact.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[out]     pNext           time of the next job
+ *
+ *  @retval         TRUE            a session is to be sent or supervised, pNext is valid
+ *  @retval         FALSE           no MD job pending
+ */
+BOOL8 trdp_mdNextJob (
+    TRDP_SESSION_PT appHandle,
+    TRDP_TIME_T     *pNext)
+{
+    TRDP_TIMER_HEAP_T *pHeap = &appHandle->mdTimers;
+
+    if (appHandle->pMDReadyFirst != NULL)
+    {
+        vos_getTime(pNext);
+        return TRUE;
+    }
+    while (pHeap->count > 0u)
+    {
+        MD_ELE_T *pTop = (MD_ELE_T *) pHeap->pTimers[0].pElement;
+
+        if (pTop->morituri == TRUE)
+        {
+            trdp_timerRemove(pHeap, &pTop->timerIdx);
+        }
+        else if ((pTop->retry == FALSE) && timercmp(&pHeap->pTimers[0].timeToGo, &pTop->timeToGo, <))
+        {
+            (void) trdp_timerInsert(pHeap, pTop, &pTop->timerIdx, &pTop->timeToGo);    /* re-key only */
+        }
+        else
+        {
+            *pNext = pHeap->pTimers[0].timeToGo;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**********************************************************************************************************************/
+/** Free the deadline heap and clear the ready list of a session
+ *  The MD sessions are not freed.
+ *
+ *  @param[in]      appHandle       session pointer
+ */
+void trdp_mdFreeSchedule (
+    TRDP_SESSION_PT appHandle)
+{
+    trdp_timerFree(&appHandle->mdTimers);
+    appHandle->pMDReadyFirst    = NULL;
+    appHandle->pMDReadyLast     = NULL;
+}
+
 /**********************************************************************************************************************/
 /** Check for incoming md packet
  *
@@ -1052,9 +1344,13 @@ static TRDP_ERR_T  trdp_mdSendPacket (VOS_SOCK_T mdSock,
  *  @param[in]      appHandle       session pointer
  *  @param[in]      mdSock          socket descriptor
  *  @param[out]     pElement        pointer to received packet
+ *  @param[out]     pStreamed       TRUE if only the header was read, the data is delivered in chunks
  *  @retval         != TRDP_NO_ERR  error
  */
-static TRDP_ERR_T trdp_mdRecvTCPPacket (TRDP_SESSION_PT appHandle, VOS_SOCK_T mdSock, MD_ELE_T *pElement)
+static TRDP_ERR_T trdp_mdRecvTCPPacket (TRDP_SESSION_PT appHandle,
+                                        VOS_SOCK_T      mdSock,
+                                        MD_ELE_T        *pElement,
+                                        BOOL8           *pStreamed)
 {
     /* TCP receiver */
     TRDP_ERR_T  err = TRDP_NO_ERR;
@@ -1069,6 +1365,8 @@ static TRDP_ERR_T trdp_mdRecvTCPPacket (TRDP_SESSION_PT appHandle, VOS_SOCK_T md
     /* Initialize to 0 the stored header size*/
     UINT32      storedHeader = 0;
 
+    *pStreamed = FALSE;
+
     /* Initialize to 0 the pElement->dataSize
      * Once it is known, the message complete data size will be saved*/
     pElement->dataSize = 0u;
@@ -1138,6 +1436,15 @@ static TRDP_ERR_T trdp_mdRecvTCPPacket (TRDP_SESSION_PT appHandle, VOS_SOCK_T md
         }
     }
 
+    /* The header is complete: a large message for a listener or caller reading it in chunks is not assembled */
+    if ((err == TRDP_NO_ERR)
+        && (size >= sizeof(MD_HEADER_T))
+        && (trdp_mdStreamStart(appHandle, socketIndex, pElement) == TRUE))
+    {
+        *pStreamed = TRUE;
+        return TRDP_NO_ERR;
+    }
+
     /* Read Data */
     if ((size >= sizeof(MD_HEADER_T))
         || ((appHandle->uncompletedTCP[socketIndex] != NULL)
@@ -1171,8 +1478,8 @@ static TRDP_ERR_T trdp_mdRecvTCPPacket (TRDP_SESSION_PT appHandle, VOS_SOCK_T md
         {
             if ( trdp_packetSizeMD(pElement->dataSize) > cMinimumMDSize )
             {
-                /* we have to allocate a bigger buffer */
-                MD_PACKET_T *pBigData = (MD_PACKET_T *) vos_memAlloc(trdp_packetSizeMD(pElement->dataSize));
+                /* we have to allocate a bigger buffer, it is completely filled from the stream */
+                MD_PACKET_T *pBigData = (MD_PACKET_T *) vos_memAllocNoInit(trdp_packetSizeMD(pElement->dataSize));
                 if ( pBigData == NULL )
                 {
                     return TRDP_MEM_ERR;
@@ -1280,8 +1587,8 @@ static TRDP_ERR_T trdp_mdRecvTCPPacket (TRDP_SESSION_PT appHandle, VOS_SOCK_T md
             {
                 if ( trdp_packetSizeMD(pElement->dataSize) > cMinimumMDSize )
                 {
-                    /* we have to allocate a bigger buffer */
-                    MD_PACKET_T *pBigData = (MD_PACKET_T *) vos_memAlloc(trdp_packetSizeMD(pElement->dataSize));
+                    /* we have to allocate a bigger buffer, it is completely filled from the stream */
+                    MD_PACKET_T *pBigData = (MD_PACKET_T *) vos_memAllocNoInit(trdp_packetSizeMD(pElement->dataSize));
                     if ( pBigData == NULL )
                     {
                         return TRDP_MEM_ERR;
@@ -1352,144 +1659,444 @@ static TRDP_ERR_T trdp_mdRecvTCPPacket (TRDP_SESSION_PT appHandle, VOS_SOCK_T md
     return TRDP_NO_ERR;
 }
 
-
-
 /**********************************************************************************************************************/
-/** Receive MD packet transmitted via UDP
+/** Check if a received message is to be delivered in chunks
+ *  If the session was configured with stream set in its MD defaults, requests and notifications are delivered in
+ *  chunks to their listener and replies to their caller. Messages without a receiver are assembled and refused as
+ *  usual.
  *
  *  @param[in]      appHandle       session pointer
- *  @param[in]      mdSock          socket descriptor
- *  @param[out]     pElement        pointer to received packet
- *  @retval         != TRDP_NO_ERR  error
+ *  @param[in]      pH              header of the received message
+ *
+ *  @retval         TRUE            deliver the data in chunks
+ *  @retval         FALSE           assemble the message
  */
-static TRDP_ERR_T trdp_mdRecvUDPPacket (TRDP_SESSION_PT appHandle, VOS_SOCK_T mdSock, MD_ELE_T *pElement)
+static BOOL8 trdp_mdStreamWanted (
+    TRDP_SESSION_PT     appHandle,
+    const MD_HEADER_T   *pH)
 {
-    /* UDP receiver */
-    TRDP_ERR_T  err = TRDP_NO_ERR;
-    UINT32      size; /* Size of the all data read until now */
+    const MD_LIS_ELE_T  *pListener;
+    const MD_ELE_T      *iterMD;
 
-    /* We read the header first */
-    size = sizeof(MD_HEADER_T);
-    pElement->addr.srcIpAddr    = 0u;
-    pElement->addr.destIpAddr   = appHandle->realIP;    /* Preset destination IP  */
-
-    err = (TRDP_ERR_T) vos_sockReceiveUDP(mdSock,
-                                          (UINT8 *)pElement->pPacket,
-                                          &size,
-                                          &pElement->addr.srcIpAddr,
-                                          &pElement->replyPort,
-                                          &pElement->addr.destIpAddr,
-                                          NULL,   /* #322 */
-                                          TRUE);
-
-    /* does the announced data fit into our (small) allocated buffer?   */
-    if ( err == TRDP_NO_ERR )
+    if (appHandle->mdDefault.stream == FALSE)
     {
-        if ((size == sizeof(MD_HEADER_T))
-            && (trdp_mdCheck(appHandle, &pElement->pPacket->frameHead, size, CHECK_HEADER_ONLY) == TRDP_NO_ERR))
-        {
-            pElement->dataSize  = vos_ntohl(pElement->pPacket->frameHead.datasetLength);
-            pElement->grossSize = trdp_packetSizeMD(pElement->dataSize);
-
-            if ( trdp_packetSizeMD(pElement->dataSize) > cMinimumMDSize )
-            {
-                /* we have to allocate a bigger buffer */
-                MD_PACKET_T *pBigData = (MD_PACKET_T *) vos_memAlloc(trdp_packetSizeMD(pElement->dataSize));
-                if ( pBigData == NULL )
-                {
-                    /* Ticket #346: We have to flush the receive buffers, in case the message is too big for us. */
-                    (void) vos_sockReceiveUDP(mdSock,
-                                              (UINT8 *)pElement->pPacket,
-                                              &size,
-                                              NULL,
-                                              NULL,
-                                              NULL,
-                                              NULL,   /* #322 */
-                                              FALSE);
-                    return TRDP_MEM_ERR;
-                }
-                /*  Swap the pointers ...  */
-                vos_memFree(pElement->pPacket);
-                pElement->pPacket   = pBigData;
-                pElement->grossSize = trdp_packetSizeMD(pElement->dataSize);
-            }
-
-            /*  get the complete packet */
-            size    = pElement->grossSize;
-            err     = (TRDP_ERR_T) vos_sockReceiveUDP(mdSock,
-                                                      (UINT8 *)pElement->pPacket,
-                                                      &size,
-                                                      &pElement->addr.srcIpAddr,
-                                                      &pElement->replyPort,
-                                                      &pElement->addr.destIpAddr,
-                                                      NULL,   /* #322 */
-                                                      FALSE);
-        }
-        else
-        {
-            /* No complain in case of size==0 and TRDP_NO_ERR for reading the header
-               - ICMP port unreachable received (result of previous send) */
-            if ( size != 0u )
-            {
-                vos_printLog(VOS_LOG_INFO,
-                             "UDP MD header check failed. Packet from socket %d thrown away\n",
-                             vos_sockId(mdSock));
-            }
-
-            /* header information can't be read - throw the packet away reading some bytes */
-            size = sizeof(MD_HEADER_T);
-            (void) vos_sockReceiveUDP(mdSock,
-                                      (UINT8 *)pElement->pPacket,
-                                      &size,
-                                      &pElement->addr.srcIpAddr,
-                                      &pElement->replyPort, &pElement->addr.destIpAddr,
-                                      NULL,   /* #322 */
-                                      FALSE);
-
-            return TRDP_NODATA_ERR;
-        }
+        return FALSE;
     }
 
-    /* If the Header is incomplete, the data size will be "0". Otherwise it will be calculated. */
-    switch ( err )
+    switch (vos_ntohs(pH->msgType))
     {
-       case TRDP_NODATA_ERR:
-           vos_printLog(VOS_LOG_INFO, "vos_sockReceiveUDP - No data at socket %d\n", vos_sockId(mdSock));
-           return TRDP_NODATA_ERR;
-       case TRDP_BLOCK_ERR:
-           return TRDP_BLOCK_ERR;
-       case TRDP_NO_ERR:
-           break;
+       case TRDP_MSG_MN:
+       case TRDP_MSG_MR:
+           pListener = trdp_mdFindListener(appHandle, TRUE, pH);
+           return (pListener != NULL) ? TRUE : FALSE;
+       case TRDP_MSG_MP:
+       case TRDP_MSG_MQ:
+           for (iterMD = trdp_MDhashFind(appHandle->pMDSndQueue, &appHandle->mdSndHash, pH->sessionID);
+                iterMD != NULL;
+                iterMD = trdp_MDhashNext(&appHandle->mdSndHash, iterMD))
+           {
+               if (0 == memcmp(iterMD->sessionID, pH->sessionID, TRDP_SESS_ID_SIZE))
+               {
+                   return TRUE;
+               }
+           }
+           return FALSE;
        default:
-           vos_printLog(VOS_LOG_ERROR, "vos_sockReceiveUDP failed (Err: %d, Socket: %d)\n", err, vos_sockId(mdSock));
-           return err;
+           return FALSE;
     }
-    return TRDP_NO_ERR;
 }
 
 /**********************************************************************************************************************/
-/** Receive MD packet
+/** Start the reception of a large TCP message in chunks
+ *  Called when the header of a message is complete. If the addressee reads the message in chunks, only the header
+ *  is kept in pElement and the data is read by trdp_mdRecvStream() into a buffer of TRDP_MD_STREAM_CHUNK_SIZE.
  *
  *  @param[in]      appHandle       session pointer
- *  @param[in]      mdSock          socket descriptor
- *  @param[in]      pElement        pointer to received packet
+ *  @param[in]      socketIndex     index of the connection in ifaceMD[]
+ *  @param[in,out]  pElement        received element holding the header
  *
- *  @retval         != TRDP_NO_ERR  error
+ *  @retval         TRUE            the data is delivered in chunks
+ *  @retval         FALSE           the message is assembled as usual
  */
-static TRDP_ERR_T  trdp_mdRecvPacket (
+static BOOL8 trdp_mdStreamStart (
     TRDP_SESSION_PT appHandle,
-    VOS_SOCK_T      mdSock,
+    UINT32          socketIndex,
     MD_ELE_T        *pElement)
 {
-    TRDP_MD_STATISTICS_T *pElementStatistics;
-    TRDP_ERR_T err = TRDP_NO_ERR;
-    /* Step 1: Use the appropriate packet receiver func- */
-    /* tion and assemble there the packet buffer         */
-    if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0)
+    MD_HEADER_T         *pH         = &pElement->pPacket->frameHead;
+    UINT32              dataSize    = vos_ntohl(pH->datasetLength);
+    TRDP_MD_STREAM_T    *pStream;
+
+    if ((dataSize <= TRDP_MD_STREAM_CHUNK_SIZE)
+        || (socketIndex >= TRDP_MAX_MD_SOCKET_CNT)
+        || (trdp_mdCheck(appHandle, pH, sizeof(MD_HEADER_T), CHECK_HEADER_ONLY) != TRDP_NO_ERR)
+        || (trdp_mdStreamWanted(appHandle, pH) == FALSE))
     {
-        /* Call TCP receiver function */
-        err = trdp_mdRecvTCPPacket(appHandle, mdSock, pElement);
-        if (err != TRDP_NO_ERR)
+        return FALSE;
+    }
+
+    pStream = (TRDP_MD_STREAM_T *) vos_memAllocNoInit(sizeof(TRDP_MD_STREAM_T));
+    if (pStream == NULL)
+    {
+        /* not enough memory for the chunk buffer, try to assemble the message */
+        return FALSE;
+    }
+    pStream->sock           = appHandle->ifaceMD[socketIndex].sock;
+    pStream->msgType        = (TRDP_MSG_T) vos_ntohs(pH->msgType);
+    memcpy(pStream->sessionID, pH->sessionID, TRDP_SESS_ID_SIZE);
+    pStream->deliver        = FALSE;
+    pStream->closeSession   = FALSE;
+    pStream->dataSize       = dataSize;
+    pStream->offset         = 0u;
+    pStream->pending        = trdp_packetSizeMD(dataSize) - sizeof(MD_HEADER_T);
+    pStream->fill           = 0u;
+
+    trdp_mdStreamEnd(appHandle, socketIndex);
+    appHandle->pMDStream[socketIndex] = pStream;
+
+    /* the part of the header received before is not needed anymore */
+    if (appHandle->uncompletedTCP[socketIndex] != NULL)
+    {
+        if (appHandle->uncompletedTCP[socketIndex]->pPacket != NULL)
+        {
+            vos_memFree(appHandle->uncompletedTCP[socketIndex]->pPacket);
+        }
+        vos_memFree(appHandle->uncompletedTCP[socketIndex]);
+        appHandle->uncompletedTCP[socketIndex] = NULL;
+    }
+
+    pElement->dataSize  = dataSize;
+    pElement->grossSize = sizeof(MD_HEADER_T);
+
+    vos_printLog(VOS_LOG_INFO, "Receiving %u bytes of MD in chunks (Socket: %d)\n",
+                 (unsigned int) dataSize, vos_sockId(pStream->sock));
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Find the session a message received in chunks is delivered to
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pStream         reception state of the message
+ *
+ *  @retval         != NULL         session
+ *  @retval         NULL            no session, the data is discarded
+ */
+static MD_ELE_T *trdp_mdStreamSession (
+    TRDP_SESSION_PT         appHandle,
+    const TRDP_MD_STREAM_T  *pStream)
+{
+    MD_ELE_T        *iterMD;
+    MD_ELE_T        *pQueue;
+    TRDP_MD_HASH_T  *pHash;
+
+    if (pStream->deliver == FALSE)
+    {
+        return NULL;
+    }
+    if ((pStream->msgType == TRDP_MSG_MN) || (pStream->msgType == TRDP_MSG_MR))
+    {
+        pQueue  = appHandle->pMDRcvQueue;
+        pHash   = &appHandle->mdRcvHash;
+    }
+    else
+    {
+        pQueue  = appHandle->pMDSndQueue;
+        pHash   = &appHandle->mdSndHash;
+    }
+    for (iterMD = trdp_MDhashFind(pQueue, pHash, pStream->sessionID);
+         iterMD != NULL;
+         iterMD = trdp_MDhashNext(pHash, iterMD))
+    {
+        if ((0 == memcmp(iterMD->sessionID, pStream->sessionID, TRDP_SESS_ID_SIZE)) && (iterMD->morituri == FALSE))
+        {
+            return iterMD;
+        }
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/** End the reception of a message in chunks on a connection
+ *  If the message is incomplete (connection closed), the application is informed and the session is closed.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      socketIndex     index of the connection in ifaceMD[]
+ */
+static void trdp_mdStreamEnd (
+    TRDP_SESSION_PT appHandle,
+    UINT32          socketIndex)
+{
+    TRDP_MD_STREAM_T    *pStream = appHandle->pMDStream[socketIndex];
+    MD_ELE_T            *pSession;
+
+    if (pStream == NULL)
+    {
+        return;
+    }
+    pSession = trdp_mdStreamSession(appHandle, pStream);
+    if (pSession != NULL)
+    {
+        if (pStream->pending > 0u)
+        {
+            vos_printLog(VOS_LOG_WARNING, "MD received in chunks incomplete (%u of %u bytes)\n",
+                         (unsigned int) (pStream->offset + pStream->fill), (unsigned int) pStream->dataSize);
+            if (pSession->pfCbFunction != NULL)
+            {
+                trdp_mdInvokeCallback(pSession, appHandle, TRDP_PACKET_ERR, NULL);
+            }
+            pSession->morituri = TRUE;
+        }
+        else if (pStream->closeSession == TRUE)
+        {
+            pSession->morituri = TRUE;
+        }
+    }
+    vos_memFree(pStream);
+    appHandle->pMDStream[socketIndex] = NULL;
+}
+
+/**********************************************************************************************************************/
+/** Receive the data of a message delivered in chunks
+ *  Reads what is available on the connection. Each time the chunk buffer is full, and with the end of the message,
+ *  the callback of the session gets the data read so far; streamOffset of TRDP_MD_INFO_T is its position in the
+ *  dataset. The padding at the end of the message is read but not delivered.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      sockIndex       index of the connection in ifaceMD[]
+ *
+ *  @retval         TRDP_NO_ERR     message complete
+ *  @retval         TRDP_PACKET_ERR message incomplete, more data to come
+ *  @retval         TRDP_NODATA_ERR connection closed
+ *  @retval         != TRDP_NO_ERR  other receive errors
+ */
+static TRDP_ERR_T trdp_mdRecvStream (
+    TRDP_SESSION_PT appHandle,
+    UINT32          sockIndex)
+{
+    TRDP_MD_STREAM_T    *pStream    = appHandle->pMDStream[sockIndex];
+    TRDP_ERR_T          err         = TRDP_NO_ERR;
+    MD_ELE_T            *pSession;
+    UINT32              wanted;
+    UINT32              readSize    = 0u;
+
+    while (pStream->pending > 0u)
+    {
+        wanted = TRDP_MD_STREAM_CHUNK_SIZE - pStream->fill;
+        if (wanted > pStream->pending)
+        {
+            wanted = pStream->pending;
+        }
+        readSize    = wanted;
+        err         = (TRDP_ERR_T) vos_sockReceiveTCP(pStream->sock, &pStream->chunk[pStream->fill], &readSize);
+        if (err != TRDP_NO_ERR)
+        {
+            break;
+        }
+        pStream->fill       += readSize;
+        pStream->pending    -= readSize;
+
+        /* hand over a full chunk or the rest of the message */
+        if ((pStream->fill == TRDP_MD_STREAM_CHUNK_SIZE) || (pStream->pending == 0u))
+        {
+            if (pStream->fill > pStream->dataSize - pStream->offset)
+            {
+                pStream->fill = pStream->dataSize - pStream->offset;    /* without padding */
+            }
+            pSession = trdp_mdStreamSession(appHandle, pStream);
+            if ((pSession != NULL) && (pSession->pfCbFunction != NULL))
+            {
+                trdp_mdInvokeCallback(pSession, appHandle, TRDP_NO_ERR, pStream);
+            }
+            pStream->offset += pStream->fill;
+            pStream->fill   = 0u;
+        }
+        if (readSize < wanted)
+        {
+            /* nothing more to read for now */
+            break;
+        }
+    }
+
+    switch (err)
+    {
+       case TRDP_NO_ERR:
+           break;
+       case TRDP_BLOCK_ERR:
+           err = TRDP_NO_ERR;
+           break;
+       default:
+           /* connection closed or broken */
+           vos_printLog(VOS_LOG_INFO, "vos_sockReceiveTCP - MD in chunks aborted (Err: %d, Socket: %d)\n",
+                        err, vos_sockId(pStream->sock));
+           trdp_mdStreamEnd(appHandle, sockIndex);
+           return err;
+    }
+    if (pStream->pending > 0u)
+    {
+        return TRDP_PACKET_ERR;
+    }
+    trdp_mdStreamEnd(appHandle, sockIndex);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Free the states of the messages received in chunks of a session
+ *
+ *  @param[in]      appHandle       session pointer
+ */
+void trdp_mdFreeStreams (
+    TRDP_SESSION_PT appHandle)
+{
+    UINT32 lIndex;
+
+    for (lIndex = 0u; lIndex < TRDP_MAX_MD_SOCKET_CNT; lIndex++)
+    {
+        if (appHandle->pMDStream[lIndex] != NULL)
+        {
+            vos_memFree(appHandle->pMDStream[lIndex]);
+            appHandle->pMDStream[lIndex] = NULL;
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/** Receive MD packet transmitted via UDP
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      mdSock          socket descriptor
+ *  @param[out]     pElement        pointer to received packet
+ *  @retval         != TRDP_NO_ERR  error
+ */
+static TRDP_ERR_T trdp_mdRecvUDPPacket (TRDP_SESSION_PT appHandle, VOS_SOCK_T mdSock, MD_ELE_T *pElement)
+{
+    /* UDP receiver */
+    TRDP_ERR_T  err = TRDP_NO_ERR;
+    UINT32      size; /* Size of the all data read until now */
+
+    /* We read the header first */
+    size = sizeof(MD_HEADER_T);
+    pElement->addr.srcIpAddr    = 0u;
+    pElement->addr.destIpAddr   = appHandle->realIP;    /* Preset destination IP  */
+
+    err = (TRDP_ERR_T) vos_sockReceiveUDP(mdSock,
+                                          (UINT8 *)pElement->pPacket,
+                                          &size,
+                                          &pElement->addr.srcIpAddr,
+                                          &pElement->replyPort,
+                                          &pElement->addr.destIpAddr,
+                                          NULL,   /* #322 */
+                                          TRUE);
+
+    /* does the announced data fit into our (small) allocated buffer?   */
+    if ( err == TRDP_NO_ERR )
+    {
+        if ((size == sizeof(MD_HEADER_T))
+            && (trdp_mdCheck(appHandle, &pElement->pPacket->frameHead, size, CHECK_HEADER_ONLY) == TRDP_NO_ERR))
+        {
+            pElement->dataSize  = vos_ntohl(pElement->pPacket->frameHead.datasetLength);
+            pElement->grossSize = trdp_packetSizeMD(pElement->dataSize);
+
+            if ( trdp_packetSizeMD(pElement->dataSize) > cMinimumMDSize )
+            {
+                /* we have to allocate a bigger buffer */
+                MD_PACKET_T *pBigData = (MD_PACKET_T *) vos_memAlloc(trdp_packetSizeMD(pElement->dataSize));
+                if ( pBigData == NULL )
+                {
+                    /* Ticket #346: We have to flush the receive buffers, in case the message is too big for us. */
+                    (void) vos_sockReceiveUDP(mdSock,
+                                              (UINT8 *)pElement->pPacket,
+                                              &size,
+                                              NULL,
+                                              NULL,
+                                              NULL,
+                                              NULL,   /* #322 */
+                                              FALSE);
+                    return TRDP_MEM_ERR;
+                }
+                /*  Swap the pointers ...  */
+                vos_memFree(pElement->pPacket);
+                pElement->pPacket   = pBigData;
+                pElement->grossSize = trdp_packetSizeMD(pElement->dataSize);
+            }
+
+            /*  get the complete packet */
+            size    = pElement->grossSize;
+            err     = (TRDP_ERR_T) vos_sockReceiveUDP(mdSock,
+                                                      (UINT8 *)pElement->pPacket,
+                                                      &size,
+                                                      &pElement->addr.srcIpAddr,
+                                                      &pElement->replyPort,
+                                                      &pElement->addr.destIpAddr,
+                                                      NULL,   /* #322 */
+                                                      FALSE);
+        }
+        else
+        {
+            /* No complain in case of size==0 and TRDP_NO_ERR for reading the header
+               - ICMP port unreachable received (result of previous send) */
+            if ( size != 0u )
+            {
+                vos_printLog(VOS_LOG_INFO,
+                             "UDP MD header check failed. Packet from socket %d thrown away\n",
+                             vos_sockId(mdSock));
+            }
+
+            /* header information can't be read - throw the packet away reading some bytes */
+            size = sizeof(MD_HEADER_T);
+            (void) vos_sockReceiveUDP(mdSock,
+                                      (UINT8 *)pElement->pPacket,
+                                      &size,
+                                      &pElement->addr.srcIpAddr,
+                                      &pElement->replyPort, &pElement->addr.destIpAddr,
+                                      NULL,   /* #322 */
+                                      FALSE);
+
+            return TRDP_NODATA_ERR;
+        }
+    }
+
+    /* If the Header is incomplete, the data size will be "0". Otherwise it will be calculated. */
+    switch ( err )
+    {
+       case TRDP_NODATA_ERR:
+           vos_printLog(VOS_LOG_INFO, "vos_sockReceiveUDP - No data at socket %d\n", vos_sockId(mdSock));
+           return TRDP_NODATA_ERR;
+       case TRDP_BLOCK_ERR:
+           return TRDP_BLOCK_ERR;
+       case TRDP_NO_ERR:
+           break;
+       default:
+           vos_printLog(VOS_LOG_ERROR, "vos_sockReceiveUDP failed (Err: %d, Socket: %d)\n", err, vos_sockId(mdSock));
+           return err;
+    }
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Receive MD packet
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      mdSock          socket descriptor
+ *  @param[in]      pElement        pointer to received packet
+ *
+ *  @retval         != TRDP_NO_ERR  error
+ */
+static TRDP_ERR_T  trdp_mdRecvPacket (
+    TRDP_SESSION_PT appHandle,
+    VOS_SOCK_T      mdSock,
+    MD_ELE_T        *pElement)
+{
+    TRDP_MD_STATISTICS_T *pElementStatistics;
+    TRDP_ERR_T err = TRDP_NO_ERR;
+    BOOL8       streamed = FALSE;
+    /* Step 1: Use the appropriate packet receiver func- */
+    /* tion and assemble there the packet buffer         */
+    if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0)
+    {
+        /* Call TCP receiver function */
+        err = trdp_mdRecvTCPPacket(appHandle, mdSock, pElement, &streamed);
+        if (err != TRDP_NO_ERR)
         {
             /* fatal communication issue, exit function, but collect error stats (Ticket #267)  */
             /* return err; */
@@ -1515,7 +2122,9 @@ static TRDP_ERR_T  trdp_mdRecvPacket (
     /* sistency and TRDP protocol coherency              */
     if (err == TRDP_NO_ERR) /* Don't do it twice */
     {
-        err = trdp_mdCheck(appHandle, &pElement->pPacket->frameHead, pElement->grossSize, CHECK_DATA_TOO);
+        /* the data of a message delivered in chunks follows later */
+        err = trdp_mdCheck(appHandle, &pElement->pPacket->frameHead, pElement->grossSize,
+                           (streamed == TRUE) ? CHECK_HEADER_ONLY : CHECK_DATA_TOO);
     }
     /* Step 3: Update the statistics structure counters  */
     /* according the trdp_mdCheck result                 */
@@ -1546,6 +2155,151 @@ static TRDP_ERR_T  trdp_mdRecvPacket (
     return err;
 }
 
+/**********************************************************************************************************************/
+/** Check if a listener accepts an incoming request or notification
+ *
+ *  @param[in]      appHandle       the handle returned by tlc_init
+ *  @param[in]      pListener       listener to check
+ *  @param[in]      isTCP           TCP ?
+ *  @param[in]      pH              Header of the incoming message
+ *
+ *  @retval         TRUE            listener accepts the message
+ *  @retval         FALSE           not addressed
+ */
+static BOOL8 trdp_mdListenerAccepts (TRDP_SESSION_PT    appHandle,
+                                     const MD_LIS_ELE_T *pListener,
+                                     BOOL8              isTCP,
+                                     const MD_HEADER_T  *pH)
+{
+    if ((pListener->socketIdx != TRDP_INVALID_SOCKET_INDEX) &&
+        (isTCP == TRUE))
+    {
+        return FALSE;
+    }
+
+    /* Ticket #206: TCP requests should use TCP listeners only */
+    if ((pListener->pktFlags & TRDP_FLAGS_TCP) && (isTCP == FALSE))
+    {
+        return FALSE;
+    }
+
+    /* Ticket #180: Do the filtering as the standard demands */
+
+    /* If comID does not match but should, reject */
+    if (((pListener->privFlags & TRDP_CHECK_COMID) != 0) &&
+        (vos_ntohl(pH->comId) != pListener->addr.comId))
+    {
+        return FALSE;
+    }
+
+    /* check the source URI if set  */
+    if ((pListener->srcURI[0] != 0) &&
+        (!trdp_isAddressed(pListener->srcURI, (CHAR8 *) pH->sourceURI)))
+    {
+        return FALSE;
+    }
+
+    /* check the destination URI if set  */
+    if ((pListener->destURI[0] != 0) &&
+        (!trdp_isAddressed(pListener->destURI, (CHAR8 *) pH->destinationURI)))
+    {
+        return FALSE;
+    }
+
+    /* check topocounts before comparing source or destination IP addresses! */
+    /* Step 1: here we need to check the topccounts */
+    /* in case of train communication (topo counters != zero) check topo validity of recvd message and */
+    /* recv queue item by matching the etbTopoCnt and opTrnTopoCnt                                     */
+    if (((pH->etbTopoCnt != 0u) || (pH->opTrnTopoCnt != 0u))
+        && (!trdp_validTopoCounters( vos_ntohl(pH->etbTopoCnt),
+                                     vos_ntohl(pH->opTrnTopoCnt),
+                                     pListener->addr.etbTopoCnt,
+                                     pListener->addr.opTrnTopoCnt)))
+    {
+        return FALSE;
+    }
+
+    /* If multicast address is set, but does not match, reject */
+    if ((pListener->addr.mcGroup != 0u || vos_isMulticast(appHandle->pMDRcvEle->addr.destIpAddr)) &&
+        (pListener->addr.mcGroup != appHandle->pMDRcvEle->addr.destIpAddr))
+    {
+        /* no IP match for unicast addressing */
+        return FALSE;
+    }
+
+    /* if source IP given (and no range) */
+    if ((pListener->addr.srcIpAddr2 == 0) &&
+        (pListener->addr.srcIpAddr != 0) &&
+        (pListener->addr.srcIpAddr != appHandle->pMDRcvEle->addr.srcIpAddr))
+    {
+        return FALSE;
+    }
+
+    /* if source IP given and is within given IP range */
+    if ((pListener->addr.srcIpAddr != 0) &&
+        (pListener->addr.srcIpAddr2 != 0) &&
+        (!trdp_isInIPrange(appHandle->pMDRcvEle->addr.srcIpAddr,
+                           pListener->addr.srcIpAddr,
+                           pListener->addr.srcIpAddr2)))
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Find the listener for an incoming request or notification
+ *  The first listener of the queue accepting the message is returned. With the listener index, only the buckets of
+ *  the comId / destination URI keys of the message are searched; the first accepting listener of each bucket is a
+ *  candidate and the one registered last (highest seqNo) is the first in the queue.
+ *
+ *  @param[in]      appHandle       the handle returned by tlc_init
+ *  @param[in]      isTCP           TCP ?
+ *  @param[in]      pH              Header of the incoming message
+ *
+ *  @retval         != NULL         matching listener
+ *  @retval         NULL            no listener
+ */
+static MD_LIS_ELE_T *trdp_mdFindListener (TRDP_SESSION_PT   appHandle,
+                                          BOOL8             isTCP,
+                                          const MD_HEADER_T *pH)
+{
+    MD_LIS_ELE_T    *pBuckets[TRDP_MD_LIS_KEYS];
+    MD_LIS_ELE_T    *iterListener;
+    MD_LIS_ELE_T    *pFound = NULL;
+    UINT32          key;
+
+    if (trdp_MDlisIndexFind(&appHandle->mdLisIndex, vos_ntohl(pH->comId), (const CHAR8 *) pH->destinationURI,
+                            pBuckets) == FALSE)
+    {
+        for (iterListener = appHandle->pMDListenQueue; iterListener != NULL; iterListener = iterListener->pNext)
+        {
+            if (trdp_mdListenerAccepts(appHandle, iterListener, isTCP, pH) == TRUE)
+            {
+                return iterListener;
+            }
+        }
+        return NULL;
+    }
+
+    for (key = 0u; key < TRDP_MD_LIS_KEYS; key++)
+    {
+        /* buckets are in descending seqNo, stop at listeners older than the candidate found so far */
+        for (iterListener = pBuckets[key];
+             (iterListener != NULL) && ((pFound == NULL) || (iterListener->seqNo > pFound->seqNo));
+             iterListener = iterListener->pHashNext)
+        {
+            if (trdp_mdListenerAccepts(appHandle, iterListener, isTCP, pH) == TRUE)
+            {
+                pFound = iterListener;
+                break;
+            }
+        }
+    }
+    return pFound;
+}
+
 /**********************************************************************************************************************/
 /** Handle incoming request message - private SW level
  *
@@ -1580,9 +2334,11 @@ static TRDP_ERR_T trdp_mdHandleRequest (TRDP_SESSION_PT     appHandle,
         /* Search for existing session (in case it is a repeated request)  */
         /* This is kind of error detection/comm issue remedy functionality */
         /* running ahead of further logic */
-        for ( iterMD = appHandle->pMDRcvQueue; iterMD != NULL; iterMD = iterMD->pNext )
+        numOfReceivers = appHandle->mdRcvHash.count;
+        for ( iterMD = trdp_MDhashFind(appHandle->pMDRcvQueue, &appHandle->mdRcvHash, pH->sessionID);
+              iterMD != NULL;
+              iterMD = trdp_MDhashNext(&appHandle->mdRcvHash, iterMD) )
         {
-            numOfReceivers++; /* count the list items here */
             if ( 0 == memcmp(iterMD->pPacket->frameHead.sessionID, pH->sessionID, TRDP_SESS_ID_SIZE))
             {
                 /* According IEC61375-2-3 A.7.7.1 (BL: non existant chapter?)*/
@@ -1637,6 +2393,7 @@ static TRDP_ERR_T trdp_mdHandleRequest (TRDP_SESSION_PT     appHandle,
                     trdp_mdUpdatePacket(iterMD);
                     /* ready to proceed - will be handled by trdp_mdSend run- */
                     /* ning within its own loop triggered cyclically.         */
+                    trdp_mdSchedule(appHandle, iterMD);
                     return result;
                 }
             }
@@ -1656,121 +2413,45 @@ static TRDP_ERR_T trdp_mdHandleRequest (TRDP_SESSION_PT     appHandle,
     iterMD = NULL; /* reset item for the actual lookup task */
 
     /* search for existing listener */
-    for ( iterListener = appHandle->pMDListenQueue; iterListener != NULL;
-          iterListener = iterListener->pNext )
+    iterListener = trdp_mdFindListener(appHandle, isTCP, pH);
+    if (iterListener != NULL)
     {
-        if ((iterListener->socketIdx != TRDP_INVALID_SOCKET_INDEX) &&
-            (isTCP == TRUE))
-        {
-            continue;
-        }
-
-        /* Ticket #206: TCP requests should use TCP listeners only */
-        if ((iterListener->pktFlags & TRDP_FLAGS_TCP) && (isTCP == FALSE))
-        {
-            continue;
-        }
-
-        /* Ticket #180: Do the filtering as the standard demands */
-
-        /* If comID does not match but should, continue */
-        if (((iterListener->privFlags & TRDP_CHECK_COMID) != 0) &&
-            (vos_ntohl(pH->comId) != iterListener->addr.comId))
+        /* We found a listener, set some values for this new session  */
+        iterMD = appHandle->pMDRcvEle;
+        iterMD->pUserRef = iterListener->pUserRef;
+        iterMD->pfCbFunction        = iterListener->pfCbFunction;
+        iterMD->stateEle            = state;
+        iterMD->addr.etbTopoCnt     = iterListener->addr.etbTopoCnt;
+        iterMD->addr.opTrnTopoCnt   = iterListener->addr.opTrnTopoCnt;
+        iterMD->pktFlags            = iterListener->pktFlags;           /* BL: This was missing! */
+        iterMD->pListener           = iterListener;
+
+
+        /* Count this Request/Notification as new session */
+        iterListener->numSessions++;
+
+        if ( iterListener->socketIdx == TRDP_INVALID_SOCKET_INDEX ) /* On TCP, listeners have no socket
+           assigned  */
         {
-            continue;
-        }
-
-        /* check the source URI if set  */
-        if ((iterListener->srcURI[0] != 0) &&
-            (!trdp_isAddressed(iterListener->srcURI, (CHAR8 *) pH->sourceURI)))
-        {
-            continue;
-        }
-
-        /* check the destination URI if set  */
-        if ((iterListener->destURI[0] != 0) &&
-            (!trdp_isAddressed(iterListener->destURI, (CHAR8 *) pH->destinationURI)))
-        {
-            continue;
-        }
-
-        /* check topocounts before comparing source or destination IP addresses! */
-        /* Step 1: here we need to check the topccounts */
-        /* in case of train communication (topo counters != zero) check topo validity of recvd message and */
-        /* recv queue item by matching the etbTopoCnt and opTrnTopoCnt                                     */
-        if (((pH->etbTopoCnt != 0u) || (pH->opTrnTopoCnt != 0u))
-            && (!trdp_validTopoCounters( vos_ntohl(pH->etbTopoCnt),
-                                         vos_ntohl(pH->opTrnTopoCnt),
-                                         iterListener->addr.etbTopoCnt,
-                                         iterListener->addr.opTrnTopoCnt)))
-        {
-            continue;
-        }
-
-        /* If multicast address is set, but does not match, we go to the next listener (if any) */
-        if ((iterListener->addr.mcGroup != 0u || vos_isMulticast(appHandle->pMDRcvEle->addr.destIpAddr)) &&
-            (iterListener->addr.mcGroup != appHandle->pMDRcvEle->addr.destIpAddr))
-        {
-            /* no IP match for unicast addressing */
-            continue;
-        }
-
-        /* if source IP given (and no range) */
-        if ((iterListener->addr.srcIpAddr2 == 0) &&
-            (iterListener->addr.srcIpAddr != 0) &&
-            (iterListener->addr.srcIpAddr != appHandle->pMDRcvEle->addr.srcIpAddr))
-        {
-            continue;
+            iterMD->socketIdx = (INT32) sockIndex;
         }
-
-        /* if source IP given and is within given IP range */
-        if ((iterListener->addr.srcIpAddr != 0) &&
-            (iterListener->addr.srcIpAddr2 != 0) &&
-            (!trdp_isInIPrange(appHandle->pMDRcvEle->addr.srcIpAddr,
-                               iterListener->addr.srcIpAddr,
-                               iterListener->addr.srcIpAddr2)))
+        else
         {
-            continue;
+            iterMD->socketIdx = iterListener->socketIdx;
         }
 
-        /* If we come here, it is the right listener! */
-        {
-            /* We found a listener, set some values for this new session  */
-            iterMD = appHandle->pMDRcvEle;
-            iterMD->pUserRef = iterListener->pUserRef;
-            iterMD->pfCbFunction        = iterListener->pfCbFunction;
-            iterMD->stateEle            = state;
-            iterMD->addr.etbTopoCnt     = iterListener->addr.etbTopoCnt;
-            iterMD->addr.opTrnTopoCnt   = iterListener->addr.opTrnTopoCnt;
-            iterMD->pktFlags            = iterListener->pktFlags;           /* BL: This was missing! */
-            iterMD->pListener           = iterListener;
-
-
-            /* Count this Request/Notification as new session */
-            iterListener->numSessions++;
-
-            if ( iterListener->socketIdx == TRDP_INVALID_SOCKET_INDEX ) /* On TCP, listeners have no socket
-               assigned  */
-            {
-                iterMD->socketIdx = (INT32) sockIndex;
-            }
-            else
-            {
-                iterMD->socketIdx = iterListener->socketIdx;
-            }
-
-            trdp_MDqueueInsFirst(&appHandle->pMDRcvQueue, iterMD);
+        /* the session ID is the key of the session hash */
+        memcpy(iterMD->sessionID, pH->sessionID, TRDP_SESS_ID_SIZE);
+        trdp_MDqueueInsFirst(&appHandle->pMDRcvQueue, &appHandle->mdRcvHash, iterMD);
 
-            appHandle->pMDRcvEle = NULL;
+        appHandle->pMDRcvEle = NULL;
 
-            vos_printLog(VOS_LOG_INFO,
-                         "Creating %s MD replier session '%02x%02x%02x%02x%02x%02x%02x%02x'\n",
-                         iterMD->pktFlags & TRDP_FLAGS_TCP ? "TCP" : "UDP",
-                         pH->sessionID[0], pH->sessionID[1], pH->sessionID[2],
-                         pH->sessionID[3], pH->sessionID[4], pH->sessionID[5],
-                         pH->sessionID[6], pH->sessionID[7]);
-            break;
-        }
+        vos_printLog(VOS_LOG_INFO,
+                     "Creating %s MD replier session '%02x%02x%02x%02x%02x%02x%02x%02x'\n",
+                     iterMD->pktFlags & TRDP_FLAGS_TCP ? "TCP" : "UDP",
+                     pH->sessionID[0], pH->sessionID[1], pH->sessionID[2],
+                     pH->sessionID[3], pH->sessionID[4], pH->sessionID[5],
+                     pH->sessionID[6], pH->sessionID[7]);
     }
     if ( NULL != iterMD )
     {
@@ -1795,10 +2476,9 @@ static TRDP_ERR_T trdp_mdHandleRequest (TRDP_SESSION_PT     appHandle,
             iterMD->interval.tv_usec    = vos_ntohl(pH->replyTimeout) % 1000000;
             vos_addTime(&iterMD->timeToGo, &iterMD->interval);
         }
-        /* save session Id and sequence counter for next steps */
-        memcpy(iterMD->sessionID, pH->sessionID, TRDP_SESS_ID_SIZE);
         /* save source URI for reply */
         vos_strncpy(iterMD->srcURI, (CHAR8 *) pH->sourceURI, TRDP_MAX_URI_USER_LEN);
+        trdp_mdSchedule(appHandle, iterMD);
     }
     else
     {
@@ -2012,6 +2692,17 @@ static TRDP_ERR_T  trdp_mdRecv (
         isTCP = FALSE;
     }
 
+    /* the data of a message delivered in chunks is pending on this connection */
+    if ((isTCP == TRUE) && (appHandle->pMDStream[sockIndex] != NULL))
+    {
+        if (appHandle->pMDStream[sockIndex]->sock == appHandle->ifaceMD[sockIndex].sock)
+        {
+            return trdp_mdRecvStream(appHandle, sockIndex);
+        }
+        /* left over from a closed connection */
+        trdp_mdStreamEnd(appHandle, sockIndex);
+    }
+
     if (appHandle->pMDRcvEle->pPacket == NULL)
     {
         /* Malloc the minimum size for now */
@@ -2104,6 +2795,19 @@ static TRDP_ERR_T  trdp_mdRecv (
            break;
     }
 
+    /* The data follows in chunks: the session is informed and closed by trdp_mdRecvStream() */
+    if ((isTCP == TRUE) && (appHandle->pMDStream[sockIndex] != NULL))
+    {
+        if (NULL != iterMD)
+        {
+            appHandle->pMDStream[sockIndex]->deliver        = TRUE;
+            appHandle->pMDStream[sockIndex]->closeSession   =
+                ((iterMD->morituri == TRUE) || (iterMD->stateEle == TRDP_ST_RX_NOTIFY_RECEIVED)) ? TRUE : FALSE;
+            iterMD->morituri = FALSE;
+        }
+        return trdp_mdRecvStream(appHandle, sockIndex);
+    }
+
     /* Inform user  */
     if (NULL != iterMD && iterMD->pfCbFunction != NULL)
     {
@@ -2112,7 +2816,7 @@ static TRDP_ERR_T  trdp_mdRecv (
             /*sending Me needs to carry an error information for the callback to the application*/
             resForCallback = TRDP_NOLIST_ERR;
         }
-        trdp_mdInvokeCallback(iterMD, appHandle, resForCallback);
+        trdp_mdInvokeCallback(iterMD, appHandle, resForCallback, NULL);
     }
 
     /*  notification sessions can be discarded after application was informed */
@@ -2207,7 +2911,7 @@ void trdp_mdFreeSession (
 
 /**********************************************************************************************************************/
 /** Sending MD messages
- *  Send the messages stored in the sendQueue
+ *  Send the messages of the ready list (sessions of the send and receive queue in an ARM state)
  *  Call user's callback if needed
  *
  *  @param[in]      appHandle           session pointer
@@ -2216,27 +2920,32 @@ TRDP_ERR_T  trdp_mdSend (
     TRDP_SESSION_PT appHandle)
 {
     TRDP_ERR_T  result      = TRDP_NO_ERR;
-    MD_ELE_T    *iterMD     = appHandle->pMDSndQueue;
-    BOOL8       firstLoop   = TRUE;
+    MD_ELE_T    *iterMD;
+    UINT32      numReady    = 0u;
 
-    /*  Find the packet which has to be sent next:
-     Note: We must also check the receive queue for pending replies! */
-    do
+    /*  Only the sessions of both queues in the ready list have to be sent. Sessions armed while sending are
+        appended again and handled by the next call, sessions which could not be sent are retried after
+        TRDP_MD_MAN_CYCLE_TIME. */
+    for (iterMD = appHandle->pMDReadyFirst; iterMD != NULL; iterMD = iterMD->pReadyNext)
+    {
+        numReady++;
+    }
+
+    while ((numReady > 0u) && (appHandle->pMDReadyFirst != NULL))
     {
         int dotx = 0;
+        BOOL8 sent = FALSE;
         TRDP_MD_ELE_ST_T nextstate = TRDP_ST_NONE;
 
-        /*  Switch to receive queue */
-        if (NULL == iterMD && TRUE == firstLoop)
+        numReady--;
+        iterMD = appHandle->pMDReadyFirst;
+        appHandle->pMDReadyFirst = iterMD->pReadyNext;
+        if (appHandle->pMDReadyFirst == NULL)
         {
-            iterMD      = appHandle->pMDRcvQueue;
-            firstLoop   = FALSE;
-        }
-
-        if (NULL == iterMD)
-        {
-            break;
+            appHandle->pMDReadyLast = NULL;
         }
+        iterMD->ready       = FALSE;
+        iterMD->pReadyNext  = NULL;
 
         switch (iterMD->stateEle)
         {
@@ -2279,12 +2988,17 @@ TRDP_ERR_T  trdp_mdSend (
                     {
                         VOS_ERR_T err;
                         /* Connect() the socket */
+                        if (!timerisset(&appHandle->ifaceMD[iterMD->socketIdx].tcpParams.connectStart))
+                        {
+                            vos_getTime(&appHandle->ifaceMD[iterMD->socketIdx].tcpParams.connectStart);
+                        }
                         err = vos_sockConnect(appHandle->ifaceMD[iterMD->socketIdx].sock,
                                               iterMD->addr.destIpAddr, appHandle->mdDefault.tcpPort);
 
                         if (err == VOS_NO_ERR)
                         {
                             iterMD->tcpParameters.doConnect = FALSE;
+                            trdp_mdPoolConnected(appHandle, iterMD->socketIdx);
                             vos_printLog(VOS_LOG_INFO,
                                          "Opened TCP connection to %s (Socket: %d, Port: %u)\n",
                                          vos_ipDotted(iterMD->addr.destIpAddr),
@@ -2298,7 +3012,7 @@ TRDP_ERR_T  trdp_mdSend (
                                          vos_sockId(appHandle->ifaceMD[iterMD->socketIdx].sock),
                                          (unsigned int)appHandle->mdDefault.tcpPort);
                             iterMD->tcpParameters.doConnect = FALSE;
-                            iterMD = iterMD->pNext;
+                            trdp_mdRetry(appHandle, iterMD);
                             continue;
                         }
                         else
@@ -2328,7 +3042,7 @@ TRDP_ERR_T  trdp_mdSend (
                             }
 
                             iterMD->morituri = TRUE;
-                            iterMD = iterMD->pNext;
+                            trdp_mdSchedule(appHandle, iterMD);
                             continue;
                         }
                     }
@@ -2357,6 +3071,7 @@ TRDP_ERR_T  trdp_mdSend (
 
                     if (result == TRDP_NO_ERR)
                     {
+                        sent = TRUE;
                         if ((iterMD->pktFlags & TRDP_FLAGS_TCP) != 0)
                         {
                             appHandle->ifaceMD[iterMD->socketIdx].tcpParams.notSend = FALSE;
@@ -2365,6 +3080,7 @@ TRDP_ERR_T  trdp_mdSend (
 
                             /* Add the socket in the file descriptor*/
                             appHandle->ifaceMD[iterMD->socketIdx].tcpParams.addFileDesc = TRUE;
+                            trdp_mdPoolConnected(appHandle, iterMD->socketIdx);
                             /* increment transmission counter for TCP */
                             appHandle->stats.tcpMd.numSend++;
                         }
@@ -2468,7 +3184,7 @@ TRDP_ERR_T  trdp_mdSend (
                                     /* Execute callback for each session */
                                     if (iterMD_find->pfCbFunction != NULL)
                                     {
-                                        trdp_mdInvokeCallback(iterMD_find, appHandle, TRDP_TIMEOUT_ERR);
+                                        trdp_mdInvokeCallback(iterMD_find, appHandle, TRDP_TIMEOUT_ERR, NULL);
                                     }
                                     /* Close the socket */
                                     appHandle->ifaceMD[iterMD->socketIdx].tcpParams.morituri = TRUE;
@@ -2479,9 +3195,16 @@ TRDP_ERR_T  trdp_mdSend (
                 }
             }
         }
-        iterMD = iterMD->pNext;
+        if (dotx && (sent == FALSE) && (iterMD->morituri == FALSE))
+        {
+            /* still armed: invalid socket, redundant, or the TCP connection is not ready for sending */
+            trdp_mdRetry(appHandle, iterMD);
+        }
+        else
+        {
+            trdp_mdSchedule(appHandle, iterMD);
+        }
     }
-    while (TRUE); /*lint !e506 */
 
     trdp_mdCloseSessions(appHandle, TRDP_INVALID_SOCKET_INDEX, VOS_INVALID_SOCKET, TRUE);
 
@@ -2567,66 +3290,309 @@ void trdp_mdCheckPending (
                     *pNoDesc = appHandle->ifaceMD[iterListener->socketIdx].sock;
                 }
             }
-        }
-    }
+        }
+    }
+
+    /*  Include MD UDP receive sockets */
+    for (iterMD = appHandle->pMDRcvQueue; iterMD != NULL; iterMD = iterMD->pNext)
+    {
+        /*    There can be several sockets depending on TRDP_PD_CONFIG_T    */
+        if ((iterMD->socketIdx != TRDP_INVALID_SOCKET_INDEX)
+            && (appHandle->ifaceMD[iterMD->socketIdx].sock != VOS_INVALID_SOCKET)
+            && ((appHandle->ifaceMD[iterMD->socketIdx].type != TRDP_SOCK_MD_TCP)
+                || ((appHandle->ifaceMD[iterMD->socketIdx].type == TRDP_SOCK_MD_TCP)
+                    && (appHandle->ifaceMD[iterMD->socketIdx].tcpParams.addFileDesc == TRUE))))
+        {
+            if (!VOS_FD_ISSET(appHandle->ifaceMD[iterMD->socketIdx].sock, (VOS_FDS_T *)pFileDesc)) /*lint !e573 !e505
+                                                                                          signed/unsigned division in macro /
+                                                                                          Redundant left argument to comma */
+            {
+                VOS_FD_SET(appHandle->ifaceMD[iterMD->socketIdx].sock, (VOS_FDS_T *)pFileDesc); /*lint !e573 !e505
+                                                                                       signed/unsigned division in macro /
+                                                                                       Redundant left argument to comma */
+                if (
+                       (vos_sockCmp(appHandle->ifaceMD[iterMD->socketIdx].sock, *pNoDesc) == 1)
+                    || (*pNoDesc == VOS_INVALID_SOCKET)
+                   )
+                {
+                    *pNoDesc = appHandle->ifaceMD[iterMD->socketIdx].sock;
+                }
+            }
+        }
+    }
+
+    for (iterMD = appHandle->pMDSndQueue; iterMD != NULL; iterMD = iterMD->pNext)
+    {
+        /*    There can be several sockets depending on TRDP_PD_CONFIG_T    */
+        if ((iterMD->socketIdx != TRDP_INVALID_SOCKET_INDEX)
+            && (appHandle->ifaceMD[iterMD->socketIdx].sock != VOS_INVALID_SOCKET)
+            && ((appHandle->ifaceMD[iterMD->socketIdx].type != TRDP_SOCK_MD_TCP)
+                || ((appHandle->ifaceMD[iterMD->socketIdx].type == TRDP_SOCK_MD_TCP)
+                    && (appHandle->ifaceMD[iterMD->socketIdx].tcpParams.addFileDesc == TRUE))))
+        {
+            if (!VOS_FD_ISSET(appHandle->ifaceMD[iterMD->socketIdx].sock, (VOS_FDS_T *)pFileDesc)) /*lint !e573 !e505
+                                                                                          signed/unsigned division in macro /
+                                                                                          Redundant left argument to comma */
+            {
+                VOS_FD_SET(appHandle->ifaceMD[iterMD->socketIdx].sock, (VOS_FDS_T *)pFileDesc); /*lint !e573 !e505
+                                                                                       signed/unsigned division in macro /
+                                                                                       Redundant left argument to comma */
+                if (
+                       (vos_sockCmp(appHandle->ifaceMD[iterMD->socketIdx].sock, *pNoDesc) >= 0)
+                    || (*pNoDesc == VOS_INVALID_SOCKET)
+                   )
+                {
+                    *pNoDesc = appHandle->ifaceMD[iterMD->socketIdx].sock;
+                }
+            }
+        }
+    }
+}
+
+
+/**********************************************************************************************************************/
+/** Accept all connection requests queued up on the TCP listen socket
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in,out]  pRfds               pointer to set of ready descriptors, may be NULL
+ *  @param[in,out]  pCount              pointer to number of ready descriptors, may be NULL
+ */
+void  trdp_mdAcceptConnections (
+    const TRDP_SESSION_PT   appHandle,
+    TRDP_FDS_T              *pRfds,
+    INT32                   *pCount)
+{
+    TRDP_ERR_T  err;
+    VOS_SOCK_T  new_sd = VOS_INVALID_SOCKET;
+
+    if ((appHandle == NULL) ||
+        (appHandle->tcpFd.listen_sd == VOS_INVALID_SOCKET))
+    {
+        return;
+    }
+
+    /*************************************************/
+    /* Accept all incoming connections that are      */
+    /* queued up on the listening socket.            */
+    /*************************************************/
+    do
+    {
+        /**********************************************/
+        /* Accept each incoming connection.           */
+        /* Check any failure on accept                */
+        /**********************************************/
+        TRDP_IP_ADDR_T  newIp;
+        UINT16          read_tcpPort;
+
+        newIp = appHandle->realIP;
+        read_tcpPort = appHandle->mdDefault.tcpPort;
+
+        err = (TRDP_ERR_T) vos_sockAccept(appHandle->tcpFd.listen_sd,
+                                          &new_sd, &newIp,
+                                          &(read_tcpPort));
+
+        if (new_sd == VOS_INVALID_SOCKET)
+        {
+            if (err == TRDP_NO_ERR)
+            {
+                break;
+            }
+            else
+            {
+                vos_printLog(VOS_LOG_ERROR, "vos_sockAccept() failed (Err: %d, Socket: %d, Port: %u)\n",
+                             err, vos_sockId(appHandle->tcpFd.listen_sd), (unsigned int) read_tcpPort);
+
+                /* Callback the error to the application  */
+                if (appHandle->mdDefault.pfCbFunction != NULL)
+                {
+                    TRDP_MD_INFO_T theMessage = cTrdp_md_info_default;
+
+                    theMessage.etbTopoCnt   = appHandle->etbTopoCnt;
+                    theMessage.opTrnTopoCnt = appHandle->opTrnTopoCnt;
+                    theMessage.resultCode   = TRDP_SOCK_ERR;
+                    theMessage.srcIpAddr    = newIp;
+                    appHandle->mdDefault.pfCbFunction(appHandle->mdDefault.pRefCon, appHandle,
+                                                      &theMessage, NULL, 0);
+                }
+                continue;
+            }
+        }
+        else
+        {
+            vos_printLog(VOS_LOG_INFO, "Accepting new TCP connection on Socket: %d (Port: %u)\n",
+                         vos_sockId(new_sd), (unsigned int) read_tcpPort);
+        }
+
+        {
+            VOS_SOCK_OPT_T trdp_sock_opt;
+
+            memset(&trdp_sock_opt, 0, sizeof(trdp_sock_opt));
+
+            trdp_sock_opt.qos   = appHandle->mdDefault.sendParam.qos;
+            trdp_sock_opt.ttl   = appHandle->mdDefault.sendParam.ttl;
+            trdp_sock_opt.ttl_multicast = 0;
+            trdp_sock_opt.reuseAddrPort = TRUE;
+            trdp_sock_opt.nonBlocking   = TRUE;
+            trdp_sock_opt.no_mc_loop    = FALSE;
+
+            err = (TRDP_ERR_T) vos_sockSetOptions(new_sd, &trdp_sock_opt);
+            if (err != TRDP_NO_ERR)
+            {
+                continue;
+            }
+        }
+
+        /* There is one more socket to manage */
+
+        /* Compare with the sockets stored in the socket list */
+        {
+            INT32   socketIndex;
+            BOOL8   socketFound = FALSE;
+
+            for (socketIndex = 0; socketIndex < trdp_getCurrentMaxSocketCnt(TRDP_SOCK_MD_UDP); socketIndex++)
+            {
+                if ((appHandle->ifaceMD[socketIndex].sock != VOS_INVALID_SOCKET)
+                    && (appHandle->ifaceMD[socketIndex].type == TRDP_SOCK_MD_TCP)
+                    && (appHandle->ifaceMD[socketIndex].tcpParams.cornerIp == newIp)
+                    && (appHandle->ifaceMD[socketIndex].rcvMostly == TRUE))
+                {
+                    vos_printLog(VOS_LOG_INFO, "New socket accepted from the same device (Ip = %u)\n", newIp);
+
+                    if (appHandle->ifaceMD[socketIndex].usage > 0)
+                    {
+                        vos_printLog(
+                            VOS_LOG_INFO,
+                            "The new socket accepted from the same device (Ip = %u), won't be removed, because it is still in use\n",
+                            newIp);
+                        socketFound = TRUE;
+                        break;
+                    }
+
+                    if ((pRfds != NULL) &&
+                        VOS_FD_ISSET(appHandle->ifaceMD[socketIndex].sock, (VOS_FDS_T *) pRfds)) /*lint !e573 !e505
+                                                                                        signed/unsigned division in macro /
+                                                                                        Redundant left argument to comma */
+                    {
+                        /* Decrement the Ready descriptors counter */
+                        if (pCount != NULL)
+                        {
+                            (*pCount)--;
+                        }
+                        VOS_FD_CLR(appHandle->ifaceMD[socketIndex].sock, (VOS_FDS_T *) pRfds); /*lint !e502 !e573 !e505
+                                                                                        signed/unsigned division
+                                                                                        in macro */
+                    }
+
+
+                    /* Close the old socket */
+                    appHandle->ifaceMD[socketIndex].tcpParams.morituri = TRUE;
+
+                    /* Manage the socket pool (update the socket) */
+                    trdp_mdCloseSessions(appHandle, socketIndex, new_sd, TRUE);
+
+                    socketFound = TRUE;
+                    break;
+                }
+            }
 
-    /*  Include MD UDP receive sockets */
-    for (iterMD = appHandle->pMDRcvQueue; iterMD != NULL; iterMD = iterMD->pNext)
-    {
-        /*    There can be several sockets depending on TRDP_PD_CONFIG_T    */
-        if ((iterMD->socketIdx != TRDP_INVALID_SOCKET_INDEX)
-            && (appHandle->ifaceMD[iterMD->socketIdx].sock != VOS_INVALID_SOCKET)
-            && ((appHandle->ifaceMD[iterMD->socketIdx].type != TRDP_SOCK_MD_TCP)
-                || ((appHandle->ifaceMD[iterMD->socketIdx].type == TRDP_SOCK_MD_TCP)
-                    && (appHandle->ifaceMD[iterMD->socketIdx].tcpParams.addFileDesc == TRUE))))
-        {
-            if (!VOS_FD_ISSET(appHandle->ifaceMD[iterMD->socketIdx].sock, (VOS_FDS_T *)pFileDesc)) /*lint !e573 !e505
-                                                                                          signed/unsigned division in macro /
-                                                                                          Redundant left argument to comma */
+            if (socketFound == FALSE)
             {
-                VOS_FD_SET(appHandle->ifaceMD[iterMD->socketIdx].sock, (VOS_FDS_T *)pFileDesc); /*lint !e573 !e505
-                                                                                       signed/unsigned division in macro /
-                                                                                       Redundant left argument to comma */
-                if (
-                       (vos_sockCmp(appHandle->ifaceMD[iterMD->socketIdx].sock, *pNoDesc) == 1)
-                    || (*pNoDesc == VOS_INVALID_SOCKET)
-                   )
+                /* Save the new socket in the ifaceMD.
+                   On receiving MD data on this connection, a listener will be searched and a receive
+                   session instantiated. The socket/connection will be closed when the session has finished.
+                 */
+                err = trdp_requestSocket(
+                        appHandle->ifaceMD,
+                        appHandle->mdDefault.tcpPort,
+                        &appHandle->mdDefault.sendParam,
+                        appHandle->realIP,
+                        0,
+                        TRDP_SOCK_MD_TCP,
+                        TRDP_OPTION_NONE,
+                        TRUE,
+                        new_sd,
+                        &socketIndex,
+                        newIp);
+
+                if (err != TRDP_NO_ERR)
                 {
-                    *pNoDesc = appHandle->ifaceMD[iterMD->socketIdx].sock;
+                    vos_printLog(VOS_LOG_ERROR, "trdp_requestSocket() failed (Err: %d, Port: %u)\n",
+                                 err, (UINT32)appHandle->mdDefault.tcpPort);
                 }
             }
         }
+
+        /**********************************************/
+        /* Loop back up and accept another incoming   */
+        /* connection                                 */
+        /**********************************************/
     }
+    while (new_sd != VOS_INVALID_SOCKET);
+}
 
-    for (iterMD = appHandle->pMDSndQueue; iterMD != NULL; iterMD = iterMD->pNext)
+/**********************************************************************************************************************/
+/** Receive one MD message on a socket
+ *  A TCP connection is closed if the corner closed it or if it is out of sync.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      lIndex              index of the socket in ifaceMD
+ */
+void  trdp_mdReceiveSocket (
+    const TRDP_SESSION_PT   appHandle,
+    INT32                   lIndex)
+{
+    TRDP_ERR_T err;
+
+    if ((appHandle == NULL) ||
+        (lIndex < 0) ||
+        (lIndex >= TRDP_MAX_MD_SOCKET_CNT) ||
+        (appHandle->ifaceMD[lIndex].sock == VOS_INVALID_SOCKET) ||
+        (appHandle->ifaceMD[lIndex].type == TRDP_SOCK_PD))
     {
-        /*    There can be several sockets depending on TRDP_PD_CONFIG_T    */
-        if ((iterMD->socketIdx != TRDP_INVALID_SOCKET_INDEX)
-            && (appHandle->ifaceMD[iterMD->socketIdx].sock != VOS_INVALID_SOCKET)
-            && ((appHandle->ifaceMD[iterMD->socketIdx].type != TRDP_SOCK_MD_TCP)
-                || ((appHandle->ifaceMD[iterMD->socketIdx].type == TRDP_SOCK_MD_TCP)
-                    && (appHandle->ifaceMD[iterMD->socketIdx].tcpParams.addFileDesc == TRUE))))
+        return;
+    }
+
+    err = trdp_mdRecv(appHandle, (UINT32) lIndex);
+
+    if (appHandle->ifaceMD[lIndex].type == TRDP_SOCK_MD_TCP)
+    {
+        /* The receive message is incomplete */
+        if (err == TRDP_PACKET_ERR)
         {
-            if (!VOS_FD_ISSET(appHandle->ifaceMD[iterMD->socketIdx].sock, (VOS_FDS_T *)pFileDesc)) /*lint !e573 !e505
-                                                                                          signed/unsigned division in macro /
-                                                                                          Redundant left argument to comma */
-            {
-                VOS_FD_SET(appHandle->ifaceMD[iterMD->socketIdx].sock, (VOS_FDS_T *)pFileDesc); /*lint !e573 !e505
-                                                                                       signed/unsigned division in macro /
-                                                                                       Redundant left argument to comma */
-                if (
-                       (vos_sockCmp(appHandle->ifaceMD[iterMD->socketIdx].sock, *pNoDesc) >= 0)
-                    || (*pNoDesc == VOS_INVALID_SOCKET)
-                   )
-                {
-                    *pNoDesc = appHandle->ifaceMD[iterMD->socketIdx].sock;
-                }
-            }
+            vos_printLog(VOS_LOG_INFO, "Incomplete TCP MD received (Socket: %d)\n",
+                         vos_sockId(appHandle->ifaceMD[lIndex].sock));
+        }
+        /* A packet error on TCP should not lead to closing of the connection!
+             The following if-clauses were converted to else-if to prevent a false error handling (Ticket #160) */
+        /* Check if the socket has been closed in the other corner */
+        else if (err == TRDP_NODATA_ERR)
+        {
+            vos_printLog(VOS_LOG_INFO,
+                         "The socket has been closed in the other corner (Corner Ip: %s, Socket: %d)\n",
+                         vos_ipDotted(appHandle->ifaceMD[lIndex].tcpParams.cornerIp),
+                         vos_sockId(appHandle->ifaceMD[lIndex].sock));
+
+            appHandle->ifaceMD[lIndex].tcpParams.morituri = TRUE;
+
+            trdp_mdCloseSessions(appHandle, TRDP_INVALID_SOCKET_INDEX, VOS_INVALID_SOCKET, TRUE);
+        }
+        /* Check if the socket has been closed in the other corner */
+        else if ((err == TRDP_CRC_ERR) ||
+                 (err == TRDP_WIRE_ERR) ||
+                 (err == TRDP_TOPO_ERR))
+        {
+            vos_printLog(VOS_LOG_WARNING,
+                         "Closing TCP connection, out of sync (Corner Ip: %s, Socket: %d)\n",
+                         vos_ipDotted(appHandle->ifaceMD[lIndex].tcpParams.cornerIp),
+                         vos_sockId(appHandle->ifaceMD[lIndex].sock));
+
+            appHandle->ifaceMD[lIndex].tcpParams.morituri = TRUE;
+
+            trdp_mdCloseSessions(appHandle, TRDP_INVALID_SOCKET_INDEX, VOS_INVALID_SOCKET, TRUE);
         }
     }
 }
 
-
 /**********************************************************************************************************************/
 /** Checking receive connection requests and data
  *  Call user's callback if needed
@@ -2644,8 +3610,6 @@ void  trdp_mdCheckListenSocks (
     INT32       noOfDesc;
     VOS_SOCK_T  highDesc = VOS_INVALID_SOCKET;
     INT32       lIndex;
-    TRDP_ERR_T  err;
-    VOS_SOCK_T  new_sd = VOS_INVALID_SOCKET;
 
     if (appHandle == NULL)
     {
@@ -2726,159 +3690,7 @@ void  trdp_mdCheckListenSocks (
             /****************************************************/
             (*pCount)--;
 
-            /*************************************************/
-            /* Accept all incoming connections that are      */
-            /* queued up on the listening socket.            */
-            /*************************************************/
-            do
-            {
-                /**********************************************/
-                /* Accept each incoming connection.           */
-                /* Check any failure on accept                */
-                /**********************************************/
-                TRDP_IP_ADDR_T  newIp;
-                UINT16          read_tcpPort;
-
-                newIp = appHandle->realIP;
-                read_tcpPort = appHandle->mdDefault.tcpPort;
-
-                err = (TRDP_ERR_T) vos_sockAccept(appHandle->tcpFd.listen_sd,
-                                                  &new_sd, &newIp,
-                                                  &(read_tcpPort));
-
-                if (new_sd == VOS_INVALID_SOCKET)
-                {
-                    if (err == TRDP_NO_ERR)
-                    {
-                        break;
-                    }
-                    else
-                    {
-                        vos_printLog(VOS_LOG_ERROR, "vos_sockAccept() failed (Err: %d, Socket: %d, Port: %u)\n",
-                                     err, vos_sockId(appHandle->tcpFd.listen_sd), (unsigned int) read_tcpPort);
-
-                        /* Callback the error to the application  */
-                        if (appHandle->mdDefault.pfCbFunction != NULL)
-                        {
-                            TRDP_MD_INFO_T theMessage = cTrdp_md_info_default;
-
-                            theMessage.etbTopoCnt   = appHandle->etbTopoCnt;
-                            theMessage.opTrnTopoCnt = appHandle->opTrnTopoCnt;
-                            theMessage.resultCode   = TRDP_SOCK_ERR;
-                            theMessage.srcIpAddr    = newIp;
-                            appHandle->mdDefault.pfCbFunction(appHandle->mdDefault.pRefCon, appHandle,
-                                                              &theMessage, NULL, 0);
-                        }
-                        continue;
-                    }
-                }
-                else
-                {
-                    vos_printLog(VOS_LOG_INFO, "Accepting new TCP connection on Socket: %d (Port: %u)\n",
-                                 vos_sockId(new_sd), (unsigned int) read_tcpPort);
-                }
-
-                {
-                    VOS_SOCK_OPT_T trdp_sock_opt;
-
-                    memset(&trdp_sock_opt, 0, sizeof(trdp_sock_opt));
-
-                    trdp_sock_opt.qos   = appHandle->mdDefault.sendParam.qos;
-                    trdp_sock_opt.ttl   = appHandle->mdDefault.sendParam.ttl;
-                    trdp_sock_opt.ttl_multicast = 0;
-                    trdp_sock_opt.reuseAddrPort = TRUE;
-                    trdp_sock_opt.nonBlocking   = TRUE;
-                    trdp_sock_opt.no_mc_loop    = FALSE;
-
-                    err = (TRDP_ERR_T) vos_sockSetOptions(new_sd, &trdp_sock_opt);
-                    if (err != TRDP_NO_ERR)
-                    {
-                        continue;
-                    }
-                }
-
-                /* There is one more socket to manage */
-
-                /* Compare with the sockets stored in the socket list */
-                {
-                    INT32   socketIndex;
-                    BOOL8   socketFound = FALSE;
-
-                    for (socketIndex = 0; socketIndex < trdp_getCurrentMaxSocketCnt(TRDP_SOCK_MD_UDP); socketIndex++)
-                    {
-                        if ((appHandle->ifaceMD[socketIndex].sock != VOS_INVALID_SOCKET)
-                            && (appHandle->ifaceMD[socketIndex].type == TRDP_SOCK_MD_TCP)
-                            && (appHandle->ifaceMD[socketIndex].tcpParams.cornerIp == newIp)
-                            && (appHandle->ifaceMD[socketIndex].rcvMostly == TRUE))
-                        {
-                            vos_printLog(VOS_LOG_INFO, "New socket accepted from the same device (Ip = %u)\n", newIp);
-
-                            if (appHandle->ifaceMD[socketIndex].usage > 0)
-                            {
-                                vos_printLog(
-                                    VOS_LOG_INFO,
-                                    "The new socket accepted from the same device (Ip = %u), won't be removed, because it is still in use\n",
-                                    newIp);
-                                socketFound = TRUE;
-                                break;
-                            }
-
-                            if (VOS_FD_ISSET(appHandle->ifaceMD[socketIndex].sock, (VOS_FDS_T *) pRfds)) /*lint !e573 !e505
-                                                                                                signed/unsigned division in macro /
-                                                                                                Redundant left argument to comma */
-                            {
-                                /* Decrement the Ready descriptors counter */
-                                (*pCount)--;
-                                VOS_FD_CLR(appHandle->ifaceMD[socketIndex].sock, (VOS_FDS_T *) pRfds); /*lint !e502 !e573 !e505
-                                                                                                signed/unsigned division
-                                                                                                in macro */
-                            }
-
-
-                            /* Close the old socket */
-                            appHandle->ifaceMD[socketIndex].tcpParams.morituri = TRUE;
-
-                            /* Manage the socket pool (update the socket) */
-                            trdp_mdCloseSessions(appHandle, socketIndex, new_sd, TRUE);
-
-                            socketFound = TRUE;
-                            break;
-                        }
-                    }
-
-                    if (socketFound == FALSE)
-                    {
-                        /* Save the new socket in the ifaceMD.
-                           On receiving MD data on this connection, a listener will be searched and a receive
-                           session instantiated. The socket/connection will be closed when the session has finished.
-                         */
-                        err = trdp_requestSocket(
-                                appHandle->ifaceMD,
-                                appHandle->mdDefault.tcpPort,
-                                &appHandle->mdDefault.sendParam,
-                                appHandle->realIP,
-                                0,
-                                TRDP_SOCK_MD_TCP,
-                                TRDP_OPTION_NONE,
-                                TRUE,
-                                new_sd,
-                                &socketIndex,
-                                newIp);
-
-                        if (err != TRDP_NO_ERR)
-                        {
-                            vos_printLog(VOS_LOG_ERROR, "trdp_requestSocket() failed (Err: %d, Port: %u)\n",
-                                         err, (UINT32)appHandle->mdDefault.tcpPort);
-                        }
-                    }
-                }
-
-                /**********************************************/
-                /* Loop back up and accept another incoming   */
-                /* connection                                 */
-                /**********************************************/
-            }
-            while (new_sd != VOS_INVALID_SOCKET);
+            trdp_mdAcceptConnections(appHandle, pRfds, pCount);
         }
     }
 
@@ -2902,45 +3714,7 @@ void  trdp_mdCheckListenSocks (
             }
             VOS_FD_CLR(appHandle->ifaceMD[lIndex].sock, (VOS_FDS_T *)pRfds); /*lint !e502 !e573 !e505 signed/unsigned division in macro
                                                                       */
-            err = trdp_mdRecv(appHandle, (UINT32) lIndex);
-
-            if (appHandle->ifaceMD[lIndex].type == TRDP_SOCK_MD_TCP)
-            {
-                /* The receive message is incomplete */
-                if (err == TRDP_PACKET_ERR)
-                {
-                    vos_printLog(VOS_LOG_INFO, "Incomplete TCP MD received (Socket: %d)\n",
-                                 vos_sockId(appHandle->ifaceMD[lIndex].sock));
-                }
-                /* A packet error on TCP should not lead to closing of the connection!
-                     The following if-clauses were converted to else-if to prevent a false error handling (Ticket #160) */
-                /* Check if the socket has been closed in the other corner */
-                else if (err == TRDP_NODATA_ERR)
-                {
-                    vos_printLog(VOS_LOG_INFO,
-                                 "The socket has been closed in the other corner (Corner Ip: %s, Socket: %d)\n",
-                                 vos_ipDotted(appHandle->ifaceMD[lIndex].tcpParams.cornerIp),
-                                 vos_sockId(appHandle->ifaceMD[lIndex].sock));
-
-                    appHandle->ifaceMD[lIndex].tcpParams.morituri = TRUE;
-
-                    trdp_mdCloseSessions(appHandle, TRDP_INVALID_SOCKET_INDEX, VOS_INVALID_SOCKET, TRUE);
-                }
-                /* Check if the socket has been closed in the other corner */
-                else if ((err == TRDP_CRC_ERR) ||
-                         (err == TRDP_WIRE_ERR) ||
-                         (err == TRDP_TOPO_ERR))
-                {
-                    vos_printLog(VOS_LOG_WARNING,
-                                 "Closing TCP connection, out of sync (Corner Ip: %s, Socket: %d)\n",
-                                 vos_ipDotted(appHandle->ifaceMD[lIndex].tcpParams.cornerIp),
-                                 vos_sockId(appHandle->ifaceMD[lIndex].sock));
-
-                    appHandle->ifaceMD[lIndex].tcpParams.morituri = TRUE;
-
-                    trdp_mdCloseSessions(appHandle, TRDP_INVALID_SOCKET_INDEX, VOS_INVALID_SOCKET, TRUE);
-                }
-            }
+            trdp_mdReceiveSocket(appHandle, lIndex);
         }
     }
 }
@@ -2957,62 +3731,62 @@ void  trdp_mdCheckListenSocks (
 void  trdp_mdCheckTimeouts (
     TRDP_SESSION_PT appHandle)
 {
-    MD_ELE_T    *iterMD     = appHandle->pMDSndQueue;
-    BOOL8       firstLoop   = TRUE;
-    BOOL8       timeOut;
-    TRDP_TIME_T now = {0};
+    MD_ELE_T                *iterMD;
+    BOOL8                   timeOut;
+    TRDP_TIME_T             now     = {0};
+    TRDP_TIMER_HEAP_T       *pHeap;
 
     if (appHandle == NULL)
     {
         return;
     }
+    pHeap = &appHandle->mdTimers;
 
-    /*  Find the sessions which needs action
-     Note: We must also check the receive queue for pending replies! */
-    do
+    /*  Only the sessions of both queues whose timeout expired need action: they are at the top of the heap */
+    vos_getTime(&now);
+    while ((pHeap->count > 0u) && (0 > vos_cmpTime(&pHeap->pTimers[0].timeToGo, &now)))
     {
         TRDP_ERR_T resultCode = TRDP_UNKNOWN_ERR;
         timeOut = FALSE; /* #393 TRDP-104: Make shure that timeouts of MD request do not affect other MD requests */
 
-        /*  Switch to receive queue */
-        if (NULL == iterMD && TRUE == firstLoop)
+        iterMD = (MD_ELE_T *) pHeap->pTimers[0].pElement;
+
+        /* retry delay of an armed session expired: send it again */
+        if ((iterMD->morituri != TRUE) && (iterMD->retry == TRUE))
         {
-            iterMD      = appHandle->pMDRcvQueue;
-            firstLoop   = FALSE;
+            trdp_timerRemove(pHeap, &iterMD->timerIdx);
+            trdp_mdSchedule(appHandle, iterMD);
+            continue;
         }
-
-        /*  Are we finished?   */
-        if (NULL == iterMD)
+        /* timeout moved later since the session was scheduled: re-key */
+        if ((iterMD->morituri != TRUE) && (0 > vos_cmpTime(&pHeap->pTimers[0].timeToGo, &iterMD->timeToGo)))
         {
-            break;
+            (void) trdp_timerInsert(pHeap, iterMD, &iterMD->timerIdx, &iterMD->timeToGo);    /* re-key only */
+            continue;
         }
+        trdp_timerRemove(pHeap, &iterMD->timerIdx);
 
         /* #393 FIX: Do not inform user if MD request is about to die */
         if (iterMD->morituri != TRUE)
         {
-            /* Update the current time always inside loop in case of application delays  */
-            vos_getTime(&now);
-
-            /* timeToGo is timeout value! */
-            if (((iterMD->interval.tv_sec != TRDP_MD_INFINITE_TIME) ||
-                 (iterMD->interval.tv_usec != TRDP_MD_INFINITE_USEC_TIME)) &&
-                (0 > vos_cmpTime(&iterMD->timeToGo, &now)))     /* timeout overflow */
-            {
-                timeOut = trdp_mdTimeOutStateHandler( iterMD, appHandle, &resultCode);
-            }
+            timeOut = trdp_mdTimeOutStateHandler( iterMD, appHandle, &resultCode);
 
             if (TRUE == timeOut)    /* Notify user  */
             {
                 /* Execute callback */
                 if (iterMD->pfCbFunction != NULL)
                 {
-                    trdp_mdInvokeCallback(iterMD, appHandle, resultCode);
+                    trdp_mdInvokeCallback(iterMD, appHandle, resultCode, NULL);
                 }
             }
+
+            /* a retransmission is armed, any other session is about to die */
+            trdp_mdSchedule(appHandle, iterMD);
         }
-        iterMD = iterMD->pNext;
+
+        /* Update the current time in case of application delays  */
+        vos_getTime(&now);
     }
-    while (TRUE); /*lint !e506 */
 
     /* Check for sockets Connection Timeouts */
     /* if ((appHandle->mdDefault.flags & TRDP_FLAGS_TCP) != 0) */
@@ -3028,11 +3802,13 @@ void  trdp_mdCheckTimeouts (
                 && ((appHandle->ifaceMD[lIndex].tcpParams.connectionTimeout.tv_sec > 0)
                     || (appHandle->ifaceMD[lIndex].tcpParams.connectionTimeout.tv_usec > 0)))
             {
-                if (0 > vos_cmpTime(&appHandle->ifaceMD[lIndex].tcpParams.connectionTimeout, &now))
+                if ((0 > vos_cmpTime(&appHandle->ifaceMD[lIndex].tcpParams.connectionTimeout, &now)) &&
+                    (appHandle->ifaceMD[lIndex].tcpParams.morituri == FALSE))
                 {
                     vos_printLog(VOS_LOG_INFO, "The socket (Num = %d) TIMEOUT\n",
                                  vos_sockId(appHandle->ifaceMD[lIndex].sock));
                     appHandle->ifaceMD[lIndex].tcpParams.morituri = TRUE;
+                    appHandle->tcpPoolStats.numIdleClosed++;
                 }
             }
         }
@@ -3067,7 +3843,7 @@ void  trdp_mdCheckTimeouts (
                             /* Execute callback for each session */
                             if (iterMD_find->pfCbFunction != NULL)
                             {
-                                trdp_mdInvokeCallback(iterMD_find, appHandle, TRDP_TIMEOUT_ERR);
+                                trdp_mdInvokeCallback(iterMD_find, appHandle, TRDP_TIMEOUT_ERR, NULL);
                             }
                         }
                     }
@@ -3084,6 +3860,194 @@ void  trdp_mdCheckTimeouts (
 
 
 
+/**********************************************************************************************************************/
+/** Find an idle TCP connection of the caller pool
+ *  The connections of the pool are the caller sockets of ifaceMD[] connected to the replier. A connection is idle
+ *  if no session uses it, it is closed by trdp_mdCheckTimeouts() when its connectionTimeout expired.
+ *  Among the idle connections to the replier, the one idle for the longest time is returned, so that concurrent
+ *  sessions use all connections of the pool in turn.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pSendParam          send parameters of the session
+ *  @param[in]      srcIpAddr           own IP address
+ *  @param[in]      destIpAddr          IP address of the replier
+ *  @param[out]     pNumIdle            number of idle connections to the replier, may be NULL
+ *
+ *  @retval         index of the connection in ifaceMD[], TRDP_INVALID_SOCKET_INDEX if none is idle
+ */
+static INT32 trdp_mdPoolFind (
+    TRDP_SESSION_PT         appHandle,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          destIpAddr,
+    UINT32                  *pNumIdle)
+{
+    TRDP_IP_ADDR_T  bindAddr    = vos_determineBindAddr(srcIpAddr, 0u, FALSE);
+    INT32           found       = TRDP_INVALID_SOCKET_INDEX;
+    UINT32          numIdle     = 0u;
+    INT32           lIndex;
+
+    for (lIndex = 0; lIndex < trdp_getCurrentMaxSocketCnt(TRDP_SOCK_MD_TCP); lIndex++)
+    {
+        const TRDP_SOCKETS_T *pSock = &appHandle->ifaceMD[lIndex];
+
+        if ((pSock->sock != VOS_INVALID_SOCKET)
+            && (pSock->type == TRDP_SOCK_MD_TCP)
+            && (pSock->rcvMostly == FALSE)
+            && (pSock->usage == 0)
+            && (pSock->tcpParams.morituri == FALSE)
+            && (pSock->tcpParams.cornerIp == destIpAddr)
+            && ((bindAddr == 0u) || (pSock->bindAddr == bindAddr))
+            && (pSock->sendParam.qos == pSendParam->qos)
+            && (pSock->sendParam.ttl == pSendParam->ttl)
+            && (pSock->sendParam.tsn == pSendParam->tsn)
+            && (pSock->sendParam.vlan == pSendParam->vlan))
+        {
+            numIdle++;
+            if ((found == TRDP_INVALID_SOCKET_INDEX) ||
+                (0 > vos_cmpTime(&pSock->tcpParams.connectionTimeout,
+                                 &appHandle->ifaceMD[found].tcpParams.connectionTimeout)))
+            {
+                found = lIndex;
+            }
+        }
+    }
+    if (pNumIdle != NULL)
+    {
+        *pNumIdle = numIdle;
+    }
+    return found;
+}
+
+/**********************************************************************************************************************/
+/** Note that a caller connection is established
+ *  Called when connect() succeeded or the first message could be sent, records the time the connection took.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      socketIdx           index of the connection in ifaceMD[]
+ */
+static void trdp_mdPoolConnected (
+    TRDP_SESSION_PT appHandle,
+    INT32           socketIdx)
+{
+    TRDP_SOCKET_TCP_T *pTcp = &appHandle->ifaceMD[socketIdx].tcpParams;
+
+    if (pTcp->connected == TRUE)
+    {
+        return;
+    }
+    pTcp->connected = TRUE;
+    if (timerisset(&pTcp->connectStart))
+    {
+        TRDP_TIME_T latency;
+        UINT32      usec;
+
+        vos_getTime(&latency);
+        vos_subTime(&latency, &pTcp->connectStart);
+        usec = (UINT32) latency.tv_sec * 1000000u + (UINT32) latency.tv_usec;
+
+        appHandle->tcpPoolStats.numConnects++;
+        appHandle->tcpConnectTimeSum += usec;
+        if (usec > appHandle->tcpPoolStats.maxConnectTime)
+        {
+            appHandle->tcpPoolStats.maxConnectTime = usec;
+        }
+        vos_clearTime(&pTcp->connectStart);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Open a TCP connection to a replier in advance
+ *  An idle connection to the replier is opened and kept in the caller pool until the connect timeout of the
+ *  session expires. The next request or notification to the replier takes it instead of connecting.
+ *  A TRDP replier keeps one idle connection per caller device, hence only one is opened.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pSendParam          send parameters of the later sessions, NULL for the default parameters
+ *  @param[in]      srcIpAddr           own IP address, 0 for the session address
+ *  @param[in]      destIpAddr          IP address of the replier
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MUTEX_ERR      mutex error
+ *  @retval         TRDP_SOCK_ERR       no more sockets or connection refused
+ */
+TRDP_ERR_T trdp_mdPreConnect (
+    TRDP_SESSION_PT         appHandle,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          destIpAddr)
+{
+    TRDP_ERR_T  err         = TRDP_NO_ERR;
+    INT32       socketIdx   = TRDP_INVALID_SOCKET_INDEX;
+
+    if ((destIpAddr == 0u) || vos_isMulticast(destIpAddr))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (pSendParam == NULL)
+    {
+        pSendParam = &appHandle->mdDefault.sendParam;
+    }
+    if (srcIpAddr == 0u)
+    {
+        srcIpAddr = appHandle->realIP;
+    }
+
+    if (vos_mutexLock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        return TRDP_MUTEX_ERR;
+    }
+
+    if (trdp_mdPoolFind(appHandle, pSendParam, srcIpAddr, destIpAddr, NULL) == TRDP_INVALID_SOCKET_INDEX)
+    {
+        err = trdp_requestSocket(appHandle->ifaceMD, appHandle->mdDefault.tcpPort, pSendParam, srcIpAddr, 0u,
+                                 TRDP_SOCK_MD_TCP, TRDP_OPTION_NONE, FALSE, VOS_INVALID_SOCKET, &socketIdx,
+                                 destIpAddr);
+    }
+
+    if (socketIdx != TRDP_INVALID_SOCKET_INDEX)
+    {
+        vos_getTime(&appHandle->ifaceMD[socketIdx].tcpParams.connectStart);
+
+        switch (vos_sockConnect(appHandle->ifaceMD[socketIdx].sock, destIpAddr, appHandle->mdDefault.tcpPort))
+        {
+           case VOS_NO_ERR:
+               trdp_mdPoolConnected(appHandle, socketIdx);
+               break;
+           case VOS_BLOCK_ERR:
+               /* connection in progress, completed when the first message is sent */
+               break;
+           default:
+               vos_printLog(VOS_LOG_WARNING, "Connecting to %s in advance failed\n", vos_ipDotted(destIpAddr));
+               err = TRDP_SOCK_ERR;
+               break;
+        }
+
+        if (err == TRDP_NO_ERR)
+        {
+            appHandle->tcpPoolStats.numPreConnects++;
+
+            /* put the connection into the pool: starts its connection timeout */
+            trdp_releaseSocket(appHandle->ifaceMD, socketIdx, appHandle->mdDefault.connectTimeout, FALSE,
+                               VOS_INADDR_ANY);
+            appHandle->ifaceMD[socketIdx].tcpParams.addFileDesc = TRUE;
+        }
+        else
+        {
+            /* the failed socket must not be found in the pool: close it now */
+            appHandle->ifaceMD[socketIdx].tcpParams.morituri = TRUE;
+            trdp_releaseSocket(appHandle->ifaceMD, TRDP_INVALID_SOCKET_INDEX, 0u, TRUE, VOS_INADDR_ANY);
+        }
+    }
+
+    if (vos_mutexUnlock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    return err;
+}
+
 /**********************************************************************************************************************/
 /*reply side functions*/
 static TRDP_ERR_T trdp_mdConnectSocket (TRDP_APP_SESSION_T      appHandle,
@@ -3099,6 +4063,25 @@ static TRDP_ERR_T trdp_mdConnectSocket (TRDP_APP_SESSION_T      appHandle,
     {
         if ( pSenderElement->socketIdx == TRDP_INVALID_SOCKET_INDEX )
         {
+            /* take an idle connection to the replier from the pool, if there is one */
+            INT32 pooledIdx = trdp_mdPoolFind(appHandle,
+                                              (pSendParam != NULL) ?
+                                              pSendParam : (&appHandle->mdDefault.sendParam),
+                                              srcIpAddr, destIpAddr, NULL);
+
+            if ( pooledIdx != TRDP_INVALID_SOCKET_INDEX )
+            {
+                pSenderElement->socketIdx = pooledIdx;
+                appHandle->ifaceMD[pooledIdx].usage = 1;
+                vos_clearTime(&appHandle->ifaceMD[pooledIdx].tcpParams.connectionTimeout);
+                /* a connection opened in advance completed in the background, its latency is unknown */
+                vos_clearTime(&appHandle->ifaceMD[pooledIdx].tcpParams.connectStart);
+                appHandle->tcpPoolStats.numHits++;
+            }
+        }
+        if ( pSenderElement->socketIdx == TRDP_INVALID_SOCKET_INDEX )
+        {
+            appHandle->tcpPoolStats.numMisses++;
             /* socket to send TCP MD for request or notify only */
             err = trdp_requestSocket(appHandle->ifaceMD,
                                      appHandle->mdDefault.tcpPort,
@@ -3120,7 +4103,8 @@ static TRDP_ERR_T trdp_mdConnectSocket (TRDP_APP_SESSION_T      appHandle,
         }
 
         /* In the case that it is the first connection, do connect() */
-        if ( appHandle->ifaceMD[pSenderElement->socketIdx].usage > 1 )
+        if (( appHandle->ifaceMD[pSenderElement->socketIdx].usage > 1 ) ||
+            ( appHandle->ifaceMD[pSenderElement->socketIdx].tcpParams.connected == TRUE ))
         {
             pSenderElement->tcpParameters.doConnect = FALSE;
         }
@@ -3244,8 +4228,9 @@ static void trdp_mdDetailSenderPacket (const TRDP_MSG_T         msgType,
     /* Insert element in send queue */
     if ( TRUE == newSession )
     {
-            trdp_MDqueueAppLast(&appHandle->pMDSndQueue, pSenderElement);
+        trdp_MDqueueAppLast(&appHandle->pMDSndQueue, &appHandle->mdSndHash, pSenderElement);
     }
+    trdp_mdSchedule(appHandle, pSenderElement);
 
     vos_printLog(VOS_LOG_INFO,
                  "MD sender element state = %d, msgType=%c%c\n",
@@ -3317,6 +4302,7 @@ TRDP_ERR_T trdp_mdReply (const TRDP_MSG_T           msgType,
     if ( pSessionId )
     {
         errv = trdp_mdLookupElement((MD_ELE_T *)appHandle->pMDRcvQueue,
+                                    &appHandle->mdRcvHash,
                                     TRDP_ST_RX_REQ_W4AP_REPLY,
                                     pSessionId,
                                     &pSenderElement);
@@ -3347,7 +4333,10 @@ TRDP_ERR_T trdp_mdReply (const TRDP_MSG_T           msgType,
                 pSenderElement->pCachedDS       = NULL;
                 pSenderElement->morituri        = FALSE;
                 trdp_mdFillStateElement(msgType, pSenderElement);
+                /* a request without session ID gets a new one: re-index the queued element */
+                trdp_MDhashRemove(&appHandle->mdRcvHash, pSenderElement);
                 trdp_mdManageSessionId(pSessionId, pSenderElement);
+                trdp_MDhashInsert(appHandle->pMDRcvQueue, &appHandle->mdRcvHash, pSenderElement);
 
                 if ( msgType == TRDP_MSG_MQ )
                 {
@@ -3374,8 +4363,9 @@ TRDP_ERR_T trdp_mdReply (const TRDP_MSG_T           msgType,
                     pSenderElement->pPacket = (MD_PACKET_T *) vos_memAlloc(pSenderElement->grossSize);
                     if ( NULL == pSenderElement->pPacket )
                     {
-                        vos_memFree(pSenderElement);
-                        pSenderElement = NULL;
+                        /* the session is closed by the next trdp_mdSend() */
+                        pSenderElement->morituri = TRUE;
+                        trdp_mdSchedule(appHandle, pSenderElement);
                         errv = TRDP_MEM_ERR;
                     }
                     else
@@ -3396,7 +4386,12 @@ TRDP_ERR_T trdp_mdReply (const TRDP_MSG_T           msgType,
                         errv = TRDP_NO_ERR;
                     }
                 }
-                /*intentionally no else here*/
+                else
+                {
+                    /* no socket for the reply: the session is closed by the next trdp_mdSend() */
+                    pSenderElement->morituri = TRUE;
+                    trdp_mdSchedule(appHandle, pSenderElement);
+                }
             }
         }
     }
@@ -3685,6 +4680,7 @@ TRDP_ERR_T trdp_mdConfirm (
     if ( pSessionId )
     {
         errv = trdp_mdLookupElement((MD_ELE_T *)appHandle->pMDSndQueue,
+                                    &appHandle->mdSndHash,
                                     TRDP_ST_TX_REQ_W4AP_CONFIRM,
                                     (const UINT8 *)pSessionId,
                                     &pSenderElement);
@@ -17,6 +17,10 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: trdp_mdFreeStreams()
+ *      AG 2026-10-16: trdp_mdPreConnect()
+ *      AG 2026-10-16: trdp_mdNextJob(), trdp_mdFreeSchedule()
+ *      AG 2026-10-16: trdp_mdAcceptConnections(), trdp_mdReceiveSocket()
  *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
  *      BL 2020-07-29: Ticket #286 tlm_reply() is missing a sourceURI parameter as defined in the standard
  *     AHW 2017-11-08: Ticket #179 Max. number of retries (part of sendParam) of a MD request needs to be checked
@@ -61,6 +65,15 @@ void        trdp_mdCheckPending (
     TRDP_FDS_T          *pFileDesc,
     TRDP_SOCK_T         *pNoDesc);
 
+void        trdp_mdAcceptConnections (
+    const TRDP_SESSION_PT   appHandle,
+    TRDP_FDS_T              *pRfds,
+    INT32                   *pCount);
+
+void        trdp_mdReceiveSocket (
+    const TRDP_SESSION_PT   appHandle,
+    INT32                   lIndex);
+
 void trdp_mdCheckListenSocks (
     const TRDP_SESSION_PT appHandle,
     TRDP_FDS_T      *pRfds,
@@ -69,6 +82,22 @@ void trdp_mdCheckListenSocks (
 void        trdp_mdCheckTimeouts (
     TRDP_SESSION_PT appHandle);
 
+BOOL8       trdp_mdNextJob (
+    TRDP_SESSION_PT appHandle,
+    TRDP_TIME_T     *pNext);
+
+void        trdp_mdFreeSchedule (
+    TRDP_SESSION_PT appHandle);
+
+void        trdp_mdFreeStreams (
+    TRDP_SESSION_PT appHandle);
+
+TRDP_ERR_T  trdp_mdPreConnect (
+    TRDP_SESSION_PT         appHandle,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          destIpAddr);
+
 TRDP_ERR_T  trdp_mdCommonSend (
     const TRDP_MSG_T        msgType,
     TRDP_APP_SESSION_T      appHandle,
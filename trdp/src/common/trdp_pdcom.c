@@ -17,6 +17,15 @@
 /*
 * $Id$
 *
+*      AG 2026-10-16: Publishing in place (trdp_pdReserve, trdp_pdCommit), the reserved frame is swapped in on commit
+*      AG 2026-10-16: Lending of received frames (trdp_pdLend, trdp_pdReturn), a lent frame is not reused for reception
+*      AG 2026-10-16: trdp_pdNextJob() and trdp_pdReceiveSocket() split off for tlc_processEvents()
+*      AG 2026-10-16: Cyclic publishers are scheduled by a send heap, trdp_pdSendQueued() pops the due ones only
+*      AG 2026-10-16: Timeout supervision of the subscriptions by a deadline heap (trdp_pdArmTimeout)
+*      AG 2026-10-16: Current time passed to trdp_checkSequenceCounter() for ageing of silent senders
+*      AG 2026-10-16: Received PDs are matched to subscriptions by the hash index (trdp_subHashFind)
+*      AG 2026-10-16: Batched PD transmission for the indexed sender (trdp_pdSendBatch)
+*      AG 2026-10-16: Batched PD reception, trdp_pdReceive() reads up to TRDP_PD_RCV_BATCH_SIZE frames per call
 *     CWE 2023-02-14: Ticket #419 PDTestFastBase2 failed - prepared debug code for logging pdReceive and pdSend packets
 *     AHW 2023-01-11: Lint warnigs and Ticket #409 In updateTCNDNSentry(), the parameter noDesc of vos_select() is uninitialized if tlc_getInterval() fails
 *     CWE 2023-01-09: Ticket #395 PD subscriber statistics when publisher start earlier
@@ -109,11 +118,28 @@
 #define UINT32_MAX  4294967295U
 #endif
 
+
 /*******************************************************************************
  * TYPEDEFS
  */
 
 
+/******************************************************************************
+ *   LOCALS
+ */
+
+static TRDP_ERR_T trdp_pdHandleFrame (TRDP_SESSION_PT   appHandle,
+                                      PD_PACKET_T       * *ppNewFrame,
+                                      UINT32            recSize,
+                                      TRDP_IP_ADDR_T    srcIpAddr,
+                                      TRDP_IP_ADDR_T    destIpAddr,
+                                      TRDP_IP_ADDR_T    srcIfAddr);
+
+#ifdef HIGH_PERF_INDEXED
+static TRDP_ERR_T trdp_pdAddToBatch (TRDP_SESSION_PT    appHandle,
+                                     PD_ELE_T           *pElement);
+#endif
+
 /******************************************************************************
  *   GLOBALS
  */
@@ -423,6 +449,197 @@ TRDP_ERR_T trdp_pdGet (
     return TRDP_NO_ERR;
 }
 
+/******************************************************************************/
+/** Lend the current frame of a subscription to the application
+ *  The frame is not used as receive buffer until all references are returned, a spare buffer takes its place.
+ *  A frame superseded while lent cannot be lent again, a newer one only after it was returned.
+ *
+ *  @param[in]      pPacket             subscription
+ *  @param[out]     ppData              pointer to the received data (network representation)
+ *  @param[out]     pDataSize           size of the received data
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NODATA_ERR     no data received yet
+ *  @retval         TRDP_TIMEOUT_ERR    packet timed out
+ *  @retval         TRDP_BLOCK_ERR      a superseded frame is still lent
+ *  @retval         TRDP_MEM_ERR        no memory for the spare buffer
+ */
+TRDP_ERR_T trdp_pdLend (
+    PD_ELE_T    *pPacket,
+    const UINT8 **ppData,
+    UINT32      *pDataSize)
+{
+    /*  Update some statistics  */
+    pPacket->getPkts++;
+
+    if ((pPacket->privFlags & TRDP_INVALID_DATA) != 0)
+    {
+        return TRDP_NODATA_ERR;
+    }
+
+    if ((pPacket->privFlags & TRDP_TIMED_OUT) != 0)
+    {
+        return TRDP_TIMEOUT_ERR;
+    }
+
+    if ((pPacket->lentCnt != 0u) && (pPacket->pLent != pPacket->pFrame))
+    {
+        return TRDP_BLOCK_ERR;
+    }
+
+    if (pPacket->pSpare == NULL)
+    {
+        pPacket->pSpare = (PD_PACKET_T *) vos_memAllocNoInit(TRDP_MAX_PD_PACKET_SIZE);
+        if (pPacket->pSpare == NULL)
+        {
+            return TRDP_MEM_ERR;
+        }
+    }
+
+    pPacket->pLent  = pPacket->pFrame;
+    pPacket->lentCnt++;
+    *ppData     = pPacket->pFrame->data;
+    *pDataSize  = pPacket->dataSize;
+    return TRDP_NO_ERR;
+}
+
+/******************************************************************************/
+/** Return a frame lent by trdp_pdLend
+ *  A superseded frame becomes the spare buffer again after its last reference is returned.
+ *
+ *  @param[in]      pPacket             subscription
+ *  @param[in]      pData               pointer returned by trdp_pdLend
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      pData is not lent
+ */
+TRDP_ERR_T trdp_pdReturn (
+    PD_ELE_T    *pPacket,
+    const UINT8 *pData)
+{
+    if ((pPacket->lentCnt == 0u) || (pPacket->pLent == NULL) || (pData != pPacket->pLent->data))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (--pPacket->lentCnt == 0u)
+    {
+        if (pPacket->pLent != pPacket->pFrame)
+        {
+            pPacket->pSpare = pPacket->pLent;   /* the spare went to reception when the lent frame was superseded */
+        }
+        pPacket->pLent = NULL;
+    }
+    return TRDP_NO_ERR;
+}
+
+/******************************************************************************/
+/** Free the spare buffer and a superseded, still lent frame of a subscription or the reserved frame of a publisher
+ *
+ *  @param[in]      pPacket             subscription or publisher
+ */
+void trdp_pdFreeLent (
+    PD_ELE_T *pPacket)
+{
+    if ((pPacket->pLent != NULL) && (pPacket->pLent != pPacket->pFrame))
+    {
+        vos_memFree(pPacket->pLent);
+    }
+    if (pPacket->pSpare != NULL)
+    {
+        vos_memFree(pPacket->pSpare);
+    }
+    pPacket->pLent      = NULL;
+    pPacket->pSpare     = NULL;
+    pPacket->spareSize  = 0u;
+    pPacket->lentCnt    = 0u;
+}
+
+/******************************************************************************/
+/** Reserve a frame of a publisher to be filled by the application
+ *  The frame is not sent before trdp_pdCommit, its former data content is undefined.
+ *
+ *  @param[in]      pPacket             publisher
+ *  @param[in]      dataSize            maximum size of the data to be written
+ *  @param[out]     ppData              pointer to the data area of the reserved frame
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      data size too large
+ *  @retval         TRDP_MEM_ERR        out of memory
+ */
+TRDP_ERR_T trdp_pdReserve (
+    PD_ELE_T    *pPacket,
+    UINT32      dataSize,
+    UINT8       **ppData)
+{
+    if (dataSize > TRDP_MAX_PD_DATA_SIZE)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if ((pPacket->pSpare == NULL) || (pPacket->spareSize < trdp_packetSizePD(dataSize)))
+    {
+        if (pPacket->pSpare != NULL)
+        {
+            vos_memFree(pPacket->pSpare);
+        }
+        pPacket->spareSize  = trdp_packetSizePD(dataSize);
+        pPacket->pSpare     = (PD_PACKET_T *) vos_memAllocNoInit(pPacket->spareSize);
+        if (pPacket->pSpare == NULL)
+        {
+            pPacket->spareSize = 0u;
+            return TRDP_MEM_ERR;
+        }
+    }
+
+    pPacket->privFlags  |= TRDP_RESERVED_FRAME;
+    *ppData             = pPacket->pSpare->data;
+    return TRDP_NO_ERR;
+}
+
+/******************************************************************************/
+/** Publish the frame reserved by trdp_pdReserve
+ *  The header is taken over from the current frame, which becomes the next reserved frame.
+ *  Sequence counter and FCS are set when sending, as for trdp_pdPut.
+ *
+ *  @param[in]      pPacket             publisher
+ *  @param[in]      dataSize            size of the data written
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      nothing reserved or data size larger than reserved
+ */
+TRDP_ERR_T trdp_pdCommit (
+    PD_ELE_T    *pPacket,
+    UINT32      dataSize)
+{
+    PD_PACKET_T *pTemp;
+
+    if (!(pPacket->privFlags & TRDP_RESERVED_FRAME) || (pPacket->spareSize < trdp_packetSizePD(dataSize)))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    memcpy(&pPacket->pSpare->frameHead, &pPacket->pFrame->frameHead, sizeof(PD_HEADER_T));
+    pPacket->pSpare->frameHead.datasetLength = vos_htonl(dataSize);
+
+    /* the current frame is at least grossSize large */
+    pTemp               = pPacket->pFrame;
+    pPacket->pFrame     = pPacket->pSpare;
+    pPacket->pSpare     = pTemp;
+    pPacket->spareSize  = pPacket->grossSize;
+    pPacket->dataSize   = dataSize;
+    pPacket->grossSize  = trdp_packetSizePD(dataSize);
+
+    /* set data valid */
+    pPacket->privFlags = (TRDP_PRIV_FLAGS_T) (pPacket->privFlags &
+                                              ~(TRDP_PRIV_FLAGS_T)(TRDP_INVALID_DATA | TRDP_RESERVED_FRAME));
+
+    /*  Update some statistics  */
+    pPacket->updPkts++;
+
+    return TRDP_NO_ERR;
+}
+
 /******************************************************************************/
 /** Send a due PD message
  *
@@ -492,14 +709,27 @@ TRDP_ERR_T  trdp_pdSendElement (
                                      iterPD->pFrame->data,
                                      vos_ntohl(iterPD->pFrame->frameHead.datasetLength));
             }
-            /* We pass the error to the application, but we keep on going    */
-            result = trdp_pdSend(appHandle->ifacePD[iterPD->socketIdx].sock, iterPD, appHandle->pdDefault.port);
-            if (result == TRDP_NO_ERR)
+#ifdef HIGH_PERF_INDEXED
+            /* Cyclic telegrams of an index table slot are collected and sent together by trdp_pdSendBatch(),
+               pulled telegrams must be sent now, their header is restored below */
+            if ((appHandle->sndBatch.active == TRUE) &&
+                !(iterPD->privFlags & TRDP_REQ_2B_SENT) &&
+                (iterPD->pullIpAddress == 0u))
             {
-                appHandle->stats.pd.numSend++;
-                iterPD->numRxTx++;
+                result = trdp_pdAddToBatch(appHandle, iterPD);
             }
             else
+#endif
+            {
+                /* We pass the error to the application, but we keep on going    */
+                result = trdp_pdSend(appHandle->ifacePD[iterPD->socketIdx].sock, iterPD, appHandle->pdDefault.port);
+                if (result == TRDP_NO_ERR)
+                {
+                    appHandle->stats.pd.numSend++;
+                    iterPD->numRxTx++;
+                }
+            }
+            if (result != TRDP_NO_ERR)
             {
                 err = result;   /* pass last error to application  */
             }
@@ -548,6 +778,7 @@ TRDP_ERR_T  trdp_pdSendElement (
         /* Save next element */
         pTemp = iterPD->pNext;
         /* Remove current element */
+        trdp_pdUnscheduleSend(appHandle, iterPD);
         trdp_queueDelElement(&appHandle->pSndQueue, iterPD);
         iterPD->magic = 0u;
         if (iterPD->pSeqCntList != NULL)
@@ -566,6 +797,7 @@ TRDP_ERR_T  trdp_pdSendElement (
 
 /******************************************************************************/
 /** Send all due PD messages
+ *  Only the due entries of the send heap are examined, the send queue is not walked.
  *
  *  @param[in]      appHandle           session pointer
  *
@@ -575,25 +807,22 @@ TRDP_ERR_T  trdp_pdSendElement (
 TRDP_ERR_T  trdp_pdSendQueued (
     TRDP_SESSION_PT appHandle)
 {
-    PD_ELE_T    *iterPD = appHandle->pSndQueue;
-    TRDP_TIME_T now;
-    TRDP_ERR_T  err = TRDP_NO_ERR;
+    TRDP_TIMER_HEAP_T       *pHeap = &appHandle->pdSndTimers;
+    TRDP_TIME_T             now;
+    TRDP_ERR_T              err = TRDP_NO_ERR;
 
     /* Clearing the nextJob indicator is of no use here, it will disturb PD timeout handling when separate
         threads are used!
      vos_clearTime(&appHandle->nextJob); */
 
-    /*    Find the packet which has to be sent next:    */
-    while (iterPD != NULL)
-    {
-        /*    Get the current time    */
-        vos_getTime(&now);
+    /*    Get the current time once for all due packets    */
+    vos_getTime(&now);
 
-        if (iterPD->privFlags & TRDP_IS_TSN)
-        {
-            iterPD = iterPD->pNext;
-            continue;
-        }
+    /*    The packets which have to be sent now are on top of the send heap:    */
+    while ((pHeap->count > 0u) &&
+           !timercmp(&pHeap->pTimers[0].timeToGo, &now, >))
+    {
+        PD_ELE_T *iterPD = (PD_ELE_T *) pHeap->pTimers[0].pElement;
 
         /*  Is this a cyclic packet and
          due to sent?
@@ -697,12 +926,10 @@ TRDP_ERR_T  trdp_pdSendQueued (
             /* remove one shot messages after they have been sent */
             if (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PR))    /* Ticket #172: remove element */
             {
-                PD_ELE_T *pTemp;
                 /* Decrease the socket ref */
                 trdp_releaseSocket(appHandle->ifacePD, iterPD->socketIdx, 0u, FALSE, VOS_INADDR_ANY);
-                /* Save next element */
-                pTemp = iterPD->pNext;
                 /* Remove current element */
+                trdp_pdUnscheduleSend(appHandle, iterPD);
                 trdp_queueDelElement(&appHandle->pSndQueue, iterPD);
                 iterPD->magic = 0u;
                 if (iterPD->pSeqCntList != NULL)
@@ -711,24 +938,32 @@ TRDP_ERR_T  trdp_pdSendQueued (
                 }
                 vos_memFree(iterPD->pFrame);
                 vos_memFree(iterPD);
+                continue;
+            }
 
-                /* pre-set next element */
-                iterPD = pTemp;
+            if (timerisset(&iterPD->interval) &&
+                !timercmp(&iterPD->timeToGo, &now, >))
+            {
+                /* a pulled packet which is due cyclically, too: send it with the next call, not twice now */
+                TRDP_TIME_T next = {0, 1};
+
+                vos_addTime(&next, &now);
+                (void) trdp_timerInsert(pHeap, iterPD, &iterPD->timerIdx, &next);    /* re-key only, cannot fail */
                 continue;
             }
         }
-        iterPD = iterPD->pNext;
+
+        /*  Re-key to the next send time, PULL-only packets leave the heap  */
+        (void) trdp_pdScheduleSend(appHandle, iterPD);
     }
     return err;
 }
 
 /******************************************************************************/
 /** Receiving PD messages
- *  Read the receive socket for arriving PDs, copy the packet to a new PD_ELE_T
- *  Check for protocol errors and compare the received data to the data in our receive queue.
- *  If it is a new packet, check if it is a PD Request (PULL).
- *  If it is an update, exchange the existing entry with the new one
- *  Call user's callback if needed
+ *  Read the receive socket for arriving PDs. Up to TRDP_PD_RCV_BATCH_SIZE frames are read with one call into the
+ *  session's receive buffers, each frame is then handled by trdp_pdHandleFrame().
+ *  If one or more frames of a batch fail, the last error is returned.
  *
  *  @param[in]      appHandle           session pointer
  *  @param[in]      sock                the socket to read from
@@ -744,33 +979,100 @@ TRDP_ERR_T  trdp_pdReceive (
     TRDP_SESSION_PT appHandle,
     VOS_SOCK_T      sock)
 {
-    PD_HEADER_T         *pNewFrameHead      = &appHandle->pNewFrame->frameHead;
+    VOS_UDP_MSG_T   msgs[TRDP_PD_RCV_BATCH_SIZE];
+    UINT32          noOfMsgs = TRDP_PD_RCV_BATCH_SIZE;
+    UINT32          idx;
+    TRDP_ERR_T      err;
+    TRDP_ERR_T      result  = TRDP_NO_ERR;
+
+    for (idx = 0u; idx < TRDP_PD_RCV_BATCH_SIZE; idx++)
+    {
+        msgs[idx].pBuffer   = (UINT8 *) &appHandle->pNewFrame[idx]->frameHead;
+        msgs[idx].size      = TRDP_MAX_PD_PACKET_SIZE;
+    }
+
+    /*  Get the packets from the wire:  */
+    err = (TRDP_ERR_T) vos_sockReceiveUDPBatch(sock, msgs, &noOfMsgs);
+    if ( err != TRDP_NO_ERR)
+    {
+        return err;
+    }
+
+    if (noOfMsgs > 0u)
+    {
+        appHandle->batchStats.numRxBatches++;
+        appHandle->batchStats.numRxPackets += noOfMsgs;
+        if (noOfMsgs > appHandle->batchStats.maxRxBatchSize)
+        {
+            appHandle->batchStats.maxRxBatchSize = noOfMsgs;
+        }
+    }
+
+    /*  Process every frame of the batch, report the last error  */
+    for (idx = 0u; idx < noOfMsgs; idx++)
+    {
+        if (msgs[idx].size == 0u)
+        {
+            result = TRDP_NODATA_ERR;
+            continue;
+        }
+        err = trdp_pdHandleFrame(appHandle,
+                                 &appHandle->pNewFrame[idx],
+                                 msgs[idx].size,
+                                 msgs[idx].srcIPAddr,
+                                 msgs[idx].dstIPAddr,
+                                 msgs[idx].srcIFAddr);
+        if (err != TRDP_NO_ERR)
+        {
+            result = err;
+        }
+    }
+    return result;
+}
+
+/******************************************************************************/
+/** Handle one received PD frame
+ *  Check for protocol errors and compare the received data to the data in our receive queue.
+ *  If it is a new packet, check if it is a PD Request (PULL).
+ *  If it is an update, the received frame is swapped with the subscriber's frame, *ppNewFrame returns the
+ *  buffer to be used for the next reception.
+ *  Call user's callback if needed
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in,out]  ppNewFrame          pointer to the receive buffer holding the frame
+ *  @param[in]      recSize             size of the received frame
+ *  @param[in]      srcIpAddr           source IP of the frame
+ *  @param[in]      destIpAddr          destination IP of the frame
+ *  @param[in]      srcIfAddr           IP of the receiving interface, 0 if unknown
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_WIRE_ERR       protocol error (late packet, version mismatch)
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_CRC_ERR        header checksum
+ *  @retval         TRDP_TOPO_ERR       invalid topocount
+ */
+static TRDP_ERR_T trdp_pdHandleFrame (
+    TRDP_SESSION_PT appHandle,
+    PD_PACKET_T     * *ppNewFrame,
+    UINT32          recSize,
+    TRDP_IP_ADDR_T  srcIpAddr,
+    TRDP_IP_ADDR_T  destIpAddr,
+    TRDP_IP_ADDR_T  srcIfAddr)
+{
+    PD_HEADER_T         *pNewFrameHead      = &(*ppNewFrame)->frameHead;
     PD_ELE_T            *pExistingElement   = NULL;
     PD_ELE_T            *pPulledElement     = NULL;
     TRDP_ERR_T          err             = TRDP_NO_ERR;
-    UINT32              recSize         = TRDP_MAX_PD_PACKET_SIZE;
     int                 informUser      = FALSE;
     int                 isTSN           = FALSE;
     TRDP_ADDRESSES_T    subAddresses    = { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u};
-    UINT32              srcIfAddr = 0u;
     TRDP_MSG_T          msgType;
 #ifdef TSN_SUPPORT
     PD2_HEADER_T        *pTSNFrameHead = (PD2_HEADER_T *) pNewFrameHead;
 #endif
 
-    /*  Get the packet from the wire:  */
-    err = (TRDP_ERR_T) vos_sockReceiveUDP(sock,
-                                          (UINT8 *) pNewFrameHead,
-                                          &recSize,
-                                          &subAddresses.srcIpAddr,
-                                          NULL,
-                                          &subAddresses.destIpAddr,
-                                          &srcIfAddr,   /* #322 */
-                                          FALSE);
-    if ( err != TRDP_NO_ERR)
-    {
-        return err;
-    }
+    subAddresses.srcIpAddr  = srcIpAddr;
+    subAddresses.destIpAddr = destIpAddr;
 
     /* #322 */
     if ((appHandle->realIP != 0u) && (srcIfAddr != 0) && (appHandle->realIP != srcIfAddr))
@@ -839,23 +1141,9 @@ TRDP_ERR_T  trdp_pdReceive (
 
     }
 
-    /*  Examine subscription queue, are we interested in this PD?   */
-#ifdef HIGH_PERF_INDEXED
-    if ((appHandle->pSlot == NULL) ||
-        (appHandle->pSlot->noOfRxEntries == 0))
-    {
-        /*  If not set up until now, we issue a warning, but handle the data...   */
-        vos_printLogStr(VOS_LOG_WARNING, "Receiving PD while tlc_updateSession() not yet called or rcvIdx empty.\n");
-        pExistingElement = trdp_queueFindSubAddr(appHandle->pRcvQueue, &subAddresses);
-    }
-    else
-    {
-        /*  This is the fast, indexed access to our subscriptions!   */
-        pExistingElement = trdp_indexedFindSubAddr(appHandle, &subAddresses);
-    }
-#else
-    pExistingElement = trdp_queueFindSubAddr(appHandle->pRcvQueue, &subAddresses);
-#endif
+    /*  Examine subscription queue, are we interested in this PD?
+        The hash index is maintained by tlp_subscribe/tlp_unsubscribe, no need to wait for tlc_updateSession() */
+    pExistingElement = trdp_subHashFind(appHandle, &subAddresses);
 
     if (pExistingElement == NULL)
     {
@@ -878,6 +1166,9 @@ TRDP_ERR_T  trdp_pdReceive (
                                    pExistingElement->addr.opTrnTopoCnt))
         {
             UINT32 newSeqCnt = vos_ntohl(pNewFrameHead->sequenceCounter);   /* same location for PD and PD2 */
+            TRDP_TIME_T now;
+
+            vos_getTime(&now);
             /* Save the source IP address of the received packet */
             pExistingElement->lastSrcIP = subAddresses.srcIpAddr;
             /* Save the real destination of the received packet (own IP or MC group) */
@@ -893,7 +1184,7 @@ TRDP_ERR_T  trdp_pdReceive (
             /* find sender in our list */
             switch (trdp_checkSequenceCounter(pExistingElement,
                                               newSeqCnt,
-                                              subAddresses.srcIpAddr, msgType))
+                                              subAddresses.srcIpAddr, msgType, &now))
             {
                 case 0:                      /* Sequence counter is valid (at least 1 higher than previous one) */
                     break;
@@ -938,7 +1229,7 @@ TRDP_ERR_T  trdp_pdReceive (
                     {
                         informUser = TRUE;                 /* Inform user anyway */
                     }
-                    else if (0 != memcmp(appHandle->pNewFrame->data,
+                    else if (0 != memcmp((*ppNewFrame)->data,
                                          pExistingElement->pFrame->data,
                                          pExistingElement->dataSize))
                     {
@@ -947,9 +1238,14 @@ TRDP_ERR_T  trdp_pdReceive (
                 }
             }
 
-            /*  Get the current time and compute the next time this packet should be received.  */
-            vos_getTime(&pExistingElement->timeToGo);
+            /*  Compute the next time this packet should be received.  */
+            pExistingElement->timeToGo = now;
             vos_addTime(&pExistingElement->timeToGo, &pExistingElement->interval);
+            if (pExistingElement->timerIdx == 0u)
+            {
+                /* supervision restarts after a time out, otherwise the heap entry follows timeToGo */
+                (void) trdp_pdArmTimeout(appHandle, pExistingElement);
+            }
 
             /*  Update some statistics  */
             pExistingElement->numRxTx++;
@@ -962,11 +1258,16 @@ TRDP_ERR_T  trdp_pdReceive (
                 (TRDP_PRIV_FLAGS_T) (pExistingElement->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_INVALID_DATA);
 
             /*  remove the old one, insert the new one  */
-            /*  -> always swap the frame pointers              */
+            /*  -> always swap the frame pointers, a frame lent by tlp_getRef() is replaced by the spare buffer  */
             {
                 PD_PACKET_T *pTemp = pExistingElement->pFrame;
-                pExistingElement->pFrame    = appHandle->pNewFrame;
-                appHandle->pNewFrame        = pTemp;
+                pExistingElement->pFrame    = *ppNewFrame;
+                if ((pTemp == pExistingElement->pLent) && (pExistingElement->pSpare != NULL))
+                {
+                    pTemp = pExistingElement->pSpare;
+                    pExistingElement->pSpare = NULL;
+                }
+                *ppNewFrame                 = pTemp;
             }
 
             /*  It might be a PULL request      */
@@ -1110,8 +1411,268 @@ TRDP_ERR_T  trdp_pdReceive (
     return err;
 }
 
+/******************************************************************************/
+/** Start or restart the timeout supervision of a subscription
+ *  The subscription is (re-)inserted into the timeout heap with its current timeToGo. Subscriptions without
+ *  timeout or deadline (PULL, infinite timeout) are removed from the heap.
+ *  Reception must not call this for every packet: advancing timeToGo of a supervised subscription is enough,
+ *  the heap entry is re-keyed by trdp_pdHandleTimeOuts() when it comes due.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        subscription
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory, the subscription is not supervised
+ */
+TRDP_ERR_T trdp_pdArmTimeout (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    TRDP_ERR_T err;
+
+    if (!timerisset(&pElement->interval) || !timerisset(&pElement->timeToGo))
+    {
+        trdp_pdDisarmTimeout(appHandle, pElement);
+        return TRDP_NO_ERR;
+    }
+
+    err = trdp_timerInsert(&appHandle->pdTimers, pElement, &pElement->timerIdx, &pElement->timeToGo);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "No timeout supervision for comId %u, out of memory\n", pElement->addr.comId);
+    }
+    return err;
+}
+
+/******************************************************************************/
+/** Stop the timeout supervision of a subscription
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        subscription
+ */
+void trdp_pdDisarmTimeout (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    trdp_timerRemove(&appHandle->pdTimers, &pElement->timerIdx);
+}
+
+/******************************************************************************/
+/** Return the next timeout of the supervised subscriptions
+ *  Heap entries left behind by reception are re-keyed first, so the returned deadline is exact.
+ *  Must be called with mutexRxPD held, tlp_subscribe() and tlp_request() may change the heap meanwhile.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[out]     pNext           next deadline
+ *
+ *  @retval         TRUE            a subscription is supervised, pNext is valid
+ *  @retval         FALSE           no subscription is supervised
+ */
+BOOL8 trdp_pdNextTimeout (
+    TRDP_SESSION_PT appHandle,
+    TRDP_TIME_T     *pNext)
+{
+    TRDP_TIMER_HEAP_T *pHeap = &appHandle->pdTimers;
+
+    while (pHeap->count > 0u)
+    {
+        PD_ELE_T *pTop = (PD_ELE_T *) pHeap->pTimers[0].pElement;
+
+        if (!timercmp(&pHeap->pTimers[0].timeToGo, &pTop->timeToGo, <))
+        {
+            break;
+        }
+        (void) trdp_timerInsert(pHeap, pTop, &pTop->timerIdx, &pTop->timeToGo);    /* re-key only, cannot fail */
+    }
+    if (pHeap->count == 0u)
+    {
+        return FALSE;
+    }
+    *pNext = pHeap->pTimers[0].timeToGo;
+    return TRUE;
+}
+
+/******************************************************************************/
+/** Schedule a publisher or request for sending
+ *  The publisher is (re-)inserted into the send heap. Its key is its timeToGo or, if it has to be sent
+ *  immediately (TRDP_REQ_2B_SENT), the epoch. PULL-only and TSN publishers are removed from the heap.
+ *  Indexed builds use the heap only until tlc_updateSession() has created the index tables.
+ *  Must be called with mutexTxPD held, whenever a queued publisher is added or its send time gets earlier.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        publisher or request
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory, the publisher is not sent
+ */
+TRDP_ERR_T trdp_pdScheduleSend (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    TRDP_TIME_T due;
+    TRDP_ERR_T  err;
+
+#ifdef HIGH_PERF_INDEXED
+    /* Once the index tables exist, trdp_pdSendIndexed() sends and the heap is not used anymore */
+    if ((appHandle->pSlot != NULL) &&
+        (appHandle->pSlot->processCycle != 0u))
+    {
+        trdp_pdUnscheduleSend(appHandle, pElement);
+        return TRDP_NO_ERR;
+    }
+#endif
+    if (pElement->privFlags & TRDP_IS_TSN)
+    {
+        trdp_pdUnscheduleSend(appHandle, pElement);
+        return TRDP_NO_ERR;
+    }
+    if (pElement->privFlags & TRDP_REQ_2B_SENT)
+    {
+        vos_clearTime(&due);
+    }
+    else if (timerisset(&pElement->interval))
+    {
+        due = pElement->timeToGo;
+    }
+    else
+    {
+        trdp_pdUnscheduleSend(appHandle, pElement);
+        return TRDP_NO_ERR;
+    }
+
+    err = trdp_timerInsert(&appHandle->pdSndTimers, pElement, &pElement->timerIdx, &due);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "comId %u not scheduled for sending, out of memory\n", pElement->addr.comId);
+    }
+    return err;
+}
+
+/******************************************************************************/
+/** Remove a publisher or request from the send heap
+ *  Must be called before the element is removed from the send queue.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        publisher or request
+ */
+void trdp_pdUnscheduleSend (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    trdp_timerRemove(&appHandle->pdSndTimers, &pElement->timerIdx);
+}
+
+/******************************************************************************/
+/** Reschedule all publishers of the send queue
+ *  To be called after the send times of the whole queue were changed (trdp_pdDistribute) and, in indexed
+ *  builds, after the index tables were created (empties the heap).
+ *
+ *  @param[in]      appHandle       session pointer
+ */
+void trdp_pdRescheduleSend (
+    TRDP_SESSION_PT appHandle)
+{
+    PD_ELE_T *iterPD;
+
+    for (iterPD = appHandle->pSndQueue; iterPD != NULL; iterPD = iterPD->pNext)
+    {
+        (void) trdp_pdScheduleSend(appHandle, iterPD);
+    }
+}
+
+/******************************************************************************/
+/** Return the next send time of the scheduled publishers
+ *  Must be called with mutexTxPD held.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[out]     pNext           next send time
+ *
+ *  @retval         TRUE            a publisher is scheduled, pNext is valid (cleared if a request is pending)
+ *  @retval         FALSE           no publisher is scheduled
+ */
+BOOL8 trdp_pdNextSend (
+    TRDP_SESSION_PT appHandle,
+    TRDP_TIME_T     *pNext)
+{
+    if (appHandle->pdSndTimers.count == 0u)
+    {
+        return FALSE;
+    }
+    *pNext = appHandle->pdSndTimers.pTimers[0].timeToGo;
+    return TRUE;
+}
+
+/******************************************************************************/
+/** Free the timeout and send heaps of a session
+ *
+ *  @param[in]      appHandle       session pointer
+ */
+void trdp_pdFreeTimeouts (
+    TRDP_SESSION_PT appHandle)
+{
+    trdp_timerFree(&appHandle->pdTimers);
+    trdp_timerFree(&appHandle->pdSndTimers);
+}
+
+/******************************************************************************/
+/** Compute the time of the next PD job
+ *  appHandle->nextJob is set to the next receive timeout and, if requested, to an earlier send time.
+ *  It is cleared if nothing is pending.
+ *  Must be called with mutexRxPD held, the send heap is read with mutexTxPD (try-lock).
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      checkSend           check send queue, too
+ */
+void trdp_pdNextJob (
+    TRDP_SESSION_PT appHandle,
+    int             checkSend)
+{
+    vos_clearTime(&appHandle->nextJob);
+
+    /*    The packet which has to be received next is on top of the timeout heap    */
+    (void) trdp_pdNextTimeout(appHandle, &appHandle->nextJob);
+
+    if (checkSend)
+    {
+        TRDP_TIME_T nextSend;
+        BOOL8       pending;
+
+        /*    The packet which has to be sent next is on top of the send heap.
+              The heap may be reallocated by tlp_publish() or tlp_request(), do not wait for a sender: if it is busy,
+              assume a packet is due now    */
+        if (vos_mutexTryLock(appHandle->mutexTxPD) == VOS_NO_ERR)
+        {
+            pending = trdp_pdNextSend(appHandle, &nextSend);
+
+            if (vos_mutexUnlock(appHandle->mutexTxPD) != VOS_NO_ERR)
+            {
+                vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+            }
+        }
+        else
+        {
+            vos_clearTime(&nextSend);
+            pending = TRUE;
+        }
+
+        if (pending)
+        {
+            if (!timerisset(&nextSend))
+            {
+                vos_getTime(&nextSend);                                 /* request pending, send now    */
+            }
+            if (timercmp(&nextSend, &appHandle->nextJob, <) ||          /* earlier than current time-out? */
+                !timerisset(&appHandle->nextJob))
+            {
+                appHandle->nextJob = nextSend;
+            }
+        }
+    }
+}
+
 /******************************************************************************/
 /** Check for pending packets, set FD if non blocking
+ *  Must be called with mutexRxPD held.
  *
  *  @param[in]      appHandle           session pointer
  *  @param[in,out]  pFileDesc           pointer to set of ready descriptors
@@ -1128,19 +1689,10 @@ void trdp_pdCheckPending (
 
     /*    Walk over the registered PDs, find pending packets */
 
-    vos_clearTime(&appHandle->nextJob);
+    trdp_pdNextJob(appHandle, checkSend);
 
-    /*    Find the packet which has to be received next:    */
     for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
     {
-        if ((!(iterPD->privFlags & TRDP_TIMED_OUT)) &&              /* Exempt already timed-out packet */
-            timerisset(&iterPD->interval) &&                        /* not PD PULL?                    */
-            (timercmp(&iterPD->timeToGo, &appHandle->nextJob, <) || /* earlier than current time-out?  */
-             !timerisset(&appHandle->nextJob)))                     /* or not set at all?              */
-        {
-            appHandle->nextJob = iterPD->timeToGo;                  /* set new next time value from queue element */
-        }
-
         /*    Check and set the socket file descriptor, if not already done    */
         if (iterPD->socketIdx != -1 &&
             appHandle->ifacePD[iterPD->socketIdx].sock != VOS_INVALID_SOCKET &&
@@ -1160,36 +1712,94 @@ void trdp_pdCheckPending (
             }
         }
     }
+}
 
-    if (checkSend)
+/******************************************************************************/
+/** Receive the PD frames pending on one socket
+ *  Compare the received data to the data in our receive queue, call user's callback if data changed.
+ *  In non-blocking mode, the socket is read as long as data is available.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      idx                 index of the socket in ifacePD
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         != TRDP_NO_ERR      last error of trdp_pdReceive()
+ */
+TRDP_ERR_T trdp_pdReceiveSocket (
+    TRDP_SESSION_PT appHandle,
+    UINT32          idx)
+{
+    TRDP_ERR_T  err;
+    BOOL8       nonBlocking = !(appHandle->option & TRDP_OPTION_BLOCK);
+
+    if ((idx >= TRDP_MAX_PD_SOCKET_CNT) ||
+        (appHandle->ifacePD[idx].sock == VOS_INVALID_SOCKET))
     {
-        /*    Find packet in send queue which evntually has to be sent earlier:    */
-        for (iterPD = appHandle->pSndQueue; iterPD != NULL; iterPD = iterPD->pNext)
-        {
-            if (timerisset(&iterPD->interval) &&                        /* has a time out value?    */
-                (timercmp(&iterPD->timeToGo, &appHandle->nextJob, <) ||  /* earlier than current time-out? */
-                 !timerisset(&appHandle->nextJob)))
-            {
-                appHandle->nextJob = iterPD->timeToGo;                  /* set new next time value from queue element */
-            }
-        }
+        return TRDP_NO_ERR;
+    }
+
+    do
+    {
+        /* Read as long as data is available */
+        err = trdp_pdReceive(appHandle, appHandle->ifacePD[idx].sock);
+
+    }
+    while ((err == TRDP_NO_ERR) && (nonBlocking == TRUE));
+
+    switch (err)
+    {
+        case TRDP_NO_ERR:
+        case TRDP_NOSUB_ERR:        /* missing subscription should not lead to extensive error output */
+        case TRDP_BLOCK_ERR:
+        case TRDP_NODATA_ERR:       /* ignore would-block or sporadic unsolicited messages */
+            return TRDP_NO_ERR;
+        case TRDP_TOPO_ERR:
+        case TRDP_TIMEOUT_ERR:
+        default:
+            vos_printLog(VOS_LOG_WARNING, "trdp_pdReceive() failed (Err: %d)\n", err);
+            break;
     }
+    return err;
 }
 
 /******************************************************************************/
 /** Check for time outs
+ *  Only the due entries of the timeout heap are examined. An entry whose subscription received data in the
+ *  meantime is re-keyed to the new deadline, otherwise the subscription timed out and leaves the heap until
+ *  the next packet is received.
  *
  *  @param[in]      appHandle         application handle
  */
 void trdp_pdHandleTimeOuts (
     TRDP_SESSION_PT appHandle)
 {
-    PD_ELE_T *iterPD = NULL;
+    TRDP_TIMER_HEAP_T   *pHeap = &appHandle->pdTimers;
+    TRDP_TIME_T         now;
 
-    /*    Examine receive queue for late packets    */
-    for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+    if (pHeap->count == 0u)
+    {
+        return;
+    }
+
+    /*    Get the current time once for all due packets    */
+    vos_getTime(&now);
+
+    while ((pHeap->count > 0u) &&
+           !timercmp(&pHeap->pTimers[0].timeToGo, &now, >))
     {
-        trdp_handleTimeout(appHandle, iterPD);
+        PD_ELE_T *pPacket = (PD_ELE_T *) pHeap->pTimers[0].pElement;
+
+        if (timercmp(&pHeap->pTimers[0].timeToGo, &pPacket->timeToGo, <))
+        {
+            /* received in time, supervise the new deadline */
+            (void) trdp_timerInsert(pHeap, pPacket, &pPacket->timerIdx, &pPacket->timeToGo);    /* re-key only */
+        }
+        else
+        {
+            /* remove it before the callback, which may unsubscribe */
+            trdp_pdDisarmTimeout(appHandle, pPacket);
+            trdp_handleTimeout(appHandle, pPacket, &now);
+        }
     }
 }
 
@@ -1199,19 +1809,16 @@ void trdp_pdHandleTimeOuts (
  *
  *  @param[in]      appHandle       Session handle
  *  @param[in]      pPacket         pointer to the packet element to check
+ *  @param[in]      pNow            current time
  */
 void trdp_handleTimeout (
-    TRDP_SESSION_PT appHandle,
-    PD_ELE_T        *pPacket)
+    TRDP_SESSION_PT     appHandle,
+    PD_ELE_T            *pPacket,
+    const TRDP_TIME_T   *pNow)
 {
-    TRDP_TIME_T now;
-
-    /*    Update the current time    */
-    vos_getTime(&now);
-
     if (timerisset(&pPacket->interval) &&
         timerisset(&pPacket->timeToGo) &&                        /*  Prevent timing out of PULLed data too early */
-        !timercmp(&pPacket->timeToGo, &now, >) &&                /*  late?   */
+        !timercmp(&pPacket->timeToGo, pNow, >) &&                /*  late?   */
         !(pPacket->privFlags & TRDP_TIMED_OUT) &&                /*  and not already flagged ?   */
         !(pPacket->addr.comId == TRDP_STATISTICS_PULL_COMID)) /*  Do not bother user with statistics timeout */
     {
@@ -1302,7 +1909,6 @@ TRDP_ERR_T   trdp_pdCheckListenSocks (
          */
         UINT32      idx;
         TRDP_ERR_T  err;
-        BOOL8       nonBlocking = !(appHandle->option & TRDP_OPTION_BLOCK);
 
         /*    Check and set the socket file descriptor by going thru the socket list    */
         for (idx = 0; idx < (UINT32) trdp_getCurrentMaxSocketCnt(TRDP_SOCK_PD); idx++)
@@ -1311,34 +1917,10 @@ TRDP_ERR_T   trdp_pdCheckListenSocks (
                 (VOS_FD_ISSET(appHandle->ifacePD[idx].sock, (VOS_FDS_T *) pRfds)))  /*lint !e573 signed/unsigned division in
                                                                                macro */
             {
-                VOS_LOG_T logType = VOS_LOG_ERROR;
-
-                /*  PD frame received? */
-                /*  Compare the received data to the data in our receive queue
-                 Call user's callback if data changed    */
-
-                do
+                err = trdp_pdReceiveSocket(appHandle, idx);
+                if (err != TRDP_NO_ERR)
                 {
-                    /* Read as long as data is available */
-                    err = trdp_pdReceive(appHandle, appHandle->ifacePD[idx].sock);
-
-                }
-                while ((err == TRDP_NO_ERR) && (nonBlocking == TRUE));
-
-                switch (err)
-                {
-                    case TRDP_NO_ERR:
-                    case TRDP_NOSUB_ERR:        /* missing subscription should not lead to extensive error output */
-                    case TRDP_BLOCK_ERR:
-                    case TRDP_NODATA_ERR:       /* ignore would-block or sporadic unsolicited messages */
-                        break;
-                    case TRDP_TOPO_ERR:
-                    case TRDP_TIMEOUT_ERR:
-                    default:
-                        result  = err;
-                        logType = VOS_LOG_WARNING;
-                        vos_printLog(logType, "trdp_pdReceive() failed (Err: %d)\n", err);
-                        break;
+                    result = err;
                 }
                 (*pCount)--;
                 VOS_FD_CLR(appHandle->ifacePD[idx].sock, (VOS_FDS_T *)pRfds); /*lint !e502 !e573 !e505
@@ -1555,7 +2137,140 @@ TRDP_ERR_T  trdp_pdSend (
     return TRDP_NO_ERR;
 }
 
-#ifndef HIGH_PERF_INDEXED
+#ifdef HIGH_PERF_INDEXED
+/******************************************************************************/
+/** Add a due PD telegram to the send batch
+ *  A full batch is sent before the telegram is added.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        telegram to send
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_IO_ERR     sending the full batch failed
+ */
+static TRDP_ERR_T trdp_pdAddToBatch (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    TRDP_ERR_T err = TRDP_NO_ERR;
+
+    if (appHandle->sndBatch.count >= TRDP_PD_SND_BATCH_SIZE)
+    {
+        err = trdp_pdSendBatch(appHandle);
+    }
+    appHandle->sndBatch.pElement[appHandle->sndBatch.count++] = pElement;
+    return err;
+}
+
+/******************************************************************************/
+/** Send the collected PD telegrams
+ *  The telegrams are grouped by socket, each group is passed to one vos_sockSendUDPBatch() call.
+ *  Statistics are updated per telegram as with trdp_pdSend().
+ *
+ *  @param[in]      appHandle       session pointer
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_IO_ERR     at least one telegram could not be sent
+ */
+TRDP_ERR_T  trdp_pdSendBatch (
+    TRDP_SESSION_PT appHandle)
+{
+    TRDP_PD_SND_BATCH_T *pBatch = &appHandle->sndBatch;
+    VOS_UDP_MSG_T       msgs[TRDP_PD_SND_BATCH_SIZE];
+    PD_ELE_T            *pGroup[TRDP_PD_SND_BATCH_SIZE];
+    TRDP_ERR_T          err = TRDP_NO_ERR;
+    UINT32              first;
+    UINT32              idx;
+
+    for (first = 0u; first < pBatch->count; first++)
+    {
+        UINT32  socketIdx;
+        UINT32  noOfMsgs = 0u;
+        UINT32  noOfDone;
+        UINT32  noOfSent;
+
+        if (pBatch->pElement[first] == NULL)
+        {
+            continue;
+        }
+
+        /* Collect all telegrams for the socket of the first pending one */
+        socketIdx = (UINT32) pBatch->pElement[first]->socketIdx;
+        for (idx = first; idx < pBatch->count; idx++)
+        {
+            PD_ELE_T *pElement = pBatch->pElement[idx];
+
+            if ((pElement != NULL) && ((UINT32) pElement->socketIdx == socketIdx))
+            {
+                pElement->sendSize          = pElement->grossSize;
+                msgs[noOfMsgs].pBuffer      = (UINT8 *) &pElement->pFrame->frameHead;
+                msgs[noOfMsgs].size         = pElement->grossSize;
+                msgs[noOfMsgs].dstIPAddr    = pElement->addr.destIpAddr;
+                pGroup[noOfMsgs++]          = pElement;
+                pBatch->pElement[idx]       = NULL;
+            }
+        }
+
+        noOfDone = noOfMsgs;
+        if (vos_sockSendUDPBatch(appHandle->ifacePD[socketIdx].sock, msgs, &noOfDone,
+                                 appHandle->pdDefault.port) != VOS_NO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_DBG, "trdp_pdSendBatch failed\n");
+            err = TRDP_IO_ERR;
+        }
+
+        /* a telegram which could not be sent has size 0, the following ones were still sent */
+        noOfSent = 0u;
+        for (idx = 0u; idx < noOfDone; idx++)
+        {
+            pGroup[idx]->sendSize = msgs[idx].size;
+            if (pGroup[idx]->sendSize == pGroup[idx]->grossSize)
+            {
+                appHandle->stats.pd.numSend++;
+                pGroup[idx]->numRxTx++;
+                noOfSent++;
+            }
+            else if (pGroup[idx]->sendSize != 0u)
+            {
+                vos_printLogStr(VOS_LOG_ERROR, "trdp_pdSendBatch incomplete\n");
+                err = TRDP_IO_ERR;
+            }
+        }
+
+        appHandle->batchStats.numTxBatches++;
+        appHandle->batchStats.numTxPackets += noOfSent;
+        if (noOfMsgs > appHandle->batchStats.maxTxBatchSize)
+        {
+            appHandle->batchStats.maxTxBatchSize = noOfMsgs;
+        }
+    }
+    pBatch->count = 0u;
+    return err;
+}
+
+/******************************************************************************/
+/** Remove a PD telegram from the send batch
+ *  Must be called before a publisher is deleted.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        telegram to remove
+ */
+void trdp_pdRemoveFromBatch (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    UINT32 idx;
+
+    for (idx = 0u; idx < appHandle->sndBatch.count; idx++)
+    {
+        if (appHandle->sndBatch.pElement[idx] == pElement)
+        {
+            appHandle->sndBatch.pElement[idx] = NULL;
+        }
+    }
+}
+
+#else
 
 /* Note: This function is not necessary for the high performance version; see trdp_pdindex.c */
 
@@ -17,6 +17,12 @@
 /*
 * $Id$
 *
+*      AG 2026-10-16: trdp_pdReserve(), trdp_pdCommit()
+*      AG 2026-10-16: trdp_pdLend(), trdp_pdReturn(), trdp_pdFreeLent()
+*      AG 2026-10-16: trdp_pdNextJob(), trdp_pdReceiveSocket()
+*      AG 2026-10-16: Send heap functions (trdp_pdScheduleSend et al.)
+*      AG 2026-10-16: Timeout heap functions (trdp_pdArmTimeout et al.), trdp_handleTimeout() takes the current time
+*      AG 2026-10-16: trdp_pdSendBatch() and trdp_pdRemoveFromBatch() for the indexed sender
 *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
 *      BL 2019-06-17: Ticket #264 Provide service oriented interface
 *      BL 2019-06-17: Ticket #162 Independent handling of PD and MD to reduce jitter
@@ -89,6 +95,27 @@ TRDP_ERR_T trdp_pdGet (
     UINT8               *pData,
     UINT32              *pDataSize);
 
+TRDP_ERR_T trdp_pdLend (
+    PD_ELE_T    *pPacket,
+    const UINT8 **ppData,
+    UINT32      *pDataSize);
+
+TRDP_ERR_T trdp_pdReturn (
+    PD_ELE_T    *pPacket,
+    const UINT8 *pData);
+
+void trdp_pdFreeLent (
+    PD_ELE_T *pPacket);
+
+TRDP_ERR_T trdp_pdReserve (
+    PD_ELE_T    *pPacket,
+    UINT32      dataSize,
+    UINT8       **ppData);
+
+TRDP_ERR_T trdp_pdCommit (
+    PD_ELE_T    *pPacket,
+    UINT32      dataSize);
+
 TRDP_ERR_T  trdp_pdSendElement (
     TRDP_SESSION_PT appHandle,
     PD_ELE_T        * *ppElement);
@@ -96,6 +123,15 @@ TRDP_ERR_T  trdp_pdSendElement (
 TRDP_ERR_T  trdp_pdSendQueued (
     TRDP_SESSION_PT appHandle);
 
+#ifdef HIGH_PERF_INDEXED
+TRDP_ERR_T  trdp_pdSendBatch (
+    TRDP_SESSION_PT appHandle);
+
+void        trdp_pdRemoveFromBatch (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement);
+#endif
+
 #ifdef TSN_SUPPORT
 TRDP_ERR_T  trdp_pdSendImmediateTSN (
     TRDP_SESSION_PT appHandle,
@@ -111,6 +147,10 @@ TRDP_ERR_T  trdp_pdReceive (
     TRDP_SESSION_PT pSessionHandle,
     VOS_SOCK_T      sock);
 
+void        trdp_pdNextJob (
+    TRDP_SESSION_PT appHandle,
+    int             checkSend);
+
 void        trdp_pdCheckPending (
     TRDP_APP_SESSION_T  appHandle,
     TRDP_FDS_T          *pFileDesc,
@@ -118,12 +158,47 @@ void        trdp_pdCheckPending (
     int                 checkSending);
 
 void        trdp_handleTimeout (
+    TRDP_SESSION_PT     appHandle,
+    PD_ELE_T            *pIterPD,
+    const TRDP_TIME_T   *pNow);
+
+TRDP_ERR_T  trdp_pdArmTimeout (
     TRDP_SESSION_PT appHandle,
-    PD_ELE_T        *pIterPD);
+    PD_ELE_T        *pElement);
+
+void        trdp_pdDisarmTimeout (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement);
+
+BOOL8       trdp_pdNextTimeout (
+    TRDP_SESSION_PT appHandle,
+    TRDP_TIME_T     *pNext);
+
+TRDP_ERR_T  trdp_pdScheduleSend (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement);
+
+void        trdp_pdUnscheduleSend (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement);
+
+void        trdp_pdRescheduleSend (
+    TRDP_SESSION_PT appHandle);
+
+BOOL8       trdp_pdNextSend (
+    TRDP_SESSION_PT appHandle,
+    TRDP_TIME_T     *pNext);
+
+void        trdp_pdFreeTimeouts (
+    TRDP_SESSION_PT appHandle);
 
 void        trdp_pdHandleTimeOuts (
     TRDP_SESSION_PT appHandle);
 
+TRDP_ERR_T  trdp_pdReceiveSocket (
+    TRDP_SESSION_PT appHandle,
+    UINT32          idx);
+
 TRDP_ERR_T  trdp_pdCheckListenSocks (
     TRDP_SESSION_PT appHandle,
     TRDP_FDS_T      *pRfds,
@@ -17,6 +17,8 @@
 /*
  * $Id$
  *
+ *      AG 2026-10-16: Timeout supervision by the deadline heap of trdp_pdcom.c, trdp_pdHandleTimeOutsIndexed() removed
+ *      AG 2026-10-16: trdp_pdSendIndexed() sends the telegrams of a slot in batches (one call per socket)
  *     CWE 2023-02-14: Ticket #419 PDTestFastBase2 failed when send-cycles were set to 256ms
  *     CWE 2023-02-02: Ticket #380 Added base 2 cycle time support for high performance PD: set HIGH_PERF_BASE2=1 in make config file (see LINUX_HP2_config)
  *     AHW 2023-01-05: Ticket #407 Interval not updated in trdp_indexCheckPending if Hight performance index with no subscriptions
@@ -997,71 +999,6 @@ TRDP_ERR_T trdp_indexCreatePubTables (TRDP_SESSION_PT appHandle)
     return err;
 }
 
-/**********************************************************************************************************************/
-/** Access the receiver index table for timeout supervision
- *  Assume to be called irregularly by the receiver thread
- *
- *  @param[in]      appHandle         pointer to the packet element to send
- *
- *  @retval         none
- */
-void  trdp_pdHandleTimeOutsIndexed (TRDP_SESSION_PT appHandle)
-{
-    UINT32 idx, idxMax;
-    TRDP_TIME_T now, interval;
-    PD_ELE_T * *pElement;
-    static TRDP_TIME_T  lastCall = {0, 0};
-    static TRDP_TIME_T  cumulatedCallTime = {0, 0};
-
-    vos_getTime(&now);
-
-    if (timerisset(&lastCall) != 0) /* On first run we do nothing but set lastCall to now */
-    {
-        /* determine the time since last call  */
-        interval = now;
-        vos_subTime(&interval, &lastCall);
-
-        /* sum up our execution time */
-        vos_addTime(&cumulatedCallTime, &interval);
-
-        /* determine which time slot we should search */
-        /* interval_ms = interval.tv_usec / 1000 + interval.tv_sec * 1000u; */
-
-        pElement    = (PD_ELE_T * *) appHandle->pSlot->pRcvTableTimeOut;
-        idxMax      = appHandle->pSlot->noOfRxEntries;
-
-        /* we need to check the first, fastest intervals each time we are called */
-        for (idx = 0;
-             (idx < idxMax) &&
-             timercmp(&(pElement[idx]->interval), &interval, < );
-             idx++)
-        {
-            if (timercmp(&(pElement[idx]->timeToGo), &now, <))
-            {
-                trdp_handleTimeout(appHandle, pElement[idx]);
-            }
-        }
-
-        /* every TRDP_TO_CHECK_CYCLE (default 100ms) check for other timeouts */
-        if ((cumulatedCallTime.tv_usec > TRDP_TO_CHECK_CYCLE) || (cumulatedCallTime.tv_sec != 0))
-        {
-            for (;
-                 idx < idxMax;
-                 idx++)
-            {
-                /* we check only briefly, complete check is done inside trdp_handleTimeout */
-                if (timercmp(&(pElement[idx]->timeToGo), &now, <))
-                {
-                    trdp_handleTimeout(appHandle, pElement[idx]);
-                }
-            }
-            /* Reset the cumulated time */
-            timerclear(&cumulatedCallTime);
-        }
-    }
-    lastCall = now;
-}
-
 /**********************************************************************************************************************/
 /** Access the transmitter index tables
  *  Assume to be called with the process cycle defined from openSession configuration!
@@ -1100,6 +1037,9 @@ TRDP_ERR_T trdp_pdSendIndexed (TRDP_SESSION_PT appHandle)
                 );
 */
 
+    /* Due telegrams of a slot are collected and sent with one call per socket (trdp_pdSendBatch) */
+    appHandle->sndBatch.active = TRUE;
+
     /* In case we are called less often than 1ms, we'll loop over the index table */
     for (i = 0u; i < pSlot->processCycle; i += TRDP_MIN_CYCLE)
     {
@@ -1122,6 +1062,11 @@ TRDP_ERR_T trdp_pdSendIndexed (TRDP_SESSION_PT appHandle)
                 result = err;   /* return first error, only. Keep on sending... */
             }
         }
+        err = trdp_pdSendBatch(appHandle);
+        if (err != TRDP_NO_ERR)
+        {
+            result = err;
+        }
 
         /* #419: base-independant align mid-index-action to the middle of the time-slot to reduce overlapping with low-index-actions */
         if ((idxLow % (TRDP_MID_CYCLE / TRDP_LOW_CYCLE)) == (TRDP_MID_CYCLE / TRDP_LOW_CYCLE / 2))
@@ -1142,6 +1087,11 @@ TRDP_ERR_T trdp_pdSendIndexed (TRDP_SESSION_PT appHandle)
                     result = err;   /* return first error, only. Keep on sending... */
                 }
             }
+            err = trdp_pdSendBatch(appHandle);
+            if (err != TRDP_NO_ERR)
+            {
+                result = err;
+            }
 
             /* We check for PD Requests in the send queue every 10ms */
             while ((appHandle->pSndQueue != NULL) &&
@@ -1180,6 +1130,11 @@ TRDP_ERR_T trdp_pdSendIndexed (TRDP_SESSION_PT appHandle)
                     result = err;   /* return first error, only. Keep on sending... */
                 }
             }
+            err = trdp_pdSendBatch(appHandle);
+            if (err != TRDP_NO_ERR)
+            {
+                result = err;
+            }
             /* Every 100ms we check here for packets with intervals beyond our upper limit */
             if (pSlot->noOfExtTxEntries != 0)
             {
@@ -1198,6 +1153,7 @@ TRDP_ERR_T trdp_pdSendIndexed (TRDP_SESSION_PT appHandle)
                         (void) trdp_pdSendElement(appHandle, &pSlot->pExtTxTable[depth]);
                     }
                 }
+                (void) trdp_pdSendBatch(appHandle);
             }
         }
         /* Proceed minimum TRDP cycle-time and check the next lowCat index */
@@ -1230,6 +1186,7 @@ TRDP_ERR_T trdp_pdSendIndexed (TRDP_SESSION_PT appHandle)
             pSlot->currentCycle = 0u;
         }
     }
+    appHandle->sndBatch.active = FALSE;
     return result;
 }
 
@@ -1402,8 +1359,9 @@ void trdp_indexCheckPending (
     TRDP_FDS_T          *pFileDesc,
     TRDP_SOCK_T         *pNoDesc)    /* #399 */
 {
-    PD_ELE_T    * *iterPD;
     UINT32      idx;
+    TRDP_TIME_T now;
+    TRDP_TIME_T next;
     TRDP_TIME_T delay = {0u, TRDP_HIGH_CYCLE_LIMIT / 1000};      /* #380: This determines the max. delay to report a timeout. 10000ms upon base 10 or 8192ms upon base 2  */
 
     if ((appHandle->pSlot == NULL) || (appHandle->pSlot->pRcvTableTimeOut == NULL))
@@ -1412,20 +1370,21 @@ void trdp_indexCheckPending (
         return;
     }
 
-    iterPD = appHandle->pSlot->pRcvTableTimeOut;
-
-    /*    Find the first packet with a non-zero timeout value; we search the ordered list and
-     stop at the first non-zero PD Element (usually the first) */
-    for (idx = 0; idx < appHandle->pSlot->noOfRxEntries; idx++)
+    /*    The next timeout is on top of the deadline heap, shared with the standard receiver    */
+    vos_getTime(&now);
+    if (trdp_pdNextTimeout(appHandle, &next))
     {
-        if (timerisset(&iterPD[idx]->interval))
+        if (timercmp(&next, &now, <))
         {
-            delay = iterPD[idx]->interval;
-            break;
+            next = now;
+        }
+        vos_subTime(&next, &now);
+        if (timercmp(&next, &delay, <))
+        {
+            delay = next;
         }
     }
-    /*    Get the current time and add the found interval to nextjob  */
-    vos_getTime(&appHandle->nextJob);
+    appHandle->nextJob = now;
     vos_addTime(&appHandle->nextJob, &delay);
 
     /* Return the interval for select() directly */
@@ -1460,6 +1419,9 @@ void    trdp_indexRemovePub (TRDP_SESSION_PT appHandle, PD_ELE_T *pElement)
     UINT32 idx;
     TRDP_HP_CAT_SLOTS_T *pSlot = appHandle->pSlot;
 
+    /* It might be waiting in the send batch */
+    trdp_pdRemoveFromBatch(appHandle, pElement);
+
     if (pSlot == NULL)
     {
         return;
@@ -17,6 +17,7 @@
 /*
  * $Id$
  *
+ *      AG 2026-10-16: trdp_pdHandleTimeOutsIndexed() removed, the deadline heap supervises both modes
  *     CWE 2023-02-14: Ticket #419 PDTestFastBase2 failed - clarified comments
  *     CWE 2023-02-02: Ticket #380 Added base 2 cycle time support for high performance PD: set HIGH_PERF_BASE2=1 in make config file (see LINUX_HP2_config)
  *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
@@ -182,7 +183,6 @@ void        trdp_queueInsThroughputAccending (PD_ELE_T  * *ppHead,
                                               PD_ELE_T  *pNew);
 
 TRDP_ERR_T  trdp_pdSendIndexed (TRDP_SESSION_PT appHandle);
-void        trdp_pdHandleTimeOutsIndexed (TRDP_SESSION_PT appHandle);
 
 PD_ELE_T    *trdp_indexedFindSubAddr (TRDP_SESSION_PT   appHandle,
                                       TRDP_ADDRESSES_T  *pAddr);
@@ -17,6 +17,21 @@
 /*
  * $Id$
  *
+ *      AG 2026-10-16: One deadline heap type for PD and MD (TRDP_TIMER_HEAP_T)
+ *      AG 2026-10-16: Chunked reception of large TCP messages (TRDP_MD_STREAM_T, pMDStream)
+ *      AG 2026-10-16: TCP connection pool: connected, connectStart of TRDP_SOCKET_TCP_T, tcpPoolStats
+ *      AG 2026-10-16: Deadline heap and ready list of the MD sessions (TRDP_TIMER_HEAP_T mdTimers, pMDReadyFirst)
+ *      AG 2026-10-16: Index of the MD listeners on comId and destination URI (TRDP_MD_LIS_INDEX_T)
+ *      AG 2026-10-16: Session ID hash index of the MD send and receive queues (TRDP_MD_HASH_T)
+ *      AG 2026-10-16: Frame reserved by tlp_reserve() (PD_ELE_T pSpare, spareSize, TRDP_RESERVED_FRAME)
+ *      AG 2026-10-16: Frames lent to the application by tlp_getRef() (PD_ELE_T pLent, pSpare, lentCnt)
+ *      AG 2026-10-16: Socket event set of the session (TRDP_EVENTS_T) for tlc_processEvents()
+ *      AG 2026-10-16: Send heap of the publishers (pdSndTimers)
+ *      AG 2026-10-16: Timeout heap of the subscriptions (TRDP_TIMER_HEAP_T pdTimers)
+ *      AG 2026-10-16: Sequence counters of the senders per subscription kept in a hash table with ageing
+ *      AG 2026-10-16: Hash index of the subscriptions (TRDP_SUB_HASH_T)
+ *      AG 2026-10-16: Send batch for the indexed PD sender (TRDP_PD_SND_BATCH_T)
+ *      AG 2026-10-16: Receive buffers and statistics for batched PD reception
  *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
  *      BL 2020-07-10: Ticket #321 Move TRDP_TIMER_GRANULARITY to public API
  *      CK 2020-04-06: Ticket #318 Added pointer to list of seqCnt used per comId for PD Requests in TRDP_SESSION_T
@@ -97,12 +112,39 @@
 
 #define TRDP_MD_MAN_CYCLE_TIME          5000u                       /**< cycle time [us} = delay for outgoing MD      */
 
+/** Buffer of a TCP message delivered in chunks (stream of TRDP_MD_CONFIG_T), smaller messages are delivered as a whole */
+#ifndef TRDP_MD_STREAM_CHUNK_SIZE
+#   define TRDP_MD_STREAM_CHUNK_SIZE    16384u
+#endif
+
 #define TRDP_DEBUG_DEFAULT_FILE_SIZE    65536u                      /**< Default maximum size of log file             */
 
 #define TRDP_MAGIC_PUB_HNDL_VALUE       0xCAFEBABEu
 #define TRDP_MAGIC_SUB_HNDL_VALUE       0xBABECAFEu
 
-#define TRDP_SEQ_CNT_START_ARRAY_SIZE   64u                         /**< This should be enough for the start          */
+#define TRDP_SEQ_CNT_START_ARRAY_SIZE   8u                          /**< Initial size of the sequence counter hash
+                                                                         table per subscription (power of 2)          */
+#define TRDP_SEQ_CNT_AGE_FACTOR         10u                         /**< Sequence counters of senders silent for this
+                                                                         many subscription timeouts are dropped       */
+#define TRDP_SEQ_CNT_MIN_AGE            10u                         /**< Minimum silence [s] before they are dropped  */
+
+/** Number of PD frames read from a socket with one receive call (see vos_sockReceiveUDPBatch) */
+#ifndef TRDP_PD_RCV_BATCH_SIZE
+#   if defined(__linux) && (VOS_MAX_UDP_BATCH >= 16u)
+#       define TRDP_PD_RCV_BATCH_SIZE   16u                         /**< Linux reads many datagrams per syscall       */
+#   else
+#       define TRDP_PD_RCV_BATCH_SIZE   1u                          /**< one frame per call, saves receive buffers    */
+#   endif
+#endif
+
+/** Number of PD frames the indexed sender hands to one send call (see vos_sockSendUDPBatch) */
+#ifndef TRDP_PD_SND_BATCH_SIZE
+#   if defined(__linux)
+#       define TRDP_PD_SND_BATCH_SIZE   VOS_MAX_UDP_BATCH           /**< Linux sends many datagrams per syscall       */
+#   else
+#       define TRDP_PD_SND_BATCH_SIZE   1u                          /**< no batching, send each frame at once         */
+#   endif
+#endif
 
 #define TRDP_IF_WAIT_FOR_READY          120u        /**< 120 seconds (120 tries each second to bind to an IP address) */
 
@@ -148,6 +190,7 @@ typedef enum
 #define TRDP_INVALID_DATA   0x4u            /**< if set, inform the user                                */
 #define TRDP_REQ_2B_SENT    0x8u            /**< if set, the request needs to be sent                   */
                                             /* TRDP_PULL_SUB removed, was unused */
+#define TRDP_RESERVED_FRAME 0x10u           /**< if set, pSpare is reserved by tlp_reserve()            */
 #define TRDP_REDUNDANT      0x20u           /**< if set, packet should not be sent (redundant)          */
 #define TRDP_CHECK_COMID    0x40u           /**< if set, do filter comId (addListener)                  */
 #define TRDP_IS_TSN         0x80u           /**< if set, PD will be sent on trdp_put() only             */
@@ -182,14 +225,21 @@ typedef struct
 {
     UINT32          lastSeqCnt;                         /**< Sequence counter value for comId           */
     TRDP_IP_ADDR_T  srcIpAddr;                          /**< Source IP address                          */
-    TRDP_MSG_T      msgType;                            /**< message type                               */
+    TRDP_MSG_T      msgType;                            /**< message type, 0 marks an unused slot       */
+    UINT32          lastRcvTime;                        /**< time [s] of the last packet from this sender */
 } TRDP_SEQ_CNT_ENTRY_T;
 
+/** Hash table (open addressing, linear probing) of the sequence counters per sender, allocated as one block */
 typedef struct
 {
-    UINT16                  maxNoOfEntries;             /**< Max. no of entries the seq[] can hold      */
-    UINT16                  curNoOfEntries;             /**< Current no of entries in array             */
-    TRDP_SEQ_CNT_ENTRY_T    seq[1];                     /**< list of used sequence no.                  */
+    UINT16                  maxNoOfEntries;             /**< Number of slots in seq[], power of 2       */
+    UINT16                  curNoOfEntries;             /**< Number of used slots                       */
+    UINT16                  peakNoOfEntries;            /**< Highest number of used slots               */
+    UINT16                  reserved;
+    UINT32                  numDuplicates;              /**< Packets dropped as duplicate or old        */
+    UINT32                  numAged;                    /**< Entries dropped by ageing                  */
+    UINT32                  numGrown;                   /**< Number of times the table was enlarged     */
+    TRDP_SEQ_CNT_ENTRY_T    seq[1];                     /**< hash table of used sequence no.            */
 } TRDP_SEQ_CNT_LIST_T;
 
 /** Tuple of last used sequence counter for PD Request (PR) per comId  */
@@ -210,6 +260,8 @@ typedef struct TRDP_SOCKET_TCP
     TRDP_TIME_T     sendingTimeout;                     /**< The timeout sending the message              */
     BOOL8           addFileDesc;                        /**< Ready to add the socket in the fd            */
     BOOL8           morituri;                           /**< about to die                                 */
+    BOOL8           connected;                          /**< Connection established (caller sockets)      */
+    TRDP_TIME_T     connectStart;                       /**< Time connect() was first called              */
 } TRDP_SOCKET_TCP_T;
 
 
@@ -333,6 +385,7 @@ typedef struct PD_ELE
     TRDP_TIME_T         interval;               /**< time out value for received packets or
                                                      interval for packets to send (set from ms)             */
     TRDP_TIME_T         timeToGo;               /**< next time this packet must be sent/rcv                 */
+    UINT32              timerIdx;               /**< position + 1 in the timeout or send heap, 0 if none    */
     TRDP_TO_BEHAVIOR_T  toBehavior;             /**< timeout behavior for packets                           */
     UINT32              dataSize;               /**< net data size                                          */
     UINT32              grossSize;              /**< complete packet size (header, data)                    */
@@ -342,13 +395,68 @@ typedef struct PD_ELE
     void                *pUserRef;              /**< from subscribe()                                       */
     TRDP_PD_CALLBACK_T  pfCbFunction;           /**< Pointer to PD callback function                        */
     PD_PACKET_T         *pFrame;                /**< header ... data + FCS...                               */
+    PD_PACKET_T         *pLent;                 /**< frame lent to the application by tlp_getRef() or NULL  */
+    PD_PACKET_T         *pSpare;                /**< receive buffer replacing the lent frame (subscriber) or
+                                                     frame reserved by tlp_reserve() (publisher) or NULL    */
+    UINT32              spareSize;              /**< allocated size of pSpare (publisher)                   */
+    UINT32              lentCnt;                /**< references to pLent not yet released                   */
 } PD_ELE_T, *TRDP_PUB_PT, *TRDP_SUB_PT;
 
+/** Entry of the subscription hash index, keyed on comId, serviceId, source and destination IP.
+    Subscriptions without source filter or with a source IP range share the key (comId, 0, 0, 0) and form the
+    fallback list of that comId. */
+typedef struct
+{
+    UINT32              comId;                  /**< key: comId                                             */
+    UINT32              serviceId;              /**< key: serviceId (always 0 without SOA_SUPPORT)          */
+    TRDP_IP_ADDR_T      srcIpAddr;              /**< key: source IP, 0 for the fallback list                */
+    TRDP_IP_ADDR_T      destIpAddr;             /**< key: destination IP or MC group, 0 for any             */
+    PD_ELE_T            *pElement;              /**< subscription, NULL for a free slot                     */
+} TRDP_SUB_HASH_ENTRY_T;
+
+/** Open addressing (linear probing) hash index of the receive queue */
+typedef struct
+{
+    UINT32              size;                   /**< number of slots (power of 2), 0 if not allocated      */
+    UINT32              count;                  /**< number of used slots                                   */
+    BOOL8               incomplete;             /**< an insert failed, the receive queue must be searched   */
+    TRDP_SUB_HASH_ENTRY_T   *pSlots;            /**< slot array                                             */
+} TRDP_SUB_HASH_T;
+
+/** Entry of a deadline heap (PD timeouts, PD sending, MD sessions). The key may be earlier than the timeToGo of the
+    element: the entry is re-keyed when it reaches the top of the heap. */
+typedef struct
+{
+    TRDP_TIME_T         timeToGo;               /**< key: deadline                                          */
+    void                *pElement;              /**< PD_ELE_T or MD_ELE_T                                   */
+    UINT32              *pIdx;                  /**< back index of the element: position + 1, 0 if none     */
+} TRDP_TIMER_T;
+
+/** Binary min-heap of deadlines, see trdp_timerInsert() */
+typedef struct
+{
+    UINT32              size;                   /**< number of allocated entries                            */
+    UINT32              count;                  /**< number of used entries                                 */
+    TRDP_TIMER_T        *pTimers;               /**< heap array, earliest deadline at index 0               */
+} TRDP_TIMER_HEAP_T;
+
+#ifdef HIGH_PERF_INDEXED
+/** PD telegrams of one index table slot waiting to be sent with one call per socket */
+typedef struct
+{
+    BOOL8               active;                 /**< collect telegrams instead of sending them at once      */
+    UINT32              count;                  /**< number of entries in pElement                          */
+    PD_ELE_T            *pElement[TRDP_PD_SND_BATCH_SIZE];  /**< telegrams to send, NULL if removed         */
+} TRDP_PD_SND_BATCH_T;
+#endif /* HIGH_PERF_INDEXED */
+
 #if MD_SUPPORT
 /** Queue element for MD listeners (UDP and TCP)   */
 typedef struct MD_LIS_ELE
 {
     struct MD_LIS_ELE   *pNext;                 /**< pointer to next element or NULL                        */
+    struct MD_LIS_ELE   *pHashNext;             /**< next listener in the same bucket of the listener index */
+    UINT32              seqNo;                  /**< registration order, highest for the newest listener   */
     TRDP_ADDRESSES_T    addr;                   /**< addressing values                                      */
     TRDP_PRIV_FLAGS_T   privFlags;              /**< private flags                                          */
     TRDP_FLAGS_T        pktFlags;               /**< flags                                                  */
@@ -371,6 +479,11 @@ typedef struct TRDP_MD_TCP
 typedef struct MD_ELE
 {
     struct MD_ELE       *pNext;                 /**< pointer to next element or NULL                        */
+    struct MD_ELE       *pHashNext;             /**< next element in the same bucket of the session hash    */
+    struct MD_ELE       *pReadyNext;            /**< next element in the ready list                         */
+    BOOL8               ready;                  /**< in the ready list (to be sent)                         */
+    UINT32              timerIdx;               /**< position + 1 in the deadline heap, 0 if none           */
+    BOOL8               retry;                  /**< in the deadline heap to be sent again, not for timeout */
     TRDP_ADDRESSES_T    addr;                   /**< handle of publisher/subscriber                         */
     UINT32              curSeqCnt;              /**< the last sent or received sequence counter             */
     TRDP_PRIV_FLAGS_T   privFlags;              /**< private flags                                          */
@@ -405,6 +518,48 @@ typedef struct MD_ELE
     MD_LIS_ELE_T        *pListener;             /**< Pointer to the Session's associated Listener           */
 } MD_ELE_T;
 
+/** Chained hash index of an MD queue, keyed on the session ID.
+    Elements with the same session ID (e.g. a request and the Me answering it locally) keep their queue order
+    within a bucket. Without buckets (not yet allocated or out of memory) the queue itself is searched. */
+typedef struct
+{
+    UINT32              size;                   /**< number of buckets (power of 2), 0 if not allocated    */
+    UINT32              count;                  /**< number of elements in the queue                        */
+    MD_ELE_T            **ppBuckets;            /**< bucket array or NULL                                   */
+} TRDP_MD_HASH_T;
+
+/** Chained hash index of the MD listeners, keyed on what a listener filters on: the comId (if checked) and the
+    lower-cased destination URI (if set). Listeners checking neither share the wildcard key. A received request
+    is looked up under its four possible keys; within a bucket the listeners are kept in queue order (descending
+    seqNo), so the first match of each bucket is compared by seqNo to find the listener the queue walk would find.
+    Without buckets (not yet allocated or out of memory) the listener queue itself is searched. */
+typedef struct
+{
+    UINT32              size;                   /**< number of buckets (power of 2), 0 if not allocated    */
+    UINT32              count;                  /**< number of listeners in the queue                       */
+    UINT32              lastSeqNo;              /**< seqNo of the newest listener                           */
+    MD_LIS_ELE_T        **ppBuckets;            /**< bucket array or NULL                                   */
+} TRDP_MD_LIS_INDEX_T;
+
+#define TRDP_MD_LIS_KEYS    4u                  /**< keys a received request is looked up under             */
+
+/** Reception of a large TCP message delivered to the application in chunks (stream of TRDP_MD_CONFIG_T).
+    Only the header is kept in the session, the data is read into the chunk buffer and handed to the callback of the
+    session each time the buffer is full. */
+typedef struct
+{
+    VOS_SOCK_T          sock;                   /**< connection the message is received on                  */
+    TRDP_MSG_T          msgType;                /**< message type, selects the session queue                */
+    UINT8               sessionID[16u];         /**< session the chunks are delivered to                    */
+    BOOL8               deliver;                /**< a session was found or created for the message         */
+    BOOL8               closeSession;           /**< close the session when the message is complete         */
+    UINT32              dataSize;               /**< dataset size announced in the header                   */
+    UINT32              offset;                 /**< dataset bytes delivered so far                         */
+    UINT32              pending;                /**< bytes still to be read, including the padding          */
+    UINT32              fill;                   /**< bytes in the chunk buffer                              */
+    UINT8               chunk[TRDP_MD_STREAM_CHUNK_SIZE];   /**< chunk buffer                               */
+} TRDP_MD_STREAM_T;
+
 /**    TCP file descriptor parameters   */
 typedef struct
 {
@@ -414,6 +569,26 @@ typedef struct
 } TRDP_TCP_FD_T;
 #endif
 
+/** Tags of the sockets registered in the event set of a session   */
+#define TRDP_EVENT_TAG_PD       0x10000u        /**< PD socket, low word is the index into ifacePD          */
+#define TRDP_EVENT_TAG_MD       0x20000u        /**< MD socket, low word is the index into ifaceMD          */
+#define TRDP_EVENT_TAG_LISTEN   0x30000u        /**< TCP listen socket                                      */
+#define TRDP_EVENT_TAG_KIND     0xFFFF0000u     /**< mask of the socket kind                                */
+#define TRDP_EVENT_TAG_INDEX    0x0000FFFFu     /**< mask of the socket index                               */
+
+/** Socket event set of a session, the sockets registered are mirrored to detect changes  */
+typedef struct
+{
+    VOS_SOCK_EVENTS_T   handle;                 /**< event set or NULL                                      */
+    BOOL8               unsupported;            /**< the target does not support event sets                 */
+    UINT32              closeCnt;               /**< socket close count at the last registration            */
+    VOS_SOCK_T          pd[TRDP_MAX_PD_SOCKET_CNT]; /**< registered PD sockets                              */
+#if MD_SUPPORT
+    VOS_SOCK_T          md[TRDP_MAX_MD_SOCKET_CNT]; /**< registered MD sockets                              */
+    VOS_SOCK_T          listen;                 /**< registered TCP listen socket                           */
+#endif
+} TRDP_EVENTS_T;
+
 struct TAU_TTDB;
 
 /** Session/application variables store */
@@ -436,13 +611,19 @@ typedef struct TRDP_SESSION
     TRDP_SOCKETS_T          ifacePD[TRDP_MAX_PD_SOCKET_CNT];  /**< Collection of sockets to use               */
     PD_ELE_T                *pSndQueue;         /**< pointer to first element of send queue                 */
     PD_ELE_T                *pRcvQueue;         /**< pointer to first element of rcv queue                  */
-    PD_PACKET_T             *pNewFrame;         /**< pointer to received PD frame                           */
+    TRDP_SUB_HASH_T         subHash;            /**< hash index of the rcv queue for received PDs           */
+    TRDP_TIMER_HEAP_T       pdTimers;           /**< timeout heap of the rcv queue                          */
+    TRDP_TIMER_HEAP_T       pdSndTimers;        /**< send heap of the send queue                            */
+    PD_PACKET_T             *pNewFrame[TRDP_PD_RCV_BATCH_SIZE]; /**< pointers to receive buffers for PD frames */
     TRDP_PR_SEQ_CNT_LIST_T  *pSeqCntList4PDReq; /**< pointer to list of sequence counters for PR per comId  */
     TRDP_TIME_T             initTime;           /**< initialization time of session                         */
     TRDP_STATISTICS_T       stats;              /**< statistics of this session                             */
+    TRDP_PD_BATCH_STATISTICS_T batchStats;      /**< statistics of batched PD reception and transmission    */
+    TRDP_EVENTS_T           events;             /**< socket event set for tlc_processEvents()               */
 #ifdef HIGH_PERF_INDEXED
     TRDP_HP_SLOTS_T         *pSlot;             /**< pointer to a struct holding a list of slots for
                                                                         high speed access to PD telegrams   */
+    TRDP_PD_SND_BATCH_T     sndBatch;           /**< PD telegrams collected for one batched send            */
 #endif
 #if MD_SUPPORT
     VOS_MUTEX_T             mutexMD;            /**< protect the message data handling                      */
@@ -452,10 +633,19 @@ typedef struct TRDP_SESSION
     TRDP_TCP_FD_T           tcpFd;              /**< TCP file descriptor parameters                         */
     TRDP_MD_CONFIG_T        mdDefault;          /**< Default configuration for message data                 */
     MD_LIS_ELE_T            *pMDListenQueue;    /**< pointer to first element of listeners queue            */
+    TRDP_MD_LIS_INDEX_T     mdLisIndex;         /**< comId / destination URI index of the listeners queue   */
     MD_ELE_T                *pMDSndQueue;       /**< pointer to first element of send MD queue (caller)     */
     MD_ELE_T                *pMDRcvQueue;       /**< pointer to first element of recv MD queue (replier)    */
+    TRDP_MD_HASH_T          mdSndHash;          /**< session ID hash index of the send MD queue             */
+    TRDP_MD_HASH_T          mdRcvHash;          /**< session ID hash index of the recv MD queue             */
+    TRDP_TIMER_HEAP_T       mdTimers;           /**< deadline heap of the sessions of both MD queues        */
+    MD_ELE_T                *pMDReadyFirst;     /**< first session to be sent (ready list, ARM states)      */
+    MD_ELE_T                *pMDReadyLast;      /**< last session of the ready list                         */
     MD_ELE_T                *pMDRcvEle;         /**< pointer to received MD element                         */
     MD_ELE_T                *uncompletedTCP[VOS_MAX_SOCKET_CNT];     /**< uncompleted TCP messages buffer   */
+    TRDP_MD_STREAM_T        *pMDStream[TRDP_MAX_MD_SOCKET_CNT];    /**< TCP messages received in chunks     */
+    TRDP_TCP_POOL_STATISTICS_T tcpPoolStats;    /**< statistics of the TCP connections of callers           */
+    UINT64                  tcpConnectTimeSum;  /**< sum of the connect latencies in us                     */
 #endif
 } TRDP_SESSION_T, *TRDP_SESSION_PT;
 
@@ -17,6 +17,9 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: tlc_getTcpPoolStatistics() added
+ *      AG 2026-10-16: tlc_getSubsSeqStatistics() added
+ *      AG 2026-10-16: tlc_getPdBatchStatistics() added
  *      SB 2021-08.09: Ticket #375 Replaced parameters of vos_memCount to prevent alignment issues
  *      BL 2019-02-01: Ticket #234 Correcting Statistics ComIds & defines
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
@@ -116,6 +119,11 @@ EXT_DECL TRDP_ERR_T tlc_resetStatistics (
 
     tempTime = appHandle->stats.upTime;
     memset(&appHandle->stats, 0, sizeof(TRDP_STATISTICS_T));
+    memset(&appHandle->batchStats, 0, sizeof(TRDP_PD_BATCH_STATISTICS_T));
+#if MD_SUPPORT
+    memset(&appHandle->tcpPoolStats, 0, sizeof(TRDP_TCP_POOL_STATISTICS_T));
+    appHandle->tcpConnectTimeSum = 0u;
+#endif
     appHandle->stats.upTime = tempTime;
 
     return TRDP_NO_ERR;
@@ -151,6 +159,44 @@ EXT_DECL TRDP_ERR_T tlc_getStatistics (
     return TRDP_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Return statistics of batched PD reception and transmission.
+ *  Reports how many PD packets were read per receive call and sent per send call (system call) on the PD sockets.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[out]     pStatistics         Pointer to batch statistics for this application session
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ */
+EXT_DECL TRDP_ERR_T tlc_getPdBatchStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    TRDP_PD_BATCH_STATISTICS_T  *pStatistics)
+{
+    if (pStatistics == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    *pStatistics = appHandle->batchStats;
+    if (pStatistics->numRxBatches != 0u)
+    {
+        pStatistics->avgRxBatchSize = (UINT32) (((UINT64) pStatistics->numRxPackets * 100u) /
+                                                pStatistics->numRxBatches);
+    }
+    if (pStatistics->numTxBatches != 0u)
+    {
+        pStatistics->avgTxBatchSize = (UINT32) (((UINT64) pStatistics->numTxPackets * 100u) /
+                                                pStatistics->numTxBatches);
+    }
+
+    return TRDP_NO_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Return PD subscription statistics.
  *  Memory for statistics information must be provided by the user.
@@ -205,6 +251,62 @@ EXT_DECL TRDP_ERR_T tlc_getSubsStatistics (
     return err;
 }
 
+/**********************************************************************************************************************/
+/** Return the sequence counter tables of the PD subscriptions.
+ *  The subscriptions are returned in the same order as by tlc_getSubsStatistics.
+ *  Memory for statistics information must be provided by the user.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in,out]  pNumSubs            In: The number of subscriptions requested
+ *                                      Out: Number of subscriptions returned
+ *  @param[in,out]  pStatistics         Pointer to an array with the sequence counter statistics
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        there are more subscriptions than requested
+ */
+EXT_DECL TRDP_ERR_T tlc_getSubsSeqStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    UINT16                      *pNumSubs,
+    TRDP_SUBS_SEQ_STATISTICS_T  *pStatistics)
+{
+    TRDP_ERR_T  err = TRDP_NO_ERR;
+    PD_ELE_T    *iter;
+    UINT16      lIndex;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (pNumSubs == NULL || pStatistics == NULL || *pNumSubs == 0)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    /*  Loop over our subscriptions, but do not exceed user supplied buffers!    */
+    for ((void)(lIndex = 0), iter = appHandle->pRcvQueue; lIndex < *pNumSubs && iter != NULL; (void)(lIndex++), iter = iter->pNext)
+    {
+        memset(&pStatistics[lIndex], 0, sizeof(TRDP_SUBS_SEQ_STATISTICS_T));
+        pStatistics[lIndex].comId       = iter->addr.comId;
+        pStatistics[lIndex].filterAddr  = iter->addr.srcIpAddr;
+        if (iter->pSeqCntList != NULL)
+        {
+            pStatistics[lIndex].numSenders      = iter->pSeqCntList->curNoOfEntries;
+            pStatistics[lIndex].peakSenders     = iter->pSeqCntList->peakNoOfEntries;
+            pStatistics[lIndex].tableSize       = iter->pSeqCntList->maxNoOfEntries;
+            pStatistics[lIndex].numDuplicates   = iter->pSeqCntList->numDuplicates;
+            pStatistics[lIndex].numAged         = iter->pSeqCntList->numAged;
+            pStatistics[lIndex].numGrown        = iter->pSeqCntList->numGrown;
+        }
+    }
+    if (lIndex >= *pNumSubs && iter != NULL)
+    {
+        err = TRDP_MEM_ERR;
+    }
+    *pNumSubs = lIndex;
+    return err;
+}
+
 /**********************************************************************************************************************/
 /** Return PD publish statistics.
  *  Memory for statistics information must be provided by the user.
@@ -358,6 +460,65 @@ EXT_DECL TRDP_ERR_T tlc_getTcpListStatistics (
     *pNumList = lIndex;
     return TRDP_NO_ERR;
 }
+
+/**********************************************************************************************************************/
+/** Return statistics of the pooled TCP connections of MD callers.
+ *  Reports how often requests and notifications reused an idle connection to their replier and how long it took
+ *  to establish new connections.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[out]     pStatistics         Pointer to pool statistics for this application session
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ */
+EXT_DECL TRDP_ERR_T tlc_getTcpPoolStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    TRDP_TCP_POOL_STATISTICS_T  *pStatistics)
+{
+    INT32 lIndex;
+
+    if (pStatistics == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    *pStatistics = appHandle->tcpPoolStats;
+    pStatistics->numOpen    = 0u;
+    pStatistics->numIdle    = 0u;
+    for (lIndex = 0; lIndex < trdp_getCurrentMaxSocketCnt(TRDP_SOCK_MD_TCP); lIndex++)
+    {
+        if ((appHandle->ifaceMD[lIndex].sock != VOS_INVALID_SOCKET) &&
+            (appHandle->ifaceMD[lIndex].type == TRDP_SOCK_MD_TCP) &&
+            (appHandle->ifaceMD[lIndex].rcvMostly == FALSE) &&
+            (appHandle->ifaceMD[lIndex].tcpParams.morituri == FALSE))
+        {
+            pStatistics->numOpen++;
+            if (appHandle->ifaceMD[lIndex].usage == 0)
+            {
+                pStatistics->numIdle++;
+            }
+        }
+    }
+    if (pStatistics->numConnects != 0u)
+    {
+        pStatistics->avgConnectTime = (UINT32) (appHandle->tcpConnectTimeSum / pStatistics->numConnects);
+    }
+    if (vos_mutexUnlock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+
+    return TRDP_NO_ERR;
+}
 #endif
 
 /**********************************************************************************************************************/
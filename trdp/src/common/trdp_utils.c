@@ -17,6 +17,13 @@
 /*
 * $Id$
 *
+*      AG 2026-10-16: Deadline heap shared by PD and MD (trdp_timerInsert, trdp_timerRemove, trdp_timerFree)
+*      AG 2026-10-16: trdp_requestSocket() does not hand out TCP sockets about to be closed
+*      AG 2026-10-16: Index of the MD listeners on comId and destination URI (trdp_MDlisIndex...)
+*      AG 2026-10-16: Count closed sockets (trdp_getSocketCloseCnt) for event set registration
+*      AG 2026-10-16: Session ID hash index of the MD queues (trdp_MDhash...), maintained by trdp_MDqueue...
+*      AG 2026-10-16: Sequence counters per sender in a hash table with ageing (trdp_checkSequenceCounter)
+*      AG 2026-10-16: Hash index of the subscriptions for received PDs (trdp_subHash...)
 *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
 *      BL 2020-08-07: Ticket #317 Bug in trdp_indexedFindSubAddr() (HIGH_PERFORMANCE)
 *      AÖ 2020-05-04: Ticket #331: Add VLAN support for Sim
@@ -61,6 +68,7 @@
  */
 
 #include <string.h>
+#include <ctype.h>
 
 #include "tlc_if.h"
 #include "trdp_utils.h"
@@ -84,6 +92,30 @@
 
 #define SAME_SERVICE_COM_ID(a,b)    (((a).comId == (b).comId) && SOA_SAME_SERVICEID_OR0((a).serviceId,(b).serviceId))
 
+#define TRDP_TIMER_MIN_SIZE         64u     /**< initial number of entries of a deadline heap */
+
+/* the serviceId is part of the subscription hash key only if services are supported */
+#ifdef SOA_SUPPORT
+#define SUB_HASH_SERVICE_ID(a)      (a)
+#else
+#define SUB_HASH_SERVICE_ID(a)      0u
+#endif
+
+#define TRDP_SUB_HASH_MIN_SIZE      64u     /**< initial number of slots of the subscription hash index */
+#define TRDP_MD_HASH_MIN_SIZE       64u     /**< initial number of buckets of the MD session hash index */
+#define TRDP_MD_LIS_INDEX_MIN_SIZE  64u     /**< initial number of buckets of the MD listener index     */
+
+/* keys of the MD listener index: what a listener filters on */
+#define TRDP_MD_LIS_KEY_ANY         0u      /**< neither comId nor destination URI                      */
+#define TRDP_MD_LIS_KEY_URI         1u      /**< destination URI only                                   */
+#define TRDP_MD_LIS_KEY_COMID       2u      /**< comId only                                             */
+#define TRDP_MD_LIS_KEY_BOTH        3u      /**< comId and destination URI                              */
+
+/* match classes of trdp_subMatch() */
+#define TRDP_SUB_NO_MATCH           0
+#define TRDP_SUB_WILDCARD_MATCH     1
+#define TRDP_SUB_HIT                2
+
 /***********************************************************************************************************************
  * TYPEDEFS
  */
@@ -93,11 +125,306 @@
  */
 static INT32 sCurrentMaxPDSocketCnt = 0;
 static INT32 sCurrentMaxMDSocketCnt = 0;
+static UINT32 sSocketCloseCnt = 0u;
 
 /***********************************************************************************************************************
  *   Local Functions
  */
 
+static int      trdp_subMatch (
+    const PD_ELE_T          *iterPD,
+    const TRDP_ADDRESSES_T  *addr);
+
+static UINT32   trdp_subHashIndex (
+    const TRDP_SUB_HASH_T   *pHash,
+    UINT32                  comId,
+    UINT32                  serviceId,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          destIpAddr);
+
+static PD_ELE_T *trdp_subHashProbe (
+    const TRDP_SUB_HASH_T   *pHash,
+    UINT32                  comId,
+    UINT32                  serviceId,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          destIpAddr);
+
+static void     trdp_subHashKey (
+    PD_ELE_T                *pElement,
+    TRDP_SUB_HASH_ENTRY_T   *pEntry);
+
+static void     trdp_subHashAdd (
+    TRDP_SUB_HASH_T *pHash,
+    PD_ELE_T        *pElement);
+
+static TRDP_ERR_T trdp_subHashRebuild (
+    TRDP_SESSION_PT appHandle,
+    UINT32          minSize);
+
+static UINT32   trdp_seqCntMaxAge (
+    const PD_ELE_T  *pElement);
+
+#if MD_SUPPORT
+static UINT32   trdp_MDhashIndex (
+    const TRDP_MD_HASH_T    *pHash,
+    const UINT8             *pSessionId);
+
+static void     trdp_MDhashAdd (
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pElement);
+
+static BOOL8    trdp_MDhashRebuild (
+    MD_ELE_T        *pHead,
+    TRDP_MD_HASH_T  *pHash,
+    UINT32          size);
+
+static BOOL8    trdp_MDhashGrow (
+    MD_ELE_T        *pHead,
+    TRDP_MD_HASH_T  *pHash);
+
+static UINT32   trdp_MDlisUriHash (
+    const CHAR8 *pUri);
+
+static UINT32   trdp_MDlisIndexBucket (
+    const TRDP_MD_LIS_INDEX_T   *pIndex,
+    UINT32                      key,
+    UINT32                      comId,
+    UINT32                      uriHash);
+
+static UINT32   trdp_MDlisIndexOf (
+    const TRDP_MD_LIS_INDEX_T   *pIndex,
+    const MD_LIS_ELE_T          *pListener);
+
+static BOOL8    trdp_MDlisIndexRebuild (
+    MD_LIS_ELE_T        *pHead,
+    TRDP_MD_LIS_INDEX_T *pIndex,
+    UINT32              size);
+#endif
+
+static TRDP_SEQ_CNT_ENTRY_T *trdp_seqCntSlot (
+    TRDP_SEQ_CNT_LIST_T *pList,
+    TRDP_IP_ADDR_T      srcIP,
+    TRDP_MSG_T          msgType);
+
+static int      trdp_seqCntRebuild (
+    PD_ELE_T    *pElement,
+    UINT32      now);
+
+/**********************************************************************************************************************/
+/** Match a subscription against the addresses of a received PD
+ *
+ *  @param[in]      iterPD          subscription
+ *  @param[in]      addr            addresses (ComID, srcIP & dest IP, serviceId) of the received PD
+ *
+ *  @retval         TRDP_SUB_HIT            source and destination match exactly or source is in range
+ *  @retval         TRDP_SUB_WILDCARD_MATCH match because of a zero (any) source or destination
+ *  @retval         TRDP_SUB_NO_MATCH       no match
+ */
+static int trdp_subMatch (
+    const PD_ELE_T          *iterPD,
+    const TRDP_ADDRESSES_T  *addr)
+{
+    if (!SAME_SERVICE_COM_ID(iterPD->addr, *addr)) /*lint !e506 meant to be true, if service support is off */
+    {
+        return TRDP_SUB_NO_MATCH;
+    }
+
+    /* if srcIP filter matches AND destIP matches THEN this is a direct hit */
+    if ((iterPD->addr.srcIpAddr == addr->srcIpAddr) &&
+        ((iterPD->addr.destIpAddr == addr->destIpAddr)))
+    {
+        return TRDP_SUB_HIT;  /* we cannot find a better match */
+    }
+
+    /* Check for IP range */
+    if (iterPD->addr.srcIpAddr2 != VOS_INADDR_ANY)
+    {
+        if ((addr->srcIpAddr >= iterPD->addr.srcIpAddr) &&
+            (addr->srcIpAddr <= iterPD->addr.srcIpAddr2) &&
+            ((iterPD->addr.destIpAddr == VOS_INADDR_ANY) || (addr->destIpAddr == VOS_INADDR_ANY) ||
+             (iterPD->addr.destIpAddr == addr->destIpAddr)))
+        {
+            return TRDP_SUB_HIT;
+        }
+    }
+
+    if (((iterPD->addr.srcIpAddr == VOS_INADDR_ANY) || (iterPD->addr.srcIpAddr == addr->srcIpAddr))
+        && ((iterPD->addr.destIpAddr == VOS_INADDR_ANY) || (addr->destIpAddr == VOS_INADDR_ANY) ||
+            (iterPD->addr.destIpAddr == addr->destIpAddr)))
+    {
+        return TRDP_SUB_WILDCARD_MATCH;
+    }
+    return TRDP_SUB_NO_MATCH;
+}
+
+/**********************************************************************************************************************/
+/** Compute the home slot of a key in the subscription hash index
+ *
+ *  @param[in]      pHash           hash index
+ *  @param[in]      comId           key: comId
+ *  @param[in]      serviceId       key: serviceId
+ *  @param[in]      srcIpAddr       key: source IP
+ *  @param[in]      destIpAddr      key: destination IP
+ *
+ *  @retval         slot index
+ */
+static UINT32 trdp_subHashIndex (
+    const TRDP_SUB_HASH_T   *pHash,
+    UINT32                  comId,
+    UINT32                  serviceId,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          destIpAddr)
+{
+    UINT32 hash = comId * 0x9E3779B1u;
+
+    hash ^= srcIpAddr * 0x85EBCA77u;
+    hash ^= destIpAddr * 0xC2B2AE3Du;
+    hash ^= serviceId * 0x27D4EB2Fu;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    return hash & (pHash->size - 1u);
+}
+
+/**********************************************************************************************************************/
+/** Return the first subscription stored under a key
+ *
+ *  @param[in]      pHash           hash index
+ *  @param[in]      comId           key: comId
+ *  @param[in]      serviceId       key: serviceId
+ *  @param[in]      srcIpAddr       key: source IP
+ *  @param[in]      destIpAddr      key: destination IP
+ *
+ *  @retval         != NULL         pointer to PD element
+ *  @retval         NULL            No PD element found
+ */
+static PD_ELE_T *trdp_subHashProbe (
+    const TRDP_SUB_HASH_T   *pHash,
+    UINT32                  comId,
+    UINT32                  serviceId,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    TRDP_IP_ADDR_T          destIpAddr)
+{
+    UINT32 idx = trdp_subHashIndex(pHash, comId, serviceId, srcIpAddr, destIpAddr);
+
+    /* There is always at least one free slot, the probe sequence ends there */
+    while (pHash->pSlots[idx].pElement != NULL)
+    {
+        const TRDP_SUB_HASH_ENTRY_T *pEntry = &pHash->pSlots[idx];
+
+        if ((pEntry->comId == comId) && (pEntry->srcIpAddr == srcIpAddr) &&
+            (pEntry->destIpAddr == destIpAddr) && (pEntry->serviceId == serviceId))
+        {
+            return pEntry->pElement;
+        }
+        idx = (idx + 1u) & (pHash->size - 1u);
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/** Fill in the hash key of a subscription
+ *
+ *  @param[in]      pElement        subscription
+ *  @param[out]     pEntry          hash entry
+ */
+static void trdp_subHashKey (
+    PD_ELE_T                *pElement,
+    TRDP_SUB_HASH_ENTRY_T   *pEntry)
+{
+    pEntry->comId       = pElement->addr.comId;
+    pEntry->pElement    = pElement;
+
+    if ((pElement->addr.srcIpAddr == VOS_INADDR_ANY) || (pElement->addr.srcIpAddr2 != VOS_INADDR_ANY))
+    {
+        /* no source filter or source range: fallback list of this comId */
+        pEntry->serviceId   = 0u;
+        pEntry->srcIpAddr   = VOS_INADDR_ANY;
+        pEntry->destIpAddr  = VOS_INADDR_ANY;
+    }
+    else
+    {
+        pEntry->serviceId   = SUB_HASH_SERVICE_ID(pElement->addr.serviceId);
+        pEntry->srcIpAddr   = pElement->addr.srcIpAddr;
+        pEntry->destIpAddr  = pElement->addr.destIpAddr;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Store a subscription in the hash index
+ *  The caller must make sure that a free slot remains.
+ *
+ *  @param[in]      pHash           hash index
+ *  @param[in]      pElement        subscription
+ */
+static void trdp_subHashAdd (
+    TRDP_SUB_HASH_T *pHash,
+    PD_ELE_T        *pElement)
+{
+    TRDP_SUB_HASH_ENTRY_T   entry;
+    UINT32                  idx;
+
+    trdp_subHashKey(pElement, &entry);
+
+    idx = trdp_subHashIndex(pHash, entry.comId, entry.serviceId, entry.srcIpAddr, entry.destIpAddr);
+    while (pHash->pSlots[idx].pElement != NULL)
+    {
+        idx = (idx + 1u) & (pHash->size - 1u);
+    }
+    pHash->pSlots[idx] = entry;
+    pHash->count++;
+}
+
+/**********************************************************************************************************************/
+/** Re-create the hash index from the receive queue
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      minSize         minimum number of slots (power of 2)
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory, the old index is kept
+ */
+static TRDP_ERR_T trdp_subHashRebuild (
+    TRDP_SESSION_PT appHandle,
+    UINT32          minSize)
+{
+    TRDP_SUB_HASH_T         *pHash = &appHandle->subHash;
+    TRDP_SUB_HASH_ENTRY_T   *pSlots;
+    PD_ELE_T                *iterPD;
+    UINT32                  noOfSubs = 0u;
+    UINT32                  size = minSize;
+
+    for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+    {
+        noOfSubs++;
+    }
+    /* keep the load factor at or below 1/2 */
+    while (size < (2u * (noOfSubs + 1u)))
+    {
+        size *= 2u;
+    }
+
+    pSlots = (TRDP_SUB_HASH_ENTRY_T *) vos_memAlloc(size * sizeof(TRDP_SUB_HASH_ENTRY_T));
+    if (pSlots == NULL)
+    {
+        return TRDP_MEM_ERR;
+    }
+    if (pHash->pSlots != NULL)
+    {
+        vos_memFree(pHash->pSlots);
+    }
+    pHash->pSlots       = pSlots;
+    pHash->size         = size;
+    pHash->count        = 0u;
+    pHash->incomplete   = FALSE;
+
+    for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+    {
+        trdp_subHashAdd(pHash, iterPD);
+    }
+    return TRDP_NO_ERR;
+}
+
 void    printSocketUsage (TRDP_SOCKETS_T iface[]);
 BOOL8   trdp_SockIsJoined (const TRDP_IP_ADDR_T mcList[VOS_MAX_MULTICAST_CNT],
                            TRDP_IP_ADDR_T       mcGroup);
@@ -258,6 +585,17 @@ TRDP_IP_ADDR_T trdp_getOwnIP( void )
  *   Globals
  */
 
+/**********************************************************************************************************************/
+/** Get the number of sockets closed so far
+ *  A socket descriptor may be reused after closing; registrations of closed sockets must be renewed.
+ *
+ *  @retval         number of calls to vos_sockClose() by trdp_releaseSocket()
+ */
+UINT32 trdp_getSocketCloseCnt (void)
+{
+    return sSocketCloseCnt;
+}
+
 INT32 trdp_getCurrentMaxSocketCnt (
  TRDP_SOCK_TYPE_T   type)
 {
@@ -530,6 +868,8 @@ PD_ELE_T *trdp_idxfindSubAddr (
 
     for (idx = startIdx; idx < maxIdx; idx++)
     {
+        int match;
+
         iterPD = array[idx];
         /* watch a comId change (needed for indexed search) */
         if ((comId != 0u) && (iterPD->addr.comId != comId))
@@ -537,268 +877,1124 @@ PD_ELE_T *trdp_idxfindSubAddr (
             break;
         }
         /*  We match if src/dst/mc address is zero or matches */
-        /* if ((iterPD->addr.comId == addr->comId)
-         && SOA_SAME_SERVICEID_OR0(addr->serviceId, iterPD->addr.serviceId)) */
-        if (SAME_SERVICE_COM_ID(iterPD->addr, *addr)) /*lint !e506 meant to be true, if service support is off */
+        match = trdp_subMatch(iterPD, addr);
+        if (match == TRDP_SUB_HIT)
         {
-            /* if srcIP filter matches AND destIP matches THEN this is a direct hit */
-            if ((iterPD->addr.srcIpAddr == addr->srcIpAddr) &&
-                ((iterPD->addr.destIpAddr == addr->destIpAddr)))
-            {
-                return iterPD;  /* we cannot find a better match */
-            }
+            return iterPD;  /* we cannot find a better match */
+        }
+        if (match == TRDP_SUB_WILDCARD_MATCH)
+        {
+            pFirstMatchedPD = iterPD;
+        }
+    }
+    return pFirstMatchedPD;
+}
+
+
+/**********************************************************************************************************************/
+/** Return the element with same comId and IP addresses
+ *
+ *  @param[in]      pHead           pointer to head of queue
+ *  @param[in]      addr            Pub/Sub handle (Address, ComID, srcIP & dest IP, serviceId) to search for
+ *  @param[in]      comId           ComId to stay on on a sorted search, 0 when searching on unsorted queues
+ *
+ *  @retval         != NULL         pointer to PD element
+ *  @retval         NULL            No PD element found
+ */
+PD_ELE_T *trdp_findSubAddr (
+    PD_ELE_T            *pHead,
+    TRDP_ADDRESSES_T    *addr,
+    UINT32              comId)
+{
+    PD_ELE_T    *iterPD;
+    PD_ELE_T    *pFirstMatchedPD = NULL;
+
+    if (pHead == NULL || addr == NULL)
+    {
+        return NULL;
+    }
+
+    for (iterPD = pHead; iterPD != NULL; iterPD = iterPD->pNext)
+    {
+        int match;
+
+        /* watch a comId change (needed for indexed search) */
+        if ((comId != 0u) && (iterPD->addr.comId != comId))
+        {
+            break;
+        }
+        /*  We match if src/dst/mc address is zero or matches */
+        match = trdp_subMatch(iterPD, addr);
+        if (match == TRDP_SUB_HIT)
+        {
+            return iterPD;  /* we cannot find a better match */
+        }
+        if (match == TRDP_SUB_WILDCARD_MATCH)
+        {
+            pFirstMatchedPD = iterPD;
+        }
+    }
+    return pFirstMatchedPD;
+}
 
-            if (((iterPD->addr.srcIpAddr == VOS_INADDR_ANY) || (iterPD->addr.srcIpAddr == addr->srcIpAddr))
-                && ((iterPD->addr.destIpAddr == VOS_INADDR_ANY) || (addr->destIpAddr == VOS_INADDR_ANY) ||
-                    (iterPD->addr.destIpAddr == addr->destIpAddr)))
+/**********************************************************************************************************************/
+/** Return the subscription for a received PD using the hash index
+ *  The search order is:
+ *      1. exact source and destination (MC group) filter,
+ *      2. IP range and source wildcard subscriptions of the comId (fallback list), a range hit is returned at once,
+ *      3. source filter with any destination,
+ *      4. the last wildcard match of the fallback list.
+ *  Without destination address (Ticket #230/#243) or if the index is incomplete, the receive queue is searched.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pAddr           Pub/Sub handle (Address, ComID, srcIP & dest IP, serviceId) to search for
+ *
+ *  @retval         != NULL         pointer to PD element
+ *  @retval         NULL            No PD element found
+ */
+PD_ELE_T *trdp_subHashFind (
+    TRDP_SESSION_PT     appHandle,
+    TRDP_ADDRESSES_T    *pAddr)
+{
+    const TRDP_SUB_HASH_T   *pHash = &appHandle->subHash;
+    PD_ELE_T                *pFound;
+    PD_ELE_T                *pWildcard = NULL;
+    UINT32                  serviceId;
+    UINT32                  idx;
+
+    if ((pHash->pSlots == NULL) || (pHash->incomplete == TRUE) || (pAddr->destIpAddr == VOS_INADDR_ANY))
+    {
+        return trdp_queueFindSubAddr(appHandle->pRcvQueue, pAddr);
+    }
+
+    /* Subscriptions with serviceId 0 accept any service */
+    serviceId = SUB_HASH_SERVICE_ID(pAddr->serviceId);
+
+    pFound = trdp_subHashProbe(pHash, pAddr->comId, serviceId, pAddr->srcIpAddr, pAddr->destIpAddr);
+    if ((pFound == NULL) && (serviceId != 0u))
+    {
+        pFound = trdp_subHashProbe(pHash, pAddr->comId, 0u, pAddr->srcIpAddr, pAddr->destIpAddr);
+    }
+    if (pFound != NULL)
+    {
+        return pFound;
+    }
+
+    /* Walk the fallback list of this comId */
+    idx = trdp_subHashIndex(pHash, pAddr->comId, 0u, VOS_INADDR_ANY, VOS_INADDR_ANY);
+    while (pHash->pSlots[idx].pElement != NULL)
+    {
+        const TRDP_SUB_HASH_ENTRY_T *pEntry = &pHash->pSlots[idx];
+
+        if ((pEntry->comId == pAddr->comId) && (pEntry->srcIpAddr == VOS_INADDR_ANY) &&
+            (pEntry->destIpAddr == VOS_INADDR_ANY) && (pEntry->serviceId == 0u))
+        {
+            int match = trdp_subMatch(pEntry->pElement, pAddr);
+
+            if (match == TRDP_SUB_HIT)
             {
-                pFirstMatchedPD = iterPD;
+                return pEntry->pElement;
             }
-
-            /* Check for IP range */
-            if (iterPD->addr.srcIpAddr2 != VOS_INADDR_ANY)
+            if (match == TRDP_SUB_WILDCARD_MATCH)
             {
-                if ((addr->srcIpAddr >= iterPD->addr.srcIpAddr) &&
-                    (addr->srcIpAddr <= iterPD->addr.srcIpAddr2) &&
-                    ((iterPD->addr.destIpAddr == VOS_INADDR_ANY) || (addr->destIpAddr == VOS_INADDR_ANY) ||
-                     (iterPD->addr.destIpAddr == addr->destIpAddr)))
-                {
-                    return iterPD;
-                }
+                pWildcard = pEntry->pElement;
             }
         }
+        idx = (idx + 1u) & (pHash->size - 1u);
+    }
+
+    pFound = trdp_subHashProbe(pHash, pAddr->comId, serviceId, pAddr->srcIpAddr, VOS_INADDR_ANY);
+    if ((pFound == NULL) && (serviceId != 0u))
+    {
+        pFound = trdp_subHashProbe(pHash, pAddr->comId, 0u, pAddr->srcIpAddr, VOS_INADDR_ANY);
+    }
+    if (pFound != NULL)
+    {
+        return pFound;
+    }
+    return pWildcard;
+}
+
+/**********************************************************************************************************************/
+/** Add a subscription to the hash index
+ *  The subscription must already be in the receive queue, which is used to rebuild a grown index.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        subscription
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory, received PDs are searched in the receive queue
+ */
+TRDP_ERR_T trdp_subHashInsert (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    TRDP_SUB_HASH_T *pHash = &appHandle->subHash;
+
+    if (pHash->incomplete == TRUE)
+    {
+        /* try to recover */
+        return trdp_subHashRebuild(appHandle, (pHash->size == 0u) ? TRDP_SUB_HASH_MIN_SIZE : pHash->size);
+    }
+
+    if ((2u * (pHash->count + 1u)) > pHash->size)
+    {
+        if (trdp_subHashRebuild(appHandle,
+                                (pHash->size == 0u) ? TRDP_SUB_HASH_MIN_SIZE : (2u * pHash->size)) == TRDP_NO_ERR)
+        {
+            return TRDP_NO_ERR;
+        }
+        /* Could not grow, use the remaining slots but one */
+        if ((pHash->count + 1u) >= pHash->size)
+        {
+            pHash->incomplete = TRUE;
+            return TRDP_MEM_ERR;
+        }
+    }
+    trdp_subHashAdd(pHash, pElement);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Remove a subscription from the hash index
+ *  Must be called before the addresses of the subscription are changed.
+ *  Linear probing: following entries are moved back to close the gap (no tombstones).
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        subscription
+ */
+void trdp_subHashRemove (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    TRDP_SUB_HASH_T         *pHash = &appHandle->subHash;
+    TRDP_SUB_HASH_ENTRY_T   key;
+    UINT32                  mask;
+    UINT32                  hole;
+    UINT32                  idx;
+
+    if (pHash->pSlots == NULL)
+    {
+        return;
+    }
+    mask = pHash->size - 1u;
+
+    trdp_subHashKey(pElement, &key);
+    hole = trdp_subHashIndex(pHash, key.comId, key.serviceId, key.srcIpAddr, key.destIpAddr);
+    while (pHash->pSlots[hole].pElement != pElement)
+    {
+        if (pHash->pSlots[hole].pElement == NULL)
+        {
+            return;     /* not indexed */
+        }
+        hole = (hole + 1u) & mask;
+    }
+
+    idx = hole;
+    for (;;)
+    {
+        const TRDP_SUB_HASH_ENTRY_T *pEntry;
+        UINT32                      home;
+
+        idx = (idx + 1u) & mask;
+        pEntry = &pHash->pSlots[idx];
+        if (pEntry->pElement == NULL)
+        {
+            break;
+        }
+        home = trdp_subHashIndex(pHash, pEntry->comId, pEntry->serviceId, pEntry->srcIpAddr, pEntry->destIpAddr);
+        /* move the entry, if its home slot is not cyclically within (hole, idx] */
+        if (((idx - home) & mask) >= ((idx - hole) & mask))
+        {
+            pHash->pSlots[hole] = *pEntry;
+            hole = idx;
+        }
+    }
+    pHash->pSlots[hole].pElement = NULL;
+    pHash->count--;
+}
+
+/**********************************************************************************************************************/
+/** Free the subscription hash index
+ *
+ *  @param[in]      appHandle       session pointer
+ */
+void trdp_subHashFree (
+    TRDP_SESSION_PT appHandle)
+{
+    if (appHandle->subHash.pSlots != NULL)
+    {
+        vos_memFree(appHandle->subHash.pSlots);
+    }
+    memset(&appHandle->subHash, 0, sizeof(TRDP_SUB_HASH_T));
+}
+
+/**********************************************************************************************************************/
+/** Store a timer at a heap position and update the back index of its element
+ *
+ *  @param[in]      pHeap           deadline heap
+ *  @param[in]      idx             heap position
+ *  @param[in]      pTimer          timer to store
+ */
+static void trdp_timerMove (
+    TRDP_TIMER_HEAP_T   *pHeap,
+    UINT32              idx,
+    const TRDP_TIMER_T  *pTimer)
+{
+    pHeap->pTimers[idx] = *pTimer;
+    *pTimer->pIdx = idx + 1u;
+}
+
+/**********************************************************************************************************************/
+/** Move a timer towards the top of the heap until its parent is not later
+ *
+ *  @param[in]      pHeap           deadline heap
+ *  @param[in]      idx             heap position of the timer
+ */
+static void trdp_timerSiftUp (
+    TRDP_TIMER_HEAP_T   *pHeap,
+    UINT32              idx)
+{
+    TRDP_TIMER_T timer = pHeap->pTimers[idx];
+
+    while (idx > 0u)
+    {
+        UINT32 parent = (idx - 1u) / 2u;
+
+        if (!timercmp(&timer.timeToGo, &pHeap->pTimers[parent].timeToGo, <))
+        {
+            break;
+        }
+        trdp_timerMove(pHeap, idx, &pHeap->pTimers[parent]);
+        idx = parent;
+    }
+    trdp_timerMove(pHeap, idx, &timer);
+}
+
+/**********************************************************************************************************************/
+/** Move a timer towards the bottom of the heap until no child is earlier
+ *
+ *  @param[in]      pHeap           deadline heap
+ *  @param[in]      idx             heap position of the timer
+ */
+static void trdp_timerSiftDown (
+    TRDP_TIMER_HEAP_T   *pHeap,
+    UINT32              idx)
+{
+    TRDP_TIMER_T timer = pHeap->pTimers[idx];
+
+    for (;; )
+    {
+        UINT32 child = 2u * idx + 1u;
+
+        if (child >= pHeap->count)
+        {
+            break;
+        }
+        if (((child + 1u) < pHeap->count) &&
+            timercmp(&pHeap->pTimers[child + 1u].timeToGo, &pHeap->pTimers[child].timeToGo, <))
+        {
+            child++;
+        }
+        if (!timercmp(&pHeap->pTimers[child].timeToGo, &timer.timeToGo, <))
+        {
+            break;
+        }
+        trdp_timerMove(pHeap, idx, &pHeap->pTimers[child]);
+        idx = child;
+    }
+    trdp_timerMove(pHeap, idx, &timer);
+}
+
+/**********************************************************************************************************************/
+/** Insert an element into a deadline heap or re-key it, if it is already in the heap
+ *  The element keeps its heap position + 1 in the back index *pIdx, 0 if it is not in the heap. Re-keying an
+ *  element which is in the heap cannot fail.
+ *
+ *  @param[in]      pHeap           deadline heap
+ *  @param[in]      pElement        PD or MD element
+ *  @param[in]      pIdx            back index of the element
+ *  @param[in]      pDue            key of the element
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    out of memory, the element is not in the heap
+ */
+TRDP_ERR_T trdp_timerInsert (
+    TRDP_TIMER_HEAP_T   *pHeap,
+    void                *pElement,
+    UINT32              *pIdx,
+    const TRDP_TIME_T   *pDue)
+{
+    if (*pIdx != 0u)
+    {
+        pHeap->pTimers[*pIdx - 1u].timeToGo = *pDue;
+        trdp_timerSiftUp(pHeap, *pIdx - 1u);
+        trdp_timerSiftDown(pHeap, *pIdx - 1u);
+        return TRDP_NO_ERR;
+    }
+
+    if (pHeap->count >= pHeap->size)
+    {
+        UINT32          newSize = (pHeap->size == 0u) ? TRDP_TIMER_MIN_SIZE : 2u * pHeap->size;
+        TRDP_TIMER_T    *pTimers = (TRDP_TIMER_T *) vos_memAlloc(newSize * sizeof(TRDP_TIMER_T));
+
+        if (pTimers == NULL)
+        {
+            return TRDP_MEM_ERR;
+        }
+        if (pHeap->pTimers != NULL)
+        {
+            memcpy(pTimers, pHeap->pTimers, pHeap->count * sizeof(TRDP_TIMER_T));
+            vos_memFree(pHeap->pTimers);
+        }
+        pHeap->pTimers  = pTimers;
+        pHeap->size     = newSize;
+    }
+    pHeap->pTimers[pHeap->count].timeToGo   = *pDue;
+    pHeap->pTimers[pHeap->count].pElement   = pElement;
+    pHeap->pTimers[pHeap->count].pIdx       = pIdx;
+    pHeap->count++;
+    trdp_timerSiftUp(pHeap, pHeap->count - 1u);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Remove an element from a deadline heap
+ *
+ *  @param[in]      pHeap           deadline heap
+ *  @param[in]      pIdx            back index of the element
+ */
+void trdp_timerRemove (
+    TRDP_TIMER_HEAP_T   *pHeap,
+    UINT32              *pIdx)
+{
+    UINT32 idx;
+
+    if (*pIdx == 0u)
+    {
+        return;
+    }
+    idx     = *pIdx - 1u;
+    *pIdx   = 0u;
+    pHeap->count--;
+    if (idx < pHeap->count)
+    {
+        /* fill the gap with the last entry */
+        UINT32 *pMovedIdx = pHeap->pTimers[pHeap->count].pIdx;
+
+        trdp_timerMove(pHeap, idx, &pHeap->pTimers[pHeap->count]);
+        trdp_timerSiftUp(pHeap, idx);
+        trdp_timerSiftDown(pHeap, *pMovedIdx - 1u);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Free a deadline heap
+ *  The elements are not freed.
+ *
+ *  @param[in]      pHeap           deadline heap
+ */
+void trdp_timerFree (
+    TRDP_TIMER_HEAP_T *pHeap)
+{
+    if (pHeap->pTimers != NULL)
+    {
+        vos_memFree(pHeap->pTimers);
+    }
+    memset(pHeap, 0, sizeof(TRDP_TIMER_HEAP_T));
+}
+
+
+/**********************************************************************************************************************/
+/** Return the element with same comId and IP addresses
+ *
+ *  @param[in]      pHead           pointer to head of queue
+ *  @param[in]      addr            Pub/Sub handle (Address, ComID, srcIP & dest IP) to search for
+ *
+ *  @retval         != NULL         pointer to PD element
+ *  @retval         NULL            No PD element found
+ */
+PD_ELE_T *trdp_queueFindExistingSub (
+    PD_ELE_T            *pHead,
+    TRDP_ADDRESSES_T    *addr)
+{
+    PD_ELE_T *iterPD;
+
+    if (pHead == NULL || addr == NULL)
+    {
+        return NULL;
+    }
+
+    for (iterPD = pHead; iterPD != NULL; iterPD = iterPD->pNext)
+    {
+        /*  We match if src/dst/mc address is zero or matches */
+        if ((iterPD->addr.comId == addr->comId)
+            && SOA_SAME_SERVICEID(iterPD->addr.serviceId, addr->serviceId)) /*lint !e506 meant to be true, if service support is off */
+        {
+            if ((iterPD->addr.srcIpAddr == addr->srcIpAddr)
+                && (iterPD->addr.destIpAddr == addr->destIpAddr))
+            {
+                return iterPD;
+            }
+            /* Check for IP range */
+            if (iterPD->addr.srcIpAddr2 != VOS_INADDR_ANY)
+            {
+                if ((addr->srcIpAddr >= iterPD->addr.srcIpAddr) &&
+                    (addr->srcIpAddr <= iterPD->addr.srcIpAddr2) &&
+                    (iterPD->addr.destIpAddr == addr->destIpAddr))
+                {
+                    return iterPD;
+                }
+            }
+
+        }
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/** Delete an element
+ *
+ *  @param[in]      ppHead          pointer to pointer to head of queue
+ *  @param[in]      pDelete         pointer to element to delete
+ */
+void    trdp_queueDelElement (
+    PD_ELE_T    * *ppHead,
+    PD_ELE_T    *pDelete)
+{
+    PD_ELE_T *iterPD;
+
+    if (ppHead == NULL || *ppHead == NULL || pDelete == NULL)
+    {
+        return;
+    }
+
+    /* handle removal of first element */
+    if (pDelete == *ppHead)
+    {
+        *ppHead = pDelete->pNext;
+        return;
+    }
+
+    for (iterPD = *ppHead; iterPD != NULL; iterPD = iterPD->pNext)
+    {
+        if (iterPD->pNext && iterPD->pNext == pDelete)
+        {
+            iterPD->pNext = pDelete->pNext;
+            return;
+        }
+    }
+}
+
+
+/**********************************************************************************************************************/
+/** Check topography counters
+ *  The applied conformance pattern follows Table A.5/A.21 (positive match):
+ *  Telegram to be sent   Locally stored value (appSession)
+ *  Case etbTopoCnt opTrnTopoCnt etbTopoCntFilter opTrnTopoCntFilter
+ *  1    any        any          0                0
+ *  2    any        equal        0                equal
+ *  3    equal      any          equal            0
+ *  4    equal      equal        equal            equal
+ *
+ *  @param[in]      etbTopoCnt              ETB topography counter to be checked
+ *  @param[in]      opTrnTopoCnt            Operational topography counter to be checked
+ *  @param[in]      etbTopoCntFilter        ETB topography counter filter value
+ *  @param[in]      opTrnTopoCntFilter      Operational topography counter filter value
+ *
+ *  @retval         TRUE           Filter criteria matched
+ *                  FALSE          Filter criteria not matched
+ */
+BOOL8 trdp_validTopoCounters (
+    UINT32  etbTopoCnt,
+    UINT32  opTrnTopoCnt,
+    UINT32  etbTopoCntFilter,
+    UINT32  opTrnTopoCntFilter)
+{
+    if (((etbTopoCntFilter == 0) || (etbTopoCnt == etbTopoCntFilter))
+        &&
+        ((opTrnTopoCntFilter == 0) || (opTrnTopoCnt == opTrnTopoCntFilter)))
+    {
+        return TRUE;
+    }
+    else
+    {
+        return FALSE;
+    }
+}
+
+#if MD_SUPPORT
+/**********************************************************************************************************************/
+/** Return the element with same comId from MD queue
+ *
+ *  @param[in]      pHead           pointer to head of queue
+ *  @param[in]      addr            Pub/Sub handle (Address, ComID, srcIP & dest IP) to search for
+ *
+ *  @retval         != NULL         pointer to PD element
+ *  @retval         NULL            No PD element found
+ */
+MD_ELE_T *trdp_MDqueueFindAddr (
+    MD_ELE_T            *pHead,
+    TRDP_ADDRESSES_T    *addr)
+{
+    MD_ELE_T *iterMD;
+
+    if (pHead == NULL || addr == NULL)
+    {
+        return NULL;
+    }
+
+    for (iterMD = pHead; iterMD != NULL; iterMD = iterMD->pNext)
+    {
+        /*  We match if src/dst address is zero or found */
+        if ((iterMD->addr.comId == addr->comId)
+            && ((addr->srcIpAddr == 0) || (iterMD->addr.srcIpAddr == addr->srcIpAddr))
+            && ((addr->destIpAddr == 0) || (iterMD->addr.destIpAddr == addr->destIpAddr)))
+        {
+            return iterMD;
+        }
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/** Compute the bucket of a session ID in the MD session hash index
+ *
+ *  @param[in]      pHash           hash index with buckets
+ *  @param[in]      pSessionId      session ID (UUID)
+ *
+ *  @retval         bucket index
+ */
+static UINT32 trdp_MDhashIndex (
+    const TRDP_MD_HASH_T    *pHash,
+    const UINT8             *pSessionId)
+{
+    UINT32  word[TRDP_SESS_ID_SIZE / 4u];
+    UINT32  hash;
+
+    /* UUIDs are not aligned in the frame header */
+    memcpy(word, pSessionId, TRDP_SESS_ID_SIZE);
+    hash    = word[0] * 0x9E3779B1u;
+    hash    ^= word[1] * 0x85EBCA77u;
+    hash    ^= word[2] * 0xC2B2AE3Du;
+    hash    ^= word[3] * 0x27D4EB2Fu;
+    hash    ^= hash >> 16;
+    return hash & (pHash->size - 1u);
+}
+
+/**********************************************************************************************************************/
+/** Append an element to its bucket
+ *  Appending keeps elements with the same session ID in queue order, as long as they are added in that order.
+ *
+ *  @param[in]      pHash           hash index with buckets
+ *  @param[in]      pElement        element to add
+ */
+static void trdp_MDhashAdd (
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pElement)
+{
+    MD_ELE_T * *ppIter = &pHash->ppBuckets[trdp_MDhashIndex(pHash, pElement->sessionID)];
+
+    while (*ppIter != NULL)
+    {
+        ppIter = &(*ppIter)->pHashNext;
+    }
+    pElement->pHashNext = NULL;
+    *ppIter = pElement;
+}
+
+/**********************************************************************************************************************/
+/** (Re-)build the hash index from the queue
+ *  If the buckets cannot be allocated, the current index is kept.
+ *
+ *  @param[in]      pHead           head of queue
+ *  @param[in]      pHash           hash index
+ *  @param[in]      size            number of buckets (power of 2)
+ *
+ *  @retval         TRUE            index rebuilt
+ *  @retval         FALSE           out of memory
+ */
+static BOOL8 trdp_MDhashRebuild (
+    MD_ELE_T        *pHead,
+    TRDP_MD_HASH_T  *pHash,
+    UINT32          size)
+{
+    MD_ELE_T    * *ppBuckets = (MD_ELE_T * *) vos_memAlloc(size * sizeof(MD_ELE_T *));
+    MD_ELE_T    *iterMD;
+
+    if (ppBuckets == NULL)
+    {
+        return FALSE;
+    }
+    if (pHash->ppBuckets != NULL)
+    {
+        vos_memFree(pHash->ppBuckets);
+    }
+    pHash->ppBuckets    = ppBuckets;
+    pHash->size         = size;
+
+    /* queue order, elements with the same session ID are found in that order */
+    for (iterMD = pHead; iterMD != NULL; iterMD = iterMD->pNext)
+    {
+        trdp_MDhashAdd(pHash, iterMD);
+    }
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Allocate or grow the buckets for the element just queued (already counted)
+ *
+ *  @param[in]      pHead           head of queue
+ *  @param[in]      pHash           hash index
+ *
+ *  @retval         TRUE            index rebuilt from the queue, the new element is indexed
+ *  @retval         FALSE           the new element must still be added, if there are buckets
+ */
+static BOOL8 trdp_MDhashGrow (
+    MD_ELE_T        *pHead,
+    TRDP_MD_HASH_T  *pHash)
+{
+    if (pHash->ppBuckets == NULL)
+    {
+        /* first element or recovering from out of memory */
+        return trdp_MDhashRebuild(pHead, pHash, TRDP_MD_HASH_MIN_SIZE);
+    }
+    if (pHash->count > pHash->size)
+    {
+        return trdp_MDhashRebuild(pHead, pHash, 2u * pHash->size);
+    }
+    return FALSE;
+}
+
+/**********************************************************************************************************************/
+/** Add an MD element to the session hash index
+ *  The element must already be in the queue, which is used to (re-)build the index. Must be called again after the
+ *  session ID of a queued element was changed (and trdp_MDhashRemove before).
+ *
+ *  @param[in]      pHead           head of queue
+ *  @param[in]      pHash           hash index of the queue
+ *  @param[in]      pElement        element to add
+ */
+void trdp_MDhashInsert (
+    MD_ELE_T        *pHead,
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pElement)
+{
+    pHash->count++;
+    if ((trdp_MDhashGrow(pHead, pHash) == FALSE) && (pHash->ppBuckets != NULL))
+    {
+        trdp_MDhashAdd(pHash, pElement);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Remove an MD element from the session hash index
+ *
+ *  @param[in]      pHash           hash index of the queue
+ *  @param[in]      pElement        element to remove
+ */
+void trdp_MDhashRemove (
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pElement)
+{
+    if (pHash->count > 0u)
+    {
+        pHash->count--;
+    }
+    if (pHash->ppBuckets != NULL)
+    {
+        MD_ELE_T * *ppIter = &pHash->ppBuckets[trdp_MDhashIndex(pHash, pElement->sessionID)];
+
+        while (*ppIter != NULL)
+        {
+            if (*ppIter == pElement)
+            {
+                *ppIter = pElement->pHashNext;
+                break;
+            }
+            ppIter = &(*ppIter)->pHashNext;
+        }
+    }
+    pElement->pHashNext = NULL;
+}
+
+/**********************************************************************************************************************/
+/** Return the first element of an MD queue with the given session ID
+ *  Further elements with the same session ID are returned by trdp_MDhashNext() in queue order.
+ *
+ *  @param[in]      pHead           head of queue
+ *  @param[in]      pHash           hash index of the queue
+ *  @param[in]      pSessionId      session ID to search for
+ *
+ *  @retval         != NULL         pointer to MD element
+ *  @retval         NULL            No MD element found
+ */
+MD_ELE_T *trdp_MDhashFind (
+    MD_ELE_T                *pHead,
+    const TRDP_MD_HASH_T    *pHash,
+    const UINT8             *pSessionId)
+{
+    MD_ELE_T *iterMD;
+
+    if (pHash->ppBuckets == NULL)
+    {
+        for (iterMD = pHead; iterMD != NULL; iterMD = iterMD->pNext)
+        {
+            if (memcmp(iterMD->sessionID, pSessionId, TRDP_SESS_ID_SIZE) == 0)
+            {
+                return iterMD;
+            }
+        }
+        return NULL;
+    }
+
+    for (iterMD = pHash->ppBuckets[trdp_MDhashIndex(pHash, pSessionId)]; iterMD != NULL; iterMD = iterMD->pHashNext)
+    {
+        if (memcmp(iterMD->sessionID, pSessionId, TRDP_SESS_ID_SIZE) == 0)
+        {
+            return iterMD;
+        }
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/** Return the next element of an MD queue with the same session ID
+ *
+ *  @param[in]      pHash           hash index of the queue
+ *  @param[in]      pElement        element returned by trdp_MDhashFind() or trdp_MDhashNext()
+ *
+ *  @retval         != NULL         pointer to MD element
+ *  @retval         NULL            No further MD element
+ */
+MD_ELE_T *trdp_MDhashNext (
+    const TRDP_MD_HASH_T    *pHash,
+    const MD_ELE_T          *pElement)
+{
+    MD_ELE_T *iterMD;
+
+    for (iterMD = (pHash->ppBuckets == NULL) ? pElement->pNext : pElement->pHashNext;
+         iterMD != NULL;
+         iterMD = (pHash->ppBuckets == NULL) ? iterMD->pNext : iterMD->pHashNext)
+    {
+        if (memcmp(iterMD->sessionID, pElement->sessionID, TRDP_SESS_ID_SIZE) == 0)
+        {
+            return iterMD;
+        }
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/** Free the buckets of an MD session hash index
+ *  The elements are not freed.
+ *
+ *  @param[in]      pHash           hash index
+ */
+void trdp_MDhashFree (
+    TRDP_MD_HASH_T *pHash)
+{
+    if (pHash->ppBuckets != NULL)
+    {
+        vos_memFree(pHash->ppBuckets);
+    }
+    pHash->ppBuckets    = NULL;
+    pHash->size         = 0u;
+    pHash->count        = 0u;
+}
+
+/**********************************************************************************************************************/
+/** Hash of a destination URI, case insensitive as trdp_isAddressed()
+ *  URIs in a received header are not necessarily terminated.
+ *
+ *  @param[in]      pUri            URI user part
+ *
+ *  @retval         hash value
+ */
+static UINT32 trdp_MDlisUriHash (
+    const CHAR8 *pUri)
+{
+    UINT32  hash = 0x811C9DC5u;
+    UINT32  i;
+
+    for (i = 0u; (i < TRDP_USR_URI_SIZE) && (pUri[i] != 0); i++)
+    {
+        hash    ^= (UINT32) tolower((unsigned char) pUri[i]);
+        hash    *= 0x01000193u;
     }
-    return pFirstMatchedPD;
+    return hash;
 }
 
+/**********************************************************************************************************************/
+/** Compute the bucket of a key in the MD listener index
+ *
+ *  @param[in]      pIndex          listener index with buckets
+ *  @param[in]      key             TRDP_MD_LIS_KEY_...
+ *  @param[in]      comId           comId, 0 if not part of the key
+ *  @param[in]      uriHash         hash of the destination URI, 0 if not part of the key
+ *
+ *  @retval         bucket index
+ */
+static UINT32 trdp_MDlisIndexBucket (
+    const TRDP_MD_LIS_INDEX_T   *pIndex,
+    UINT32                      key,
+    UINT32                      comId,
+    UINT32                      uriHash)
+{
+    UINT32 hash;
+
+    hash    = (key + 1u) * 0x9E3779B1u;
+    hash    ^= comId * 0x85EBCA77u;
+    hash    ^= uriHash * 0xC2B2AE3Du;
+    hash    ^= hash >> 16;
+    return hash & (pIndex->size - 1u);
+}
 
 /**********************************************************************************************************************/
-/** Return the element with same comId and IP addresses
+/** Compute the bucket of a listener from what it filters on
  *
- *  @param[in]      pHead           pointer to head of queue
- *  @param[in]      addr            Pub/Sub handle (Address, ComID, srcIP & dest IP, serviceId) to search for
- *  @param[in]      comId           ComId to stay on on a sorted search, 0 when searching on unsorted queues
+ *  @param[in]      pIndex          listener index with buckets
+ *  @param[in]      pListener       listener
  *
- *  @retval         != NULL         pointer to PD element
- *  @retval         NULL            No PD element found
+ *  @retval         bucket index
  */
-PD_ELE_T *trdp_findSubAddr (
-    PD_ELE_T            *pHead,
-    TRDP_ADDRESSES_T    *addr,
-    UINT32              comId)
+static UINT32 trdp_MDlisIndexOf (
+    const TRDP_MD_LIS_INDEX_T   *pIndex,
+    const MD_LIS_ELE_T          *pListener)
 {
-    PD_ELE_T    *iterPD;
-    PD_ELE_T    *pFirstMatchedPD = NULL;
+    UINT32  key     = TRDP_MD_LIS_KEY_ANY;
+    UINT32  comId   = 0u;
+    UINT32  uriHash = 0u;
 
-    if (pHead == NULL || addr == NULL)
+    if ((pListener->privFlags & TRDP_CHECK_COMID) != 0)
     {
-        return NULL;
+        key     |= TRDP_MD_LIS_KEY_COMID;
+        comId   = pListener->addr.comId;
     }
-
-    for (iterPD = pHead; iterPD != NULL; iterPD = iterPD->pNext)
+    if (pListener->destURI[0] != 0)
     {
-        /* watch a comId change (needed for indexed search) */
-        if ((comId != 0u) && (iterPD->addr.comId != comId))
-        {
-            break;
-        }
-        /*  We match if src/dst/mc address is zero or matches */
-       /* if ((iterPD->addr.comId == addr->comId)
-              && SOA_SAME_SERVICEID_OR0(addr->serviceId, iterPD->addr.serviceId)) */
-        if (SAME_SERVICE_COM_ID(iterPD->addr, *addr)) /*lint !e506 meant to be true, if service support is off */
-        {
-            /* if srcIP filter matches AND destIP matches THEN this is a direct hit */
-            if ((iterPD->addr.srcIpAddr == addr->srcIpAddr) &&
-                ((iterPD->addr.destIpAddr == addr->destIpAddr)))
-            {
-                return iterPD;  /* we cannot find a better match */
-            }
-
-            if (((iterPD->addr.srcIpAddr == VOS_INADDR_ANY) || (iterPD->addr.srcIpAddr == addr->srcIpAddr))
-                && ((iterPD->addr.destIpAddr == VOS_INADDR_ANY) || (addr->destIpAddr == VOS_INADDR_ANY) ||
-                    (iterPD->addr.destIpAddr == addr->destIpAddr)))
-            {
-                pFirstMatchedPD = iterPD;
-            }
-
-            /* Check for IP range */
-            if (iterPD->addr.srcIpAddr2 != VOS_INADDR_ANY)
-            {
-                if ((addr->srcIpAddr >= iterPD->addr.srcIpAddr) &&
-                    (addr->srcIpAddr <= iterPD->addr.srcIpAddr2) &&
-                    ((iterPD->addr.destIpAddr == VOS_INADDR_ANY) || (addr->destIpAddr == VOS_INADDR_ANY) ||
-                     (iterPD->addr.destIpAddr == addr->destIpAddr)))
-                {
-                    return iterPD;
-                }
-            }
-        }
+        key     |= TRDP_MD_LIS_KEY_URI;
+        uriHash = trdp_MDlisUriHash(pListener->destURI);
     }
-    return pFirstMatchedPD;
+    return trdp_MDlisIndexBucket(pIndex, key, comId, uriHash);
 }
 
-
 /**********************************************************************************************************************/
-/** Return the element with same comId and IP addresses
+/** (Re-)build the listener index from the listener queue
+ *  If the buckets cannot be allocated, the current index is kept.
  *
- *  @param[in]      pHead           pointer to head of queue
- *  @param[in]      addr            Pub/Sub handle (Address, ComID, srcIP & dest IP) to search for
+ *  @param[in]      pHead           head of the listener queue
+ *  @param[in]      pIndex          listener index
+ *  @param[in]      size            number of buckets (power of 2)
  *
- *  @retval         != NULL         pointer to PD element
- *  @retval         NULL            No PD element found
+ *  @retval         TRUE            index rebuilt
+ *  @retval         FALSE           out of memory
  */
-PD_ELE_T *trdp_queueFindExistingSub (
-    PD_ELE_T            *pHead,
-    TRDP_ADDRESSES_T    *addr)
+static BOOL8 trdp_MDlisIndexRebuild (
+    MD_LIS_ELE_T        *pHead,
+    TRDP_MD_LIS_INDEX_T *pIndex,
+    UINT32              size)
 {
-    PD_ELE_T *iterPD;
+    MD_LIS_ELE_T    * *ppBuckets = (MD_LIS_ELE_T * *) vos_memAlloc(size * sizeof(MD_LIS_ELE_T *));
+    MD_LIS_ELE_T    * *ppTail;
+    MD_LIS_ELE_T    *iterLis;
 
-    if (pHead == NULL || addr == NULL)
+    if (ppBuckets == NULL)
     {
-        return NULL;
+        return FALSE;
+    }
+    if (pIndex->ppBuckets != NULL)
+    {
+        vos_memFree(pIndex->ppBuckets);
     }
+    pIndex->ppBuckets   = ppBuckets;
+    pIndex->size        = size;
 
-    for (iterPD = pHead; iterPD != NULL; iterPD = iterPD->pNext)
+    /* appending in queue order keeps the buckets in descending seqNo */
+    for (iterLis = pHead; iterLis != NULL; iterLis = iterLis->pNext)
     {
-        /*  We match if src/dst/mc address is zero or matches */
-        if ((iterPD->addr.comId == addr->comId)
-            && SOA_SAME_SERVICEID(iterPD->addr.serviceId, addr->serviceId)) /*lint !e506 meant to be true, if service support is off */
+        ppTail = &pIndex->ppBuckets[trdp_MDlisIndexOf(pIndex, iterLis)];
+        while (*ppTail != NULL)
         {
-            if ((iterPD->addr.srcIpAddr == addr->srcIpAddr)
-                && (iterPD->addr.destIpAddr == addr->destIpAddr))
-            {
-                return iterPD;
-            }
-            /* Check for IP range */
-            if (iterPD->addr.srcIpAddr2 != VOS_INADDR_ANY)
-            {
-                if ((addr->srcIpAddr >= iterPD->addr.srcIpAddr) &&
-                    (addr->srcIpAddr <= iterPD->addr.srcIpAddr2) &&
-                    (iterPD->addr.destIpAddr == addr->destIpAddr))
-                {
-                    return iterPD;
-                }
-            }
-
+            ppTail = &(*ppTail)->pHashNext;
         }
+        iterLis->pHashNext  = NULL;
+        *ppTail             = iterLis;
     }
-    return NULL;
+    return TRUE;
 }
 
 /**********************************************************************************************************************/
-/** Delete an element
+/** Add a new listener to the listener index
+ *  The listener must already be inserted at the head of the listener queue, it gets the highest seqNo.
+ *  comId, TRDP_CHECK_COMID and the destination URI of an indexed listener must not be changed.
  *
- *  @param[in]      ppHead          pointer to pointer to head of queue
- *  @param[in]      pDelete         pointer to element to delete
+ *  @param[in]      pHead           head of the listener queue
+ *  @param[in]      pIndex          listener index
+ *  @param[in]      pListener       listener to add
  */
-void    trdp_queueDelElement (
-    PD_ELE_T    * *ppHead,
-    PD_ELE_T    *pDelete)
+void trdp_MDlisIndexInsert (
+    MD_LIS_ELE_T        *pHead,
+    TRDP_MD_LIS_INDEX_T *pIndex,
+    MD_LIS_ELE_T        *pListener)
 {
-    PD_ELE_T *iterPD;
+    UINT32 slot;
 
-    if (ppHead == NULL || *ppHead == NULL || pDelete == NULL)
+    pIndex->count++;
+    if (pIndex->lastSeqNo == 0xFFFFFFFFu)
     {
-        return;
-    }
+        /* renumber in queue order before the seqNo wraps, the order within the buckets does not change */
+        MD_LIS_ELE_T *iterLis;
 
-    /* handle removal of first element */
-    if (pDelete == *ppHead)
+        pIndex->lastSeqNo = 0u;
+        for (iterLis = pHead; iterLis != NULL; iterLis = iterLis->pNext)
+        {
+            pIndex->lastSeqNo++;
+        }
+        slot = pIndex->lastSeqNo;
+        for (iterLis = pHead; iterLis != NULL; iterLis = iterLis->pNext)
+        {
+            iterLis->seqNo = slot--;
+        }
+    }
+    else
     {
-        *ppHead = pDelete->pNext;
-        return;
+        pListener->seqNo = ++pIndex->lastSeqNo;
     }
 
-    for (iterPD = *ppHead; iterPD != NULL; iterPD = iterPD->pNext)
+    if ((pIndex->ppBuckets == NULL) || (pIndex->count > pIndex->size))
     {
-        if (iterPD->pNext && iterPD->pNext == pDelete)
+        /* first listener, recovering from out of memory or growing */
+        if (trdp_MDlisIndexRebuild(pHead, pIndex,
+                                   (pIndex->ppBuckets == NULL) ? TRDP_MD_LIS_INDEX_MIN_SIZE : 2u * pIndex->size)
+            == TRUE)
         {
-            iterPD->pNext = pDelete->pNext;
             return;
         }
     }
+    if (pIndex->ppBuckets != NULL)
+    {
+        /* the newest listener is the first of its bucket */
+        slot = trdp_MDlisIndexOf(pIndex, pListener);
+        pListener->pHashNext        = pIndex->ppBuckets[slot];
+        pIndex->ppBuckets[slot]     = pListener;
+    }
 }
 
-
 /**********************************************************************************************************************/
-/** Check topography counters
- *  The applied conformance pattern follows Table A.5/A.21 (positive match):
- *  Telegram to be sent   Locally stored value (appSession)
- *  Case etbTopoCnt opTrnTopoCnt etbTopoCntFilter opTrnTopoCntFilter
- *  1    any        any          0                0
- *  2    any        equal        0                equal
- *  3    equal      any          equal            0
- *  4    equal      equal        equal            equal
+/** Remove a listener from the listener index
  *
- *  @param[in]      etbTopoCnt              ETB topography counter to be checked
- *  @param[in]      opTrnTopoCnt            Operational topography counter to be checked
- *  @param[in]      etbTopoCntFilter        ETB topography counter filter value
- *  @param[in]      opTrnTopoCntFilter      Operational topography counter filter value
- *
- *  @retval         TRUE           Filter criteria matched
- *                  FALSE          Filter criteria not matched
+ *  @param[in]      pIndex          listener index
+ *  @param[in]      pListener       listener to remove
  */
-BOOL8 trdp_validTopoCounters (
-    UINT32  etbTopoCnt,
-    UINT32  opTrnTopoCnt,
-    UINT32  etbTopoCntFilter,
-    UINT32  opTrnTopoCntFilter)
+void trdp_MDlisIndexRemove (
+    TRDP_MD_LIS_INDEX_T *pIndex,
+    MD_LIS_ELE_T        *pListener)
 {
-    if (((etbTopoCntFilter == 0) || (etbTopoCnt == etbTopoCntFilter))
-        &&
-        ((opTrnTopoCntFilter == 0) || (opTrnTopoCnt == opTrnTopoCntFilter)))
+    if (pIndex->count > 0u)
     {
-        return TRUE;
+        pIndex->count--;
     }
-    else
+    if (pIndex->ppBuckets != NULL)
     {
-        return FALSE;
+        MD_LIS_ELE_T * *ppIter = &pIndex->ppBuckets[trdp_MDlisIndexOf(pIndex, pListener)];
+
+        while (*ppIter != NULL)
+        {
+            if (*ppIter == pListener)
+            {
+                *ppIter = pListener->pHashNext;
+                break;
+            }
+            ppIter = &(*ppIter)->pHashNext;
+        }
     }
+    pListener->pHashNext = NULL;
 }
 
-#if MD_SUPPORT
 /**********************************************************************************************************************/
-/** Return the element with same comId from MD queue
+/** Return the buckets holding the candidate listeners for a received request or notification
+ *  The buckets of the four keys the request can match are returned, NULL for empty or duplicate buckets.
+ *  They are linked by pHashNext and may also hold listeners of other keys, so all filters must still be applied.
+ *  The first listener of the queue accepting the request is the matching one with the highest seqNo.
  *
- *  @param[in]      pHead           pointer to head of queue
- *  @param[in]      addr            Pub/Sub handle (Address, ComID, srcIP & dest IP) to search for
+ *  @param[in]      pIndex          listener index
+ *  @param[in]      comId           received comId
+ *  @param[in]      pDestURI        received destination URI
+ *  @param[out]     pBuckets        first listener of each candidate bucket
  *
- *  @retval         != NULL         pointer to PD element
- *  @retval         NULL            No PD element found
+ *  @retval         TRUE            candidates returned
+ *  @retval         FALSE           no index, the listener queue must be searched
  */
-MD_ELE_T *trdp_MDqueueFindAddr (
-    MD_ELE_T            *pHead,
-    TRDP_ADDRESSES_T    *addr)
+BOOL8 trdp_MDlisIndexFind (
+    const TRDP_MD_LIS_INDEX_T   *pIndex,
+    UINT32                      comId,
+    const CHAR8                 *pDestURI,
+    MD_LIS_ELE_T                *pBuckets[TRDP_MD_LIS_KEYS])
 {
-    MD_ELE_T *iterMD;
+    UINT32  slot[TRDP_MD_LIS_KEYS];
+    UINT32  uriHash;
+    UINT32  key, i;
 
-    if (pHead == NULL || addr == NULL)
+    if (pIndex->ppBuckets == NULL)
     {
-        return NULL;
+        return FALSE;
     }
 
-    for (iterMD = pHead; iterMD != NULL; iterMD = iterMD->pNext)
+    uriHash = trdp_MDlisUriHash(pDestURI);
+    for (key = 0u; key < TRDP_MD_LIS_KEYS; key++)
     {
-        /*  We match if src/dst address is zero or found */
-        if ((iterMD->addr.comId == addr->comId)
-            && ((addr->srcIpAddr == 0) || (iterMD->addr.srcIpAddr == addr->srcIpAddr))
-            && ((addr->destIpAddr == 0) || (iterMD->addr.destIpAddr == addr->destIpAddr)))
+        slot[key] = trdp_MDlisIndexBucket(pIndex, key,
+                                          ((key & TRDP_MD_LIS_KEY_COMID) != 0u) ? comId : 0u,
+                                          ((key & TRDP_MD_LIS_KEY_URI) != 0u) ? uriHash : 0u);
+        pBuckets[key] = pIndex->ppBuckets[slot[key]];
+
+        /* a listener with a destination URI never accepts an empty one */
+        if (((key & TRDP_MD_LIS_KEY_URI) != 0u) && (pDestURI[0] == 0))
         {
-            return iterMD;
+            pBuckets[key] = NULL;
+        }
+        for (i = 0u; i < key; i++)
+        {
+            if ((slot[i] == slot[key]) && (pBuckets[i] != NULL))
+            {
+                pBuckets[key] = NULL;
+            }
         }
     }
-    return NULL;
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Free the buckets of the MD listener index
+ *  The listeners are not freed.
+ *
+ *  @param[in]      pIndex          listener index
+ */
+void trdp_MDlisIndexFree (
+    TRDP_MD_LIS_INDEX_T *pIndex)
+{
+    if (pIndex->ppBuckets != NULL)
+    {
+        vos_memFree(pIndex->ppBuckets);
+    }
+    pIndex->ppBuckets   = NULL;
+    pIndex->size        = 0u;
+    pIndex->count       = 0u;
+    pIndex->lastSeqNo   = 0u;
 }
 
 /**********************************************************************************************************************/
-/** Delete an element from MD queue
+/** Delete an element from MD queue and its session hash index
  *
  *  @param[in]      ppHead          pointer to pointer to head of queue
+ *  @param[in]      pHash           session hash index of the queue
  *  @param[in]      pDelete         pointer to element to delete
  */
 void    trdp_MDqueueDelElement (
-    MD_ELE_T    * *ppHead,
-    MD_ELE_T    *pDelete)
+    MD_ELE_T        * *ppHead,
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pDelete)
 {
     MD_ELE_T *iterMD;
 
@@ -811,6 +2007,7 @@ void    trdp_MDqueueDelElement (
     if (pDelete == *ppHead)
     {
         *ppHead = pDelete->pNext;
+        trdp_MDhashRemove(pHash, pDelete);
         return;
     }
 
@@ -819,20 +2016,24 @@ void    trdp_MDqueueDelElement (
         if (iterMD->pNext && iterMD->pNext == pDelete)
         {
             iterMD->pNext = pDelete->pNext;
+            trdp_MDhashRemove(pHash, pDelete);
             return;
         }
     }
 }
 
 /**********************************************************************************************************************/
-/** Append an element at end of queue
+/** Append an element at end of queue and add it to the session hash index
+ *  The session ID of the element must be set.
  *
  *  @param[in]      ppHead          pointer to pointer to head of queue
+ *  @param[in]      pHash           session hash index of the queue
  *  @param[in]      pNew            pointer to element to append
  */
 void    trdp_MDqueueAppLast (
-    MD_ELE_T    * *ppHead,
-    MD_ELE_T    *pNew)
+    MD_ELE_T        * *ppHead,
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pNew)
 {
     MD_ELE_T *iterMD;
 
@@ -847,25 +2048,30 @@ void    trdp_MDqueueAppLast (
     if (*ppHead == NULL)
     {
         *ppHead = pNew;
-        return;
     }
-
-    for (iterMD = *ppHead; iterMD->pNext != NULL; iterMD = iterMD->pNext)
+    else
     {
-        ;
+        for (iterMD = *ppHead; iterMD->pNext != NULL; iterMD = iterMD->pNext)
+        {
+            ;
+        }
+        iterMD->pNext = pNew;
     }
-    iterMD->pNext = pNew;
+    trdp_MDhashInsert(*ppHead, pHash, pNew);
 }
 
 /**********************************************************************************************************************/
-/** Insert an element at front of MD queue
+/** Insert an element at front of MD queue and add it to the session hash index
+ *  The session ID of the element must be set.
  *
  *  @param[in]      ppHead          pointer to pointer to head of queue
+ *  @param[in]      pHash           session hash index of the queue
  *  @param[in]      pNew            pointer to element to insert
  */
 void    trdp_MDqueueInsFirst (
-    MD_ELE_T    * *ppHead,
-    MD_ELE_T    *pNew)
+    MD_ELE_T        * *ppHead,
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pNew)
 {
     if (ppHead == NULL || pNew == NULL)
     {
@@ -874,6 +2080,16 @@ void    trdp_MDqueueInsFirst (
 
     pNew->pNext = *ppHead;
     *ppHead     = pNew;
+
+    pHash->count++;
+    if ((trdp_MDhashGrow(*ppHead, pHash) == FALSE) && (pHash->ppBuckets != NULL))
+    {
+        /* first in queue order: first in its bucket */
+        MD_ELE_T * *ppBucket = &pHash->ppBuckets[trdp_MDhashIndex(pHash, pNew->sessionID)];
+
+        pNew->pHashNext = *ppBucket;
+        *ppBucket       = pNew;
+    }
 }
 
 /**********************************************************************************************************************/
@@ -1046,7 +2262,7 @@ TRDP_ERR_T  trdp_requestSocket (
                  && (iface[lIndex].rcvMostly == rcvMostly)
                  && ((type != TRDP_SOCK_MD_TCP)
                      || ((type == TRDP_SOCK_MD_TCP) && (iface[lIndex].tcpParams.cornerIp == cornerIp) &&
-                         (iface[lIndex].usage == 0))))
+                         (iface[lIndex].usage == 0) && (iface[lIndex].tcpParams.morituri == FALSE))))
         {
             /*  Did this socket join the required multicast group?  */
             if (mcGroup != 0 && trdp_SockIsJoined(iface[lIndex].mcGroups, mcGroup) == FALSE)
@@ -1187,6 +2403,8 @@ TRDP_ERR_T  trdp_requestSocket (
         iface[lIndex].tcpParams.morituri    = FALSE;
         iface[lIndex].tcpParams.sendingTimeout.tv_sec   = 0;
         iface[lIndex].tcpParams.sendingTimeout.tv_usec  = 0;
+        iface[lIndex].tcpParams.connected   = FALSE;
+        vos_clearTime(&iface[lIndex].tcpParams.connectStart);
 
 
         /* Add to the file desc only if it's an accepted socket */
@@ -1496,6 +2714,7 @@ void  trdp_releaseSocket (
                 vos_printLog(VOS_LOG_INFO, "The socket (Num = %d) will be closed\n", sock_id);
 
                 err = (TRDP_ERR_T) vos_sockClose(iface[lIndex].sock);
+                sSocketCloseCnt++;
                 if (err != TRDP_NO_ERR)
                 {
                     vos_printLog(VOS_LOG_ERROR, "vos_sockClose() failed (Err:%d)\n", err);
@@ -1518,6 +2737,7 @@ void  trdp_releaseSocket (
                 iface[lIndex].tcpParams.connectionTimeout.tv_usec   = 0;
                 iface[lIndex].tcpParams.addFileDesc = FALSE;
                 iface[lIndex].tcpParams.morituri    = FALSE;
+                iface[lIndex].tcpParams.connected   = FALSE;
             }
         }
 
@@ -1543,6 +2763,7 @@ void  trdp_releaseSocket (
                 /* Close that socket, nobody uses it anymore */
                 INT32 sock_id = vos_sockId(iface[lIndex].sock);
                 err = (TRDP_ERR_T) vos_sockClose(iface[lIndex].sock);
+                sSocketCloseCnt++;
                 if (err != TRDP_NO_ERR)
                 {
                     vos_printLogStr(VOS_LOG_DBG, "Trying to close socket again?\n");
@@ -1612,6 +2833,121 @@ void  trdp_releaseSocket (
     }
 }
 
+/**********************************************************************************************************************/
+/** Return the time a sender must be silent before its sequence counter is dropped
+ *
+ *  @param[in]      pElement            subscription element
+ *
+ *  @retval         maximum age in seconds
+ */
+static UINT32 trdp_seqCntMaxAge (
+    const PD_ELE_T *pElement)
+{
+    UINT32 timeout = (UINT32) pElement->interval.tv_sec + ((pElement->interval.tv_usec > 0) ? 1u : 0u);
+
+    if ((timeout * TRDP_SEQ_CNT_AGE_FACTOR) > TRDP_SEQ_CNT_MIN_AGE)
+    {
+        return timeout * TRDP_SEQ_CNT_AGE_FACTOR;
+    }
+    return TRDP_SEQ_CNT_MIN_AGE;
+}
+
+/**********************************************************************************************************************/
+/** Return the slot of a sender in the sequence counter table
+ *  The table is never full, so probing ends on the entry of the sender or on an unused slot.
+ *
+ *  @param[in]      pList               sequence counter table
+ *  @param[in]      srcIP               Source IP address
+ *  @param[in]      msgType             message type
+ *
+ *  @retval         slot holding the sender or unused slot (msgType == 0) to store it
+ */
+static TRDP_SEQ_CNT_ENTRY_T *trdp_seqCntSlot (
+    TRDP_SEQ_CNT_LIST_T *pList,
+    TRDP_IP_ADDR_T      srcIP,
+    TRDP_MSG_T          msgType)
+{
+    UINT32  mask    = (UINT32) pList->maxNoOfEntries - 1u;
+    UINT32  hash    = (srcIP * 0x9E3779B1u) ^ ((UINT32) msgType * 0x85EBCA77u);
+    UINT32  idx     = (hash ^ (hash >> 16)) & mask;
+
+    while ((pList->seq[idx].msgType != 0) &&
+           ((pList->seq[idx].srcIpAddr != srcIP) || (pList->seq[idx].msgType != msgType)))
+    {
+        idx = (idx + 1u) & mask;
+    }
+    return &pList->seq[idx];
+}
+
+/**********************************************************************************************************************/
+/** Rebuild the sequence counter table of a subscription before a new sender is added.
+ *  Entries of senders silent for longer than trdp_seqCntMaxAge() are dropped, the remaining ones are rehashed
+ *  into a table sized for a load of at most 1/4. The table is allocated on first use.
+ *
+ *  @param[in]      pElement            subscription element
+ *  @param[in]      now                 current time [s]
+ *
+ *  @retval          0 - table has room for a new sender
+ *  @retval         -1 - memory error
+ */
+static int trdp_seqCntRebuild (
+    PD_ELE_T    *pElement,
+    UINT32      now)
+{
+    TRDP_SEQ_CNT_LIST_T *pOld   = pElement->pSeqCntList;
+    TRDP_SEQ_CNT_LIST_T *pNew;
+    UINT32  maxAge  = trdp_seqCntMaxAge(pElement);
+    UINT32  live    = 0u;
+    UINT32  newSize = TRDP_SEQ_CNT_START_ARRAY_SIZE;
+    UINT32  i;
+
+    if (pOld != NULL)
+    {
+        for (i = 0u; i < pOld->maxNoOfEntries; i++)
+        {
+            if ((pOld->seq[i].msgType != 0) && ((now - pOld->seq[i].lastRcvTime) <= maxAge))
+            {
+                live++;
+            }
+        }
+    }
+    while ((newSize < (4u * (live + 1u))) && (newSize < 0x8000u))
+    {
+        newSize <<= 1;
+    }
+    if ((live + 1u) >= newSize)
+    {
+        return -1;
+    }
+
+    pNew = (TRDP_SEQ_CNT_LIST_T *) vos_memAlloc(newSize * sizeof(TRDP_SEQ_CNT_ENTRY_T) +
+                                                sizeof(TRDP_SEQ_CNT_LIST_T));
+    if (pNew == NULL)
+    {
+        return -1;
+    }
+    pNew->maxNoOfEntries = (UINT16) newSize;
+
+    if (pOld != NULL)
+    {
+        pNew->peakNoOfEntries   = pOld->peakNoOfEntries;
+        pNew->numDuplicates     = pOld->numDuplicates;
+        pNew->numAged           = pOld->numAged + (pOld->curNoOfEntries - live);
+        pNew->numGrown          = pOld->numGrown + ((newSize > pOld->maxNoOfEntries) ? 1u : 0u);
+        for (i = 0u; i < pOld->maxNoOfEntries; i++)
+        {
+            if ((pOld->seq[i].msgType != 0) && ((now - pOld->seq[i].lastRcvTime) <= maxAge))
+            {
+                *trdp_seqCntSlot(pNew, pOld->seq[i].srcIpAddr, pOld->seq[i].msgType) = pOld->seq[i];
+            }
+        }
+        vos_memFree(pOld);
+    }
+    pNew->curNoOfEntries    = (UINT16) live;
+    pElement->pSeqCntList   = pNew;
+    return 0;
+}
+
 /**********************************************************************************************************************/
 /** remove the sequence counter for the comID/source IP.
  *  The sequence counter should be reset if there was a packet time out.
@@ -1629,20 +2965,16 @@ void trdp_resetSequenceCounter (
     TRDP_IP_ADDR_T  srcIP,
     TRDP_MSG_T      msgType)
 {
-    int l_index;
+    TRDP_SEQ_CNT_ENTRY_T *pEntry;
 
     if (pElement == NULL || pElement->pSeqCntList == NULL)
     {
         return;
     }
-    /* Loop over entries */
-    for (l_index = 0; l_index < pElement->pSeqCntList->curNoOfEntries; ++l_index)
+    pEntry = trdp_seqCntSlot(pElement->pSeqCntList, srcIP, msgType);
+    if (pEntry->msgType != 0)
     {
-        if ((srcIP == pElement->pSeqCntList->seq[l_index].srcIpAddr) &&
-            (msgType == pElement->pSeqCntList->seq[l_index].msgType))
-        {
-            pElement->pSeqCntList->seq[l_index].lastSeqCnt = 0;
-        }
+        pEntry->lastSeqCnt = 0;
     }
 }
 
@@ -1651,11 +2983,15 @@ void trdp_resetSequenceCounter (
  *  If the comID/srcIP is not found, update it and return 0 -
  *  else if already received, return 1
  *  On memory error, return -1
+ *  The senders are kept in a hash table per subscription; a sender silent for longer than
+ *  TRDP_SEQ_CNT_AGE_FACTOR subscription timeouts (at least TRDP_SEQ_CNT_MIN_AGE s) is treated as new
+ *  and its entry is dropped when the table needs room.
  *
  *  @param[in]      pElement            subscription element
  *  @param[in]      sequenceCounter     sequence counter to check
  *  @param[in]      srcIP               Source IP address
  *  @param[in]      msgType             type of the message
+ *  @param[in]      pNow                current time
  *
  *  @retval         0 - no duplicate
  *                  1 - duplicate or old sequence counter
@@ -1663,51 +2999,34 @@ void trdp_resetSequenceCounter (
  */
 
 int trdp_checkSequenceCounter (
-    PD_ELE_T        *pElement,
-    UINT32          sequenceCounter,
-    TRDP_IP_ADDR_T  srcIP,
-    TRDP_MSG_T      msgType)
+    PD_ELE_T            *pElement,
+    UINT32              sequenceCounter,
+    TRDP_IP_ADDR_T      srcIP,
+    TRDP_MSG_T          msgType,
+    const TRDP_TIME_T   *pNow)
 {
-    int l_index;
+    TRDP_SEQ_CNT_ENTRY_T    *pEntry;
+    UINT32                  now;
 
-    if (pElement == NULL)
+    if ((pElement == NULL) || (pNow == NULL))
     {
         vos_printLogStr(VOS_LOG_DBG, "Parameter error\n");
         return -1;
     }
+    now = (UINT32) pNow->tv_sec;
 
-    if (pElement->pSeqCntList == NULL)
-    {
-        /* Allocate some space */
-        pElement->pSeqCntList = (TRDP_SEQ_CNT_LIST_T *) vos_memAlloc(TRDP_SEQ_CNT_START_ARRAY_SIZE *
-                                                                     sizeof(TRDP_SEQ_CNT_ENTRY_T) +
-                                                                     sizeof(TRDP_SEQ_CNT_LIST_T));
-        if (pElement->pSeqCntList == NULL)
-        {
-            return -1;
-        }
-        pElement->pSeqCntList->maxNoOfEntries   = TRDP_SEQ_CNT_START_ARRAY_SIZE;
-        pElement->pSeqCntList->curNoOfEntries   = 0;
-    }
-    /* Loop over entries */
-    for (l_index = 0; l_index < pElement->pSeqCntList->curNoOfEntries; ++l_index)
+    if (pElement->pSeqCntList != NULL)
     {
-        if ((srcIP == pElement->pSeqCntList->seq[l_index].srcIpAddr) &&
-            (msgType == pElement->pSeqCntList->seq[l_index].msgType))
+        pEntry = trdp_seqCntSlot(pElement->pSeqCntList, srcIP, msgType);
+        if (pEntry->msgType != 0)
         {
             /*        Is this packet a duplicate?    */
-            if ((pElement->pSeqCntList->seq[l_index].lastSeqCnt == 0) ||    /* first time after timeout */
-                (sequenceCounter > pElement->pSeqCntList->seq[l_index].lastSeqCnt))
+            if ((pEntry->lastSeqCnt == 0) ||                                    /* first time after timeout */
+                (sequenceCounter > pEntry->lastSeqCnt) ||
+                ((now - pEntry->lastRcvTime) > trdp_seqCntMaxAge(pElement)))    /* silent for long, restarted */
             {
-                /*
-                 vos_printLog(VOS_LOG_DBG,
-                 "Rcv sequence: %u    last seq: %u\n",
-                 sequenceCounter,
-                 pElement->pSeqCntList->seq[l_index].lastSeqCnt);
-                 vos_printLog(VOS_LOG_DBG, "-> new PD data found (SrcIp: %s comId %u)\n", vos_ipDotted(
-                 srcIP), pElement->addr.comId);
-                 */
-                pElement->pSeqCntList->seq[l_index].lastSeqCnt = sequenceCounter;
+                pEntry->lastSeqCnt  = sequenceCounter;
+                pEntry->lastRcvTime = now;
                 return 0;
             }
             else
@@ -1715,38 +3034,34 @@ int trdp_checkSequenceCounter (
                 vos_printLog(VOS_LOG_DBG,
                              "Rcv sequence: %u    last seq: %u\n",
                              sequenceCounter,
-                             pElement->pSeqCntList->seq[l_index].lastSeqCnt);
+                             pEntry->lastSeqCnt);
                 vos_printLog(VOS_LOG_DBG, "-> duplicated PD data ignored (SrcIp: %s comId %u)\n", vos_ipDotted(
                                  srcIP), pElement->addr.comId);
+                pElement->pSeqCntList->numDuplicates++;
                 return 1;
             }
         }
     }
 
-    /* Not found in list, add new entry */
-    if (pElement->pSeqCntList->curNoOfEntries >= pElement->pSeqCntList->maxNoOfEntries)
+    /* Not found in table, add new entry; keep the load at 1/2 at most */
+    if ((pElement->pSeqCntList == NULL) ||
+        ((2u * ((UINT32) pElement->pSeqCntList->curNoOfEntries + 1u)) > pElement->pSeqCntList->maxNoOfEntries))
     {
-        /* Allocate some more space */
-        UINT16 newSize = 2 * pElement->pSeqCntList->curNoOfEntries;
-        TRDP_SEQ_CNT_LIST_T *newList = (TRDP_SEQ_CNT_LIST_T *) vos_memAlloc(newSize * sizeof(TRDP_SEQ_CNT_ENTRY_T) +
-                                                                            sizeof(TRDP_SEQ_CNT_LIST_T));
-        if (newList == NULL)
+        if (trdp_seqCntRebuild(pElement, now) != 0)
         {
             return -1;
         }
-
-        /* Copy old data into new, larger area */
-        memcpy(newList, pElement->pSeqCntList, pElement->pSeqCntList->maxNoOfEntries *
-               sizeof(TRDP_SEQ_CNT_ENTRY_T) +
-               sizeof(TRDP_SEQ_CNT_LIST_T));
-        vos_memFree(pElement->pSeqCntList);     /* Free old area */
-        pElement->pSeqCntList = newList;
-        pElement->pSeqCntList->maxNoOfEntries = newSize;
-    }
-    pElement->pSeqCntList->seq[pElement->pSeqCntList->curNoOfEntries].lastSeqCnt    = sequenceCounter;
-    pElement->pSeqCntList->seq[pElement->pSeqCntList->curNoOfEntries].srcIpAddr     = srcIP;
-    pElement->pSeqCntList->seq[pElement->pSeqCntList->curNoOfEntries].msgType       = msgType;
+    }
+    pEntry = trdp_seqCntSlot(pElement->pSeqCntList, srcIP, msgType);
+    pEntry->lastSeqCnt  = sequenceCounter;
+    pEntry->srcIpAddr   = srcIP;
+    pEntry->msgType     = msgType;
+    pEntry->lastRcvTime = now;
     pElement->pSeqCntList->curNoOfEntries++;
+    if (pElement->pSeqCntList->curNoOfEntries > pElement->pSeqCntList->peakNoOfEntries)
+    {
+        pElement->pSeqCntList->peakNoOfEntries = pElement->pSeqCntList->curNoOfEntries;
+    }
     vos_printLog(VOS_LOG_DBG, "Rcv sequence: %u\n", sequenceCounter);
     vos_printLog(VOS_LOG_DBG, "*** new sequence entry (SrcIp: %s comId %u)\n", vos_ipDotted(
                      srcIP), pElement->addr.comId);
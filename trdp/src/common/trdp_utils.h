@@ -17,6 +17,12 @@
 /*
 * $Id$
 *
+*      AG 2026-10-16: Deadline heap of PD and MD (trdp_timerInsert, trdp_timerRemove, trdp_timerFree)
+*      AG 2026-10-16: Index of the MD listeners on comId and destination URI (trdp_MDlisIndex...)
+*      AG 2026-10-16: Session ID hash index of the MD queues (trdp_MDhash...), passed to trdp_MDqueue...
+*      AG 2026-10-16: trdp_getSocketCloseCnt()
+*      AG 2026-10-16: trdp_checkSequenceCounter() takes the current time for ageing
+*      AG 2026-10-16: Hash index of the subscriptions (trdp_subHash...)
 *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
 *      BL 2020-08-07: Ticket #317 Bug in trdp_indeedFindSubAddr() (HIGH_PERFORMANCE)
 *      SB 2020-03-30: Ticket #311: removed trdp_getSeqCnt() because redundant publisher should not run on the same interface
@@ -101,6 +107,34 @@ PD_ELE_T        *trdp_queueFindSubAddr (
     PD_ELE_T            *pHead,
     TRDP_ADDRESSES_T    *pAddr);
 
+PD_ELE_T        *trdp_subHashFind (
+    TRDP_SESSION_PT     appHandle,
+    TRDP_ADDRESSES_T    *pAddr);
+
+TRDP_ERR_T      trdp_subHashInsert (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement);
+
+void            trdp_subHashRemove (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement);
+
+void            trdp_subHashFree (
+    TRDP_SESSION_PT appHandle);
+
+TRDP_ERR_T      trdp_timerInsert (
+    TRDP_TIMER_HEAP_T   *pHeap,
+    void                *pElement,
+    UINT32              *pIdx,
+    const TRDP_TIME_T   *pDue);
+
+void            trdp_timerRemove (
+    TRDP_TIMER_HEAP_T   *pHeap,
+    UINT32              *pIdx);
+
+void            trdp_timerFree (
+    TRDP_TIMER_HEAP_T *pHeap);
+
 PD_ELE_T        *trdp_queueFindExistingSub (
     PD_ELE_T            *pHead,
     TRDP_ADDRESSES_T    *pAddr);
@@ -127,21 +161,65 @@ MD_ELE_T    *trdp_MDqueueFindAddr (
     TRDP_ADDRESSES_T    *addr);
 
 void        trdp_MDqueueDelElement (
-    MD_ELE_T    * *ppHead,
-    MD_ELE_T    *pDelete);
+    MD_ELE_T        * *ppHead,
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pDelete);
 
 void        trdp_MDqueueAppLast (
-    MD_ELE_T    * *pHead,
-    MD_ELE_T    *pNew);
+    MD_ELE_T        * *pHead,
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pNew);
 
 void        trdp_MDqueueInsFirst (
-    MD_ELE_T    * *ppHead,
-    MD_ELE_T    *pNew);
+    MD_ELE_T        * *ppHead,
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pNew);
+
+MD_ELE_T    *trdp_MDhashFind (
+    MD_ELE_T                *pHead,
+    const TRDP_MD_HASH_T    *pHash,
+    const UINT8             *pSessionId);
+
+MD_ELE_T    *trdp_MDhashNext (
+    const TRDP_MD_HASH_T    *pHash,
+    const MD_ELE_T          *pElement);
+
+void        trdp_MDhashInsert (
+    MD_ELE_T        *pHead,
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pElement);
+
+void        trdp_MDhashRemove (
+    TRDP_MD_HASH_T  *pHash,
+    MD_ELE_T        *pElement);
+
+void        trdp_MDhashFree (
+    TRDP_MD_HASH_T *pHash);
+
+void        trdp_MDlisIndexInsert (
+    MD_LIS_ELE_T        *pHead,
+    TRDP_MD_LIS_INDEX_T *pIndex,
+    MD_LIS_ELE_T        *pListener);
+
+void        trdp_MDlisIndexRemove (
+    TRDP_MD_LIS_INDEX_T *pIndex,
+    MD_LIS_ELE_T        *pListener);
+
+BOOL8       trdp_MDlisIndexFind (
+    const TRDP_MD_LIS_INDEX_T   *pIndex,
+    UINT32                      comId,
+    const CHAR8                 *pDestURI,
+    MD_LIS_ELE_T                *pBuckets[TRDP_MD_LIS_KEYS]);
+
+void        trdp_MDlisIndexFree (
+    TRDP_MD_LIS_INDEX_T *pIndex);
 #endif
 
 INT32   trdp_getCurrentMaxSocketCnt (
     TRDP_SOCK_TYPE_T    type);
 
+UINT32  trdp_getSocketCloseCnt (void);
+
 void trdp_setCurrentMaxSocketCnt (
     TRDP_SOCK_TYPE_T    type,
     INT32               currentMaxSocketCnt);
@@ -193,10 +271,11 @@ UINT32  trdp_packetSizeMD (
     UINT32 dataSize);
 
 int trdp_checkSequenceCounter (
-    PD_ELE_T        *pElement,
-    UINT32          sequenceCounter,
-    TRDP_IP_ADDR_T  srcIP,
-    TRDP_MSG_T      msgType);
+    PD_ELE_T            *pElement,
+    UINT32              sequenceCounter,
+    TRDP_IP_ADDR_T      srcIP,
+    TRDP_MSG_T          msgType,
+    const TRDP_TIME_T   *pNow);
 
 BOOL8 trdp_isAddressed (
     const char      *listUri,
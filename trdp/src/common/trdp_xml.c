@@ -17,6 +17,9 @@
 /*
 * $Id$
 *
+*      AG 2026-10-16: trdp_XMLOpen split into trdp_XMLLoad and trdp_XMLIndex (binary configuration cache)
+*      AG 2026-10-16: Tokenizer on the document in memory (mmap'ed file or stream buffer), element index built in
+*                     one pass is used by seek, count and rewind
 *     AHW 2023-01-20: Ticket #415: trdp_XMLGet Attribute: ULONG_MAX should be an allowed value
 *      BL 2020-01-07: Ticket #284: Parsing Unsigned Values from Config XML
 *      BL 2019-01-29: Ticket #232: Write access to XML file
@@ -38,12 +41,21 @@
 
 #include <sys/types.h>
 
+#ifdef POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "trdp_xml.h"
 
 /***********************************************************************************************************************
  * DEFINES
  */
 
+#define XML_INITIAL_NODES   256u            /* Initial size of the element index, doubled as needed */
+
 /***********************************************************************************************************************
  * TYPEDEFS
  */
@@ -52,325 +64,525 @@
 *  LOCAL FUNCTIONS
 */
 
-/***********************************************************************************************************************
-NAME:       trdp_XMLNextToken
-ABSTRACT:   Returns next XML token.
-            Skips occurences of whitespace and <!...> and <?...>
-RETURNS:    TOK_OPEN ("<"), TOK_CLOSE (">"), TOK_OPEN_END = ("</"),
-            TOK_CLOSE_EMPTY = ("/>"), TOK_EQUAL = ("="), TOK_ID, TOK_EOF
-*/
 /**********************************************************************************************************************/
-/** Return next XML token.
- *    Skips occurences of whitespace and <!...> and <?...>
+/** Return next XML token inside a start tag.
+ *    Skips whitespace, the read position is pXML->pos.
+ *    Comments and processing instructions are handled by the element index.
  *
  *  @param[in]      pXML        Pointer to local data
  *
- *  @retval         TOK_OPEN ("<"), TOK_CLOSE (">"), TOK_OPEN_END = ("</"),
+ *  @retval         TOK_OPEN ("<"), TOK_CLOSE (">"),
  *                  TOK_CLOSE_EMPTY = ("/>"), TOK_EQUAL = ("="), TOK_ID, TOK_EOF
  *
  */
 static XML_TOKEN_T trdp_XMLNextToken (
     XML_HANDLE_T *pXML)
 {
-    int     ch = 0;
-    char    *p;
+    const char  *pCur   = pXML->pDoc + pXML->pos;
+    const char  *pEnd   = pXML->pDoc + pXML->docSize;
+    const char  *pStart;
+    XML_TOKEN_T token   = TOK_EOF;
+    size_t      len     = 0u;
 
     for (;; )
     {
         /* Skip whitespace */
-        while (!feof(pXML->infile) && (ch = fgetc(pXML->infile)) <= ' ') /*lint !e160 Lint objects a GNU warning
-                                                                           suppression macro - OK */
+        while ((pCur < pEnd) && ((unsigned char) *pCur <= ' '))
         {
-            ;
+            pCur++;
         }
 
-        /* Check for EOF */
-        if (feof(pXML->infile)) /*lint !e611 Lint for VxWorks gets lost in macro defintions*/
+        if (pCur >= pEnd)
         {
-            return TOK_EOF;
+            token = TOK_EOF;
+            break;
         }
 
-        /* Handle quoted identifiers */
-        if (ch == '"')
+        if (*pCur == '"')
         {
-            p = pXML->tokenValue;
-            while (!feof(pXML->infile) && (ch = fgetc(pXML->infile)) != '"') /*lint !e160 Lint objects a GNU warning
-                                                                               suppression macro - OK */
+            /* Quoted identifier */
+            pStart  = ++pCur;
+            pCur    = (const char *) memchr(pStart, '"', (size_t) (pEnd - pStart));
+            if (pCur == NULL)
             {
-                if (p < (pXML->tokenValue + MAX_TOK_LEN - 1))
-                {
-                    *(p++) = (char) ch;
-                }
+                pCur = pEnd;
+            }
+            len = (size_t) (pCur - pStart);
+            if (pCur < pEnd)
+            {
+                pCur++;
+            }
+        }
+        else if (*pCur == '<')
+        {
+            /* Next tag, the attributes end here */
+            token = TOK_OPEN;
+            break;
+        }
+        else if (*pCur == '>')
+        {
+            pCur++;
+            token = TOK_CLOSE;
+            break;
+        }
+        else if (*pCur == '=')
+        {
+            pCur++;
+            token = TOK_EQUAL;
+            break;
+        }
+        else if (*pCur == '/')
+        {
+            pCur++;
+            if ((pCur < pEnd) && (*pCur == '>'))
+            {
+                pCur++;
+                token = TOK_CLOSE_EMPTY;
+                break;
+            }
+            continue;   /* a single '/' is ignored */
+        }
+        else
+        {
+            /* Unquoted identifier */
+            pStart = pCur;
+            while ((pCur < pEnd) && ((unsigned char) *pCur > ' ') &&
+                   (*pCur != '<') && (*pCur != '>') && (*pCur != '=') && (*pCur != '/'))
+            {
+                pCur++;
             }
+            len = (size_t) (pCur - pStart);
+        }
+
+        if (len > (MAX_TOK_LEN - 1u))
+        {
+            len = MAX_TOK_LEN - 1u;
+        }
+        memcpy(pXML->tokenValue, pStart, len);
+        pXML->tokenValue[len] = 0;
+        token = TOK_ID;
+        break;
+    }
 
-            *(p++) = 0;
-            return TOK_ID;
+    pXML->pos = (UINT32) (pCur - pXML->pDoc);
+    return token;
+}
+
+/**********************************************************************************************************************/
+/** Append an element to the index, doubling its size if needed
+ *
+ *  @param[in]      pXML        Pointer to local data
+ *  @param[in,out]  pMaxNodes   Allocated entries of the index
+ *
+ *  @retval         index of the new element
+ *                  XML_NO_NODE if out of memory
+ */
+static UINT32 trdp_XMLNewNode (
+    XML_HANDLE_T    *pXML,
+    UINT32          *pMaxNodes)
+{
+    if (pXML->noOfNodes == *pMaxNodes)
+    {
+        XML_NODE_T *pNodes = (XML_NODE_T *) realloc(pXML->pNodes, 2u * *pMaxNodes * sizeof(XML_NODE_T));
+        if (pNodes == NULL)
+        {
+            return XML_NO_NODE;
         }
-        else if (ch == '<')
+        pXML->pNodes    = pNodes;
+        *pMaxNodes      *= 2u;
+    }
+    pXML->pNodes[pXML->noOfNodes].firstChild    = XML_NO_NODE;
+    pXML->pNodes[pXML->noOfNodes].nextSibling   = XML_NO_NODE;
+    return pXML->noOfNodes++;
+}
+
+/**********************************************************************************************************************/
+/** Build the element index of the document in a single pass.
+ *    Skips text, comments <!-- -->, declarations <!...> and processing instructions <?...?>.
+ *    The index is held in heap memory, it must survive a re-initialisation of the VOS memory (tau_xsession_load).
+ *
+ *  @param[in]      pXML        Pointer to local data, pDoc and docSize set
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_MEM_ERR
+ *  @retval         TRDP_XML_PARSER_ERR     unterminated comment or elements nested too deep
+ */
+static TRDP_ERR_T trdp_XMLBuildIndex (
+    XML_HANDLE_T *pXML)
+{
+    const char  *pCur       = pXML->pDoc;
+    const char  *pEnd       = pXML->pDoc + pXML->docSize;
+    UINT32      open[MAX_XML_DEPTH + 1];    /* Open elements, open[0] is the document */
+    UINT32      last[MAX_XML_DEPTH + 1];    /* Last child of the open elements */
+    int         depth       = 0;
+    UINT32      maxNodes    = XML_INITIAL_NODES;
+    UINT32      node;
+
+    pXML->pNodes = (XML_NODE_T *) malloc(maxNodes * sizeof(XML_NODE_T));
+    if (pXML->pNodes == NULL)
+    {
+        return TRDP_MEM_ERR;
+    }
+    pXML->noOfNodes = 0u;
+    node            = trdp_XMLNewNode(pXML, &maxNodes);
+    pXML->pNodes[node].nameOffset   = 0u;
+    pXML->pNodes[node].attrOffset   = 0u;
+    pXML->pNodes[node].nameLen      = 0u;
+    open[0] = node;
+    last[0] = XML_NO_NODE;
+
+    while ((pCur < pEnd) && ((pCur = (const char *) memchr(pCur, '<', (size_t) (pEnd - pCur))) != NULL))
+    {
+        if (++pCur >= pEnd)
         {
-            /* Tag start character */
-            ch = fgetc(pXML->infile);    /*lint !e160 Lint objects a GNU warning suppression macro - OK */
+            break;
+        }
 
-            if (ch == '?') /* Skip processing instruction */
+        if (*pCur == '?')
+        {
+            /* Skip processing instruction */
+            while ((++pCur < pEnd) && !((*pCur == '>') && (pCur[-1] == '?')))
             {
-                while (!feof(pXML->infile) && (ch = fgetc(pXML->infile))) /*lint !e160 Lint objects a GNU warning
-                                                                            suppression macro - OK */
-                {
-                    if (ch == '?')
-                    {
-                        if ((ch = fgetc(pXML->infile)) == '>')
-                        {
-                            break;
-                        }
-                        else
-                        {
-                            (void) ungetc(ch, pXML->infile);
-                        }
-                    }
-                }
+                ;
             }
-            else if (ch == '!')
+        }
+        else if (*pCur == '!')
+        {
+            if (((pEnd - pCur) > 2) && (pCur[1] == '-') && (pCur[2] == '-'))
             {
-                /* Is it a comment? */
-                if (!feof(pXML->infile) && (ch = fgetc(pXML->infile)))
+                /* Skip comment */
+                pCur += 3;
+                while ((pCur < pEnd) && !((*pCur == '>') && (pCur[-1] == '-') && (pCur[-2] == '-')))
                 {
-                    if (ch == '-')
-                    {
-                        if ((ch = fgetc(pXML->infile) == '-'))
-                        {
-                            int endTagCnt = 0;
-                            while (!feof(pXML->infile) && (ch = fgetc(pXML->infile))) /*lint !e160 Lint objects a GNU
-                                                                                        warning suppression macro - OK
-                                                                                        */
-                            {
-                                if (ch == '-')
-                                {
-                                    endTagCnt++;
-                                }
-                                else if (ch == '>' && endTagCnt == 2)
-                                {
-                                    endTagCnt = 0;
-                                    break;
-                                }
-                                else
-                                {
-                                    endTagCnt = 0;
-                                }
-                            }
-                            /* Exit on unexpected end-of-file */
-                            if (endTagCnt != 2 && feof(pXML->infile))
-                            {
-                                pXML->error = TRDP_XML_PARSER_ERR;
-                                return TOK_EOF;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        while (!feof(pXML->infile) && (ch = fgetc(pXML->infile)) != '>')
-                        {
-                            ;
-                        }
-                    }
-                }
-                /* Exit on unexpected end-of-file */
-                if (feof(pXML->infile))
-                {
-                    pXML->error = TRDP_XML_PARSER_ERR;
-                    return TOK_EOF;
+                    pCur++;
                 }
             }
-            else if (ch == '/')
+            else
             {
-                return TOK_OPEN_END;
+                pCur = (const char *) memchr(pCur, '>', (size_t) (pEnd - pCur));
             }
-            else
+            if ((pCur == NULL) || (pCur >= pEnd))
             {
-                (void) ungetc(ch, pXML->infile);
-                return TOK_OPEN;
+                return TRDP_XML_PARSER_ERR;     /* Unexpected end of file */
             }
         }
-        else if (ch == '/')
+        else if (*pCur == '/')
         {
-            ch = fgetc(pXML->infile); /*lint !e160 Lint objects a GNU warning suppression macro - OK */
-            if (ch == '>')
-            {
-                return TOK_CLOSE_EMPTY;
-            }
-            else
+            /* End tag */
+            if (depth > 0)
             {
-                (void) ungetc(ch, pXML->infile);
+                depth--;
             }
         }
-        else if (ch == '>')
-        {
-            return TOK_CLOSE;
-        }
-        else if (ch == '=')
-        {
-            return TOK_EQUAL;
-        }
         else
         {
-            /* Unquoted identifier */
-            p       = pXML->tokenValue;
-            *(p++)  = (char) ch;
-            while ((!feof(pXML->infile)) &&
-                   ((ch = fgetc(pXML->infile)) != '<') /*lint !e160 Lint objects a GNU warning suppression macro - OK */
-                   && (ch != '>')
-                   && (ch != '=')
-                   && (ch != '/')
-                   && (ch > ' '))
+            /* Start tag */
+            while ((pCur < pEnd) && ((unsigned char) *pCur <= ' '))
             {
-                if (p < (pXML->tokenValue + MAX_TOK_LEN - 1u))
-                {
-                    *(p++) = (char) ch;
-                }
+                pCur++;
+            }
+            node = trdp_XMLNewNode(pXML, &maxNodes);
+            if (node == XML_NO_NODE)
+            {
+                return TRDP_MEM_ERR;
+            }
+            pXML->pNodes[node].nameOffset = (UINT32) (pCur - pXML->pDoc);
+            while ((pCur < pEnd) && ((unsigned char) *pCur > ' ') &&
+                   (*pCur != '<') && (*pCur != '>') && (*pCur != '=') && (*pCur != '/'))
+            {
+                pCur++;
             }
+            pXML->pNodes[node].attrOffset   = (UINT32) (pCur - pXML->pDoc);
+            pXML->pNodes[node].nameLen      = pXML->pNodes[node].attrOffset - pXML->pNodes[node].nameOffset;
 
-            *(p++) = 0;
+            if (last[depth] == XML_NO_NODE)
+            {
+                pXML->pNodes[open[depth]].firstChild = node;
+            }
+            else
+            {
+                pXML->pNodes[last[depth]].nextSibling = node;
+            }
+            last[depth] = node;
 
-            if ((ch == '<') || (ch == '>') || (ch == '=') || (ch == '/'))
+            /* Skip the attributes, quoted values may contain '>' and '/' */
+            while ((pCur < pEnd) && (*pCur != '>'))
             {
-                (void) ungetc(ch, pXML->infile);
+                if (*pCur == '"')
+                {
+                    pCur = (const char *) memchr(pCur + 1, '"', (size_t) (pEnd - pCur - 1));
+                    if (pCur == NULL)
+                    {
+                        pCur = pEnd;
+                        break;
+                    }
+                }
+                pCur++;
             }
 
-            return TOK_ID;
+            if ((pCur < pEnd) && (pCur[-1] != '/'))
+            {
+                /* Not an empty element, following elements are its children */
+                if (depth >= MAX_XML_DEPTH)
+                {
+                    return TRDP_XML_PARSER_ERR;
+                }
+                depth++;
+                open[depth] = node;
+                last[depth] = XML_NO_NODE;
+            }
         }
     }
+    return TRDP_NO_ERR;
 }
 
 /**********************************************************************************************************************/
-/** Return next high level XML token.
- *    Any Id is stored in pXML->tokenValue
- *    Other tokens are returned as is
+/** Compare the tag name of an element
  *
  *  @param[in]      pXML        Pointer to local data
+ *  @param[in]      node        Index of the element
+ *  @param[in]      tag         Tag name
+ *
+ *  @retval         TRUE if the element has this tag name
+ */
+static BOOL8 trdp_XMLIsTag (
+    const XML_HANDLE_T  *pXML,
+    UINT32              node,
+    const char          *tag)
+{
+    const XML_NODE_T *pNode = &pXML->pNodes[node];
+
+    return ((strncmp(pXML->pDoc + pNode->nameOffset, tag, pNode->nameLen) == 0) &&
+            (tag[pNode->nameLen] == 0)) ? TRUE : FALSE;
+}
+
+/**********************************************************************************************************************/
+/** First element on the current level following the element last found
  *
- *  @retval         TOK_START_TAG = TOK_OPEN + TOK_ID
- *                  TOK_END_TAG = TOK_OPEN_END + TOK_ID + TOK_CLOSE
+ *  @param[in]      pXML        Pointer to local data
  *
+ *  @retval         Index of the element
+ *                  XML_NO_NODE if there are no more elements on this level
  */
-static XML_TOKEN_T trdp_XMLNextTokenHl (
-    XML_HANDLE_T *pXML)
+static UINT32 trdp_XMLFollowing (
+    const XML_HANDLE_T *pXML)
 {
-    XML_TOKEN_T token;
+    UINT32 container, node;
 
-    token = trdp_XMLNextToken(pXML);
+    if ((pXML->tagDepthSeek <= 0) || (pXML->tagDepthSeek >= MAX_XML_DEPTH))
+    {
+        return XML_NO_NODE;
+    }
+    container   = pXML->container[pXML->tagDepthSeek];
+    node        = pXML->current[pXML->tagDepthSeek];
+    if ((container >= pXML->noOfNodes) || (node == XML_END_NODE))
+    {
+        return XML_NO_NODE;
+    }
+    return (node == XML_NO_NODE) ? pXML->pNodes[container].firstChild : pXML->pNodes[node].nextSibling;
+}
+
+/**********************************************************************************************************************/
+/** Read a complete file into heap memory, if it cannot be mapped
+ *
+ *  @param[in]      pXML        Pointer to local data
+ *  @param[in]      file        Pathname of XML file
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_IO_ERR
+ *  @retval         TRDP_MEM_ERR
+ */
+static TRDP_ERR_T trdp_XMLReadFile (
+    XML_HANDLE_T    *pXML,
+    const char      *file)
+{
+    FILE        *infile;
+    long        size;
+    char        *pBuffer;
+    TRDP_ERR_T  err = TRDP_IO_ERR;
 
-    if (token == TOK_OPEN)
+    if ((infile = fopen(file, "rb")) == NULL)
     {
-        pXML->tagDepth++;
-        token = trdp_XMLNextToken(pXML);
+        return TRDP_IO_ERR;
+    }
 
-        if (token == TOK_ID)
+    if ((fseek(infile, 0, SEEK_END) == 0) &&
+        ((size = ftell(infile)) >= 0) &&
+        ((unsigned long) size < UINT_MAX) &&
+        (fseek(infile, 0, SEEK_SET) == 0))
+    {
+        pBuffer = (char *) malloc((size_t) size + 1u);
+        if (pBuffer == NULL)
         {
-            vos_strncpy(pXML->tokenTag, pXML->tokenValue, MAX_TAG_LEN);
-            token = TOK_START_TAG;  /* TOK_OPEN + TOK_ID */
+            err = TRDP_MEM_ERR;
+        }
+        else if (fread(pBuffer, 1u, (size_t) size, infile) != (size_t) size)
+        {
+            free(pBuffer);
         }
         else
         {
-            token = TOK_EOF;  /* Something wrong, < should always be followed by a tag id */
+            pXML->pDoc      = pBuffer;
+            pXML->docSize   = (UINT32) size;
+            pXML->allocated = 1;
+            err = TRDP_NO_ERR;
         }
     }
-    else if (token == TOK_OPEN_END)
+    (void) fclose(infile);
+    return err;
+}
+
+/*******************************************************************************
+*  GLOBAL FUNCTIONS
+*/
+
+/**********************************************************************************************************************/
+/** Loads an XML file without indexing it.
+ *    The file is mapped into memory (read into memory where mapping is not available).
+ *
+ *  @param[in]      pXML        Pointer to local data
+ *  @param[in]      file        Pathname of XML file
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_IO_ERR
+ *  @retval         TRDP_MEM_ERR
+ */
+TRDP_ERR_T trdp_XMLLoad (
+    XML_HANDLE_T    *pXML,
+    const char      *file)
+{
+    TRDP_ERR_T err = TRDP_NO_ERR;
+
+    memset(pXML, 0, sizeof(XML_HANDLE_T));
+
+#ifdef POSIX
     {
-        pXML->tagDepth--;
-        token = trdp_XMLNextToken(pXML);
+        struct stat st;
+        int         fd = open(file, O_RDONLY);
 
-        if (token == TOK_ID)
+        if (fd == -1)
         {
-            vos_strncpy(pXML->tokenTag, pXML->tokenValue, MAX_TAG_LEN);
-            token = TOK_END_TAG; /* TOK_OPEN_END + TOK_ID + TOK_CLOSE */
+            return TRDP_IO_ERR;
         }
-        else
+        if ((fstat(fd, &st) == 0) && (st.st_size > 0) && ((unsigned long long) st.st_size < UINT_MAX))
         {
-            token = TOK_EOF;  /* Something wrong, </ should always be followed by a tag id + ">"*/
+            void *pMap = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (pMap != MAP_FAILED)
+            {
+                pXML->pDoc      = (const char *) pMap;
+                pXML->docSize   = (UINT32) st.st_size;
+                pXML->mapped    = 1;
+            }
         }
+        (void) close(fd);
     }
-    else if (token == TOK_CLOSE_EMPTY)
+#endif
+
+    if (pXML->pDoc == NULL)
     {
-        pXML->tagDepth--;
+        err = trdp_XMLReadFile(pXML, file);
     }
-    else if (token == TOK_ID)
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** Indexes a document loaded by trdp_XMLLoad in one pass and rewinds it.
+ *    The handle is closed on error.
+ *
+ *  @param[in]      pXML        Pointer to local data
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_MEM_ERR
+ *  @retval         TRDP_XML_PARSER_ERR
+ */
+TRDP_ERR_T trdp_XMLIndex (
+    XML_HANDLE_T *pXML)
+{
+    TRDP_ERR_T err = trdp_XMLBuildIndex(pXML);
+
+    if (err != TRDP_NO_ERR)
     {
-        vos_strncpy(pXML->tokenTag, pXML->tokenValue, MAX_TAG_LEN);
-        token = TOK_ID;
+        trdp_XMLClose(pXML);
+        return err;
     }
 
-    return token;
+    trdp_XMLRewind(pXML);
+    return TRDP_NO_ERR;
 }
 
-/*******************************************************************************
-*  GLOBAL FUNCTIONS
-*/
-
 /**********************************************************************************************************************/
 /** Opens the XML parsing.
+ *    The file is mapped into memory (read into memory where mapping is not available) and indexed in one pass.
  *
  *  @param[in]      pXML        Pointer to local data
  *  @param[in]      file        Pathname of XML file
  *
- *  @retval         none
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_IO_ERR
+ *  @retval         TRDP_MEM_ERR
+ *  @retval         TRDP_XML_PARSER_ERR
  */
 TRDP_ERR_T trdp_XMLOpen (
     XML_HANDLE_T    *pXML,
     const char      *file)
 {
-    if ((pXML->infile = fopen(file, "rb")) == NULL)
+    TRDP_ERR_T err = trdp_XMLLoad(pXML, file);
+
+    if (err != TRDP_NO_ERR)
     {
-        return TRDP_IO_ERR;
+        return err;
     }
-
-    pXML->tagDepth      = 0;
-    pXML->tagDepthSeek  = 0;
-    pXML->error         = TRDP_NO_ERR;
-    return TRDP_NO_ERR;
+    return trdp_XMLIndex(pXML);
 }
 
 /**********************************************************************************************************************/
 /** Opens the XML parsing from a buffer (string stream).
+ *    The buffer is copied, the caller may release it after tau_prepareXmlMem.
  *
  *  @param[in]      pXML        Pointer to local data
  *  @param[in]      pBuffer     Pointer to XML stream buffer
  *  @param[in]      bufSize     Size of XML stream buffer
  *
+ *  @retval         TRDP_NO_ERR
  *  @retval         TRDP_IO_ERR
+ *  @retval         TRDP_MEM_ERR
+ *  @retval         TRDP_XML_PARSER_ERR
  */
 TRDP_ERR_T trdp_XMLMemOpen (
     XML_HANDLE_T    *pXML,
     const char      *pBuffer,
     size_t          bufSize)
 {
-#ifdef HAS_FMEMOPEN
-#ifdef __APPLE__
-    if (__builtin_available(macOS 10.13, *))
-#endif
-    if ((pXML->infile = fmemopen((void *)pBuffer, bufSize, "rb")) == NULL)
+    TRDP_ERR_T  err;
+    char        *pCopy;
+
+    memset(pXML, 0, sizeof(XML_HANDLE_T));
+
+    if ((pBuffer == NULL) || (bufSize >= UINT_MAX))
     {
         vos_printLogStr(VOS_LOG_ERROR, "XML stream could not be opened for reading\n");
         return TRDP_IO_ERR;
     }
+    pCopy = (char *) malloc(bufSize + 1u);
+    if (pCopy == NULL)
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "XML stream could not be copied\n");
+        return TRDP_MEM_ERR;
+    }
+    memcpy(pCopy, pBuffer, bufSize);
+    pXML->pDoc      = pCopy;
+    pXML->docSize   = (UINT32) bufSize;
+    pXML->allocated = 1;
 
-    pXML->tagDepth      = 0;
-    pXML->tagDepthSeek  = 0;
-    pXML->error         = TRDP_NO_ERR;
-    return TRDP_NO_ERR;
-#else
-    /* Create and open a temporary file */
-    pXML->infile = tmpfile();               /* Note: Needs admin rights under VISTA!    */
-    if (pXML->infile != NULL)
+    err = trdp_XMLBuildIndex(pXML);
+    if (err != TRDP_NO_ERR)
     {
-        /* Write to temp file */
-    	if (fwrite(pBuffer, 1, bufSize, pXML->infile) == bufSize) {
-    		/* prepare for reading */
-    		trdp_XMLRewind (pXML);
-    		return TRDP_NO_ERR;
-    	}
+        trdp_XMLClose(pXML);
+        return err;
     }
-    vos_printLogStr(VOS_LOG_ERROR, "Temporary XML file could not be opened to write\n");
-    return TRDP_IO_ERR;
-#endif
+
+    trdp_XMLRewind(pXML);
+    return TRDP_NO_ERR;
 }
 
 /**********************************************************************************************************************/
@@ -383,18 +595,16 @@ TRDP_ERR_T trdp_XMLMemOpen (
 void trdp_XMLRewind (
     XML_HANDLE_T *pXML)
 {
-    if (pXML->infile == NULL)
+    if ((pXML->pDoc == NULL) || (pXML->pNodes == NULL))
     {
         pXML->error = TRDP_XML_PARSER_ERR;
     }
-    else if (fseek(pXML->infile, 0, SEEK_SET) == -1)
-    {
-        pXML->error = TRDP_IO_ERR;
-    }
     else
     {
-        pXML->tagDepth      = 0;
         pXML->tagDepthSeek  = 0;
+        pXML->container[0]  = XML_NO_NODE;
+        pXML->current[0]    = 0u;           /* the document, entered by the first trdp_XMLEnter */
+        pXML->pos           = pXML->docSize;
         pXML->error         = TRDP_NO_ERR;
     }
 }
@@ -409,7 +619,23 @@ void trdp_XMLRewind (
 void trdp_XMLClose (
     XML_HANDLE_T *pXML)
 {
-    fclose(pXML->infile);
+#ifdef POSIX
+    if (pXML->mapped)
+    {
+        (void) munmap((void *) pXML->pDoc, (size_t) pXML->docSize);
+    }
+#endif
+    if (pXML->allocated)
+    {
+        free((void *) pXML->pDoc);
+    }
+    free(pXML->pNodes);
+    pXML->pDoc      = NULL;
+    pXML->docSize   = 0u;
+    pXML->mapped    = 0;
+    pXML->allocated = 0;
+    pXML->pNodes    = NULL;
+    pXML->noOfNodes = 0u;
 }
 
 /**********************************************************************************************************************/
@@ -428,31 +654,30 @@ int trdp_XMLSeekStartTagAny (
     char            *tag,
     int             maxlen)
 {
-    XML_TOKEN_T token;
-    int         ret = 99;
+    UINT32 node = trdp_XMLFollowing(pXML);
+    UINT32 len;
 
-    while (ret == 99)
+    if (node == XML_NO_NODE)
     {
-        token = trdp_XMLNextTokenHl(pXML);
-
-        if (token == TOK_EOF)
-        {
-            ret = -1;            /* End of file, interrupt */
-        }
-        else if (pXML->tagDepth < (pXML->tagDepthSeek - 1))
+        if ((pXML->tagDepthSeek > 0) && (pXML->tagDepthSeek < MAX_XML_DEPTH))
         {
-            ret = -2;            /* No more tokens on this depth, interrupt */
+            pXML->current[pXML->tagDepthSeek] = XML_END_NODE;
         }
-        else if ((pXML->tagDepth == pXML->tagDepthSeek) && (token == TOK_START_TAG))
-        {
-            /* We are on the correct depth and have found a start tag */
-            vos_strncpy(tag, pXML->tokenTag, (UINT32) maxlen);
-            ret = 0;
-        }
-        /* else ignore */
+        pXML->pos = pXML->docSize;
+        return (pXML->tagDepthSeek == 1) ? -1 : -2;     /* End of file or no more tags on this depth */
     }
 
-    return ret;
+    pXML->current[pXML->tagDepthSeek]   = node;
+    pXML->pos                           = pXML->pNodes[node].attrOffset;
+
+    len = pXML->pNodes[node].nameLen;
+    if (len > (UINT32) (maxlen - 1))
+    {
+        len = (UINT32) (maxlen - 1);
+    }
+    memcpy(tag, pXML->pDoc + pXML->pNodes[node].nameOffset, len);
+    tag[len] = 0;
+    return 0;
 }
 
 /**********************************************************************************************************************/
@@ -468,54 +693,54 @@ int trdp_XMLSeekStartTag (
     XML_HANDLE_T    *pXML,
     const char      *tag)
 {
-    int     ret;
-    char    buf[MAX_TAG_LEN + 1];
-    do
+    UINT32 node;
+
+    for (node = trdp_XMLFollowing(pXML); node != XML_NO_NODE; node = pXML->pNodes[node].nextSibling)
     {
-        ret = trdp_XMLSeekStartTagAny(pXML, buf, sizeof(buf));
+        if (trdp_XMLIsTag(pXML, node, tag))
+        {
+            pXML->current[pXML->tagDepthSeek]   = node;
+            pXML->pos                           = pXML->pNodes[node].attrOffset;
+            return 0;
+        }
     }
-    while ((ret == 0) && (strcmp(buf, tag) != 0));
 
-    return ret;
+    if ((pXML->tagDepthSeek > 0) && (pXML->tagDepthSeek < MAX_XML_DEPTH))
+    {
+        pXML->current[pXML->tagDepthSeek] = XML_END_NODE;
+    }
+    pXML->pos = pXML->docSize;
+    return (pXML->tagDepthSeek == 1) ? -1 : -2;
 }
 
 /**********************************************************************************************************************/
-/** Count a specific tag
+/** Count a specific tag on the current depth, following the current position
  *
  *  @param[in]      pXML        Pointer to local data
  *  @param[in]      tag         Tag to count
  *
- *  @retval         0           if found
- *                  !=0         if not found
+ *  @retval         number of tags found
  */
 int trdp_XMLCountStartTag (
     XML_HANDLE_T    *pXML,
     const char      *tag)
 {
-    int             ret;
-    char            buf[MAX_TAG_LEN + 1u];
-    int             count = 0;
-
-    XML_HANDLE_T    safe        = *pXML;
-    off_t           last_read   = ftell(pXML->infile);
+    UINT32  node;
+    int     count = 0;
 
-    do
+    for (node = trdp_XMLFollowing(pXML); node != XML_NO_NODE; node = pXML->pNodes[node].nextSibling)
     {
-        ret = trdp_XMLSeekStartTagAny(pXML, buf, sizeof(buf));
-        if (ret == 0 && strcmp(buf, tag) == 0)
+        if (trdp_XMLIsTag(pXML, node, tag))
         {
             count++;
         }
     }
-    while (ret == 0);
-
-    *pXML = safe;
-    fseek(pXML->infile, (long) last_read, SEEK_SET);
     return count;
 }
 
 /**********************************************************************************************************************/
 /** Enter level in XML file
+ *    The element found last on the current level becomes the container of the new level.
  *
  *  @param[in]      pXML        Pointer to local data
  *
@@ -525,6 +750,13 @@ void trdp_XMLEnter (
     XML_HANDLE_T *pXML)
 {
     pXML->tagDepthSeek++;
+    if ((pXML->tagDepthSeek > 0) && (pXML->tagDepthSeek < MAX_XML_DEPTH))
+    {
+        UINT32 container = pXML->current[pXML->tagDepthSeek - 1];
+
+        pXML->container[pXML->tagDepthSeek] = (container == XML_END_NODE) ? XML_NO_NODE : container;
+        pXML->current[pXML->tagDepthSeek]   = XML_NO_NODE;
+    }
 }
 
 /**********************************************************************************************************************/
@@ -537,7 +769,10 @@ void trdp_XMLEnter (
 void trdp_XMLLeave (
     XML_HANDLE_T *pXML)
 {
-    pXML->tagDepthSeek--;
+    if (pXML->tagDepthSeek > 0)
+    {
+        pXML->tagDepthSeek--;
+    }
 }
 
 /**********************************************************************************************************************/
@@ -558,17 +793,18 @@ XML_TOKEN_T trdp_XMLGetAttribute (
     CHAR8           *value)
 {
     XML_TOKEN_T token;
+    UINT32      pos = pXML->pos;
 
-    token = trdp_XMLNextTokenHl(pXML);
+    token = trdp_XMLNextToken(pXML);
 
     if (token == TOK_ID)
     {
         vos_strncpy(attribute, pXML->tokenValue, MAX_TOK_LEN - 1u);
-        token = trdp_XMLNextTokenHl(pXML);
+        token = trdp_XMLNextToken(pXML);
 
         if (token == TOK_EQUAL)
         {
-            token = trdp_XMLNextTokenHl(pXML);
+            token = trdp_XMLNextToken(pXML);
 
             if (token == TOK_ID)
             {
@@ -588,6 +824,10 @@ XML_TOKEN_T trdp_XMLGetAttribute (
             }
         }
     }
+    else
+    {
+        pXML->pos = pos;    /* stay at the end of the tag, repeated calls return the same token */
+    }
 
     return token;
 }
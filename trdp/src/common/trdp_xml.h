@@ -17,6 +17,8 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: trdp_XMLLoad and trdp_XMLIndex for the binary configuration cache
+ *      AG 2026-10-16: Document held in memory (mmap'ed file or stream buffer) with an element index built in one pass
  *      BL 2019-01-23: Ticket #231: XML config from stream buffer
  *      BL 2016-02-11: Ticket #102: Replacing libxml2
  *
@@ -48,6 +50,10 @@
 #define MAX_URI_LEN     101u         /* Max length of a URI string */
 #define MAX_TOK_LEN     124u         /* Max length of token/attribute string */
 #define MAX_TAG_LEN     132u         /* Max length of tag string */
+#define MAX_XML_DEPTH   32           /* Max nesting depth of elements */
+
+#define XML_NO_NODE     0xFFFFFFFFu  /* No element / before the first element of a level */
+#define XML_END_NODE    0xFFFFFFFEu  /* All elements of a level have been visited */
 
 /* Tokens */
 typedef enum
@@ -67,14 +73,31 @@ typedef enum
     TOK_ATTRIBUTE       /* "<" character    */
 } XML_TOKEN_T;
 
+/* Element index entry, node 0 is the document itself */
+typedef struct
+{
+    UINT32  nameOffset;                     /* Offset of the tag name in the document */
+    UINT32  attrOffset;                     /* Offset behind the tag name, where the attributes start */
+    UINT32  firstChild;                     /* Index of the first child element or XML_NO_NODE */
+    UINT32  nextSibling;                    /* Index of the next element on the same level or XML_NO_NODE */
+    UINT32  nameLen;                        /* Length of the tag name */
+} XML_NODE_T;
+
+/* The handle is copied by value (tau_xsession_load), it must not point into itself */
 typedef struct XML_HANDLE
 {
-    FILE    *infile;
-    char    tokenValue[MAX_TOK_LEN];
-    int     tagDepth;
-    int     tagDepthSeek;
-    char    tokenTag[MAX_TAG_LEN + 1];
-    int     error;
+    const char  *pDoc;                      /* Document in memory (mapped file, read file or stream buffer) */
+    UINT32      docSize;                    /* Size of the document */
+    UINT32      pos;                        /* Read position of trdp_XMLGetAttribute */
+    int         mapped;                     /* pDoc is a mapped file */
+    int         allocated;                  /* pDoc was read or copied into heap memory */
+    XML_NODE_T  *pNodes;                    /* Element index in document order */
+    UINT32      noOfNodes;                  /* Used entries of the element index */
+    UINT32      container[MAX_XML_DEPTH];   /* Element entered on each level */
+    UINT32      current[MAX_XML_DEPTH];     /* Element last found on each level */
+    char        tokenValue[MAX_TOK_LEN];
+    int         tagDepthSeek;               /* Current level */
+    int         error;
 } XML_HANDLE_T, *TRDP_XML_HANDLE_T;
 
 /*******************************************************************************
@@ -84,6 +107,11 @@ typedef struct XML_HANDLE
 TRDP_ERR_T  trdp_XMLOpen (XML_HANDLE_T  *pXML,
                           const char    *file);
 
+TRDP_ERR_T  trdp_XMLLoad (XML_HANDLE_T  *pXML,
+                          const char    *file);
+
+TRDP_ERR_T  trdp_XMLIndex (XML_HANDLE_T *pXML);
+
 TRDP_ERR_T  trdp_XMLMemOpen (XML_HANDLE_T   *pXML,
                              const char     *pBuffer,
                              size_t         bufSize);
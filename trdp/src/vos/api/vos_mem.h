@@ -18,6 +18,7 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: vos_memAllocNoInit(), per-thread magazines (VOS_MEM_MAGAZINE_SIZE)
  *      SB 2021-08.09: Ticket #375 Replaced parameters of vos_memCount to prevent alignment issues
  *      BL 2019-09-06: Default pre-allocated blocks for HIGH_PERF raised again
  *      BL 2019-08-15: Default pre-allocated blocks for HIGH_PERF raised
@@ -49,6 +50,13 @@ extern "C" {
 
 #define VOS_MEM_NBLOCKSIZES         15u  /**< No of pre-defined block sizes */
 
+#ifndef VOS_MEM_MAGAZINE_SIZE
+#define VOS_MEM_MAGAZINE_SIZE       8u   /**< Max. no. of free blocks per size cached by a thread, 0 disables caching */
+#endif
+#ifndef VOS_MEM_MAGAZINE_MAX_BLOCK
+#define VOS_MEM_MAGAZINE_MAX_BLOCK  2048u /**< Largest block size cached by a thread */
+#endif
+
 /** Queue policy matching pthread/Posix defines    */
 typedef enum
 {
@@ -167,6 +175,17 @@ EXT_DECL VOS_ERR_T vos_memInit (
 EXT_DECL void vos_memDelete (
     UINT8 *pMemoryArea);
 
+/**********************************************************************************************************************/
+/** Return the number of the current memory area.
+ *  The number changes with each vos_memInit()/vos_memDelete() of a memory area. Blocks allocated while another
+ *  number was current must not be accessed any more.
+ *
+ *  @retval         number of the memory area, 0 if standard heap memory is used or the unit is not initialised
+ */
+
+EXT_DECL UINT32 vos_memGeneration (
+    void);
+
 /**********************************************************************************************************************/
 /** Allocate a block of memory (from memory area above).
  *
@@ -179,6 +198,18 @@ EXT_DECL void vos_memDelete (
 EXT_DECL UINT8 *vos_memAlloc (
     UINT32 size);
 
+/**********************************************************************************************************************/
+/** Allocate a block of memory (from memory area above) without clearing it.
+ *
+ *  @param[in]      size            Size of requested block
+ *
+ *  @retval         Pointer to memory area
+ *  @retval         NULL if no memory available
+ */
+
+EXT_DECL UINT8 *vos_memAllocNoInit (
+    UINT32 size);
+
 /**********************************************************************************************************************/
 /** Deallocate a block of memory (from memory area above).
  *
@@ -17,6 +17,9 @@
 /*
  * $Id$
  *
+ *      AG 2026-10-16: Socket event sets (vos_sockEventsCreate et al.)
+ *      AG 2026-10-16: Batched UDP transmission (vos_sockSendUDPBatch)
+ *      AG 2026-10-16: Batched UDP reception (vos_sockReceiveUDPBatch)
  *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1', it is provided with the highest socket, and VOS implementation of the function will add the '+1' (if needed)
  *     AHW 2021-05-06: Ticket #322 Subscriber multicast message routing in multi-home device
  *      Tz 2019-11-24: added headers for PikeOS-Posix
@@ -125,6 +128,14 @@ extern "C" {
 #endif
 #endif
 
+#ifndef VOS_MAX_UDP_BATCH           /**< Upper limit of datagrams handled by one vos_sock...UDPBatch() call     */
+#define VOS_MAX_UDP_BATCH   32u
+#endif
+
+#ifndef VOS_MAX_SOCK_EVENTS         /**< Upper limit of ready sockets reported by one vos_sockEventsWait() call */
+#define VOS_MAX_SOCK_EVENTS 64u
+#endif
+
 #define VOS_INADDR_ANY      INADDR_ANY
 
 #define VOS_DEFAULT_IFACE   cDefaultIface
@@ -191,6 +202,20 @@ typedef struct
 
 typedef fd_set VOS_FDS_T;
 
+/** Handle of a socket event set (epoll instance on Linux) */
+typedef struct VOS_SOCK_EVENTS *VOS_SOCK_EVENTS_T;
+
+/** Descriptor for one datagram of a batched UDP read or write */
+typedef struct
+{
+    UINT8   *pBuffer;       /**< pointer to the receive / send buffer                   */
+    UINT32  size;           /**< In: size of the buffer, Out: no of bytes received/sent */
+    UINT32  srcIPAddr;      /**< source IP address                                      */
+    UINT16  srcIPPort;      /**< source port                                            */
+    UINT32  dstIPAddr;      /**< destination IP address (own IP or MC group)            */
+    UINT32  srcIFAddr;      /**< IP address of the receiving network interface          */
+} VOS_UDP_MSG_T;
+
 typedef struct
 {
     CHAR8           name[VOS_MAX_IF_NAME_SIZE]; /**< interface adapter name         */
@@ -356,6 +381,87 @@ EXT_DECL INT32 vos_select (
     VOS_FDS_T       *pErrorFD,
     VOS_TIMEVAL_T   *pTimeOut);
 
+/**********************************************************************************************************************/
+/** Create a socket event set.
+ *  Sockets are registered once with vos_sockEventsAdd(), vos_sockEventsWait() then reports the readable ones,
+ *  without the FD_SETSIZE limit and the per call cost of vos_select(). A closed socket leaves the set.
+ *
+ *  @param[out]     pEvents         pointer to the handle of the event set
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error
+ *  @retval         VOS_MEM_ERR     out of memory or descriptors
+ *  @retval         VOS_SOCK_ERR    socket event sets are not supported by the target, use vos_select()
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsCreate (
+    VOS_SOCK_EVENTS_T *pEvents);
+
+/**********************************************************************************************************************/
+/** Delete a socket event set.
+ *  The registered sockets are not closed.
+ *
+ *  @param[in]      events          handle of the event set
+ */
+
+EXT_DECL void vos_sockEventsDelete (
+    VOS_SOCK_EVENTS_T events);
+
+/**********************************************************************************************************************/
+/** Register a socket with an event set.
+ *  The socket is supervised for readability (level triggered) until it is removed or closed.
+ *
+ *  @param[in]      events          handle of the event set
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      tag             value reported by vos_sockEventsWait() when the socket is readable
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error, socket already registered
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsAdd (
+    VOS_SOCK_EVENTS_T   events,
+    VOS_SOCK_T          sock,
+    UINT32              tag);
+
+/**********************************************************************************************************************/
+/** Remove a socket from an event set.
+ *
+ *  @param[in]      events          handle of the event set
+ *  @param[in]      sock            socket descriptor
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error, socket not registered
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsRemove (
+    VOS_SOCK_EVENTS_T   events,
+    VOS_SOCK_T          sock);
+
+/**********************************************************************************************************************/
+/** Wait for readable sockets of an event set.
+ *  Returns after the time out or as soon as at least one registered socket is readable; an interrupted wait
+ *  returns without ready sockets.
+ *
+ *  @param[in]      events          handle of the event set
+ *  @param[in]      pTimeOut        maximum time to wait, NULL to wait forever
+ *  @param[out]     pTags           tags of the readable sockets
+ *  @param[in,out]  pCount          In: size of pTags (max. VOS_MAX_SOCK_EVENTS), Out: number of readable sockets
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error
+ *  @retval         VOS_IO_ERR      wait failed
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsWait (
+    VOS_SOCK_EVENTS_T   events,
+    const VOS_TIMEVAL_T *pTimeOut,
+    UINT32              *pTags,
+    UINT32              *pCount);
+
 /*    Sockets    */
 
 /**********************************************************************************************************************/
@@ -514,6 +620,31 @@ EXT_DECL VOS_ERR_T vos_sockSendUDP (
     UINT32      ipAddress,
     UINT16      port);
 
+/**********************************************************************************************************************/
+/** Send a batch of UDP datagrams.
+ *  Send up to *pCount datagrams (max. VOS_MAX_UDP_BATCH) to the same port with as few system calls as the target
+ *  supports (sendmmsg() on Linux). Targets without batched transmission send one datagram after the other.
+ *  For each descriptor, pBuffer, size and dstIPAddr must be set; size is set to the number of bytes sent on return.
+ *  A datagram which could not be sent (e.g. unreachable destination) gets size 0 and is skipped, the following ones
+ *  are still sent. Sending stops only if the socket would block.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in,out]  pMsgs           array of send descriptors
+ *  @param[in,out]  pCount          In: number of descriptors, Out: number of descriptors processed
+ *  @param[in]      port            destination port
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      at least one datagram could not be sent (its size is set to 0)
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPBatch (
+    VOS_SOCK_T      sock,
+    VOS_UDP_MSG_T   *pMsgs,
+    UINT32          *pCount,
+    UINT16          port);
+
 /**********************************************************************************************************************/
 /** Receive UDP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -549,6 +680,30 @@ EXT_DECL VOS_ERR_T vos_sockReceiveUDP (
     UINT32      *pSrcIFAddr,
     BOOL8       peek);
 
+/**********************************************************************************************************************/
+/** Receive a batch of UDP datagrams.
+ *  Read up to *pCount datagrams with as few system calls as the target supports (recvmmsg() on Linux). Targets
+ *  without batched reception return at most one datagram per call.
+ *  In blocking mode, the call blocks until the first datagram arrives and then returns all datagrams queued so far.
+ *  In non-blocking mode, VOS_BLOCK_ERR is returned if no data is available.
+ *  Source IP, source port, destination IP and receiving interface are reported for each datagram.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in,out]  pMsgs           array of receive descriptors, buffers and sizes to be set by the caller
+ *  @param[in,out]  pCount          In: number of descriptors, Out: number of datagrams received
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be read
+ *  @retval         VOS_NODATA_ERR  no data
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveUDPBatch (
+    VOS_SOCK_T      sock,
+    VOS_UDP_MSG_T   *pMsgs,
+    UINT32          *pCount);
+
 /**********************************************************************************************************************/
 /** Bind a socket to an address and port.
  *
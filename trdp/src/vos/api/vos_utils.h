@@ -17,6 +17,7 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: vos_copyNetOrder16/32/64() for array marshalling
  *      A 2023-01-13: Ticket #413 In Windows export gPDebugFunction and gRefCon
  *     AHW 2023-01-11: Lint warnigs
  *      BL 2019-01-23: Ticket #231: XML config from stream buffer
@@ -227,6 +228,32 @@ EXT_DECL UINT32 vos_sc32 (
     const UINT8 *pData,
     UINT32      dataLen);
 
+/**********************************************************************************************************************/
+/** Copy 16, 32 or 64 bit items converting between host and network byte order.
+ *  The conversion is symmetric, the same functions are used for marshalling and unmarshalling. On little endian
+ *  hosts the bytes are swapped by SSSE3/AVX2 (selected at run time) or NEON kernels where available.
+ *
+ *  @param[out]         pDst            Destination, need not be aligned
+ *  @param[in]          pSrc            Source, need not be aligned, must not overlap the destination
+ *  @param[in]          noOfItems       Number of items
+ *  @retval             none
+ */
+
+EXT_DECL void vos_copyNetOrder16 (
+    UINT8       *pDst,
+    const UINT8 *pSrc,
+    UINT32      noOfItems);
+
+EXT_DECL void vos_copyNetOrder32 (
+    UINT8       *pDst,
+    const UINT8 *pSrc,
+    UINT32      noOfItems);
+
+EXT_DECL void vos_copyNetOrder64 (
+    UINT8       *pDst,
+    const UINT8 *pSrc,
+    UINT32      noOfItems);
+
 /**********************************************************************************************************************/
 /** Initialize the vos library.
  *  This is used to set the output function for all VOS error and debug output.
@@ -20,6 +20,7 @@
  *
  * Changes:
  * 
+ *      AG 2026-10-16: Per-thread magazines of free blocks, size class lookup table, vos_memAllocNoInit()
  *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, CWE: easier init of gMem
  *      SB 2021-08.09: Ticket #375 Replaced parameters of vos_memCount to prevent alignment issues
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
@@ -92,6 +93,32 @@ typedef struct
 
 } MEM_STATISTIC_T;
 
+#if defined (POSIX) && defined (__GNUC__) && (VOS_MEM_MAGAZINE_SIZE > 0)
+#define VOS_MEM_MAGAZINES               /* Per-thread caches of free blocks */
+#define VOS_MEM_CNT_ADD(cnt, val)   (void) __atomic_add_fetch(&(cnt), (val), __ATOMIC_RELAXED)
+#define VOS_MEM_CNT_SUB(cnt, val)   (void) __atomic_sub_fetch(&(cnt), (val), __ATOMIC_RELAXED)
+#else
+#define VOS_MEM_CNT_ADD(cnt, val)   (cnt) += (val)
+#define VOS_MEM_CNT_SUB(cnt, val)   (cnt) -= (val)
+#endif
+
+#define VOS_MEM_CLASS_SHIFT     6u          /* Granule of the size class table: 64 Bytes */
+#define VOS_MEM_CLASS_ENTRIES   ((131072u >> VOS_MEM_CLASS_SHIFT) + 1u)
+
+/* Per-thread cache of free blocks, one list per block size */
+typedef struct memMagazine
+{
+    struct memMagazine  *pNext;                         /* Next magazine (of another thread) */
+    MEM_BLOCK_T         *pFirst[VOS_MEM_NBLOCKSIZES];   /* Cached free blocks */
+    UINT32              cnt[VOS_MEM_NBLOCKSIZES];       /* No of cached blocks (upper bound) */
+} MEM_MAGAZINE_T;
+
+typedef struct
+{
+    MEM_MAGAZINE_T  *pMagazine;         /* Magazine of the thread */
+    UINT32          generation;         /* Memory area the magazine belongs to */
+} MEM_THREAD_CACHE_T;
+
 typedef struct
 {
     struct VOS_MUTEX    mutex;          /* Memory allocation semaphore */
@@ -108,6 +135,9 @@ typedef struct
         UINT32      size;               /* Block size */
         MEM_BLOCK_T *pFirst;            /* Pointer to first free block */
     } freeBlock[VOS_MEM_NBLOCKSIZES];
+    UINT8           sizeClass[VOS_MEM_CLASS_ENTRIES];   /* Smallest size class per size granule */
+    MEM_MAGAZINE_T  *pMagazines;        /* Magazines of all threads */
+    UINT32          generation;         /* Number of this memory area, 0 while not initialised */
     MEM_STATISTIC_T memCnt;             /* Statistic counters */
 } MEM_CONTROL_T;
 
@@ -151,6 +181,371 @@ const UINT32    cQueueMagic = 0xE5E1E5E1;
  */
 
 static MEM_CONTROL_T gMem;
+static UINT32 sMemGeneration = 0u;      /* incremented by each vos_memInit() */
+
+#ifdef VOS_MEM_MAGAZINES
+static __thread MEM_THREAD_CACHE_T  sThreadCache;
+static pthread_key_t                sThreadCacheKey;
+static pthread_once_t               sThreadCacheOnce = PTHREAD_ONCE_INIT;
+#endif
+
+/***********************************************************************************************************************
+ * LOCAL FUNCTIONS
+ */
+
+static UINT8 *vos_memAllocBlock (
+    UINT32  size,
+    BOOL8   clear);
+
+/**********************************************************************************************************************/
+/** Find the smallest block size class for a size.
+ *  The table lookup yields the class of the smallest size of a VOS_MEM_CLASS_GRANULE range, classes smaller than
+ *  the granule are stepped over.
+ *
+ *  @param[in]      size            Size of requested block (> 0)
+ *
+ *  @retval         index into gMem.freeBlock, gMem.noOfBlocks if no block size is big enough
+ */
+
+static UINT32 vos_memSizeClass (
+    UINT32 size)
+{
+    UINT32 i;
+    UINT32 bucket = (size - 1u) >> VOS_MEM_CLASS_SHIFT;
+
+    if (bucket >= VOS_MEM_CLASS_ENTRIES)
+    {
+        bucket = VOS_MEM_CLASS_ENTRIES - 1u;
+    }
+    i = gMem.sizeClass[bucket];
+    while ((i < gMem.noOfBlocks) && (size > gMem.freeBlock[i].size))
+    {
+        i++;
+    }
+    return i;
+}
+
+#ifdef VOS_MEM_MAGAZINES
+/**********************************************************************************************************************/
+/** Return the magazine of the calling thread.
+ *  Magazines of a previous memory area (before vos_memDelete/vos_memInit) are ignored.
+ *
+ *  @retval         Pointer to magazine or NULL
+ */
+
+static MEM_MAGAZINE_T *vos_memMagazine (void)
+{
+    if ((gMem.generation != 0u) && (sThreadCache.generation == gMem.generation))
+    {
+        return sThreadCache.pMagazine;
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/** Take a block from a magazine.
+ *  Only called by the owning thread. Blocks may be reclaimed concurrently by vos_memReclaim().
+ *
+ *  @param[in]      pMagazine       magazine of the calling thread
+ *  @param[in]      i               size class
+ *
+ *  @retval         Pointer to block or NULL
+ */
+
+static MEM_BLOCK_T *vos_memMagazinePop (
+    MEM_MAGAZINE_T  *pMagazine,
+    UINT32          i)
+{
+    MEM_BLOCK_T *pBlock = __atomic_load_n(&pMagazine->pFirst[i], __ATOMIC_ACQUIRE);
+
+    while ((pBlock != NULL) &&
+           !__atomic_compare_exchange_n(&pMagazine->pFirst[i], &pBlock, pBlock->pNext, FALSE,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        ;   /* list was reclaimed meanwhile, pBlock holds the new head */
+    }
+    if ((pBlock != NULL) && (pMagazine->cnt[i] > 0u))
+    {
+        pMagazine->cnt[i]--;
+    }
+    return pBlock;
+}
+
+/**********************************************************************************************************************/
+/** Put a block into a magazine.
+ *
+ *  @param[in]      pMagazine       magazine of the calling thread
+ *  @param[in]      i               size class
+ *  @param[in]      pBlock          free block
+ */
+
+static void vos_memMagazinePush (
+    MEM_MAGAZINE_T  *pMagazine,
+    UINT32          i,
+    MEM_BLOCK_T     *pBlock)
+{
+    MEM_BLOCK_T *pFirst = __atomic_load_n(&pMagazine->pFirst[i], __ATOMIC_ACQUIRE);
+
+    do
+    {
+        pBlock->pNext = pFirst;
+    }
+    while (!__atomic_compare_exchange_n(&pMagazine->pFirst[i], &pFirst, pBlock, FALSE,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+    pMagazine->cnt[i]++;
+}
+
+/**********************************************************************************************************************/
+/** Return all blocks of one size class of a magazine to the free block list.
+ *  The memory semaphore must be held.
+ *
+ *  @param[in]      pMagazine       magazine
+ *  @param[in]      i               size class
+ *
+ *  @retval         number of blocks returned
+ */
+
+static UINT32 vos_memMagazineFlush (
+    MEM_MAGAZINE_T  *pMagazine,
+    UINT32          i)
+{
+    UINT32      cnt     = 0u;
+    MEM_BLOCK_T *pBlock = __atomic_exchange_n(&pMagazine->pFirst[i], NULL, __ATOMIC_ACQ_REL);
+
+    while (pBlock != NULL)
+    {
+        MEM_BLOCK_T *pNext = pBlock->pNext;
+
+        pBlock->pNext = gMem.freeBlock[i].pFirst;
+        gMem.freeBlock[i].pFirst = pBlock;
+        pBlock = pNext;
+        cnt++;
+    }
+    if (sThreadCache.pMagazine == pMagazine)
+    {
+        pMagazine->cnt[i] = 0u;     /* the counter belongs to the owner, others leave it as upper bound */
+    }
+    return cnt;
+}
+
+/**********************************************************************************************************************/
+/** Return the cached blocks of all threads to the free block lists.
+ *  Called if the memory area is exhausted, so the cached blocks never reduce the usable memory.
+ *  The memory semaphore must be held.
+ *
+ *  @retval         number of blocks returned
+ */
+
+static UINT32 vos_memReclaim (void)
+{
+    UINT32          i;
+    UINT32          cnt = 0u;
+    MEM_MAGAZINE_T  *pMagazine;
+
+    for (pMagazine = gMem.pMagazines; pMagazine != NULL; pMagazine = pMagazine->pNext)
+    {
+        for (i = 0u; i < gMem.noOfBlocks; i++)
+        {
+            cnt += vos_memMagazineFlush(pMagazine, i);
+        }
+    }
+    return cnt;
+}
+#endif
+
+/**********************************************************************************************************************/
+/** Take a free block of a size class from the free block list or the free memory area.
+ *  If no block of this size is left, the next bigger free block is used.
+ *  The memory semaphore must be held.
+ *
+ *  @param[in,out]  pIdx            size class, updated if a bigger block was taken
+ *  @param[in]      size            requested size (for logging)
+ *
+ *  @retval         Pointer to block or NULL
+ */
+
+static MEM_BLOCK_T *vos_memTakeBlock (
+    UINT32  *pIdx,
+    UINT32  size)
+{
+    UINT32      i           = *pIdx;
+    UINT32      blockSize   = gMem.freeBlock[i].size;
+    MEM_BLOCK_T *pBlock     = gMem.freeBlock[i].pFirst;
+
+    /* Check if there is a free block ready */
+    if (pBlock != NULL)
+    {
+        /* There is, get it. */
+        /* Set start pointer to next free block in the linked list */
+        gMem.freeBlock[i].pFirst = pBlock->pNext;
+        return pBlock;
+    }
+
+    /* There was no suitable free block, create one from the free area */
+
+    /* Enough free memory left ? */
+    if ((gMem.allocSize + blockSize + sizeof(MEM_BLOCK_T)) < gMem.memSize)
+    {
+        pBlock = (MEM_BLOCK_T *) gMem.pFreeArea; /*lint !e826 Allocation of MEM_BLOCK from free area*/
+
+        gMem.pFreeArea  = (UINT8 *) gMem.pFreeArea + (sizeof(MEM_BLOCK_T) + blockSize);
+        gMem.allocSize  += blockSize + sizeof(MEM_BLOCK_T);
+        gMem.memCnt.blockCnt[i]++;
+        return pBlock;
+    }
+
+#ifdef VOS_MEM_MAGAZINES
+    /* Blocks cached by the threads are still available */
+    if ((vos_memReclaim() > 0u) && (gMem.freeBlock[i].pFirst != NULL))
+    {
+        pBlock = gMem.freeBlock[i].pFirst;
+        gMem.freeBlock[i].pFirst = pBlock->pNext;
+        return pBlock;
+    }
+#endif
+
+    for (i++; i < gMem.noOfBlocks; i++)
+    {
+        pBlock = gMem.freeBlock[i].pFirst;
+        if (pBlock != NULL)
+        {
+            vos_printLog(
+                VOS_LOG_ERROR,
+                "vos_memAlloc() Used a bigger buffer size=%d asked size=%d\n",
+                gMem.freeBlock[i].size,
+                size);
+            /* There is, get it. */
+            /* Set start pointer to next free block in the linked list */
+            gMem.freeBlock[i].pFirst = pBlock->pNext;
+            *pIdx = i;
+            return pBlock;
+        }
+    }
+    return NULL;
+}
+
+#ifdef VOS_MEM_MAGAZINES
+/**********************************************************************************************************************/
+/** Release the magazine of a terminating thread.
+ *
+ *  @param[in]      pArg            pointer to the thread's cache
+ */
+
+static void vos_memThreadExit (
+    void *pArg)
+{
+    MEM_THREAD_CACHE_T  *pCache = (MEM_THREAD_CACHE_T *) pArg;
+    MEM_MAGAZINE_T      *pMagazine;
+    MEM_MAGAZINE_T      * *ppIter;
+    UINT32              i;
+
+    if ((pCache == NULL) ||
+        (pCache->pMagazine == NULL) ||
+        (gMem.generation == 0u) ||
+        (pCache->generation != gMem.generation) ||
+        (vos_mutexLock(&gMem.mutex) != VOS_NO_ERR))
+    {
+        return;
+    }
+
+    pMagazine = pCache->pMagazine;
+    for (i = 0u; i < gMem.noOfBlocks; i++)
+    {
+        (void) vos_memMagazineFlush(pMagazine, i);
+    }
+    for (ppIter = &gMem.pMagazines; *ppIter != NULL; ppIter = &(*ppIter)->pNext)
+    {
+        if (*ppIter == pMagazine)
+        {
+            *ppIter = pMagazine->pNext;
+            break;
+        }
+    }
+    pCache->pMagazine = NULL;
+
+    /* The magazine itself is an allocated block */
+    {
+        MEM_BLOCK_T *pBlock = (MEM_BLOCK_T *) ((UINT8 *) pMagazine - sizeof(MEM_BLOCK_T));
+
+        i = vos_memSizeClass(pBlock->size);
+        VOS_MEM_CNT_ADD(gMem.memCnt.freeSize, pBlock->size + sizeof(MEM_BLOCK_T));
+        VOS_MEM_CNT_SUB(gMem.memCnt.allocCnt, 1u);
+        pBlock->size    = 0u;
+        pBlock->pNext   = gMem.freeBlock[i].pFirst;
+        gMem.freeBlock[i].pFirst = pBlock;
+    }
+
+    if (vos_mutexUnlock(&gMem.mutex) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+}
+
+/**********************************************************************************************************************/
+/** Create the key to release the magazines of terminating threads.
+ */
+
+static void vos_memThreadKeyCreate (void)
+{
+    if (pthread_key_create(&sThreadCacheKey, vos_memThreadExit) != 0)
+    {
+        vos_printLogStr(VOS_LOG_WARNING, "vos_memInit() pthread_key_create failed\n");
+    }
+}
+
+/**********************************************************************************************************************/
+/** Refill the magazine of the calling thread with free blocks of a size class.
+ *  The magazine is created on first use. The memory semaphore must be held.
+ *
+ *  @param[in]      i               size class
+ */
+
+static void vos_memMagazineRefill (
+    UINT32 i)
+{
+    MEM_MAGAZINE_T  *pMagazine = vos_memMagazine();
+    UINT32          cnt;
+
+    if (pMagazine == NULL)
+    {
+        UINT32      idx     = vos_memSizeClass(sizeof(MEM_MAGAZINE_T));
+        MEM_BLOCK_T *pBlock;
+
+        if ((idx >= gMem.noOfBlocks) ||
+            ((gMem.freeBlock[idx].pFirst == NULL) &&
+             ((gMem.allocSize + gMem.freeBlock[idx].size + sizeof(MEM_BLOCK_T)) >= gMem.memSize)))
+        {
+            return;     /* memory is short, no caching */
+        }
+        pBlock = vos_memTakeBlock(&idx, sizeof(MEM_MAGAZINE_T));
+        if (pBlock == NULL)
+        {
+            return;
+        }
+        pBlock->size = gMem.freeBlock[idx].size;
+        VOS_MEM_CNT_SUB(gMem.memCnt.freeSize, pBlock->size + sizeof(MEM_BLOCK_T));
+        VOS_MEM_CNT_ADD(gMem.memCnt.allocCnt, 1u);
+
+        pMagazine = (MEM_MAGAZINE_T *) ((UINT8 *) pBlock + sizeof(MEM_BLOCK_T));
+        memset(pMagazine, 0, sizeof(MEM_MAGAZINE_T));
+        pMagazine->pNext    = gMem.pMagazines;
+        gMem.pMagazines     = pMagazine;
+
+        sThreadCache.pMagazine  = pMagazine;
+        sThreadCache.generation = gMem.generation;
+        (void) pthread_once(&sThreadCacheOnce, vos_memThreadKeyCreate);
+        (void) pthread_setspecific(sThreadCacheKey, &sThreadCache);
+    }
+
+    for (cnt = 0u; (cnt < VOS_MEM_MAGAZINE_SIZE / 2u) && (gMem.freeBlock[i].pFirst != NULL); cnt++)
+    {
+        MEM_BLOCK_T *pBlock = gMem.freeBlock[i].pFirst;
+
+        gMem.freeBlock[i].pFirst = pBlock->pNext;
+        vos_memMagazinePush(pMagazine, i, pBlock);
+    }
+}
+#endif
 
 /***********************************************************************************************************************
  * GLOBAL FUNCTIONS
@@ -283,6 +678,21 @@ EXT_DECL VOS_ERR_T vos_memInit (
     {
         gMem.freeBlock[i].pFirst    = (MEM_BLOCK_T *)NULL;
         gMem.freeBlock[i].size      = blockSize[i];
+    }
+
+    /* Size class lookup table */
+    for (i = 0, j = 0; i < VOS_MEM_CLASS_ENTRIES; i++)
+    {
+        while ((j < gMem.noOfBlocks) && (((i << VOS_MEM_CLASS_SHIFT) + 1u) > gMem.freeBlock[j].size))
+        {
+            j++;
+        }
+        gMem.sizeClass[i] = (UINT8) j;
+    }
+
+    /* Pre-allocate */
+    for (i = 0; i < (UINT32) VOS_MEM_NBLOCKSIZES; i++)
+    {
         max     = gMem.memCnt.preAlloc[i];
         minSize += blockSize[i];
 
@@ -313,6 +723,9 @@ EXT_DECL VOS_ERR_T vos_memInit (
         }
     }
 
+    /* Magazines are used from now on, the pre-allocated blocks stay in the free block lists */
+    gMem.generation = ++sMemGeneration;
+
     return VOS_NO_ERR;
 }
 
@@ -344,9 +757,21 @@ EXT_DECL void vos_memDelete (
     memset(&gMem, 0, sizeof(gMem));
 }
 
+/**********************************************************************************************************************/
+/** Return the number of the current memory area.
+ *
+ *  @retval         number of the memory area, 0 if standard heap memory is used or the unit is not initialised
+ */
+
+EXT_DECL UINT32 vos_memGeneration (
+    void)
+{
+    return gMem.generation;
+}
+
 /**********************************************************************************************************************/
 /** Allocate a block of memory (from memory area above).
- *  Always clears returned memory area
+ *  Always clears the requested size of the returned memory area
  *
  *  @param[in]      size            Size of requested block
  *
@@ -356,9 +781,47 @@ EXT_DECL void vos_memDelete (
 
 EXT_DECL UINT8 *vos_memAlloc (
     UINT32 size)
+{
+    return vos_memAllocBlock(size, TRUE);
+}
+
+/**********************************************************************************************************************/
+/** Allocate a block of memory (from memory area above) without clearing it.
+ *  For callers which overwrite the whole requested size anyway.
+ *
+ *  @param[in]      size            Size of requested block
+ *
+ *  @retval         Pointer to memory area
+ *  @retval         NULL if no memory available
+ */
+
+EXT_DECL UINT8 *vos_memAllocNoInit (
+    UINT32 size)
+{
+    return vos_memAllocBlock(size, FALSE);
+}
+
+/**********************************************************************************************************************/
+/** Allocate a block of memory (from memory area above).
+ *  A free block of the size class is taken from the magazine of the calling thread without locking; only if the
+ *  magazine is empty, the memory semaphore is taken and the magazine is refilled.
+ *
+ *  @param[in]      size            Size of requested block
+ *  @param[in]      clear           clear the requested size of the block
+ *
+ *  @retval         Pointer to memory area
+ *  @retval         NULL if no memory available
+ */
+
+static UINT8 *vos_memAllocBlock (
+    UINT32  size,
+    BOOL8   clear)
 {
     UINT32      i, blockSize;
-    MEM_BLOCK_T *pBlock;
+    MEM_BLOCK_T *pBlock = NULL;
+#ifdef VOS_MEM_MAGAZINES
+    MEM_MAGAZINE_T *pMagazine;
+#endif
 
     if (size == 0)
     {
@@ -371,7 +834,7 @@ EXT_DECL UINT8 *vos_memAlloc (
     if (gMem.memSize == 0 && gMem.pArea == NULL)
     {
         UINT8 *p = (UINT8 *) malloc(size);    /*lint !e421 !e586 optional use of heap memory for debugging/development */
-        if (p != NULL)
+        if ((p != NULL) && clear)
         {
             memset(p, 0, size);
         }
@@ -384,13 +847,7 @@ EXT_DECL UINT8 *vos_memAlloc (
     size = ((size + sizeof(UINT32) - 1) / sizeof(UINT32)) * sizeof(UINT32);
 
     /* Find appropriate blocksize */
-    for (i = 0; i < gMem.noOfBlocks; i++)
-    {
-        if (size <= gMem.freeBlock[i].size)
-        {
-            break;
-        }
-    }
+    i = vos_memSizeClass(size);
 
     if (i >= gMem.noOfBlocks)
     {
@@ -401,102 +858,83 @@ EXT_DECL UINT8 *vos_memAlloc (
         return NULL; /* No block size big enough */
     }
 
-    /* Get memory sempahore */
-    if (vos_mutexLock(&gMem.mutex) != VOS_NO_ERR)
+#ifdef VOS_MEM_MAGAZINES
+    pMagazine = vos_memMagazine();
+    if ((pMagazine != NULL) && (gMem.freeBlock[i].size <= VOS_MEM_MAGAZINE_MAX_BLOCK))
     {
-        gMem.memCnt.allocErrCnt++;
-
-        vos_printLogStr(VOS_LOG_ERROR, "vos_memAlloc can't get semaphore\n");
-
-        return NULL;
+        pBlock = vos_memMagazinePop(pMagazine, i);
     }
-    else
-    {
-        blockSize   = gMem.freeBlock[i].size;
-        pBlock      = gMem.freeBlock[i].pFirst;
 
-        /* Check if there is a free block ready */
-        if (pBlock != NULL)
+    if (pBlock == NULL)
+#endif
+    {
+        /* Get memory sempahore */
+        if (vos_mutexLock(&gMem.mutex) != VOS_NO_ERR)
         {
-            /* There is, get it. */
-            /* Set start pointer to next free block in the linked list */
-            gMem.freeBlock[i].pFirst = pBlock->pNext;
+            gMem.memCnt.allocErrCnt++;
+
+            vos_printLogStr(VOS_LOG_ERROR, "vos_memAlloc can't get semaphore\n");
+
+            return NULL;
         }
-        else
-        {
-            /* There was no suitable free block, create one from the free area */
 
-            /* Enough free memory left ? */
-            if ((gMem.allocSize + blockSize + sizeof(MEM_BLOCK_T)) < gMem.memSize)
-            {
-                pBlock = (MEM_BLOCK_T *) gMem.pFreeArea; /*lint !e826 Allocation of MEM_BLOCK from free area*/
+        pBlock = vos_memTakeBlock(&i, size);
 
-                gMem.pFreeArea  = (UINT8 *) gMem.pFreeArea + (sizeof(MEM_BLOCK_T) + blockSize);
-                gMem.allocSize  += blockSize + sizeof(MEM_BLOCK_T);
-                gMem.memCnt.blockCnt[i]++;
-            }
-            else
-            {
-                while ((++i < gMem.noOfBlocks) && (pBlock == NULL))
-                {
-                    pBlock = gMem.freeBlock[i].pFirst;
-                    if (pBlock != NULL)
-                    {
-                        vos_printLog(
-                            VOS_LOG_ERROR,
-                            "vos_memAlloc() Used a bigger buffer size=%d asked size=%d\n",
-                            gMem.freeBlock[i].size,
-                            size);
-                        /* There is, get it. */
-                        /* Set start pointer to next free block in the linked list */
-                        gMem.freeBlock[i].pFirst = pBlock->pNext;
-
-                        blockSize = gMem.freeBlock[i].size;
-                    }
-                }
-            }
+#ifdef VOS_MEM_MAGAZINES
+        /* Refill the magazine of this thread for the next calls */
+        if ((pBlock != NULL) && (gMem.freeBlock[i].size <= VOS_MEM_MAGAZINE_MAX_BLOCK))
+        {
+            vos_memMagazineRefill(i);
         }
+#endif
 
         /* Release semaphore */
         if (vos_mutexUnlock(&gMem.mutex) != VOS_NO_ERR)
         {
             vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
         }
+    }
 
-        if (pBlock != NULL)
-        {
-            /* Fill in size in memory header of the block. To be used when it is returned.*/
-            pBlock->size = blockSize;
-            gMem.memCnt.freeSize -= blockSize + sizeof(MEM_BLOCK_T);
-            if (gMem.memCnt.freeSize < gMem.memCnt.minFreeSize)
-            {
-                gMem.memCnt.minFreeSize = gMem.memCnt.freeSize;
-            }
-            gMem.memCnt.allocCnt++;
-
-            /* Clear returned memory area to be compliant with malloc'ed version */
-            memset((UINT8 *) pBlock + sizeof(MEM_BLOCK_T), 0, blockSize);
+    if (pBlock != NULL)
+    {
+        blockSize = gMem.freeBlock[i].size;
 
-            /* Return pointer to data area, not the memory block itself */
-            vos_printLog(VOS_LOG_DBG,
-                         "vos_memAlloc() %p, size\t%u\n",
-                         (void *) ((UINT8 *) pBlock + sizeof(MEM_BLOCK_T)),
-                         size);
-            return (UINT8 *) pBlock + sizeof(MEM_BLOCK_T);
+        /* Fill in size in memory header of the block. To be used when it is returned.*/
+        pBlock->size = blockSize;
+        VOS_MEM_CNT_SUB(gMem.memCnt.freeSize, blockSize + sizeof(MEM_BLOCK_T));
+        if (gMem.memCnt.freeSize < gMem.memCnt.minFreeSize)
+        {
+            gMem.memCnt.minFreeSize = gMem.memCnt.freeSize;
         }
-        else
+        VOS_MEM_CNT_ADD(gMem.memCnt.allocCnt, 1u);
+
+        /* Clear returned memory area to be compliant with malloc'ed version, the rest of the block is not used */
+        if (clear)
         {
-            /* Not enough memory */
-            vos_printLog(VOS_LOG_ERROR, "vos_memAlloc() Not enough memory, size %u\n", size);
-            gMem.memCnt.allocErrCnt++;
-            return NULL;
+            memset((UINT8 *) pBlock + sizeof(MEM_BLOCK_T), 0, size);
         }
+
+        /* Return pointer to data area, not the memory block itself */
+        vos_printLog(VOS_LOG_DBG,
+                     "vos_memAlloc() %p, size\t%u\n",
+                     (void *) ((UINT8 *) pBlock + sizeof(MEM_BLOCK_T)),
+                     size);
+        return (UINT8 *) pBlock + sizeof(MEM_BLOCK_T);
+    }
+    else
+    {
+        /* Not enough memory */
+        vos_printLog(VOS_LOG_ERROR, "vos_memAlloc() Not enough memory, size %u\n", size);
+        gMem.memCnt.allocErrCnt++;
+        return NULL;
     }
 }
 
 
 /**********************************************************************************************************************/
 /** Deallocate a block of memory (from memory area above).
+ *  Blocks of small size classes are put into the magazine of the calling thread without locking. A full magazine is
+ *  returned to the free block lists.
  *
  *  @param[in]      pMemBlock         Pointer to memory block to be freed
  */
@@ -532,6 +970,41 @@ EXT_DECL void vos_memFree (void *pMemBlock)
         return;
     }
 
+    /* Set block pointer to start of block, before the returned pointer */
+    pBlock      = (MEM_BLOCK_T *) ((UINT8 *) pMemBlock - sizeof(MEM_BLOCK_T));
+    blockSize   = pBlock->size;
+
+    /* Find appropriate free block item */
+    i = (blockSize == 0u) ? gMem.noOfBlocks : vos_memSizeClass(blockSize);
+
+    if ((i >= gMem.noOfBlocks) || (blockSize != gMem.freeBlock[i].size))
+    {
+        gMem.memCnt.freeErrCnt++;
+        vos_printLogStr(VOS_LOG_ERROR, "vos_memFree illegal sized memory\n");
+        return;
+    }
+
+    vos_printLog(VOS_LOG_DBG, "vos_memFree() %p, size %u\n", pMemBlock, pBlock->size);
+
+    VOS_MEM_CNT_ADD(gMem.memCnt.freeSize, blockSize + sizeof(MEM_BLOCK_T));
+    VOS_MEM_CNT_SUB(gMem.memCnt.allocCnt, 1u);
+
+    /* Destroy the size first in the block. If user tries to return same memory this will then fail. */
+    pBlock->size = 0;
+
+#ifdef VOS_MEM_MAGAZINES
+    if (blockSize <= VOS_MEM_MAGAZINE_MAX_BLOCK)
+    {
+        MEM_MAGAZINE_T *pMagazine = vos_memMagazine();
+
+        if ((pMagazine != NULL) && (pMagazine->cnt[i] < VOS_MEM_MAGAZINE_SIZE))
+        {
+            vos_memMagazinePush(pMagazine, i, pBlock);
+            return;
+        }
+    }
+#endif
+
     /* Get memory sempahore */
     if (vos_mutexLock(&gMem.mutex) != VOS_NO_ERR)
     {
@@ -541,38 +1014,22 @@ EXT_DECL void vos_memFree (void *pMemBlock)
     }
     else
     {
-        /* Set block pointer to start of block, before the returned pointer */
-        pBlock      = (MEM_BLOCK_T *) ((UINT8 *) pMemBlock - sizeof(MEM_BLOCK_T));
-        blockSize   = pBlock->size;
-
-        /* Find appropriate free block item */
-        for (i = 0; i < gMem.noOfBlocks; i++)
+#ifdef VOS_MEM_MAGAZINES
+        /* Return the full magazine, too */
+        if (blockSize <= VOS_MEM_MAGAZINE_MAX_BLOCK)
         {
-            if (blockSize == gMem.freeBlock[i].size)
+            MEM_MAGAZINE_T *pMagazine = vos_memMagazine();
+
+            if (pMagazine != NULL)
             {
-                break;
+                vos_memMagazineFlush(pMagazine, i);
             }
         }
+#endif
 
-        if (i >= gMem.noOfBlocks)
-        {
-            gMem.memCnt.freeErrCnt++;
-
-            vos_printLogStr(VOS_LOG_ERROR, "vos_memFree illegal sized memory\n");
-        }
-        else
-        {
-            gMem.memCnt.freeSize += blockSize + sizeof(MEM_BLOCK_T);
-            gMem.memCnt.allocCnt--;
-
-            /* Put the returned block first in the linked list */
-            pBlock->pNext = gMem.freeBlock[i].pFirst;
-            gMem.freeBlock[i].pFirst = pBlock;
-
-            vos_printLog(VOS_LOG_DBG, "vos_memFree() %p, size %u\n", pMemBlock, pBlock->size);
-            /* Destroy the size first in the block. If user tries to return same memory this will then fail. */
-            pBlock->size = 0;
-        }
+        /* Put the returned block first in the linked list */
+        pBlock->pNext = gMem.freeBlock[i].pFirst;
+        gMem.freeBlock[i].pFirst = pBlock;
 
         /* Release semaphore */
         if (vos_mutexUnlock(&gMem.mutex) != VOS_NO_ERR)
@@ -17,6 +17,7 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: struct VOS_SOCK_EVENTS (epoll instance)
  *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced
  *     AHW 2021-05-26: Ticket #322: Subscriber multicast message routing in multi-home device
  *      BL 2020-07-27: Ticket #333: Insufficient memory allocation in posix vos_semaCreate
@@ -89,6 +90,11 @@ struct VOS_SHRD
     CHAR8   *sharedMemoryName;      /* shared memory Name */
 };
 
+struct VOS_SOCK_EVENTS
+{
+    int     fd;                     /* epoll file descriptor */
+};
+
 VOS_ERR_T   vos_mutexLocalCreate (struct VOS_MUTEX *pMutex);
 void        vos_mutexLocalDelete (struct VOS_MUTEX *pMutex);
 
@@ -17,6 +17,9 @@
 /*
 * $Id$
 *
+*      AG 2026-10-16: Socket event sets with epoll() (vos_sockEventsCreate et al.)
+*      AG 2026-10-16: Batched UDP transmission with sendmmsg() (vos_sockSendUDPBatch)
+*      AG 2026-10-16: Batched UDP reception with recvmmsg() (vos_sockReceiveUDPBatch)
 *     AHW 2023-01-10: Ticket #406 Socket handling: check for EAGAIN missing for Linux/Posix
 *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
 *      SB 2021-08-09: Lint warnings
@@ -68,6 +71,7 @@
 
 #ifdef __linux
 #   include <net/if.h>
+#   include <sys/epoll.h>
 #   include <byteswap.h>
 #   include <linux/if_vlan.h>
 #   include <linux/sockios.h>
@@ -86,6 +90,7 @@
 #include "vos_utils.h"
 #include "vos_sock.h"
 #include "vos_thread.h"
+#include "vos_mem.h"
 #include "vos_private.h"
 
 /***********************************************************************************************************************
@@ -98,6 +103,12 @@ const CHAR8 *cDefaultIface = "en0";
 const CHAR8 *cDefaultIface = "eth0";
 #endif
 
+/* Batched reception and transmission are available with the GNU extensions of Linux */
+#if defined(__linux) && defined(_GNU_SOURCE) && defined(MSG_WAITFORONE)
+#define VOS_HAS_RECVMMSG
+#define VOS_HAS_SENDMMSG
+#endif
+
 /* Hack for macOS and iOS */
 #if defined(__APPLE__) && !defined(SOL_IP)
 #define SOL_IP SOL_SOCKET
@@ -157,6 +168,46 @@ UINT32 vos_getInterfaceIP (UINT32 ifIndex)
     return 0u;
 }
 
+/**********************************************************************************************************************/
+/** Evaluate the ancillary data of a received datagram.
+ *
+ *  @param[in]      pMsg            pointer to the message header filled by recvmsg()/recvmmsg()
+ *  @param[out]     pDstIPAddr      pointer to dest IP
+ *  @param[out]     pSrcIFAddr      pointer to source network interface IP (optional)
+ */
+static void vos_sockGetDestAddr (
+    struct msghdr   *pMsg,
+    UINT32          *pDstIPAddr,
+    UINT32          *pSrcIFAddr)
+{
+    struct cmsghdr *cmsg;
+
+    for (cmsg = CMSG_FIRSTHDR(pMsg); cmsg != NULL; cmsg = CMSG_NXTHDR(pMsg, cmsg))
+    {
+#if defined(IP_RECVDSTADDR)
+        if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_RECVDSTADDR)
+        {
+            struct in_addr *pia = (struct in_addr *)CMSG_DATA(cmsg);
+            *pDstIPAddr = (UINT32)vos_ntohl(pia->s_addr);
+            /* vos_printLog(VOS_LOG_DBG, "udp message dest IP: %s\n", vos_ipDotted(*pDstIPAddr)); */
+        }
+#elif defined(IP_PKTINFO)
+        if (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_PKTINFO)
+        {
+            struct in_pktinfo *pia = (struct in_pktinfo *)CMSG_DATA(cmsg);
+            *pDstIPAddr = (UINT32)vos_ntohl(pia->ipi_addr.s_addr);
+
+            /* vos_printLog(VOS_LOG_DBG, "udp message dest IP: %s\n", vos_ipDotted(*pDstIPAddr)); */
+
+            if (pSrcIFAddr != NULL)
+            {
+                *pSrcIFAddr = vos_getInterfaceIP(pia->ipi_ifindex);  /* #322 */
+            }
+        }
+#endif
+    }
+}
+
 
 /**********************************************************************************************************************/
 /** Get the MAC address for a named interface.
@@ -460,6 +511,222 @@ EXT_DECL INT32 vos_select (
                   (fd_set *) pErrorFD, (struct timeval *) pTimeOut);
 }
 
+/**********************************************************************************************************************/
+/** Create a socket event set.
+ *  Linux: one epoll instance per set, other targets are not supported.
+ *
+ *  @param[out]     pEvents         pointer to the handle of the event set
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error
+ *  @retval         VOS_MEM_ERR     out of memory or descriptors
+ *  @retval         VOS_SOCK_ERR    socket event sets are not supported by the target, use vos_select()
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsCreate (
+    VOS_SOCK_EVENTS_T *pEvents)
+{
+#ifdef __linux
+    if (pEvents == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    *pEvents = (VOS_SOCK_EVENTS_T) vos_memAlloc(sizeof(struct VOS_SOCK_EVENTS));
+    if (*pEvents == NULL)
+    {
+        return VOS_MEM_ERR;
+    }
+
+    (*pEvents)->fd = epoll_create1(EPOLL_CLOEXEC);
+    if ((*pEvents)->fd == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_ERROR, "epoll_create1() failed (Err: %s)\n", buff);
+        vos_memFree(*pEvents);
+        *pEvents = NULL;
+        return VOS_MEM_ERR;
+    }
+    return VOS_NO_ERR;
+#else
+    (void) pEvents;
+    return VOS_SOCK_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Delete a socket event set.
+ *  The registered sockets are not closed.
+ *
+ *  @param[in]      events          handle of the event set
+ */
+
+EXT_DECL void vos_sockEventsDelete (
+    VOS_SOCK_EVENTS_T events)
+{
+#ifdef __linux
+    if (events != NULL)
+    {
+        (void) close(events->fd);
+        vos_memFree(events);
+    }
+#else
+    (void) events;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Register a socket with an event set.
+ *  The socket is supervised for readability (level triggered) until it is removed or closed.
+ *
+ *  @param[in]      events          handle of the event set
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      tag             value reported by vos_sockEventsWait() when the socket is readable
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error, socket already registered
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsAdd (
+    VOS_SOCK_EVENTS_T   events,
+    VOS_SOCK_T          sock,
+    UINT32              tag)
+{
+#ifdef __linux
+    struct epoll_event ev;
+
+    if ((events == NULL) || (sock == VOS_INVALID_SOCKET))
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events   = EPOLLIN;
+    ev.data.u32 = tag;
+    if (epoll_ctl(events->fd, EPOLL_CTL_ADD, sock, &ev) == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_WARNING, "epoll_ctl(ADD, %d) failed (Err: %s)\n", sock, buff);
+        return VOS_PARAM_ERR;
+    }
+    return VOS_NO_ERR;
+#else
+    (void) events;
+    (void) sock;
+    (void) tag;
+    return VOS_SOCK_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Remove a socket from an event set.
+ *
+ *  @param[in]      events          handle of the event set
+ *  @param[in]      sock            socket descriptor
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error, socket not registered
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsRemove (
+    VOS_SOCK_EVENTS_T   events,
+    VOS_SOCK_T          sock)
+{
+#ifdef __linux
+    struct epoll_event ev;  /* ignored, but must not be NULL for kernels before 2.6.9 */
+
+    if ((events == NULL) || (sock == VOS_INVALID_SOCKET))
+    {
+        return VOS_PARAM_ERR;
+    }
+    if (epoll_ctl(events->fd, EPOLL_CTL_DEL, sock, &ev) == -1)
+    {
+        return VOS_PARAM_ERR;
+    }
+    return VOS_NO_ERR;
+#else
+    (void) events;
+    (void) sock;
+    return VOS_SOCK_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Wait for readable sockets of an event set.
+ *  Returns after the time out or as soon as at least one registered socket is readable; an interrupted wait
+ *  returns without ready sockets.
+ *
+ *  @param[in]      events          handle of the event set
+ *  @param[in]      pTimeOut        maximum time to wait, NULL to wait forever
+ *  @param[out]     pTags           tags of the readable sockets
+ *  @param[in,out]  pCount          In: size of pTags (max. VOS_MAX_SOCK_EVENTS), Out: number of readable sockets
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error
+ *  @retval         VOS_IO_ERR      wait failed
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsWait (
+    VOS_SOCK_EVENTS_T   events,
+    const VOS_TIMEVAL_T *pTimeOut,
+    UINT32              *pTags,
+    UINT32              *pCount)
+{
+#ifdef __linux
+    struct epoll_event  ev[VOS_MAX_SOCK_EVENTS];
+    int                 timeout = -1;
+    int                 maxCount;
+    int                 noOfEvents;
+    int                 i;
+
+    if ((events == NULL) || (pTags == NULL) || (pCount == NULL) || (*pCount == 0u))
+    {
+        return VOS_PARAM_ERR;
+    }
+    maxCount = (*pCount > VOS_MAX_SOCK_EVENTS) ? (int) VOS_MAX_SOCK_EVENTS : (int) *pCount;
+    *pCount = 0u;
+
+    if (pTimeOut != NULL)
+    {
+        /* round up to full milliseconds, we must not return before the time out */
+        timeout = (int) (pTimeOut->tv_sec * 1000 + (pTimeOut->tv_usec + 999) / 1000);
+    }
+
+    noOfEvents = epoll_wait(events->fd, ev, maxCount, timeout);
+    if (noOfEvents == -1)
+    {
+        if (errno == EINTR)
+        {
+            return VOS_NO_ERR;
+        }
+        else
+        {
+            char buff[VOS_MAX_ERR_STR_SIZE];
+            STRING_ERR(buff);
+            vos_printLog(VOS_LOG_ERROR, "epoll_wait() failed (Err: %s)\n", buff);
+            return VOS_IO_ERR;
+        }
+    }
+    for (i = 0; i < noOfEvents; i++)
+    {
+        pTags[i] = ev[i].data.u32;
+    }
+    *pCount = (UINT32) noOfEvents;
+    return VOS_NO_ERR;
+#else
+    (void) events;
+    (void) pTimeOut;
+    (void) pTags;
+    (void) pCount;
+    return VOS_SOCK_ERR;
+#endif
+}
+
 /**********************************************************************************************************************/
 /** Get a list of interface addresses
  *  The caller has to provide an array of interface records to be filled.
@@ -1233,6 +1500,131 @@ EXT_DECL VOS_ERR_T vos_sockSendUDP (
     return VOS_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Send a batch of UDP datagrams.
+ *  On Linux, the datagrams are handed to the kernel by sendmmsg(), other targets send them one by one.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in,out]  pMsgs           array of send descriptors
+ *  @param[in,out]  pCount          In: number of descriptors, Out: number of descriptors processed
+ *  @param[in]      port            destination port
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      at least one datagram could not be sent (its size is set to 0)
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPBatch (
+    VOS_SOCK_T      sock,
+    VOS_UDP_MSG_T   *pMsgs,
+    UINT32          *pCount,
+    UINT16          port)
+{
+#ifdef VOS_HAS_SENDMMSG
+    struct mmsghdr      msgs[VOS_MAX_UDP_BATCH];
+    struct iovec        iov[VOS_MAX_UDP_BATCH];
+    struct sockaddr_in  destAddr[VOS_MAX_UDP_BATCH];
+    VOS_ERR_T   err = VOS_NO_ERR;
+    UINT32      maxCount;
+    UINT32      sent = 0u;
+    UINT32      idx;
+    int         rc;
+
+    if (sock == -1 || pMsgs == NULL || pCount == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    maxCount    = (*pCount < VOS_MAX_UDP_BATCH) ? *pCount : VOS_MAX_UDP_BATCH;
+    *pCount     = 0u;
+
+    memset(msgs, 0, maxCount * sizeof(struct mmsghdr));
+    memset(destAddr, 0, maxCount * sizeof(struct sockaddr_in));
+
+    for (idx = 0u; idx < maxCount; idx++)
+    {
+        destAddr[idx].sin_family        = AF_INET;
+        destAddr[idx].sin_addr.s_addr   = vos_htonl(pMsgs[idx].dstIPAddr);
+        destAddr[idx].sin_port          = vos_htons(port);
+        iov[idx].iov_base               = pMsgs[idx].pBuffer;
+        iov[idx].iov_len                = pMsgs[idx].size;
+        msgs[idx].msg_hdr.msg_name      = &destAddr[idx];
+        msgs[idx].msg_hdr.msg_namelen   = sizeof(struct sockaddr_in);
+        msgs[idx].msg_hdr.msg_iov       = &iov[idx];
+        msgs[idx].msg_hdr.msg_iovlen    = 1;
+    }
+
+    /* sendmmsg() returns after the first failing datagram, the next call reports the error for it */
+    while (sent < maxCount)
+    {
+        rc = sendmmsg(sock, &msgs[sent], maxCount - sent, 0);
+
+        if (rc == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if ((errno == EWOULDBLOCK) || (errno == EAGAIN))
+            {
+                *pCount = sent;
+                return VOS_BLOCK_ERR;
+            }
+            else
+            {
+                char buff[VOS_MAX_ERR_STR_SIZE];
+                STRING_ERR(buff);
+                vos_printLog(VOS_LOG_WARNING, "sendmmsg() to %s:%u failed (Err: %s)\n",
+                             inet_ntoa(destAddr[sent].sin_addr), (unsigned int)port, buff);
+                /* skip the failing datagram, the others may reach their destinations */
+                pMsgs[sent].size = 0u;
+                sent++;
+                err = VOS_IO_ERR;
+                continue;
+            }
+        }
+
+        for (idx = sent; idx < sent + (UINT32) rc; idx++)
+        {
+            pMsgs[idx].size = (UINT32) msgs[idx].msg_len;
+        }
+        sent += (UINT32) rc;
+    }
+
+    *pCount = sent;
+    return err;
+#else
+    VOS_ERR_T   err = VOS_NO_ERR;
+    VOS_ERR_T   sendErr;
+    UINT32      count;
+
+    if (pMsgs == NULL || pCount == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+    count   = *pCount;
+    *pCount = 0u;
+    while (*pCount < count)
+    {
+        sendErr = vos_sockSendUDP(sock, pMsgs[*pCount].pBuffer, &pMsgs[*pCount].size, pMsgs[*pCount].dstIPAddr,
+                                  port);
+        if (sendErr == VOS_BLOCK_ERR)
+        {
+            return VOS_BLOCK_ERR;
+        }
+        if (sendErr != VOS_NO_ERR)
+        {
+            /* skip the failing datagram, the others may reach their destinations */
+            pMsgs[*pCount].size = 0u;
+            err = sendErr;
+        }
+        (*pCount)++;
+    }
+    return err;
+#endif
+}
+
 /**********************************************************************************************************************/
 /** Receive UDP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -1278,7 +1670,6 @@ EXT_DECL VOS_ERR_T vos_sockReceiveUDP (
     ssize_t rcvSize = 0;
     struct msghdr       msg;
     struct iovec        iov;
-    struct cmsghdr      *cmsg;
 
     if (sock == -1 || pBuffer == NULL || pSize == NULL)
     {
@@ -1316,37 +1707,7 @@ EXT_DECL VOS_ERR_T vos_sockReceiveUDP (
         {
             if (pDstIPAddr != NULL)
             {
-                for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
-                {
-#if defined(IP_RECVDSTADDR)
-                    if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_RECVDSTADDR)
-                    {
-                        struct in_addr *pia = (struct in_addr *)CMSG_DATA(cmsg);
-                        *pDstIPAddr = (UINT32)vos_ntohl(pia->s_addr);
-                        /* vos_printLog(VOS_LOG_DBG, "udp message dest IP: %s\n", vos_ipDotted(*pDstIPAddr)); */
-                    }
-#elif defined(IP_PKTINFO)
-                    if (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_PKTINFO)
-                    {
-                        struct in_pktinfo *pia = (struct in_pktinfo *)CMSG_DATA(cmsg);
-                        *pDstIPAddr = (UINT32)vos_ntohl(pia->ipi_addr.s_addr);
-
-                        /* vos_printLog(VOS_LOG_DBG, "udp message dest IP: %s\n", vos_ipDotted(*pDstIPAddr)); */
-
-                        if (pSrcIFAddr != NULL)
-                        {
-                            *pSrcIFAddr = vos_getInterfaceIP(pia->ipi_ifindex);  /* #322 */
-                        }
-                    }
-#elif defined(IP_RECVDSTADDR)
-                    if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_RECVDSTADDR)
-                    {
-                        struct in_addr *pia = (struct in_addr *)CMSG_DATA(cmsg);
-                        *pDstIPAddr = (UINT32)vos_ntohl(pia->s_addr);
-                        /* vos_printLog(VOS_LOG_DBG, "udp message dest IP: %s\n", vos_ipDotted(*pDstIPAddr)); */
-                    }
-#endif
-                }
+                vos_sockGetDestAddr(&msg, pDstIPAddr, pSrcIFAddr);
             }
 
             if (pSrcIPAddr != NULL)
@@ -1394,6 +1755,136 @@ EXT_DECL VOS_ERR_T vos_sockReceiveUDP (
     }
 }
 
+/**********************************************************************************************************************/
+/** Receive a batch of UDP datagrams.
+ *  Read up to *pCount datagrams with one recvmmsg() call. The call returns as soon as the first datagram has been
+ *  read, together with all further datagrams already queued on the socket (MSG_WAITFORONE).
+ *  If recvmmsg() is not available, a single datagram is read by vos_sockReceiveUDP().
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in,out]  pMsgs           array of receive descriptors, buffers and sizes to be set by the caller
+ *  @param[in,out]  pCount          In: number of descriptors, Out: number of datagrams received
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be read
+ *  @retval         VOS_NODATA_ERR  no data
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveUDPBatch (
+    VOS_SOCK_T      sock,
+    VOS_UDP_MSG_T   *pMsgs,
+    UINT32          *pCount)
+{
+#ifdef VOS_HAS_RECVMMSG
+    union
+    {
+        struct cmsghdr  cm;
+        char            raw[32];
+    } control_un[VOS_MAX_UDP_BATCH];
+    struct sockaddr_in  srcAddr[VOS_MAX_UDP_BATCH];
+    struct mmsghdr      msgs[VOS_MAX_UDP_BATCH];
+    struct iovec        iov[VOS_MAX_UDP_BATCH];
+    UINT32              maxCount;
+    UINT32              i;
+    int                 rcvCount;
+
+    if (sock == -1 || pMsgs == NULL || pCount == NULL || *pCount == 0u)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    maxCount = (*pCount > VOS_MAX_UDP_BATCH) ? VOS_MAX_UDP_BATCH : *pCount;
+    *pCount = 0u;
+
+    /* clear our address buffers */
+    memset(msgs, 0, maxCount * sizeof(struct mmsghdr));
+    memset(control_un, 0, maxCount * sizeof(control_un[0]));
+
+    for (i = 0u; i < maxCount; i++)
+    {
+        /* fill the scatter/gather list with the callers data buffer */
+        iov[i].iov_base = pMsgs[i].pBuffer;
+        iov[i].iov_len  = pMsgs[i].size;
+
+        /* fill the msg block for recvmmsg */
+        msgs[i].msg_hdr.msg_iov         = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen      = 1;
+        msgs[i].msg_hdr.msg_name        = &srcAddr[i];
+        msgs[i].msg_hdr.msg_namelen     = sizeof(struct sockaddr_in);
+        msgs[i].msg_hdr.msg_control     = &control_un[i].cm;
+        msgs[i].msg_hdr.msg_controllen  = sizeof(control_un[i]);
+    }
+
+    do
+    {
+        rcvCount = recvmmsg(sock, msgs, maxCount, MSG_WAITFORONE, NULL);
+
+        if ((rcvCount == -1) && ((errno == EWOULDBLOCK) || (errno == EAGAIN)))
+        {
+            return VOS_BLOCK_ERR;
+        }
+    }
+    while (rcvCount == -1 && errno == EINTR);
+
+    if (rcvCount == -1)
+    {
+        if (errno == ECONNRESET)
+        {
+            /* ICMP port unreachable received (result of previous send), treat this as no error */
+            return VOS_NO_ERR;
+        }
+        else
+        {
+            char buff[VOS_MAX_ERR_STR_SIZE];
+            STRING_ERR(buff);
+            vos_printLog(VOS_LOG_ERROR, "recvmmsg() failed (Err: %s)\n", buff);
+            return VOS_IO_ERR;
+        }
+    }
+    else if (rcvCount == 0)
+    {
+        return VOS_NODATA_ERR;
+    }
+
+    for (i = 0u; i < (UINT32) rcvCount; i++)
+    {
+        pMsgs[i].size       = (UINT32) msgs[i].msg_len;
+        pMsgs[i].srcIPAddr  = (UINT32) vos_ntohl(srcAddr[i].sin_addr.s_addr);
+        pMsgs[i].srcIPPort  = (UINT16) vos_ntohs(srcAddr[i].sin_port);
+        pMsgs[i].dstIPAddr  = 0u;
+        pMsgs[i].srcIFAddr  = 0u;   /* #322  */
+        vos_sockGetDestAddr(&msgs[i].msg_hdr, &pMsgs[i].dstIPAddr, &pMsgs[i].srcIFAddr);
+    }
+    *pCount = (UINT32) rcvCount;
+    return VOS_NO_ERR;
+#else
+    VOS_ERR_T err;
+
+    if (pMsgs == NULL || pCount == NULL || *pCount == 0u)
+    {
+        return VOS_PARAM_ERR;
+    }
+    *pCount = 0u;
+    pMsgs[0].dstIPAddr  = 0u;
+    pMsgs[0].srcIFAddr  = 0u;   /* #322, filled by vos_sockReceiveUDP() if known */
+    err = vos_sockReceiveUDP(sock,
+                             pMsgs[0].pBuffer,
+                             &pMsgs[0].size,
+                             &pMsgs[0].srcIPAddr,
+                             &pMsgs[0].srcIPPort,
+                             &pMsgs[0].dstIPAddr,
+                             &pMsgs[0].srcIFAddr,
+                             FALSE);
+    if (err == VOS_NO_ERR)
+    {
+        *pCount = 1u;
+    }
+    return err;
+#endif
+}
+
 /**********************************************************************************************************************/
 /** Bind a socket to an address and port.
  *
@@ -17,6 +17,9 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-16: vos_sockEventsCreate() et al. added (not supported by this target)
+ *      AG 2026-10-16: vos_sockSendUDPBatch() added (one datagram per send call)
+ *      AG 2026-10-16: vos_sockReceiveUDPBatch() added (single datagram per call)
  *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
  *      MM 2022-05-30: Ticket #326: fixed handling of destination (own) address on UDP receive
  *     AHW 2021-05-06: Ticket #322 Subscriber multicast message routing in multi-home device
@@ -390,6 +393,104 @@ EXT_DECL INT32 vos_select (
                   (fd_set *) pErrorFD, (struct timeval *) pTimeOut);
 }
 
+/**********************************************************************************************************************/
+/** Create a socket event set.
+ *  Not supported by this target, use vos_select().
+ *
+ *  @param[out]     pEvents         pointer to the handle of the event set
+ *
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsCreate (
+    VOS_SOCK_EVENTS_T *pEvents)
+{
+    (void) pEvents;
+    return VOS_SOCK_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Delete a socket event set.
+ *  Not supported by this target.
+ *
+ *  @param[in]      events          handle of the event set
+ */
+
+EXT_DECL void vos_sockEventsDelete (
+    VOS_SOCK_EVENTS_T events)
+{
+    (void) events;
+}
+
+/**********************************************************************************************************************/
+/** Register a socket with an event set.
+ *  Not supported by this target.
+ *
+ *  @param[in]      events          handle of the event set
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      tag             value reported by vos_sockEventsWait() when the socket is readable
+ *
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsAdd (
+    VOS_SOCK_EVENTS_T   events,
+    VOS_SOCK_T          sock,
+    UINT32              tag)
+{
+    (void) events;
+    (void) sock;
+    (void) tag;
+    return VOS_SOCK_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Remove a socket from an event set.
+ *  Not supported by this target.
+ *
+ *  @param[in]      events          handle of the event set
+ *  @param[in]      sock            socket descriptor
+ *
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsRemove (
+    VOS_SOCK_EVENTS_T   events,
+    VOS_SOCK_T          sock)
+{
+    (void) events;
+    (void) sock;
+    return VOS_SOCK_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Wait for readable sockets of an event set.
+ *  Not supported by this target.
+ *
+ *  @param[in]      events          handle of the event set
+ *  @param[in]      pTimeOut        maximum time to wait, NULL to wait forever
+ *  @param[out]     pTags           tags of the readable sockets
+ *  @param[in,out]  pCount          In: size of pTags, Out: number of readable sockets
+ *
+ *  @retval         VOS_SOCK_ERR    not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEventsWait (
+    VOS_SOCK_EVENTS_T   events,
+    const VOS_TIMEVAL_T *pTimeOut,
+    UINT32              *pTags,
+    UINT32              *pCount)
+{
+    (void) events;
+    (void) pTimeOut;
+    (void) pTags;
+    if (pCount != NULL)
+    {
+        *pCount = 0u;
+    }
+    return VOS_SOCK_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Get a list of interface addresses
  *  The caller has to provide an array of interface records to be filled.
@@ -1071,6 +1172,47 @@ EXT_DECL VOS_ERR_T vos_sockSendUDP (
     return VOS_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Send a batch of UDP datagrams.
+ *  This target has no batched transmission, the datagrams are sent one by one by vos_sockSendUDP().
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in,out]  pMsgs           array of send descriptors
+ *  @param[in,out]  pCount          In: number of descriptors, Out: number of datagrams sent
+ *  @param[in]      port            destination port
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPBatch (
+    VOS_SOCK_T      sock,
+    VOS_UDP_MSG_T   *pMsgs,
+    UINT32          *pCount,
+    UINT16          port)
+{
+    VOS_ERR_T   err = VOS_NO_ERR;
+    UINT32      count;
+
+    if (pMsgs == NULL || pCount == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+    count   = *pCount;
+    *pCount = 0u;
+    while ((*pCount < count) && (err == VOS_NO_ERR))
+    {
+        err = vos_sockSendUDP(sock, pMsgs[*pCount].pBuffer, &pMsgs[*pCount].size, pMsgs[*pCount].dstIPAddr, port);
+        if (err == VOS_NO_ERR)
+        {
+            (*pCount)++;
+        }
+    }
+    return err;
+}
+
 /**********************************************************************************************************************/
 /** Receive UDP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -1225,6 +1367,49 @@ EXT_DECL VOS_ERR_T vos_sockReceiveUDP (
     }
 }
 
+/**********************************************************************************************************************/
+/** Receive a batch of UDP datagrams.
+ *  This target has no batched reception, a single datagram is read by vos_sockReceiveUDP().
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in,out]  pMsgs           array of receive descriptors, buffers and sizes to be set by the caller
+ *  @param[in,out]  pCount          In: number of descriptors, Out: number of datagrams received
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be read
+ *  @retval         VOS_NODATA_ERR  no data
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveUDPBatch (
+    VOS_SOCK_T      sock,
+    VOS_UDP_MSG_T   *pMsgs,
+    UINT32          *pCount)
+{
+    VOS_ERR_T err;
+
+    if (pMsgs == NULL || pCount == NULL || *pCount == 0u)
+    {
+        return VOS_PARAM_ERR;
+    }
+    *pCount = 0u;
+    pMsgs[0].dstIPAddr = 0u;
+    err = vos_sockReceiveUDP(sock,
+                             pMsgs[0].pBuffer,
+                             &pMsgs[0].size,
+                             &pMsgs[0].srcIPAddr,
+                             &pMsgs[0].srcIPPort,
+                             &pMsgs[0].dstIPAddr,
+                             &pMsgs[0].srcIFAddr,
+                             FALSE);
+    if (err == VOS_NO_ERR)
+    {
+        *pCount = 1u;
+    }
+    return err;
+}
+
 /**********************************************************************************************************************/
 /** Bind a socket to an address and port.
  *
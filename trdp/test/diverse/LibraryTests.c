@@ -14,6 +14,10 @@
  *
  * $Id$
  *
+ *      AG 2026-10-16: Byte order conversion test for vos_copyNetOrder16/32/64()
+ *      AG 2026-10-17: CRC conformance test: every length and alignment around the 16 byte folding blocks, long inputs
+ *      AG 2026-10-16: CRC conformance test against bitwise reference implementations
+ *      AG 2026-10-16: Memory test: size classes, vos_memAllocNoInit, thread caches
  *      SB 2021-08-09: Compiler warnings
  *      BL 2017-05-22: Ticket #122: Addendum for 64Bit compatibility (VOS_TIME_T -> VOS_TIMEVAL_T)
  */
@@ -253,6 +257,194 @@ int testCRCcalculation()
     return 0; /* all time tests succeeded */
 }
 
+/* Bitwise reference implementations of the IEEE802.3 FCS and the SC-32 */
+static UINT32 refCrc32 (UINT32 crc, const UINT8 *pData, UINT32 dataLen)
+{
+    UINT32 i, bit;
+    for (i = 0; i < dataLen; i++)
+    {
+        crc ^= pData[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1u) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+        }
+    }
+    return ~crc;
+}
+
+static UINT32 refSc32 (UINT32 crc, const UINT8 *pData, UINT32 dataLen)
+{
+    UINT32 i, bit;
+    for (i = 0; i < dataLen; i++)
+    {
+        crc ^= (UINT32) pData[i] << 24;
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x80000000u) ? ((crc << 1) ^ 0xF4ACFB13u) : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+int testCRCconformance()
+{
+    static UINT8    buffer[16384 + 16];
+    const UINT8     check[] = "123456789";
+    UINT32          i, run, len, offset, seed, split, errors = 0;
+    VOS_TIMEVAL_T   start, end;
+
+    if (vos_crc32(0xFFFFFFFFu, check, 9) != 0xCBF43926u ||
+        vos_sc32(0xFFFFFFFFu, check, 9) != 0xC683B9E5u)
+    {
+        return 1;
+    }
+
+    /* random buffers of any length and alignment, random initial values */
+    srand(4711);
+    for (i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = (UINT8) rand();
+    }
+    for (run = 0; run < 20000; run++)
+    {
+        len     = (run < 64) ? run : (UINT32) rand() % 2048;
+        offset  = (UINT32) rand() % 8;
+        seed    = ((UINT32) rand() << 16) ^ (UINT32) rand();
+        if (vos_crc32(seed, buffer + offset, len) != refCrc32(seed, buffer + offset, len) ||
+            vos_sc32(seed, buffer + offset, len) != refSc32(seed, buffer + offset, len))
+        {
+            printf("CRC mismatch: length %u, offset %u, seed %x\n", len, offset, seed);
+            errors++;
+        }
+    }
+
+    /* every length up to a few 64 byte folding steps at every alignment of the 16 byte blocks */
+    for (len = 0; len <= 320; len++)
+    {
+        for (offset = 0; offset < 16; offset++)
+        {
+            seed = ((UINT32) rand() << 16) ^ (UINT32) rand();
+            if (vos_crc32(seed, buffer + offset, len) != refCrc32(seed, buffer + offset, len) ||
+                vos_sc32(seed, buffer + offset, len) != refSc32(seed, buffer + offset, len))
+            {
+                printf("CRC mismatch: length %u, offset %u, seed %x\n", len, offset, seed);
+                errors++;
+            }
+        }
+    }
+
+    /* long inputs, also computed in two calls continuing the CRC */
+    for (run = 0; run < 200; run++)
+    {
+        len     = (UINT32) rand() % 16384;
+        offset  = (UINT32) rand() % 16;
+        split   = (len == 0) ? 0 : (UINT32) rand() % len;
+        seed    = ((UINT32) rand() << 16) ^ (UINT32) rand();
+        if (vos_crc32(seed, buffer + offset, len) != refCrc32(seed, buffer + offset, len) ||
+            vos_sc32(seed, buffer + offset, len) != refSc32(seed, buffer + offset, len) ||
+            vos_crc32(~vos_crc32(seed, buffer + offset, split), buffer + offset + split, len - split) !=
+            refCrc32(seed, buffer + offset, len) ||
+            vos_sc32(vos_sc32(seed, buffer + offset, split), buffer + offset + split, len - split) !=
+            refSc32(seed, buffer + offset, len))
+        {
+            printf("CRC mismatch: length %u, offset %u, split %u, seed %x\n", len, offset, split, seed);
+            errors++;
+        }
+    }
+
+    /* cost of a PD header FCS and of a 1kB SDT payload */
+    vos_getTime(&start);
+    for (run = 0, seed = 0; run < 1000000; run++)
+    {
+        seed ^= vos_crc32(seed, buffer, 36);
+    }
+    vos_getTime(&end);
+    vos_subTime(&end, &start);
+    printf("vos_crc32:\t36 bytes: %u ns\n", (UINT32) (end.tv_sec * 1000 + end.tv_usec / 1000));
+    vos_getTime(&start);
+    for (run = 0; run < 100000; run++)
+    {
+        seed ^= vos_crc32(seed, buffer, 1024);
+    }
+    vos_getTime(&end);
+    vos_subTime(&end, &start);
+    printf("vos_crc32:\t1024 bytes: %u ns\n", (UINT32) (end.tv_sec * 10000 + end.tv_usec / 100));
+    vos_getTime(&start);
+    for (run = 0; run < 100000; run++)
+    {
+        seed ^= vos_sc32(seed, buffer, 1024);
+    }
+    vos_getTime(&end);
+    vos_subTime(&end, &start);
+    printf("vos_sc32:\t1024 bytes: %u ns (%x)\n", (UINT32) (end.tv_sec * 10000 + end.tv_usec / 100), seed);
+
+    return (errors == 0) ? 0 : 1;
+}
+
+int testNetOrderCopy()
+{
+    static UINT8    src[4096 + 8], dst[4096 + 8];
+    UINT32          i, j, run, noOfItems, offset, itemSize, errors = 0;
+    VOS_TIMEVAL_T   start, end;
+    UINT16          v16     = 0x1234u;
+    UINT32          v32     = 0x12345678u;
+    UINT64          v64     = 0x123456789ABCDEF0ull;
+
+    /* network order is big endian */
+    vos_copyNetOrder16(dst, (const UINT8 *) &v16, 1);
+    vos_copyNetOrder32(dst + 2, (const UINT8 *) &v32, 1);
+    vos_copyNetOrder64(dst + 6, (const UINT8 *) &v64, 1);
+    if (memcmp(dst, "\x12\x34\x12\x34\x56\x78\x12\x34\x56\x78\x9A\xBC\xDE\xF0", 14) != 0)
+    {
+        return 1;
+    }
+
+    /* random item counts and alignments against a bytewise reference */
+    srand(815);
+    for (i = 0; i < sizeof(src); i++)
+    {
+        src[i] = (UINT8) rand();
+    }
+    for (run = 0; run < 3000; run++)
+    {
+        itemSize    = 2u << (run % 3);
+        noOfItems   = (run < 300) ? run / 3 : (UINT32) rand() % (4096 / itemSize);
+        offset      = (UINT32) rand() % 8;
+        memset(dst, 0, sizeof(dst));
+        switch (itemSize)
+        {
+           case 2:  vos_copyNetOrder16(dst + 1, src + offset, noOfItems); break;
+           case 4:  vos_copyNetOrder32(dst + 1, src + offset, noOfItems); break;
+           default: vos_copyNetOrder64(dst + 1, src + offset, noOfItems); break;
+        }
+        for (i = 0; i < noOfItems * itemSize; i++)
+        {
+            j = vos_hostIsBigEndian() ? i : (i - i % itemSize) + (itemSize - 1 - i % itemSize);
+            if (dst[1 + i] != src[offset + j])
+            {
+                break;
+            }
+        }
+        if ((i < noOfItems * itemSize) || (dst[0] != 0) || (dst[1 + noOfItems * itemSize] != 0))
+        {
+            printf("Byte order copy mismatch: item size %u, items %u, offset %u\n", itemSize, noOfItems, offset);
+            errors++;
+        }
+    }
+
+    /* cost of a 1kB array of 32 bit items */
+    vos_getTime(&start);
+    for (run = 0; run < 100000; run++)
+    {
+        vos_copyNetOrder32(dst, src, 256);
+    }
+    vos_getTime(&end);
+    vos_subTime(&end, &start);
+    printf("vos_copyNetOrder32:\t1024 bytes: %u ns\n", (UINT32) (end.tv_sec * 10000 + end.tv_usec / 100));
+
+    return (errors == 0) ? 0 : 1;
+}
+
 int testNetwork()
 {
     UINT8 MAC[6];
@@ -337,6 +529,213 @@ int testInterfaces()
     return 0; /* all time tests succeeded */
 }
 
+#define MEM_TEST_AREA_SIZE   (256u * 1024u)
+#define MEM_TEST_THREADS     4u
+#define MEM_TEST_LOOPS       20000u
+#define MEM_TEST_LIVE        16u
+#define MEM_TEST_CACHED      4u
+
+static UINT8        memTestArea[MEM_TEST_AREA_SIZE];
+static const UINT32 memTestPrealloc[VOS_MEM_NBLOCKSIZES] = {1u};   /* independent of VOS_MEM_PREALLOCATE */
+static VOS_SEMA_T   memTestDone;
+static VOS_SEMA_T   memTestGo;
+static UINT8        *memTestCached[MEM_TEST_CACHED];
+static int          memTestErrors;
+
+/* Allocate, fill and free blocks of changing sizes */
+static void *memTestWorker (void *pArg)
+{
+    static const UINT32 sizes[] = {8u, 60u, 100u, 200u, 300u, 700u, 1400u, 2000u, 3000u};
+    UINT8   *p[MEM_TEST_LIVE];
+    UINT32  n = (UINT32)(size_t) pArg;
+    UINT32  i;
+
+    memset(p, 0, sizeof(p));
+    for (i = 0u; i < MEM_TEST_LOOPS; i++)
+    {
+        UINT32 slot = (i * 7u + n) % MEM_TEST_LIVE;
+        UINT32 size = sizes[(i + n) % (sizeof(sizes) / sizeof(sizes[0]))];
+
+        if (p[slot] != NULL)
+        {
+            if (p[slot][0] != (UINT8) n)
+            {
+                memTestErrors++;
+            }
+            vos_memFree(p[slot]);
+        }
+        p[slot] = (i & 1u) ? vos_memAlloc(size) : vos_memAllocNoInit(size);
+        if (p[slot] == NULL)
+        {
+            memTestErrors++;
+            break;
+        }
+        memset(p[slot], (int) n, size);
+    }
+    for (i = 0u; i < MEM_TEST_LIVE; i++)
+    {
+        if (p[i] != NULL)
+        {
+            vos_memFree(p[i]);
+        }
+    }
+    vos_semaGive(memTestDone);
+    return NULL;
+}
+
+/* Keep some free blocks cached until the main thread is done */
+static void *memTestCacher (void *pArg)
+{
+    UINT32 i;
+
+    (void) pArg;
+    for (i = 0u; i < MEM_TEST_CACHED; i++)
+    {
+        memTestCached[i] = vos_memAlloc(500u);
+    }
+    for (i = 0u; i < MEM_TEST_CACHED; i++)
+    {
+        vos_memFree(memTestCached[i]);
+    }
+    vos_semaGive(memTestDone);
+    (void) vos_semaTake(memTestGo, 0xFFFFFFFFu);
+    vos_semaGive(memTestDone);
+    return NULL;
+}
+
+int testMemory()
+{
+    VOS_MEM_STATISTICS_T    before, after;
+    VOS_THREAD_T            thread;
+    UINT8                   *p;
+    UINT8                   *pAll[1024];
+    UINT32                  i, j, n, found;
+    int                     result = 0;
+
+    /* switch from heap to a memory area */
+    vos_memDelete(NULL);
+    if (vos_memInit(memTestArea, MEM_TEST_AREA_SIZE, memTestPrealloc) != VOS_NO_ERR)
+    {
+        return 1;
+    }
+    if ((vos_semaCreate(&memTestDone, VOS_SEMA_EMPTY) != VOS_NO_ERR) ||
+        (vos_semaCreate(&memTestGo, VOS_SEMA_EMPTY) != VOS_NO_ERR))
+    {
+        return 1;
+    }
+
+    /* size classes: the smallest fitting block size of the table is used (plus a constant header) */
+    for (i = 1u, n = 0u; i < 4000u; i += 7u)
+    {
+        (void) vos_memCount(&before);
+        p = vos_memAlloc(i);
+        (void) vos_memCount(&after);
+        for (j = 0u; (j < VOS_MEM_NBLOCKSIZES) && (before.blockSize[j] < ((i + 3u) & ~3u)); j++)
+        {
+            ;
+        }
+        if (n == 0u)
+        {
+            n = before.free - after.free - before.blockSize[j];
+        }
+        if ((p == NULL) || (j >= VOS_MEM_NBLOCKSIZES) || ((before.free - after.free) != (before.blockSize[j] + n)))
+        {
+            printf("size class wrong for %u\n", i);
+            result = 1;
+        }
+        vos_memFree(p);
+    }
+
+    /* cleared allocation after uncleared use of the same block */
+    p = vos_memAllocNoInit(100u);
+    memset(p, 0xA5, 100u);
+    vos_memFree(p);
+    p = vos_memAlloc(100u);
+    for (i = 0u; i < 100u; i++)
+    {
+        if (p[i] != 0u)
+        {
+            printf("vos_memAlloc() not cleared\n");
+            result = 1;
+            break;
+        }
+    }
+    vos_memFree(p);
+
+    /* several threads, blocks are passed through the thread caches */
+    (void) vos_memCount(&before);
+    memTestErrors = 0;
+    for (i = 0u; i < MEM_TEST_THREADS; i++)
+    {
+        if (vos_threadCreate(&thread, "memTest", VOS_THREAD_POLICY_OTHER, 0, 0u, 0u,
+                             memTestWorker, (void *)(size_t) (i + 1u)) != VOS_NO_ERR)
+        {
+            return 1;
+        }
+    }
+    for (i = 0u; i < MEM_TEST_THREADS; i++)
+    {
+        (void) vos_semaTake(memTestDone, 0xFFFFFFFFu);
+    }
+    (void) vos_threadDelay(100000u);      /* let the threads terminate and return their caches */
+    (void) vos_memCount(&after);
+    printf("memory: %u blocks before, %u after, %u / %u free, %u errors\n",
+           before.numAllocBlocks, after.numAllocBlocks, before.free, after.free, memTestErrors);
+    if ((memTestErrors != 0) ||
+        (after.numAllocBlocks != before.numAllocBlocks) ||
+        (after.free != before.free) ||
+        (after.numFreeErr != before.numFreeErr))
+    {
+        result = 1;
+    }
+
+    /* blocks cached by another thread are reclaimed if memory runs short */
+    if (vos_threadCreate(&thread, "memCache", VOS_THREAD_POLICY_OTHER, 0, 0u, 0u,
+                         memTestCacher, NULL) != VOS_NO_ERR)
+    {
+        return 1;
+    }
+    (void) vos_semaTake(memTestDone, 0xFFFFFFFFu);
+    for (n = 0u; n < 1024u; n++)
+    {
+        pAll[n] = vos_memAlloc(500u);
+        if (pAll[n] == NULL)
+        {
+            break;
+        }
+    }
+    for (i = 0u, found = 0u; i < MEM_TEST_CACHED; i++)
+    {
+        for (j = 0u; j < n; j++)
+        {
+            if (pAll[j] == memTestCached[i])
+            {
+                found++;
+                break;
+            }
+        }
+    }
+    for (j = 0u; j < n; j++)
+    {
+        vos_memFree(pAll[j]);
+    }
+    printf("memory: %u blocks until exhausted, %u of %u cached blocks reclaimed\n", n, found, MEM_TEST_CACHED);
+    if ((n == 0u) || (n >= 1024u) || (found != MEM_TEST_CACHED))
+    {
+        result = 1;
+    }
+    vos_semaGive(memTestGo);
+    (void) vos_semaTake(memTestDone, 0xFFFFFFFFu);
+    (void) vos_threadDelay(100000u);
+
+    /* back to the heap */
+    vos_semaDelete(memTestGo);
+    vos_semaDelete(memTestDone);
+    vos_memDelete(memTestArea);
+    (void) vos_memInit(NULL, 0u, NULL);
+    return result;
+}
+
 int main(int argc, char *argv[])
 {
     /*    Init the library  */
@@ -379,6 +778,24 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    if (testCRCconformance())
+    {
+        printf("CRC conformance test failed\n");
+        return 1;
+    }
+
+    if (testNetOrderCopy())
+    {
+        printf("Byte order conversion test failed\n");
+        return 1;
+    }
+
+    if (testMemory())
+    {
+        printf("Memory test failed\n");
+        return 1;
+    }
+
     if(testNetwork())
     {
         printf("Network testing failed\n");
@@ -18,6 +18,24 @@
  *
  * $Id$
  *
+ *      AG 2026-10-16: Test 31: PD sending before tlc_updateSession (send heap in indexed builds)
+ *      AG 2026-10-16: Test 30: TCP MD received in chunks (stream of TRDP_MD_CONFIG_T)
+ *      AG 2026-10-16: Test 29: TCP connection pool (tlm_preConnect, tlc_getTcpPoolStatistics)
+ *      AG 2026-10-16: Test 28: MD timeout supervision (deadline heap)
+ *      AG 2026-10-16: Test 27: Many MD listeners (listener index)
+ *      AG 2026-10-16: Test 26: Many concurrent MD sessions (session ID hash)
+ *      AG 2026-10-16: trdp_loop: run while the session is open, the thread id may not be stored yet;
+ *                     test_deinit: do not terminate threads not created
+ *      AG 2026-10-16: Test 25: XML binary configuration cache
+ *      AG 2026-10-16: Test 24: Bulk put and get (tlp_putMany, tlp_getMany)
+ *      AG 2026-10-16: Test 23: Publishing in place (tlp_reserve, tlp_commit)
+ *      AG 2026-10-16: Test 22: Zero copy PD reception (tlp_getRef, tlp_release)
+ *      AG 2026-10-16: Test 21: Event loop (tlc_processEvents)
+ *      AG 2026-10-16: Test 20: PD send scheduling (send heap)
+ *      AG 2026-10-16: Test 19: PD timeout supervision (deadline heap)
+ *      AG 2026-10-16: trdp_loop: initialize noDesc
+ *      AG 2026-10-16: Test 9 checks the sequence counter tables of the subscriptions
+ *      AG 2026-10-16: Test 9 reports the PD receive batch statistics
  *      AM 2022-12-01: Ticket #399 Abstract socket type (VOS_SOCK_T, TRDP_SOCK_T) introduced, vos_select function is not anymore called with '+1'
  *      BL 2019-08-27: Interval timing in test 9 changed
  *      BL 2018-03-06: Ticket #101 Optional callback function on PD send
@@ -44,6 +62,7 @@
 #include "vos_utils.h"
 
 #include "tau_xml.h"
+#include "tau_marshall.h"
 #include "vos_shared_mem.h"
 
 /***********************************************************************************************************************
@@ -56,6 +75,7 @@ typedef int (test_func_t)(void);
 UINT32      gDestMC = 0xEF000202u;
 int         gFailed;
 int         gFullLog = FALSE;
+int         gUseEvents = FALSE;     /* trdp_loop uses tlc_processEvents() instead of select() */
 
 static FILE *gFp = NULL;
 
@@ -449,15 +469,25 @@ static void *trdp_loop (void *pArg)
     /*
         Enter the main processing loop.
      */
-    while (pSession->threadId)
+    /* the thread id may not be stored yet, the session is opened before the thread is created */
+    while (pSession->appHandle != NULL)
     {
         TRDP_FDS_T  rfds;
-        INT32       noDesc;
+        INT32       noDesc = 0;
         INT32       rv;
         TRDP_TIME_T tv;
         TRDP_TIME_T max_tv  = {0u, 20000};
         TRDP_TIME_T min_tv  = {0u, 5000};
 
+#ifndef HIGH_PERF_INDEXED
+        if (gUseEvents)
+        {
+            /* wait for ready sockets and process them in one call */
+            (void) tlc_processEvents(pSession->appHandle, &max_tv);
+            continue;
+        }
+#endif
+
         /*
          Prepare the file descriptor set for the select call.
          Additional descriptors can be added here.
@@ -576,18 +606,20 @@ static void test_deinit (
     TRDP_THREAD_SESSION_T   *pSession1,
     TRDP_THREAD_SESSION_T   *pSession2)
 {
-    if (pSession1)
+    /* vos_threadTerminate(NULL) would end the calling thread */
+    if (pSession1 && pSession1->threadId)
     {
         //pSession1->threadRun = 0;
         vos_threadTerminate(pSession1->threadId);
         vos_threadDelay(100000);
     }
-    if (pSession2)
+    if (pSession2 && pSession2->threadId)
     {
         //pSession2->threadRun = 0;
         vos_threadTerminate(pSession2->threadId);
         vos_threadDelay(100000);
     }
+    gUseEvents = FALSE;
     tlc_terminate();
 }
 
@@ -1411,6 +1443,45 @@ static int test9 ()
                 }
             }
         }
+
+        {
+            TRDP_PD_BATCH_STATISTICS_T batchStats;
+
+            err = tlc_getPdBatchStatistics(gSession2.appHandle, &batchStats);
+            IF_ERROR("tlc_getPdBatchStatistics");
+            fprintf(gFp, "\nReceive batches: %u, packets: %u, max. batch: %u, avg. batch: %u.%02u\n",
+                    batchStats.numRxBatches, batchStats.numRxPackets, batchStats.maxRxBatchSize,
+                    batchStats.avgRxBatchSize / 100u, batchStats.avgRxBatchSize % 100u);
+#ifndef HIGH_PERF_INDEXED
+            /* nothing is received in indexed builds, trdp_loop uses tlc_process() */
+            if ((batchStats.numRxPackets == 0u) || (batchStats.numRxPackets < batchStats.numRxBatches))
+            {
+                fprintf(gFp, "### unexpected batch statistics\n");
+                gFailed = 1;
+                goto end;
+            }
+#endif
+        }
+
+        {
+            static TRDP_SUBS_SEQ_STATISTICS_T seqStats[TEST9_NO_OF_TELEGRAMS + 8u];
+            UINT16 numSubs = TEST9_NO_OF_TELEGRAMS + 8u;
+            UINT16 j;
+
+            err = tlc_getSubsSeqStatistics(gSession2.appHandle, &numSubs, seqStats);
+            IF_ERROR("tlc_getSubsSeqStatistics");
+            for (j = 0u; j < numSubs; j++)
+            {
+                if ((seqStats[j].comId >= TEST9_COMID) && (seqStats[j].comId < (TEST9_COMID + TEST9_NO_OF_TELEGRAMS)) &&
+                    ((seqStats[j].numSenders > 1u) || (seqStats[j].numSenders > seqStats[j].tableSize / 2u)))
+                {
+                    fprintf(gFp, "### unexpected sequence counter table of comId %u: %u senders, %u slots\n",
+                            seqStats[j].comId, seqStats[j].numSenders, seqStats[j].tableSize);
+                    gFailed = 1;
+                    goto end;
+                }
+            }
+        }
     }
 
     /* ------------------------- test code ends here --------------------------- */
@@ -2268,6 +2339,1722 @@ static int test18 ()
 
 
 
+/**********************************************************************************************************************/
+/** test19
+ *  A subscription must time out exactly once after its publisher stopped and be supervised again after the
+ *  publisher resumed; a second subscription without traffic must time out in between.
+ *  Publisher and subscriber share one session (and socket), the telegrams are sent to the own address.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+static UINT32   gTest19Timeouts[2];
+static UINT32   gTest19Received;
+
+static void test19PDcallBack (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    UINT32 idx = (UINT32) (uintptr_t) pMsg->pUserRef;
+
+    if (pMsg->resultCode == TRDP_TIMEOUT_ERR)
+    {
+        gTest19Timeouts[idx]++;
+    }
+    else if ((pMsg->resultCode == TRDP_NO_ERR) && (idx == 0u))
+    {
+        gTest19Received++;
+    }
+}
+
+static int test19 ()
+{
+    PREPARE("PD timeout supervision", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, trdp_loop uses tlc_process()\n");
+#else
+    {
+        TRDP_PUB_T  pubHandle;
+        TRDP_SUB_T  subHandle[2];
+        UINT32      counter;
+
+#define TEST19_COMID     1900u
+#define TEST19_INTERVAL  50000u
+#define TEST19_TIMEOUT   (TEST19_INTERVAL * 4u)
+#define TEST19_DATA      "Timeout supervision"
+
+        memset(gTest19Timeouts, 0, sizeof(gTest19Timeouts));
+        gTest19Received = 0u;
+
+        err = tlp_publish(gSession1.appHandle, &pubHandle, NULL, NULL, 0u, TEST19_COMID, 0u, 0u,
+                          0u, gSession1.ifaceIP, TEST19_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL,
+                          (UINT8 *) TEST19_DATA, sizeof(TEST19_DATA));
+        IF_ERROR("tlp_publish");
+
+        err = tlp_subscribe(gSession1.appHandle, &subHandle[0], (void *) 0u, test19PDcallBack, 0u,
+                            TEST19_COMID, 0u, 0u, gSession1.ifaceIP, 0u, 0u, TRDP_FLAGS_CALLBACK, NULL,
+                            TEST19_TIMEOUT, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe");
+
+        /* nobody publishes this one */
+        err = tlp_subscribe(gSession1.appHandle, &subHandle[1], (void *) 1u, test19PDcallBack, 0u,
+                            TEST19_COMID + 1u, 0u, 0u, gSession1.ifaceIP, 0u, 0u, TRDP_FLAGS_CALLBACK, NULL,
+                            TEST19_TIMEOUT, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe");
+
+        /* 1s of traffic: no timeout expected for the first subscription */
+        for (counter = 0u; counter < 20u; counter++)
+        {
+            vos_threadDelay(TEST19_INTERVAL);
+        }
+        if ((gTest19Received == 0u) || (gTest19Timeouts[0] != 0u) || (gTest19Timeouts[1] != 1u))
+        {
+            fprintf(gFp, "### with traffic: received %u, timeouts %u / %u\n",
+                    gTest19Received, gTest19Timeouts[0], gTest19Timeouts[1]);
+            gFailed = 1;
+            goto end;
+        }
+
+        /* stop publishing: exactly one timeout expected */
+        err = tlp_unpublish(gSession1.appHandle, pubHandle);
+        IF_ERROR("tlp_unpublish");
+        vos_threadDelay(TEST19_TIMEOUT * 4u);
+        if (gTest19Timeouts[0] != 1u)
+        {
+            fprintf(gFp, "### after unpublish: %u timeouts\n", gTest19Timeouts[0]);
+            gFailed = 1;
+            goto end;
+        }
+
+        /* publish again: supervision restarts, stop again: second timeout */
+        err = tlp_publish(gSession1.appHandle, &pubHandle, NULL, NULL, 0u, TEST19_COMID, 0u, 0u,
+                          0u, gSession1.ifaceIP, TEST19_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL,
+                          (UINT8 *) TEST19_DATA, sizeof(TEST19_DATA));
+        IF_ERROR("tlp_publish");
+        vos_threadDelay(TEST19_TIMEOUT * 2u);
+        err = tlp_unpublish(gSession1.appHandle, pubHandle);
+        IF_ERROR("tlp_unpublish");
+        vos_threadDelay(TEST19_TIMEOUT * 4u);
+        if ((gTest19Timeouts[0] != 2u) || (gTest19Timeouts[1] != 1u))
+        {
+            fprintf(gFp, "### after republish: timeouts %u / %u\n", gTest19Timeouts[0], gTest19Timeouts[1]);
+            gFailed = 1;
+            goto end;
+        }
+        fprintf(gFp, "received %u, timeouts %u / %u\n", gTest19Received, gTest19Timeouts[0], gTest19Timeouts[1]);
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test20
+ *  Publishers with different intervals must be sent at their own rate; after one of them was unpublished, the
+ *  others must go on at their rate.
+ *  The number of sent telegrams is taken from the publisher statistics.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define TEST20_PUBS         3u
+#define TEST20_MAX_STATS    8u
+
+static int test20CheckRate (
+    TRDP_APP_SESSION_T  appHandle,
+    UINT32              firstPub,
+    const UINT32        *pInterval,
+    const UINT32        *pBefore,
+    UINT32              duration,
+    UINT32              *pAfter)
+{
+    TRDP_PUB_STATISTICS_T   pubStats[TEST20_MAX_STATS];
+    UINT16                  numPub  = TEST20_MAX_STATS;
+    int                     ok      = 1;
+    UINT32                  i, j;
+
+    if (tlc_getPubStatistics(appHandle, &numPub, pubStats) != TRDP_NO_ERR)
+    {
+        fprintf(gFp, "### tlc_getPubStatistics failed\n");
+        return 0;
+    }
+    for (i = firstPub; i < TEST20_PUBS; i++)
+    {
+        UINT32 expected = duration / pInterval[i];
+
+        pAfter[i] = 0u;
+        for (j = 0u; j < numPub; j++)
+        {
+            if (pubStats[j].cycle == pInterval[i])
+            {
+                pAfter[i] = pubStats[j].numSend;
+            }
+        }
+        /* allow for 30% jitter of the test loop */
+        if (((pAfter[i] - pBefore[i]) < (expected * 7u) / 10u) || ((pAfter[i] - pBefore[i]) > (expected * 13u) / 10u))
+        {
+            fprintf(gFp, "### interval %u: sent %u, expected %u\n", pInterval[i], pAfter[i] - pBefore[i], expected);
+            ok = 0;
+        }
+    }
+    return ok;
+}
+
+static int test20 ()
+{
+    PREPARE("PD send scheduling", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, trdp_loop uses tlc_process()\n");
+#else
+    {
+        static const UINT32 interval[TEST20_PUBS] = {20000u, 50000u, 100000u};
+        TRDP_PUB_T  pubHandle[TEST20_PUBS];
+        UINT32      before[TEST20_PUBS];
+        UINT32      after[TEST20_PUBS];
+        UINT32      i;
+
+#define TEST20_COMID     2000u
+#define TEST20_DURATION  1000000u
+#define TEST20_DATA      "Send scheduling"
+
+        memset(before, 0, sizeof(before));
+
+        for (i = 0u; i < TEST20_PUBS; i++)
+        {
+            err = tlp_publish(gSession1.appHandle, &pubHandle[i], NULL, NULL, 0u, TEST20_COMID + i, 0u, 0u,
+                              0u, gSession2.ifaceIP, interval[i], 0u, TRDP_FLAGS_DEFAULT, NULL,
+                              (UINT8 *) TEST20_DATA, sizeof(TEST20_DATA));
+            IF_ERROR("tlp_publish");
+        }
+
+        /* every publisher at its own rate */
+        vos_threadDelay(TEST20_DURATION);
+        if (!test20CheckRate(gSession1.appHandle, 0u, interval, before, TEST20_DURATION, after))
+        {
+            gFailed = 1;
+            goto end;
+        }
+
+        /* the fastest one stops, the others go on */
+        err = tlp_unpublish(gSession1.appHandle, pubHandle[0]);
+        IF_ERROR("tlp_unpublish");
+        memcpy(before, after, sizeof(before));
+        vos_threadDelay(TEST20_DURATION);
+        if (!test20CheckRate(gSession1.appHandle, 1u, interval, before, TEST20_DURATION, after))
+        {
+            gFailed = 1;
+            goto end;
+        }
+        fprintf(gFp, "sent %u / %u\n", after[1], after[2]);
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test21
+ *  The sessions are processed by tlc_processEvents(): PD must be sent at the publisher rates, MD requests via
+ *  UDP and TCP (new connections on the listen socket) must be replied.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define TEST21_COMID        2100u
+#define TEST21_MD_COMID     2110u
+#define TEST21_REQUESTS     5u
+#define TEST21_REQUEST      "Event loop request"
+#define TEST21_REPLY        "Event loop reply"
+
+static UINT32 gTest21Replies = 0u;
+
+static void test21CBFunction (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    if (pMsg->comId != TEST21_MD_COMID)
+    {
+        return;
+    }
+    if (pMsg->resultCode != TRDP_NO_ERR)
+    {
+        fprintf(gFp, "### MD error %d (msgType %x)\n", pMsg->resultCode, pMsg->msgType);
+    }
+    else if (pMsg->msgType == TRDP_MSG_MR)
+    {
+        if (tlm_reply(appHandle, &pMsg->sessionId, TEST21_MD_COMID, 0u, NULL,
+                      (UINT8 *) TEST21_REPLY, sizeof(TEST21_REPLY), NULL) != TRDP_NO_ERR)
+        {
+            fprintf(gFp, "### tlm_reply failed\n");
+        }
+    }
+    else if ((pMsg->msgType == TRDP_MSG_MP) &&
+             (pData != NULL) &&
+             (dataSize == sizeof(TEST21_REPLY)) &&
+             (memcmp(pData, TEST21_REPLY, sizeof(TEST21_REPLY)) == 0))
+    {
+        gTest21Replies++;
+    }
+}
+
+static int test21 ()
+{
+    gUseEvents = TRUE;
+    PREPARE("Event loop", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, tlc_processEvents() is not supported\n");
+#else
+    {
+        static const UINT32 interval[TEST20_PUBS] = {20000u, 50000u, 100000u};
+        TRDP_PUB_T  pubHandle[TEST20_PUBS];
+        UINT32      before[TEST20_PUBS];
+        UINT32      after[TEST20_PUBS];
+        TRDP_LIS_T  listenHandle[2];
+        TRDP_UUID_T sessionId;
+        UINT32      i;
+
+        memset(before, 0, sizeof(before));
+        gTest21Replies = 0u;
+
+        for (i = 0u; i < TEST20_PUBS; i++)
+        {
+            err = tlp_publish(gSession1.appHandle, &pubHandle[i], NULL, NULL, 0u, TEST21_COMID + i, 0u, 0u,
+                              0u, gSession2.ifaceIP, interval[i], 0u, TRDP_FLAGS_DEFAULT, NULL,
+                              (UINT8 *) TEST21_REQUEST, sizeof(TEST21_REQUEST));
+            IF_ERROR("tlp_publish");
+        }
+
+        err = tlm_addListener(appHandle2, &listenHandle[0], NULL, test21CBFunction, TRUE,
+                              TEST21_MD_COMID, 0u, 0u, 0u, VOS_INADDR_ANY, VOS_INADDR_ANY,
+                              TRDP_FLAGS_CALLBACK, NULL, NULL);
+        IF_ERROR("tlm_addListener");
+        err = tlm_addListener(appHandle2, &listenHandle[1], NULL, test21CBFunction, TRUE,
+                              TEST21_MD_COMID, 0u, 0u, 0u, VOS_INADDR_ANY, VOS_INADDR_ANY,
+                              TRDP_FLAGS_CALLBACK | TRDP_FLAGS_TCP, NULL, NULL);
+        IF_ERROR("tlm_addListener");
+
+        /* requests via UDP and TCP, the TCP connection is accepted on the registered listen socket */
+        for (i = 0u; i < 2u * TEST21_REQUESTS; i++)
+        {
+            err = tlm_request(appHandle1, NULL, test21CBFunction, &sessionId, TEST21_MD_COMID, 0u, 0u,
+                              0u, gSession2.ifaceIP,
+                              (i < TEST21_REQUESTS) ? TRDP_FLAGS_CALLBACK : (TRDP_FLAGS_CALLBACK | TRDP_FLAGS_TCP),
+                              1u, 1000000u, NULL, (UINT8 *) TEST21_REQUEST, sizeof(TEST21_REQUEST), NULL, NULL);
+            IF_ERROR("tlm_request");
+            vos_threadDelay(100000u);
+        }
+
+        vos_threadDelay(TEST20_DURATION - 2u * TEST21_REQUESTS * 100000u);
+        if (!test20CheckRate(gSession1.appHandle, 0u, interval, before, TEST20_DURATION, after))
+        {
+            gFailed = 1;
+            goto end;
+        }
+        if (gTest21Replies != 2u * TEST21_REQUESTS)
+        {
+            fprintf(gFp, "### %u of %u replies received\n", gTest21Replies, 2u * TEST21_REQUESTS);
+            gFailed = 1;
+            goto end;
+        }
+
+        for (i = 0u; i < 2u; i++)
+        {
+            err = tlm_delListener(appHandle2, listenHandle[i]);
+            IF_ERROR("tlm_delListener");
+        }
+        fprintf(gFp, "sent %u / %u / %u, replies %u\n", after[0], after[1], after[2], gTest21Replies);
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test22
+ *  Zero copy PD reception: data referenced by tlp_getRef() must not change while newer telegrams are received,
+ *  tlp_get() delivers the newer data meanwhile.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int test22 ()
+{
+    PREPARE("Zero copy PD reception", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, trdp_loop uses tlc_process()\n");
+#else
+    {
+        TRDP_PUB_T      pubHandle;
+        TRDP_SUB_T      subHandle;
+        TRDP_PD_INFO_T  pdInfo;
+        const UINT8     *pRef1 = NULL;
+        const UINT8     *pRef2 = NULL;
+        UINT32          size1, size2;
+        char            data1[32u];
+        char            data2[32u];
+        UINT32          i;
+
+#define TEST22_COMID     2200u
+#define TEST22_INTERVAL  20000u
+
+        sprintf(data1, "Zero copy %05u", 0u);
+        err = tlp_publish(gSession1.appHandle, &pubHandle, NULL, NULL, 0u, TEST22_COMID, 0u, 0u,
+                          0u, gSession1.ifaceIP, TEST22_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL,
+                          (UINT8 *) data1, (UINT32) strlen(data1) + 1u);
+        IF_ERROR("tlp_publish");
+
+        err = tlp_subscribe(gSession1.appHandle, &subHandle, NULL, NULL, 0u, TEST22_COMID, 0u, 0u,
+                            gSession1.ifaceIP, 0u, 0u, TRDP_FLAGS_DEFAULT, NULL, TEST22_INTERVAL * 50u, TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe");
+
+        for (i = 0u; i < 50u; i++)
+        {
+            vos_threadDelay(TEST22_INTERVAL);
+            err = tlp_getRef(gSession1.appHandle, subHandle, &pdInfo, &pRef1, &size1);
+            if (err != TRDP_NODATA_ERR)
+            {
+                break;
+            }
+        }
+        IF_ERROR("tlp_getRef");
+        if ((pRef1 == NULL) || (size1 != strlen(data1) + 1u) || (strcmp((const char *) pRef1, data1) != 0) ||
+            (pdInfo.comId != TEST22_COMID))
+        {
+            fprintf(gFp, "### tlp_getRef delivered wrong data\n");
+            gFailed = 1;
+            goto end;
+        }
+
+        /* newer telegrams are received while the first one is referenced */
+        sprintf(data1, "Zero copy %05u", 1u);
+        err = tlp_put(gSession1.appHandle, pubHandle, (UINT8 *) data1, (UINT32) strlen(data1) + 1u);
+        IF_ERROR("tlp_put");
+        vos_threadDelay(TEST22_INTERVAL * 10u);
+
+        if (strcmp((const char *) pRef1, "Zero copy 00000") != 0)
+        {
+            fprintf(gFp, "### referenced data changed: %s\n", (const char *) pRef1);
+            gFailed = 1;
+            goto end;
+        }
+        size2 = sizeof(data2);
+        err = tlp_get(gSession1.appHandle, subHandle, NULL, (UINT8 *) data2, &size2);
+        IF_ERROR("tlp_get");
+        if (strcmp(data2, data1) != 0)
+        {
+            fprintf(gFp, "### tlp_get delivered old data: %s\n", data2);
+            gFailed = 1;
+            goto end;
+        }
+        err = tlp_getRef(gSession1.appHandle, subHandle, NULL, &pRef2, &size2);
+        if (err != TRDP_BLOCK_ERR)
+        {
+            fprintf(gFp, "### tlp_getRef on a superseded reference: %d\n", err);
+            gFailed = 1;
+            goto end;
+        }
+
+        err = tlp_release(gSession1.appHandle, subHandle, pRef1);
+        IF_ERROR("tlp_release");
+        err = tlp_release(gSession1.appHandle, subHandle, pRef1);
+        if (err != TRDP_PARAM_ERR)
+        {
+            fprintf(gFp, "### tlp_release of a released reference: %d\n", err);
+            gFailed = 1;
+            goto end;
+        }
+
+        /* nested references to the current telegram */
+        err = tlp_getRef(gSession1.appHandle, subHandle, NULL, &pRef1, &size1);
+        IF_ERROR("tlp_getRef");
+        err = tlp_getRef(gSession1.appHandle, subHandle, NULL, &pRef2, &size2);
+        IF_ERROR("tlp_getRef");
+        if ((strcmp((const char *) pRef1, data1) != 0) || (strcmp((const char *) pRef2, data1) != 0))
+        {
+            fprintf(gFp, "### tlp_getRef delivered old data\n");
+            gFailed = 1;
+            goto end;
+        }
+        err = tlp_release(gSession1.appHandle, subHandle, pRef2);
+        IF_ERROR("tlp_release");
+        vos_threadDelay(TEST22_INTERVAL * 5u);
+        err = tlp_release(gSession1.appHandle, subHandle, pRef1);
+        IF_ERROR("tlp_release");
+
+        err = tlp_unsubscribe(gSession1.appHandle, subHandle);
+        IF_ERROR("tlp_unsubscribe");
+        err = tlp_unpublish(gSession1.appHandle, pubHandle);
+        IF_ERROR("tlp_unpublish");
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test23
+ *  Publishing in place: data written into a reserved frame must not be sent before tlp_commit(), the former data
+ *  is sent meanwhile.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int test23 ()
+{
+    PREPARE("Publishing in place", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, trdp_loop uses tlc_process()\n");
+#else
+    {
+        static const char   *text[3] = {"In place 1", "In place 22", "In place 333"};
+        TRDP_PUB_T          pubHandle;
+        TRDP_SUB_T          subHandle;
+        UINT8               *pFrameData;
+        char                data[32u];
+        UINT32              dataSize;
+        UINT32              i;
+
+#define TEST23_COMID     2300u
+#define TEST23_INTERVAL  20000u
+
+        /* no data yet, nothing is sent */
+        err = tlp_publish(gSession1.appHandle, &pubHandle, NULL, NULL, 0u, TEST23_COMID, 0u, 0u,
+                          0u, gSession1.ifaceIP, TEST23_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL, NULL, 0u);
+        IF_ERROR("tlp_publish");
+        err = tlp_subscribe(gSession1.appHandle, &subHandle, NULL, NULL, 0u, TEST23_COMID, 0u, 0u,
+                            gSession1.ifaceIP, 0u, 0u, TRDP_FLAGS_DEFAULT, NULL, TEST23_INTERVAL * 50u,
+                            TRDP_TO_DEFAULT);
+        IF_ERROR("tlp_subscribe");
+
+        err = tlp_commit(gSession1.appHandle, pubHandle, 0u);
+        if (err != TRDP_PARAM_ERR)
+        {
+            fprintf(gFp, "### tlp_commit without tlp_reserve: %d\n", err);
+            gFailed = 1;
+            goto end;
+        }
+
+        for (i = 0u; i < 3u; i++)
+        {
+            err = tlp_reserve(gSession1.appHandle, pubHandle, sizeof(data), &pFrameData);
+            IF_ERROR("tlp_reserve");
+            strcpy((char *) pFrameData, text[i]);
+            vos_threadDelay(TEST23_INTERVAL * 5u);
+
+            /* the reserved frame is not sent yet */
+            dataSize    = sizeof(data);
+            err         = tlp_get(gSession1.appHandle, subHandle, NULL, (UINT8 *) data, &dataSize);
+            if (((i == 0u) && (err != TRDP_NODATA_ERR)) ||
+                ((i > 0u) && ((err != TRDP_NO_ERR) || (strcmp(data, text[i - 1u]) != 0))))
+            {
+                fprintf(gFp, "### uncommitted data sent (%d)\n", err);
+                gFailed = 1;
+                goto end;
+            }
+
+            err = tlp_commit(gSession1.appHandle, pubHandle, (UINT32) strlen(text[i]) + 1u);
+            IF_ERROR("tlp_commit");
+            vos_threadDelay(TEST23_INTERVAL * 5u);
+
+            dataSize    = sizeof(data);
+            err         = tlp_get(gSession1.appHandle, subHandle, NULL, (UINT8 *) data, &dataSize);
+            IF_ERROR("tlp_get");
+            if ((dataSize != strlen(text[i]) + 1u) || (strcmp(data, text[i]) != 0))
+            {
+                fprintf(gFp, "### committed data not received: %s\n", data);
+                gFailed = 1;
+                goto end;
+            }
+        }
+
+        /* tlp_put still works on the swapped frames */
+        err = tlp_put(gSession1.appHandle, pubHandle, (const UINT8 *) "Copied", 7u);
+        IF_ERROR("tlp_put");
+        vos_threadDelay(TEST23_INTERVAL * 5u);
+        dataSize    = sizeof(data);
+        err         = tlp_get(gSession1.appHandle, subHandle, NULL, (UINT8 *) data, &dataSize);
+        IF_ERROR("tlp_get");
+        if (strcmp(data, "Copied") != 0)
+        {
+            fprintf(gFp, "### tlp_put data not received: %s\n", data);
+            gFailed = 1;
+            goto end;
+        }
+
+        /* a reservation not committed is freed on unpublish */
+        err = tlp_reserve(gSession1.appHandle, pubHandle, 1000u, &pFrameData);
+        IF_ERROR("tlp_reserve");
+        err = tlp_unpublish(gSession1.appHandle, pubHandle);
+        IF_ERROR("tlp_unpublish");
+        err = tlp_unsubscribe(gSession1.appHandle, subHandle);
+        IF_ERROR("tlp_unsubscribe");
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test24
+ *  Bulk put and get: many telegrams are updated by one tlp_putMany() and read by one tlp_getMany() per cycle,
+ *  the results are reported per entry.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+#define TEST24_TELEGRAMS    64u
+
+static int test24 ()
+{
+    PREPARE("Bulk put and get", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, trdp_loop uses tlc_process()\n");
+#else
+    {
+        TRDP_PUB_T          pubHandle[TEST24_TELEGRAMS];
+        TRDP_SUB_T          subHandle[TEST24_TELEGRAMS];
+        TRDP_PUT_ENTRY_T    putEntry[TEST24_TELEGRAMS + 1u];
+        TRDP_GET_ENTRY_T    getEntry[TEST24_TELEGRAMS + 1u];
+        TRDP_PD_INFO_T      pdInfo[TEST24_TELEGRAMS];
+        char                txData[TEST24_TELEGRAMS][32u];
+        char                rxData[TEST24_TELEGRAMS][32u];
+        UINT32              i, cycle;
+
+#define TEST24_COMID     2400u
+#define TEST24_INTERVAL  20000u
+
+        for (i = 0u; i < TEST24_TELEGRAMS; i++)
+        {
+            err = tlp_publish(gSession1.appHandle, &pubHandle[i], NULL, NULL, 0u, TEST24_COMID + i, 0u, 0u,
+                              0u, gSession1.ifaceIP, TEST24_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL, NULL, 0u);
+            IF_ERROR("tlp_publish");
+            err = tlp_subscribe(gSession1.appHandle, &subHandle[i], NULL, NULL, 0u, TEST24_COMID + i, 0u, 0u,
+                                gSession1.ifaceIP, 0u, 0u, TRDP_FLAGS_DEFAULT, NULL, TEST24_INTERVAL * 50u,
+                                TRDP_TO_DEFAULT);
+            IF_ERROR("tlp_subscribe");
+        }
+
+        for (cycle = 0u; cycle < 3u; cycle++)
+        {
+            for (i = 0u; i < TEST24_TELEGRAMS; i++)
+            {
+                sprintf(txData[i], "Bulk %u/%u", cycle, i);
+                putEntry[i].pubHandle   = pubHandle[i];
+                putEntry[i].pData       = (const UINT8 *) txData[i];
+                putEntry[i].dataSize    = (UINT32) strlen(txData[i]) + 1u;
+            }
+            err = tlp_putMany(gSession1.appHandle, putEntry, TEST24_TELEGRAMS);
+            IF_ERROR("tlp_putMany");
+
+            vos_threadDelay(TEST24_INTERVAL * 5u);
+
+            for (i = 0u; i < TEST24_TELEGRAMS; i++)
+            {
+                getEntry[i].subHandle   = subHandle[i];
+                getEntry[i].pPdInfo     = &pdInfo[i];
+                getEntry[i].pData       = (UINT8 *) rxData[i];
+                getEntry[i].dataSize    = sizeof(rxData[i]);
+            }
+            err = tlp_getMany(gSession1.appHandle, getEntry, TEST24_TELEGRAMS);
+            IF_ERROR("tlp_getMany");
+            for (i = 0u; i < TEST24_TELEGRAMS; i++)
+            {
+                if ((getEntry[i].result != TRDP_NO_ERR) ||
+                    (getEntry[i].dataSize != strlen(txData[i]) + 1u) ||
+                    (strcmp(rxData[i], txData[i]) != 0) ||
+                    (pdInfo[i].comId != TEST24_COMID + i))
+                {
+                    fprintf(gFp, "### entry %u: %d, %s\n", i, getEntry[i].result, rxData[i]);
+                    gFailed = 1;
+                    goto end;
+                }
+            }
+        }
+
+        /* an invalid entry is reported, the others are processed */
+        putEntry[TEST24_TELEGRAMS].pubHandle    = NULL;
+        putEntry[TEST24_TELEGRAMS].pData        = NULL;
+        putEntry[TEST24_TELEGRAMS].dataSize     = 0u;
+        getEntry[TEST24_TELEGRAMS].subHandle    = (TRDP_SUB_T) pubHandle[0];
+        getEntry[TEST24_TELEGRAMS].pPdInfo      = NULL;
+        getEntry[TEST24_TELEGRAMS].pData        = NULL;
+        getEntry[TEST24_TELEGRAMS].dataSize     = 0u;
+        err = tlp_putMany(gSession1.appHandle, putEntry, TEST24_TELEGRAMS + 1u);
+        if ((err != TRDP_PARAM_ERR) || (putEntry[TEST24_TELEGRAMS].result != TRDP_PARAM_ERR) ||
+            (putEntry[0].result != TRDP_NO_ERR))
+        {
+            fprintf(gFp, "### tlp_putMany with invalid entry: %d\n", err);
+            gFailed = 1;
+            goto end;
+        }
+        getEntry[0].dataSize = sizeof(rxData[0]);
+        err = tlp_getMany(gSession1.appHandle, getEntry, TEST24_TELEGRAMS + 1u);
+        if ((err != TRDP_NOSUB_ERR) || (getEntry[TEST24_TELEGRAMS].result != TRDP_NOSUB_ERR) ||
+            (getEntry[0].result != TRDP_NO_ERR))
+        {
+            fprintf(gFp, "### tlp_getMany with invalid entry: %d\n", err);
+            gFailed = 1;
+            goto end;
+        }
+
+        for (i = 0u; i < TEST24_TELEGRAMS; i++)
+        {
+            err = tlp_unpublish(gSession1.appHandle, pubHandle[i]);
+            IF_ERROR("tlp_unpublish");
+            err = tlp_unsubscribe(gSession1.appHandle, subHandle[i]);
+            IF_ERROR("tlp_unsubscribe");
+        }
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test25
+ *  The binary configuration cache must deliver the configuration read by tau_readXml..., be used on the next load
+ *  and be rebuilt after the XML file or the cache file changed.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+#define TEST25_XML      "api_test25.xml"
+#define TEST25_CACHE    "api_test25.xml.cache"
+
+/* Write the XML configuration, the first cycle attribute replaced */
+static int test25WriteXml (
+    const char *pCycle)
+{
+    FILE    *pFile = fopen(TEST25_XML, "wb");
+    char    *pPos   = strstr(xmlBuffer, "cycle=\"500000\"");
+    size_t  head    = (size_t) (pPos - xmlBuffer) + strlen("cycle=\"");
+    int     ok;
+
+    if (pFile == NULL)
+    {
+        return 0;
+    }
+    ok = (fwrite(xmlBuffer, 1u, head, pFile) == head) &&
+         (fwrite(pCycle, 1u, strlen(pCycle), pFile) == strlen(pCycle)) &&
+         (fputs(pPos + strlen("cycle=\"500000"), pFile) >= 0);
+    return (fclose(pFile) == 0) && ok;
+}
+
+/* Compare the cached configuration with the one read from the XML file, returns the difference found */
+static const char *test25Compare (
+    const TAU_XML_CACHE_T *pCache)
+{
+    TRDP_XML_DOC_HANDLE_T   docHnd;
+    TRDP_MEM_CONFIG_T       memConfig[2];
+    TRDP_DBG_CONFIG_T       dbgConfig[2];
+    UINT32                  numComPar[2], numIfConfig[2], numExchgPar[2], numComId[2], numDataset[2];
+    TRDP_COM_PAR_T          *pComPar[2];
+    TRDP_IF_CONFIG_T        *pIfConfig[2];
+    TRDP_PROCESS_CONFIG_T   processConfig[2];
+    TRDP_PD_CONFIG_T        pdConfig[2];
+    TRDP_MD_CONFIG_T        mdConfig[2];
+    TRDP_EXCHG_PAR_T        *pExchgPar[2];
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap[2];
+    apTRDP_DATASET_T        apDataset[2];
+    const char              *pDiff = NULL;
+    UINT32                  i;
+
+    if ((tau_prepareXmlDoc(TEST25_XML, &docHnd) != TRDP_NO_ERR) ||
+        (tau_readXmlDeviceConfig(&docHnd, &memConfig[0], &dbgConfig[0], &numComPar[0], &pComPar[0],
+                                 &numIfConfig[0], &pIfConfig[0]) != TRDP_NO_ERR) ||
+        (tau_readXmlInterfaceConfig(&docHnd, pIfConfig[0][0].ifName, &processConfig[0], &pdConfig[0],
+                                    &mdConfig[0], &numExchgPar[0], &pExchgPar[0]) != TRDP_NO_ERR) ||
+        (tau_readXmlDatasetConfig(&docHnd, &numComId[0], &pComIdDsIdMap[0], &numDataset[0],
+                                  &apDataset[0]) != TRDP_NO_ERR))
+    {
+        return "tau_readXml... failed";
+    }
+
+    if ((tau_readXmlCacheDeviceConfig(pCache, &memConfig[1], &dbgConfig[1], &numComPar[1], &pComPar[1],
+                                      &numIfConfig[1], &pIfConfig[1]) != TRDP_NO_ERR) ||
+        (tau_readXmlCacheInterfaceConfig(pCache, "ENP0S3:1", &processConfig[1], &pdConfig[1], &mdConfig[1],
+                                         &numExchgPar[1], &pExchgPar[1]) != TRDP_NO_ERR) ||
+        (tau_readXmlCacheDatasetConfig(pCache, &numComId[1], &pComIdDsIdMap[1], &numDataset[1],
+                                       &apDataset[1]) != TRDP_NO_ERR))
+    {
+        pDiff = "tau_readXmlCache... failed";
+    }
+    else if ((memConfig[1].size != memConfig[0].size) ||
+             (memcmp(memConfig[1].prealloc, memConfig[0].prealloc, sizeof(memConfig[0].prealloc)) != 0) ||
+             (strcmp(dbgConfig[1].fileName, dbgConfig[0].fileName) != 0) ||
+             (numComPar[1] != numComPar[0]) || (pComPar[1][2].sendParam.ttl != pComPar[0][2].sendParam.ttl) ||
+             (numIfConfig[1] != numIfConfig[0]) || (pIfConfig[1][0].hostIp != pIfConfig[0][0].hostIp))
+    {
+        pDiff = "device configuration differs";
+    }
+    else if ((strcmp(processConfig[1].hostName, processConfig[0].hostName) != 0) ||
+             (processConfig[1].cycleTime != processConfig[0].cycleTime) ||
+             (pdConfig[1].timeout != pdConfig[0].timeout) || (mdConfig[1].tcpPort != mdConfig[0].tcpPort) ||
+             (numExchgPar[1] != numExchgPar[0]))
+    {
+        pDiff = "interface configuration differs";
+    }
+    else if ((numComId[1] != numComId[0]) || (numDataset[1] != numDataset[0]) ||
+             (apDataset[1][0]->numElement != apDataset[0][0]->numElement) ||
+             (strcmp(apDataset[1][0]->pElement[1].name, apDataset[0][0]->pElement[1].name) != 0))
+    {
+        pDiff = "dataset configuration differs";
+    }
+    for (i = 0u; (pDiff == NULL) && (i < numExchgPar[0]); i++)
+    {
+        const TRDP_EXCHG_PAR_T *p0 = &pExchgPar[0][i], *p1 = &pExchgPar[1][i];
+
+        if ((p1->comId != p0->comId) || (p1->datasetId != p0->datasetId) || (p1->pPdPar == NULL) ||
+            (p1->pPdPar->cycle != p0->pPdPar->cycle) || (p1->pPdPar->toBehav != p0->pPdPar->toBehav) ||
+            (p1->srcCnt != p0->srcCnt) || (p1->destCnt != p0->destCnt) ||
+            (strcmp(*p1->pSrc[0].pUriHost1, *p0->pSrc[0].pUriHost1) != 0) ||
+            ((p1->pSrc[0].pSdtPar == NULL) != (p0->pSrc[0].pSdtPar == NULL)) ||
+            ((p0->pSrc[0].pSdtPar != NULL) && (p1->pSrc[0].pSdtPar->smi1 != p0->pSrc[0].pSdtPar->smi1)))
+        {
+            pDiff = "telegram configuration differs";
+        }
+    }
+
+    tau_freeTelegrams(numExchgPar[0], pExchgPar[0]);
+    tau_freeXmlDatasetConfig(numComId[0], pComIdDsIdMap[0], numDataset[0], apDataset[0]);
+    vos_memFree(pComPar[0]);
+    vos_memFree(pIfConfig[0]);
+    tau_freeXmlDoc(&docHnd);
+    return pDiff;
+}
+
+/* Telegram cycle of the first telegram in the cache */
+static UINT32 test25Cycle (
+    const TAU_XML_CACHE_T *pCache)
+{
+    TRDP_PD_CONFIG_T    pdConfig;
+    TRDP_MD_CONFIG_T    mdConfig;
+    UINT32              numExchgPar = 0u;
+    TRDP_EXCHG_PAR_T    *pExchgPar  = NULL;
+
+    if ((tau_readXmlCacheInterfaceConfig(pCache, "", NULL, &pdConfig, &mdConfig, &numExchgPar,
+                                         &pExchgPar) != TRDP_NO_ERR) || (numExchgPar == 0u))
+    {
+        return 0u;
+    }
+    return pExchgPar[0].pPdPar->cycle;
+}
+
+static int test25 ()
+{
+    PREPARE1("XML binary configuration cache"); /* allocates appHandle1, failed = 0, err = TRDP_NO_ERR */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+        TAU_XML_CACHE_T         *pCache = NULL;
+        TRDP_PROCESS_CONFIG_T   processConfig;
+        TRDP_PD_CONFIG_T        pdConfig;
+        TRDP_MD_CONFIG_T        mdConfig;
+        UINT32                  numExchgPar, numComId, numDataset;
+        TRDP_EXCHG_PAR_T        *pExchgPar;
+        TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap;
+        apTRDP_DATASET_T        apDataset;
+        void                    *pRefCon = NULL;
+        const char              *pDiff;
+        FILE                    *pFile;
+        int                     pass;
+
+        (void) remove(TEST25_CACHE);
+        if (!test25WriteXml("500000"))
+        {
+            FAILED("writing " TEST25_XML);
+        }
+
+        /* built on the first load, mapped on the second one */
+        for (pass = 0; pass < 2; pass++)
+        {
+            err = tau_loadXmlCache(TEST25_XML, NULL, &pCache);
+            IF_ERROR("tau_loadXmlCache");
+            pDiff = test25Compare(pCache);
+            tau_freeXmlCache(pCache);
+            pCache = NULL;
+            if (pDiff != NULL)
+            {
+                FAILED(pDiff);
+            }
+            pFile = fopen(TEST25_CACHE, "rb");
+            if (pFile == NULL)
+            {
+                FAILED("cache file not written");
+            }
+            (void) fclose(pFile);
+        }
+
+        /* cached arrays are owned by the cache and sorted for tau_initMarshall */
+        err = tau_loadXmlCache(TEST25_XML, TEST25_CACHE, &pCache);
+        IF_ERROR("tau_loadXmlCache");
+        err = tau_readXmlCacheDatasetConfig(pCache, &numComId, &pComIdDsIdMap, &numDataset, &apDataset);
+        IF_ERROR("tau_readXmlCacheDatasetConfig");
+        err = tau_initMarshall(&pRefCon, numComId, pComIdDsIdMap, numDataset, apDataset);
+        IF_ERROR("tau_initMarshall");
+        (void) tau_deInitMarshall(pRefCon);
+        if (tau_readXmlCacheInterfaceConfig(pCache, "eth9", &processConfig, &pdConfig, &mdConfig, &numExchgPar,
+                                            &pExchgPar) != TRDP_PARAM_ERR)
+        {
+            tau_freeXmlCache(pCache);
+            FAILED("unknown interface not reported");
+        }
+        tau_freeXmlCache(pCache);
+        pCache = NULL;
+
+        /* a changed XML file of the same size invalidates the cache */
+        if (!test25WriteXml("250000"))
+        {
+            FAILED("writing " TEST25_XML);
+        }
+        err = tau_loadXmlCache(TEST25_XML, NULL, &pCache);
+        IF_ERROR("tau_loadXmlCache");
+        pDiff = (test25Cycle(pCache) != 250000u) ? "cache not rebuilt after XML change" : test25Compare(pCache);
+        tau_freeXmlCache(pCache);
+        pCache = NULL;
+        if (pDiff != NULL)
+        {
+            FAILED(pDiff);
+        }
+
+        /* a damaged cache file is rebuilt */
+        pFile = fopen(TEST25_CACHE, "r+b");
+        if ((pFile == NULL) || (fseek(pFile, 200, SEEK_SET) != 0) || (fputc(0x5A, pFile) == EOF) ||
+            (fclose(pFile) != 0))
+        {
+            FAILED("damaging the cache file");
+        }
+        err = tau_loadXmlCache(TEST25_XML, NULL, &pCache);
+        IF_ERROR("tau_loadXmlCache");
+        pDiff = (test25Cycle(pCache) != 250000u) ? "damaged cache used" : test25Compare(pCache);
+        tau_freeXmlCache(pCache);
+        pCache = NULL;
+        if (pDiff != NULL)
+        {
+            FAILED(pDiff);
+        }
+
+        (void) remove(TEST25_XML);
+        (void) remove(TEST25_CACHE);
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test26
+ *  Many concurrent MD sessions: replies with query and confirmations must be matched to their sessions in the
+ *  send queue of the caller and the receive queue of the replier, which are indexed by session ID.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define TEST26_COMID        2600u
+#define TEST26_SESSIONS     100u
+#define TEST26_REQUEST      "Session request"
+#define TEST26_REPLY        "Session reply"
+
+static volatile UINT32  gTest26Replies  = 0u;
+static volatile UINT32  gTest26Confirms = 0u;
+static volatile UINT32  gTest26Errors   = 0u;
+
+static void test26CBFunction (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    if (pMsg->resultCode != TRDP_NO_ERR)
+    {
+        fprintf(gFp, "### MD error %d (msgType %x)\n", pMsg->resultCode, pMsg->msgType);
+        gTest26Errors++;
+    }
+    else if (pMsg->msgType == TRDP_MSG_MR)
+    {
+        if (tlm_replyQuery(appHandle, &pMsg->sessionId, TEST26_COMID, 0u, 10000000u, NULL,
+                           (UINT8 *) TEST26_REPLY, sizeof(TEST26_REPLY), NULL) != TRDP_NO_ERR)
+        {
+            gTest26Errors++;
+        }
+    }
+    else if (pMsg->msgType == TRDP_MSG_MQ)
+    {
+        /* the reply must belong to the session it is reported for */
+        if ((pData == NULL) || (dataSize != sizeof(TEST26_REPLY)) ||
+            (memcmp(pData, TEST26_REPLY, sizeof(TEST26_REPLY)) != 0) ||
+            (pMsg->pUserRef == NULL) || (memcmp(pMsg->pUserRef, pMsg->sessionId, TRDP_SESS_ID_SIZE) != 0) ||
+            (tlm_confirm(appHandle, &pMsg->sessionId, 0u, NULL) != TRDP_NO_ERR))
+        {
+            gTest26Errors++;
+        }
+        gTest26Replies++;
+    }
+    else if (pMsg->msgType == TRDP_MSG_MC)
+    {
+        gTest26Confirms++;
+    }
+}
+
+static int test26 ()
+{
+    PREPARE("Many concurrent MD sessions", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, the sessions are processed by tlc_process()\n");
+#else
+    {
+        static TRDP_UUID_T  sessionId[TEST26_SESSIONS];
+        TRDP_LIS_T          listenHandle;
+        UINT32              i, pending, peak, size;
+
+        gTest26Replies  = 0u;
+        gTest26Confirms = 0u;
+        gTest26Errors   = 0u;
+
+        err = tlm_addListener(appHandle2, &listenHandle, NULL, test26CBFunction, TRUE,
+                              TEST26_COMID, 0u, 0u, 0u, VOS_INADDR_ANY, VOS_INADDR_ANY,
+                              TRDP_FLAGS_CALLBACK, NULL, NULL);
+        IF_ERROR("tlm_addListener");
+
+        /* the session ID is the user reference, the callback checks that the reply matched its session */
+        for (i = 0u; i < TEST26_SESSIONS; i++)
+        {
+            err = tlm_request(appHandle1, sessionId[i], test26CBFunction, &sessionId[i], TEST26_COMID, 0u, 0u,
+                              0u, gSession2.ifaceIP, TRDP_FLAGS_CALLBACK, 1u, 10000000u, NULL,
+                              (UINT8 *) TEST26_REQUEST, sizeof(TEST26_REQUEST), NULL, NULL);
+            IF_ERROR("tlm_request");
+        }
+        peak = appHandle1->mdSndHash.count;
+        size = appHandle1->mdSndHash.size;
+
+        for (i = 0u; (i < 200u) && (gTest26Confirms < TEST26_SESSIONS) && (gTest26Errors == 0u); i++)
+        {
+            vos_threadDelay(50000u);
+        }
+        /* wait for the sessions to be closed */
+        for (pending = 1u, i = 0u; (pending > 0u) && (i < 40u); i++)
+        {
+            vos_threadDelay(50000u);
+            pending = appHandle1->mdSndHash.count + appHandle2->mdRcvHash.count;
+        }
+
+        fprintf(gFp, "%u sessions (%u buckets), %u replies, %u confirmations, %u still open\n",
+                peak, size, gTest26Replies, gTest26Confirms, pending);
+        if ((peak < TEST26_SESSIONS) || (size < peak))
+        {
+            FAILED("session hash not grown");
+        }
+        if ((gTest26Errors != 0u) || (gTest26Replies != TEST26_SESSIONS) || (gTest26Confirms != TEST26_SESSIONS))
+        {
+            FAILED("sessions not matched");
+        }
+        if (pending != 0u)
+        {
+            FAILED("sessions not closed");
+        }
+
+        err = tlm_delListener(appHandle2, listenHandle);
+        IF_ERROR("tlm_delListener");
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test27
+ *  Many MD listeners: notifications must be dispatched to the same listener as by walking the listener queue, i.e.
+ *  to the listener registered last among those accepting the comId and destination URI (case insensitive).
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define TEST27_COMID        2700u
+#define TEST27_LISTENERS    100u
+#define TEST27_NOTIFY       "Listener notification"
+
+static volatile UINT32  gTest27Received = 0u;
+static void *volatile   gTest27UserRef  = NULL;
+
+static void test27CBFunction (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    if ((pMsg->resultCode == TRDP_NO_ERR) && (pMsg->msgType == TRDP_MSG_MN))
+    {
+        gTest27UserRef = pMsg->pUserRef;
+        gTest27Received++;
+    }
+}
+
+/* send a notification and return the user reference of the listener it was dispatched to */
+static void *test27Notify (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_IP_ADDR_T      destIpAddr,
+    UINT32              comId,
+    const CHAR8         *pDestURI)
+{
+    TRDP_URI_USER_T destURI = "";
+    UINT32          received = gTest27Received;
+    UINT32          i;
+
+    vos_strncpy(destURI, pDestURI, TRDP_MAX_URI_USER_LEN);
+    gTest27UserRef = NULL;
+    if (tlm_notify(appHandle, NULL, NULL, comId, 0u, 0u, 0u, destIpAddr, TRDP_FLAGS_CALLBACK, NULL,
+                   (UINT8 *) TEST27_NOTIFY, sizeof(TEST27_NOTIFY), NULL, destURI) != TRDP_NO_ERR)
+    {
+        return NULL;
+    }
+    for (i = 0u; (i < 100u) && (gTest27Received == received); i++)
+    {
+        vos_threadDelay(10000u);
+    }
+    return gTest27UserRef;
+}
+
+static int test27 ()
+{
+    PREPARE("Many MD listeners", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, the sessions are processed by tlc_process()\n");
+#else
+    {
+        static TRDP_LIS_T   comIdHandle[TEST27_LISTENERS];
+        static TRDP_LIS_T   uriHandle[TEST27_LISTENERS];
+        static UINT8        comIdRef[TEST27_LISTENERS];
+        static UINT8        uriRef[TEST27_LISTENERS];
+        static UINT8        anyRef, catchRef;
+        TRDP_LIS_T          anyHandle, catchHandle;
+        TRDP_URI_USER_T     uri;
+        CHAR8               msg[80];
+        UINT32              i;
+
+        gTest27Received = 0u;
+
+        /* oldest: any comId and destination URI */
+        err = tlm_addListener(appHandle2, &anyHandle, &anyRef, test27CBFunction, FALSE, 0u, 0u, 0u, 0u, 0u,
+                              VOS_INADDR_ANY, TRDP_FLAGS_CALLBACK, NULL, NULL);
+        IF_ERROR("tlm_addListener any");
+        for (i = 0u; i < TEST27_LISTENERS; i++)
+        {
+            err = tlm_addListener(appHandle2, &comIdHandle[i], &comIdRef[i], test27CBFunction, TRUE,
+                                  TEST27_COMID + i, 0u, 0u, 0u, 0u, VOS_INADDR_ANY, TRDP_FLAGS_CALLBACK, NULL, NULL);
+            IF_ERROR("tlm_addListener comId");
+        }
+        for (i = 0u; i < TEST27_LISTENERS; i++)
+        {
+            (void) vos_snprintf(uri, sizeof(uri), "Lis%02u", i);
+            err = tlm_addListener(appHandle2, &uriHandle[i], &uriRef[i], test27CBFunction, TRUE,
+                                  TEST27_COMID + i, 0u, 0u, 0u, 0u, VOS_INADDR_ANY, TRDP_FLAGS_CALLBACK, NULL, uri);
+            IF_ERROR("tlm_addListener comId and URI");
+        }
+        /* newest: destination URI of any comId */
+        vos_strncpy(uri, "Catch", TRDP_MAX_URI_USER_LEN);
+        err = tlm_addListener(appHandle2, &catchHandle, &catchRef, test27CBFunction, FALSE, 0u, 0u, 0u, 0u, 0u,
+                              VOS_INADDR_ANY, TRDP_FLAGS_CALLBACK, NULL, uri);
+        IF_ERROR("tlm_addListener URI");
+
+        fprintf(gFp, "%u listeners (%u buckets)\n", appHandle2->mdLisIndex.count, appHandle2->mdLisIndex.size);
+        if ((appHandle2->mdLisIndex.count != 2u * TEST27_LISTENERS + 2u) ||
+            (appHandle2->mdLisIndex.size < appHandle2->mdLisIndex.count))
+        {
+            FAILED("listener index not grown");
+        }
+
+        for (i = 0u; i < TEST27_LISTENERS; i += 7u)
+        {
+            (void) vos_snprintf(uri, sizeof(uri), "LIS%02u", i);
+            if (test27Notify(appHandle1, gSession2.ifaceIP, TEST27_COMID + i, uri) != &uriRef[i])
+            {
+                (void) vos_snprintf(msg, sizeof(msg), "comId %u, URI %s: wrong listener", TEST27_COMID + i, uri);
+                FAILED(msg);
+            }
+            if (test27Notify(appHandle1, gSession2.ifaceIP, TEST27_COMID + i, "") != &comIdRef[i])
+            {
+                (void) vos_snprintf(msg, sizeof(msg), "comId %u: wrong listener", TEST27_COMID + i);
+                FAILED(msg);
+            }
+            if (test27Notify(appHandle1, gSession2.ifaceIP, TEST27_COMID + i, "catch") != &catchRef)
+            {
+                (void) vos_snprintf(msg, sizeof(msg), "comId %u, URI catch: wrong listener", TEST27_COMID + i);
+                FAILED(msg);
+            }
+        }
+        if (test27Notify(appHandle1, gSession2.ifaceIP, TEST27_COMID + TEST27_LISTENERS, "Lis00") != &anyRef)
+        {
+            FAILED("unknown comId: wrong listener");
+        }
+
+        /* deleted and readded listeners */
+        err = tlm_delListener(appHandle2, uriHandle[5]);
+        IF_ERROR("tlm_delListener");
+        err = tlm_readdListener(appHandle2, comIdHandle[5], 0u, 0u, 0u, 0u, VOS_INADDR_ANY);
+        IF_ERROR("tlm_readdListener");
+        if (test27Notify(appHandle1, gSession2.ifaceIP, TEST27_COMID + 5u, "lis05") != &comIdRef[5])
+        {
+            FAILED("deleted listener still dispatched to");
+        }
+        err = tlm_delListener(appHandle2, catchHandle);
+        IF_ERROR("tlm_delListener");
+        if (test27Notify(appHandle1, gSession2.ifaceIP, TEST27_COMID + 7u, "catch") != &comIdRef[7])
+        {
+            FAILED("deleted listener still dispatched to");
+        }
+        fprintf(gFp, "%u notifications dispatched\n", gTest27Received);
+
+        for (i = 0u; i < TEST27_LISTENERS; i++)
+        {
+            (void) tlm_delListener(appHandle2, comIdHandle[i]);
+            if (i != 5u)
+            {
+                (void) tlm_delListener(appHandle2, uriHandle[i]);
+            }
+        }
+        err = tlm_delListener(appHandle2, anyHandle);
+        IF_ERROR("tlm_delListener");
+        if (appHandle2->mdLisIndex.count != 0u)
+        {
+            FAILED("listener index not emptied");
+        }
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test28
+ *  MD timeout supervision: requests which are never replied must be retried once and then time out in the order of
+ *  their deadlines. tlc_getInterval() must report the time to the nearest deadline.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define TEST28_COMID        2800u
+#define TEST28_SESSIONS     20u
+#define TEST28_TIMEOUT      300000u             /* reply timeout of the first request [us]  */
+#define TEST28_STEP         20000u              /* increment of the reply timeout [us]      */
+#define TEST28_REQUEST      "Unanswered request"
+
+static volatile UINT32  gTest28Timeouts = 0u;
+static volatile UINT32  gTest28Errors   = 0u;
+static UINT32           gTest28Order[TEST28_SESSIONS];
+static VOS_TIMEVAL_T    gTest28Time[TEST28_SESSIONS];
+
+static void test28CBFunction (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    if ((pMsg->resultCode == TRDP_REPLYTO_ERR) && (pMsg->pUserRef != NULL))
+    {
+        /* caller: the user reference is the index of the request */
+        if (gTest28Timeouts < TEST28_SESSIONS)
+        {
+            gTest28Order[gTest28Timeouts] = *(const UINT32 *) pMsg->pUserRef;
+            vos_getTime(&gTest28Time[gTest28Timeouts]);
+        }
+        gTest28Timeouts++;
+    }
+    else if ((pMsg->resultCode != TRDP_NO_ERR) && (pMsg->resultCode != TRDP_APP_REPLYTO_ERR))
+    {
+        fprintf(gFp, "### MD error %d (msgType %x)\n", pMsg->resultCode, pMsg->msgType);
+        gTest28Errors++;
+    }
+    /* the replier never replies */
+}
+
+static int test28 ()
+{
+    PREPARE("MD timeout supervision", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, the sessions are processed by tlc_process()\n");
+#else
+    {
+        static UINT32       index[TEST28_SESSIONS];
+        TRDP_LIS_T          listenHandle;
+        TRDP_SEND_PARAM_T   sendParam;
+        TRDP_FDS_T          rfds;
+        INT32               noDesc = 0;
+        TRDP_TIME_T         interval;
+        VOS_TIMEVAL_T       start, elapsed;
+        UINT32              i, timers;
+        CHAR8               msg[80];
+
+        gTest28Timeouts = 0u;
+        gTest28Errors   = 0u;
+
+        err = tlm_addListener(appHandle2, &listenHandle, NULL, test28CBFunction, TRUE,
+                              TEST28_COMID, 0u, 0u, 0u, VOS_INADDR_ANY, VOS_INADDR_ANY,
+                              TRDP_FLAGS_CALLBACK, NULL, NULL);
+        IF_ERROR("tlm_addListener");
+
+        memset(&sendParam, 0, sizeof(sendParam));
+        sendParam.qos       = TRDP_MD_DEFAULT_QOS;
+        sendParam.ttl       = TRDP_MD_DEFAULT_TTL;
+        sendParam.retries   = 1u;
+
+        /* the later requests time out first */
+        vos_getTime(&start);
+        for (i = 0u; i < TEST28_SESSIONS; i++)
+        {
+            index[i] = TEST28_SESSIONS - 1u - i;
+            err = tlm_request(appHandle1, &index[i], test28CBFunction, NULL, TEST28_COMID, 0u, 0u,
+                              0u, gSession2.ifaceIP, TRDP_FLAGS_CALLBACK, 1u,
+                              TEST28_TIMEOUT + index[i] * TEST28_STEP, &sendParam,
+                              (UINT8 *) TEST28_REQUEST, sizeof(TEST28_REQUEST), NULL, NULL);
+            IF_ERROR("tlm_request");
+        }
+
+        vos_threadDelay(100000u);
+        timers = appHandle1->mdTimers.count;
+
+        /* no PD is sent: the wait time is given by the first MD deadline */
+        VOS_FD_ZERO((VOS_FDS_T *) &rfds);
+        err = tlc_getInterval(appHandle1, &interval, &rfds, &noDesc);
+        IF_ERROR("tlc_getInterval");
+        fprintf(gFp, "%u sessions supervised, next deadline in %u us\n", timers,
+                (UINT32) (interval.tv_sec * 1000000 + interval.tv_usec));
+        if (timers != TEST28_SESSIONS)
+        {
+            FAILED("sessions not supervised");
+        }
+        if ((interval.tv_sec != 0) || (interval.tv_usec > (INT32) TEST28_TIMEOUT))
+        {
+            FAILED("interval does not end at the next deadline");
+        }
+
+        for (i = 0u; (i < 100u) && (gTest28Timeouts < TEST28_SESSIONS); i++)
+        {
+            vos_threadDelay(50000u);
+        }
+        fprintf(gFp, "%u reply timeouts\n", gTest28Timeouts);
+        if ((gTest28Timeouts != TEST28_SESSIONS) || (gTest28Errors != 0u))
+        {
+            FAILED("requests not timed out");
+        }
+        for (i = 0u; i < TEST28_SESSIONS; i++)
+        {
+            if (gTest28Order[i] != i)
+            {
+                (void) vos_snprintf(msg, sizeof(msg), "timeout %u reported for request %u", i, gTest28Order[i]);
+                FAILED(msg);
+            }
+        }
+        /* one retry: the first timeout is reported after twice its reply timeout */
+        elapsed = gTest28Time[0];
+        vos_subTime(&elapsed, &start);
+        fprintf(gFp, "first timeout after %u us\n", (UINT32) (elapsed.tv_sec * 1000000 + elapsed.tv_usec));
+        if ((elapsed.tv_sec * 1000000 + elapsed.tv_usec) < (INT32) (2u * TEST28_TIMEOUT))
+        {
+            FAILED("request not retried");
+        }
+
+        err = tlm_delListener(appHandle2, listenHandle);
+        IF_ERROR("tlm_delListener");
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test29
+ *  TCP connection pool: the connection opened in advance by tlm_preConnect() must be used by the following TCP
+ *  requests to the replier instead of new connections.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define TEST29_COMID        2900u
+#define TEST29_REQUESTS     4u
+#define TEST29_REQUEST      "Pooled request"
+#define TEST29_REPLY        "Pooled reply"
+
+static volatile UINT32  gTest29Replies  = 0u;
+static volatile UINT32  gTest29Errors   = 0u;
+
+static void test29CBFunction (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    if (pMsg->resultCode != TRDP_NO_ERR)
+    {
+        fprintf(gFp, "### MD error %d (msgType %x)\n", pMsg->resultCode, pMsg->msgType);
+        gTest29Errors++;
+    }
+    else if (pMsg->msgType == TRDP_MSG_MR)
+    {
+        if (tlm_reply(appHandle, &pMsg->sessionId, TEST29_COMID, 0u, NULL,
+                      (UINT8 *) TEST29_REPLY, sizeof(TEST29_REPLY), NULL) != TRDP_NO_ERR)
+        {
+            gTest29Errors++;
+        }
+    }
+    else if (pMsg->msgType == TRDP_MSG_MP)
+    {
+        gTest29Replies++;
+    }
+}
+
+static int test29 ()
+{
+    PREPARE("TCP connection pool", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, the sessions are processed by tlc_process()\n");
+#else
+    {
+        TRDP_LIS_T                  listenHandle;
+        TRDP_TCP_POOL_STATISTICS_T  stats;
+        UINT32                      i, j;
+
+        gTest29Replies  = 0u;
+        gTest29Errors   = 0u;
+
+        err = tlm_addListener(appHandle2, &listenHandle, NULL, test29CBFunction, TRUE,
+                              TEST29_COMID, 0u, 0u, 0u, VOS_INADDR_ANY, VOS_INADDR_ANY,
+                              TRDP_FLAGS_CALLBACK | TRDP_FLAGS_TCP, NULL, NULL);
+        IF_ERROR("tlm_addListener");
+
+        err = tlm_preConnect(appHandle1, NULL, 0u, gSession2.ifaceIP);
+        IF_ERROR("tlm_preConnect");
+        vos_threadDelay(100000u);
+
+        err = tlc_getTcpPoolStatistics(appHandle1, &stats);
+        IF_ERROR("tlc_getTcpPoolStatistics");
+        fprintf(gFp, "pre-connected: %u open, %u idle\n", stats.numOpen, stats.numIdle);
+        if ((stats.numPreConnects != 1u) || (stats.numOpen != 1u) || (stats.numIdle != 1u))
+        {
+            FAILED("connection not opened in advance");
+        }
+
+        /* the connections are taken from the pool, one request after the other */
+        for (i = 0u; i < TEST29_REQUESTS; i++)
+        {
+            err = tlm_request(appHandle1, NULL, test29CBFunction, NULL, TEST29_COMID, 0u, 0u,
+                              0u, gSession2.ifaceIP, TRDP_FLAGS_CALLBACK | TRDP_FLAGS_TCP, 1u, 2000000u, NULL,
+                              (UINT8 *) TEST29_REQUEST, sizeof(TEST29_REQUEST), NULL, NULL);
+            IF_ERROR("tlm_request");
+            for (j = 0u; (j < 100u) && (gTest29Replies <= i) && (gTest29Errors == 0u); j++)
+            {
+                vos_threadDelay(20000u);
+            }
+            /* let the session be closed, its connection returns to the pool */
+            vos_threadDelay(50000u);
+        }
+
+        err = tlc_getTcpPoolStatistics(appHandle1, &stats);
+        IF_ERROR("tlc_getTcpPoolStatistics");
+        fprintf(gFp, "%u replies: %u hits, %u misses, %u open, %u idle\n", gTest29Replies, stats.numHits,
+                stats.numMisses, stats.numOpen, stats.numIdle);
+        if ((gTest29Replies != TEST29_REQUESTS) || (gTest29Errors != 0u))
+        {
+            FAILED("requests not replied");
+        }
+        if ((stats.numHits != TEST29_REQUESTS) || (stats.numMisses != 0u) ||
+            (stats.numOpen != 1u) || (stats.numIdle != 1u))
+        {
+            FAILED("pooled connections not reused");
+        }
+
+        err = tlm_delListener(appHandle2, listenHandle);
+        IF_ERROR("tlm_delListener");
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test30
+ *  TCP MD received in chunks: in sessions configured to stream MD, a large request to a listener and the large
+ *  reply to the caller must be delivered in chunks, in order and complete.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+
+#define TEST30_COMID    3000u
+#define TEST30_SIZE     60000u
+
+typedef struct
+{
+    UINT32  received;                       /* dataset bytes received in order  */
+    UINT32  chunks;                         /* number of chunks                 */
+    UINT32  errors;                         /* wrong chunks or MD errors        */
+    BOOL8   complete;                       /* last chunk received              */
+} TEST30_RCV_T;
+
+static UINT8            gTest30Data[TEST30_SIZE];
+static TEST30_RCV_T     gTest30Request;
+static TEST30_RCV_T     gTest30Reply;
+
+static void test30Chunk (
+    TEST30_RCV_T            *pRcv,
+    const TRDP_MD_INFO_T    *pMsg,
+    const UINT8             *pData,
+    UINT32                  dataSize)
+{
+    if ((pMsg->resultCode != TRDP_NO_ERR) || (pData == NULL) ||
+        (pMsg->streamSize != TEST30_SIZE) || (pMsg->streamOffset != pRcv->received) ||
+        (pMsg->streamOffset + dataSize > TEST30_SIZE) ||
+        (memcmp(pData, &gTest30Data[pMsg->streamOffset], dataSize) != 0))
+    {
+        fprintf(gFp, "### chunk error %d (offset %u, size %u)\n", pMsg->resultCode, pMsg->streamOffset, dataSize);
+        pRcv->errors++;
+        return;
+    }
+    pRcv->received += dataSize;
+    pRcv->chunks++;
+    pRcv->complete = (pRcv->received == pMsg->streamSize) ? TRUE : FALSE;
+}
+
+static void test30CBFunction (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    if (pMsg->msgType == TRDP_MSG_MR)
+    {
+        test30Chunk(&gTest30Request, pMsg, pData, dataSize);
+        if (gTest30Request.complete == TRUE)
+        {
+            if (tlm_reply(appHandle, &pMsg->sessionId, TEST30_COMID, 0u, NULL,
+                          gTest30Data, TEST30_SIZE, NULL) != TRDP_NO_ERR)
+            {
+                gTest30Request.errors++;
+            }
+        }
+    }
+    else if (pMsg->msgType == TRDP_MSG_MP)
+    {
+        test30Chunk(&gTest30Reply, pMsg, pData, dataSize);
+    }
+    else
+    {
+        fprintf(gFp, "### MD error %d (msgType %x)\n", pMsg->resultCode, pMsg->msgType);
+        gTest30Reply.errors++;
+    }
+}
+
+static int test30 ()
+{
+    PREPARE("TCP MD received in chunks", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+#ifdef HIGH_PERF_INDEXED
+    fprintf(gFp, "not applicable, the sessions are processed by tlc_process()\n");
+#else
+    {
+        TRDP_LIS_T          listenHandle;
+        TRDP_MD_CONFIG_T    mdConfig;
+        UINT32              i;
+
+        /* only stream is set, the other defaults of the sessions are kept */
+        memset(&mdConfig, 0, sizeof(mdConfig));
+        mdConfig.stream = TRUE;
+        err = tlc_configSession(appHandle1, NULL, NULL, &mdConfig, NULL);
+        IF_ERROR("tlc_configSession");
+        err = tlc_configSession(appHandle2, NULL, NULL, &mdConfig, NULL);
+        IF_ERROR("tlc_configSession");
+
+        for (i = 0u; i < TEST30_SIZE; i++)
+        {
+            gTest30Data[i] = (UINT8) (i * 7u + (i >> 8));
+        }
+        memset(&gTest30Request, 0, sizeof(gTest30Request));
+        memset(&gTest30Reply, 0, sizeof(gTest30Reply));
+
+        err = tlm_addListener(appHandle2, &listenHandle, NULL, test30CBFunction, TRUE,
+                              TEST30_COMID, 0u, 0u, 0u, VOS_INADDR_ANY, VOS_INADDR_ANY,
+                              TRDP_FLAGS_CALLBACK | TRDP_FLAGS_TCP, NULL, NULL);
+        IF_ERROR("tlm_addListener");
+
+        err = tlm_request(appHandle1, NULL, test30CBFunction, NULL, TEST30_COMID, 0u, 0u,
+                          0u, gSession2.ifaceIP, TRDP_FLAGS_CALLBACK | TRDP_FLAGS_TCP, 1u,
+                          2000000u, NULL, gTest30Data, TEST30_SIZE, NULL, NULL);
+        IF_ERROR("tlm_request");
+
+        for (i = 0u; (i < 100u) && (gTest30Reply.complete == FALSE) && (gTest30Reply.errors == 0u) &&
+             (gTest30Request.errors == 0u); i++)
+        {
+            vos_threadDelay(20000u);
+        }
+
+        fprintf(gFp, "request: %u bytes in %u chunks, reply: %u bytes in %u chunks\n",
+                gTest30Request.received, gTest30Request.chunks, gTest30Reply.received, gTest30Reply.chunks);
+        if ((gTest30Request.complete == FALSE) || (gTest30Request.errors != 0u) || (gTest30Request.chunks < 2u))
+        {
+            FAILED("request not received in chunks");
+        }
+        if ((gTest30Reply.complete == FALSE) || (gTest30Reply.errors != 0u) || (gTest30Reply.chunks < 2u))
+        {
+            FAILED("reply not received in chunks");
+        }
+
+        err = tlm_delListener(appHandle2, listenHandle);
+        IF_ERROR("tlm_delListener");
+    }
+#endif
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
+/**********************************************************************************************************************/
+/** test31
+ *  PD sending by tlp_processSend() before tlc_updateSession() was called: publishers and requests must be sent
+ *  in indexed builds, too.
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+static int test31 ()
+{
+    PREPARE("PD sending before tlc_updateSession", "test"); /* allocates appHandle1, appHandle2, failed = 0, err */
+
+    /* ------------------------- test code starts here --------------------------- */
+
+    {
+        TRDP_PUB_T          pubHandle;
+        TRDP_STATISTICS_T   stats;
+        UINT32              before;
+        UINT32              i;
+
+#define TEST31_COMID     3100u
+#define TEST31_INTERVAL  20000u
+#define TEST31_CYCLES    10u
+
+        err = tlp_publish(appHandle1, &pubHandle, NULL, NULL, 0u, TEST31_COMID, 0u, 0u,
+                          0u, gSession2.ifaceIP, TEST31_INTERVAL, 0u, TRDP_FLAGS_DEFAULT, NULL,
+                          dataBuffer3, sizeof(dataBuffer3));
+        IF_ERROR("tlp_publish");
+
+        err = tlc_getStatistics(appHandle1, &stats);
+        IF_ERROR("tlc_getStatistics");
+        before = stats.pd.numSend;
+
+        err = tlp_request(appHandle1, NULL, 0u, TEST31_COMID + 1u, 0u, 0u,
+                          0u, gSession2.ifaceIP, 0u, TRDP_FLAGS_DEFAULT, NULL, NULL, 0u, 0u, 0u);
+        IF_ERROR("tlp_request");
+
+        /* no tlc_updateSession(): indexed builds send from the send heap */
+        for (i = 0u; i < TEST31_CYCLES; i++)
+        {
+            err = tlp_processSend(appHandle1);
+            IF_ERROR("tlp_processSend");
+            vos_threadDelay(TEST31_INTERVAL);
+        }
+
+        err = tlc_getStatistics(appHandle1, &stats);
+        IF_ERROR("tlc_getStatistics");
+        fprintf(gFp, "sent %u PDs in %u cycles\n", stats.pd.numSend - before, TEST31_CYCLES);
+        /* the request and at least half of the cycles of the publisher */
+        if ((stats.pd.numSend - before) < (1u + TEST31_CYCLES / 2u))
+        {
+            FAILED("PDs not sent");
+        }
+
+        err = tlp_unpublish(appHandle1, pubHandle);
+        IF_ERROR("tlp_unpublish");
+    }
+
+    /* ------------------------- test code ends here --------------------------- */
+
+
+    CLEANUP;
+}
+
 /**********************************************************************************************************************/
 /* This array holds pointers to the m-th test (m = 1 will execute test1...)                                           */
 /**********************************************************************************************************************/
@@ -2292,6 +4079,19 @@ test_func_t *testArray[] =
     test16,     /* MD Request - Reply / UDP */
     test17,     /* CRC */
     test18,     /* XML stream */
+    test19,     /* PD timeout supervision */
+    test20,     /* PD send scheduling */
+    test21,     /* Event loop */
+    test22,     /* Zero copy PD reception */
+    test23,     /* Publishing in place */
+    test24,     /* Bulk put and get */
+    test25,     /* XML binary configuration cache */
+    test26,     /* Many concurrent MD sessions */
+    test27,     /* Many MD listeners */
+    test28,     /* MD timeout supervision */
+    test29,     /* TCP connection pool */
+    test30,     /* TCP MD received in chunks */
+    test31,     /* PD sending before tlc_updateSession */
     NULL
 };
 
@@ -0,0 +1,213 @@
+/**********************************************************************************************************************/
+/**
+ * @file            test_marshall_gen.c
+ *
+ * @brief           Round trip test of generated marshalling functions
+ *
+ * @details         Reads the dataset configuration the functions in tau_gen_example.c were generated from and
+ *                  compares, for every generated dataset and random wire data, the results of the generic
+ *                  interpreter, the compiled plans and the generated functions in both directions.
+ *                  Reports the throughput of the three variants.
+ *
+ *                  usage: test_marshall_gen <xml file>
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          TCNOpen
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ *      AG 2026-10-16: Created
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tau_xml.h"
+#include "tau_marshall.h"
+#include "vos_utils.h"
+#include "tau_gen_example.h"
+
+/* --- defines ---------------------------------------------------------------*/
+
+#define TEST_BUF_SIZE   8192u                   /* max. size of a dataset       */
+#define TEST_RUNS       20u                     /* random patterns per dataset  */
+#define TEST_LOOPS      100000u                 /* iterations for throughput    */
+
+/* variants under test */
+#define VARIANT_INTERPRETER 0u
+#define VARIANT_PLAN        1u
+#define VARIANT_GENERATED   2u
+#define VARIANTS            3u
+
+/* --- globals ---------------------------------------------------------------*/
+
+static UINT64   wire[VARIANTS][TEST_BUF_SIZE / 8u];
+static UINT64   host[VARIANTS][TEST_BUF_SIZE / 8u];
+static UINT64   pattern[TEST_BUF_SIZE / 8u];
+static void     *pRefCon = NULL;
+
+static const char *cVariant[VARIANTS] = {"interpreter", "compiled plan", "generated"};
+
+/**********************************************************************************************************************/
+/** Select a variant: plans and generated functions are only used while plans are enabled */
+static void selectVariant (
+    UINT32 variant)
+{
+    static BOOL8 registered = FALSE;
+
+    tau_enableMarshallPlans((variant != VARIANT_INTERPRETER) ? TRUE : FALSE);
+    if ((variant == VARIANT_GENERATED) && (registered == FALSE))
+    {
+        if (tau_registerMarshallFuncs(pRefCon, tau_gen_example_numFuncs, tau_gen_example_funcs) != TRDP_NO_ERR)
+        {
+            printf("tau_registerMarshallFuncs failed\n");
+            exit(1);
+        }
+        registered = TRUE;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Round trip of one dataset: random wire data -> host -> wire, identical for all variants */
+static int roundTrip (
+    const TAU_MARSHALL_FUNCS_T *pFuncs)
+{
+    UINT32  run, i, v;
+    UINT32  hostSize[VARIANTS], wireSize[VARIANTS];
+
+    for (run = 0u; run < TEST_RUNS; run++)
+    {
+        for (i = 0u; i < pFuncs->wireSize; i++)
+        {
+            ((UINT8 *) pattern)[i] = (UINT8) rand();
+        }
+
+        for (v = 0u; v < VARIANTS; v++)
+        {
+            TRDP_ERR_T err;
+
+            selectVariant(v);
+            memset(host[v], 0, sizeof(host[v]));
+            memset(wire[v], 0, sizeof(wire[v]));
+            hostSize[v] = sizeof(host[v]);
+            wireSize[v] = sizeof(wire[v]);
+
+            err = tau_unmarshallDs(pRefCon, pFuncs->datasetId, (UINT8 *) pattern, pFuncs->wireSize,
+                                   (UINT8 *) host[v], &hostSize[v], NULL);
+            if (err == TRDP_NO_ERR)
+            {
+                err = tau_marshallDs(pRefCon, pFuncs->datasetId, (UINT8 *) host[v], hostSize[v],
+                                     (UINT8 *) wire[v], &wireSize[v], NULL);
+            }
+            if ((err != TRDP_NO_ERR) ||
+                (hostSize[v] != pFuncs->hostSize) || (wireSize[v] != pFuncs->wireSize) ||
+                (memcmp(wire[v], pattern, pFuncs->wireSize) != 0) ||
+                (memcmp(host[v], host[0], pFuncs->hostSize) != 0))
+            {
+                printf("Dataset %u: %s differs (err %d, host size %u/%u, wire size %u/%u)\n", pFuncs->datasetId,
+                       cVariant[v], err, hostSize[v], pFuncs->hostSize, wireSize[v], pFuncs->wireSize);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/** Throughput of marshalling and unmarshalling one dataset */
+static void throughput (
+    const TAU_MARSHALL_FUNCS_T *pFuncs)
+{
+    UINT32          i, v, hostSize, wireSize;
+    VOS_TIMEVAL_T   start, end;
+
+    printf("%u x dataset %u (%u bytes):    marshall   unmarshall\n", TEST_LOOPS, pFuncs->datasetId,
+           pFuncs->wireSize);
+    for (v = 0u; v < VARIANTS; v++)
+    {
+        UINT32 usec[2];
+
+        selectVariant(v);
+        vos_getTime(&start);
+        for (i = 0u; i < TEST_LOOPS; i++)
+        {
+            wireSize = sizeof(wire[v]);
+            (void) tau_marshallDs(pRefCon, pFuncs->datasetId, (UINT8 *) host[0], pFuncs->hostSize,
+                                  (UINT8 *) wire[v], &wireSize, NULL);
+        }
+        vos_getTime(&end);
+        vos_subTime(&end, &start);
+        usec[0] = (UINT32) (end.tv_sec * 1000000 + end.tv_usec);
+
+        vos_getTime(&start);
+        for (i = 0u; i < TEST_LOOPS; i++)
+        {
+            hostSize = sizeof(host[v]);
+            (void) tau_unmarshallDs(pRefCon, pFuncs->datasetId, (UINT8 *) wire[0], pFuncs->wireSize,
+                                    (UINT8 *) host[v], &hostSize, NULL);
+        }
+        vos_getTime(&end);
+        vos_subTime(&end, &start);
+        usec[1] = (UINT32) (end.tv_sec * 1000000 + end.tv_usec);
+
+        printf("  %-14s %12u us %9u us\n", cVariant[v], usec[0], usec[1]);
+    }
+}
+
+/******/
+int main (
+    int     argc,
+    char    *argv[])
+{
+    TRDP_XML_DOC_HANDLE_T   docHandle;
+    UINT32                  numComId = 0u, numDataset = 0u, i, largest = 0u;
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap = NULL;
+    apTRDP_DATASET_T        apDataset = NULL;
+
+    if (argc != 2)
+    {
+        printf("usage: %s <xml file>\n", argv[0]);
+        return 1;
+    }
+
+    if ((tau_prepareXmlDoc(argv[1], &docHandle) != TRDP_NO_ERR) ||
+        (tau_readXmlDatasetConfig(&docHandle, &numComId, &pComIdDsIdMap, &numDataset, &apDataset) != TRDP_NO_ERR) ||
+        (tau_initMarshall(&pRefCon, numComId, pComIdDsIdMap, numDataset, apDataset) != TRDP_NO_ERR))
+    {
+        printf("Failed to read the dataset configuration of %s\n", argv[1]);
+        return 1;
+    }
+
+    srand(4711);
+    for (i = 0u; i < tau_gen_example_numFuncs; i++)
+    {
+        if ((tau_gen_example_funcs[i].wireSize > TEST_BUF_SIZE) ||
+            (tau_gen_example_funcs[i].hostSize > TEST_BUF_SIZE) ||
+            (roundTrip(&tau_gen_example_funcs[i]) != 0))
+        {
+            return 1;
+        }
+        if (tau_gen_example_funcs[i].wireSize > tau_gen_example_funcs[largest].wireSize)
+        {
+            largest = i;
+        }
+    }
+    printf("Round trip of %u generated datasets matched the generic marshalling\n", tau_gen_example_numFuncs);
+
+    if (tau_gen_example_numFuncs > 0u)
+    {
+        throughput(&tau_gen_example_funcs[largest]);
+    }
+
+    (void) tau_deInitMarshall(pRefCon);
+    tau_freeXmlDatasetConfig(numComId, pComIdDsIdMap, numDataset, apDataset);
+    tau_freeXmlDoc(&docHandle);
+    return 0;
+}
@@ -16,6 +16,10 @@
  *
  * $Id$
  *
+ *      AG 2026-10-16: Size calculation from plans compared to the interpreter for all source sizes
+ *      AG 2026-10-16: Field accessors on fixed and variable datasets, by name and by element number
+ *      AG 2026-10-16: Two marshalling databases with different layouts for the same ComId
+ *      AG 2026-10-16: Plan/interpreter comparison and throughput for fixed-layout dataset 1002
  *      IB 2021-08-09: Ticket #374 'init added for TRDP_EXTRA_LABEL_T name' in datasets using TRDP_DATASET_T
  *      SB 2019-05-24: Ticket #252 Bug in unmarshalling/marshalling of TIMEDATE48 and TIMEDATE64
  *      BL 2018-09-05: Ticket #211 XML handling: Dataset Name should be stored in TRDP_DATASET_ELEMENT_T
@@ -25,6 +29,8 @@
 #include <stdio.h>
 #include <string.h>
 #include "tau_marshall.h"
+#include "vos_thread.h"
+#include "vos_mem.h"
 
 /*    Test data sets    */
 TRDP_DATASET_T  gDataSet1990 =
@@ -517,11 +523,73 @@ TRDP_DATASET_T  gDataSet2003 =
     }
 };
 
+/*    Fixed-layout dataset, marshalled by compiled plan    */
+TRDP_DATASET_T  gDataSet1002 =
+{
+    1002,       /*    dataset/com ID  */
+    0,          /*    reserved        */
+    10,         /*    No of elements    */
+	{'\0'},          /*    name */
+    {           /*    TRDP_DATASET_ELEMENT_T[]    */
+        {
+            TRDP_UINT32,
+            1,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            TRDP_UINT16,
+            64,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            TRDP_INT32,
+            64,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            TRDP_REAL32,
+            32,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            TRDP_TIMEDATE64,
+            8,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            TRDP_TIMEDATE48,
+            4,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            TRDP_UINT64,
+            8,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            TRDP_UINT8,
+            16,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            1993,
+            2,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            2002,
+            1,
+            NULL, NULL, 0, 0, NULL
+        }
+    }
+};
+
 /*    Will be sorted by tau_initMarshall    */
 TRDP_DATASET_T  *gDataSets[] =
 {
     &gDataSet1001,
     &gDataSet1000,
+    &gDataSet1002,
     &gDataSet1990,
     &gDataSet1991,
     &gDataSet1992,
@@ -714,6 +782,20 @@ struct DS2 {
     'a', 0x12345678, 0x23456789
 };
 
+struct myDataSet1002
+{
+    UINT32                  counter;
+    UINT16                  uint16_64[64];
+    INT32                   int32_64[64];
+    float                   float32_32[32];
+    TIMEDATE64              timedate64_8[8];
+    TIMEDATE48              timedate48_4[4];
+    UINT64                  uint64_8[8];
+    UINT8                   uint8_16[16];
+    struct myDataSet1993    ds[2];
+    struct DS2              ds2;
+} gMyDataSet1002;
+
 struct myDataSet2003 {
     UINT32 a;
     //INT32 b;
@@ -728,6 +810,7 @@ TRDP_COMID_DSID_MAP_T   gComIdMap[] =
 {
     {1000, 1000},
     {1001, 1001},
+    {1002, 1002},
     {2003, 2003}
 };
 
@@ -737,6 +820,8 @@ UINT32  *gpRefCon = NULL;
 struct myDataSet1000    gMyDataSet1000Copy;
 struct myDataSet1001    gMyDataSet1001Copy;
 struct myDataSet2003    gMyDataSet2003Copy;
+struct myDataSet1002    gMyDataSet1002Copy[2];
+UINT8                   gDstDataBuffer2[1500];
 
 UINT8 gMarshalledData1000[] = { 1,
                             'A',
@@ -1061,16 +1146,588 @@ static int __unused test2()
     return 0;
 }
 
+/***********************************************************************************************************************
+    Compare compiled plan and interpreter for a fixed-layout dataset, measure throughput
+***********************************************************************************************************************/
+static UINT32 elapsedUs (VOS_TIMEVAL_T *pStart)
+{
+    VOS_TIMEVAL_T now;
+
+    vos_getTime(&now);
+    vos_subTime(&now, pStart);
+    return (UINT32) (now.tv_sec * 1000000 + now.tv_usec);
+}
+
+static int test3()
+{
+    TRDP_ERR_T      err;
+    UINT32          bufSize[2];
+    UINT32          bufSize2[2];
+    UINT32          i, j, usec[2][2];
+    VOS_TIMEVAL_T   start;
+    const UINT32    loops = 100000;
+
+    gMyDataSet1002.counter = 0x12345678;
+    for (i = 0; i < 64; i++)
+    {
+        gMyDataSet1002.uint16_64[i] = (UINT16) (0x1234 + i);
+        gMyDataSet1002.int32_64[i]  = (INT32) (0x89ABCDE0 + i);
+    }
+    for (i = 0; i < 32; i++)
+    {
+        gMyDataSet1002.float32_32[i] = 0.12345f * (float) i;
+    }
+    for (i = 0; i < 8; i++)
+    {
+        gMyDataSet1002.timedate64_8[i].tv_sec   = 0x12345670 + i;
+        gMyDataSet1002.timedate64_8[i].tv_usec  = (INT32) (0x9ABCDEF0 + i);
+        gMyDataSet1002.uint64_8[i]              = 0x123456789ABCDEF0ull + i;
+        gMyDataSet1002.uint8_16[i]              = (UINT8) i;
+        gMyDataSet1002.uint8_16[i + 8]          = (UINT8) (0x80 + i);
+    }
+    for (i = 0; i < 4; i++)
+    {
+        gMyDataSet1002.timedate48_4[i].sec      = 0x12345670 + i;
+        gMyDataSet1002.timedate48_4[i].ticks    = (UINT16) (0x89A0 + i);
+    }
+    for (i = 0; i < 2; i++)
+    {
+        gMyDataSet1002.ds[i].level = (UINT8) (1 + i);
+        gMyDataSet1002.ds[i].ds.level = 2;
+        gMyDataSet1002.ds[i].ds.ds.level = 3;
+        gMyDataSet1002.ds[i].ds.ds.ds.level = 4;
+        strcpy(gMyDataSet1002.ds[i].ds.ds.ds.string, "Nested Datasets");
+    }
+    gMyDataSet1002.ds2 = gMyDataSet2002;
+
+    /*  j == 0: interpreter, j == 1: compiled plan  */
+    for (j = 0; j < 2; j++)
+    {
+        UINT8 *pBuf = (j == 0) ? gDstDataBuffer : gDstDataBuffer2;
+
+        tau_enableMarshallPlans((BOOL8) j);
+        memset(pBuf, 0, 1500);
+        memset(&gMyDataSet1002Copy[j], 0, sizeof(gMyDataSet1002Copy[j]));
+        bufSize[j]  = 1500;
+        bufSize2[j] = sizeof(gMyDataSet1002Copy[j]);
+
+        err = tau_marshall(gpRefCon, 1002, (UINT8 *) &gMyDataSet1002, sizeof(gMyDataSet1002), pBuf, &bufSize[j], NULL);
+        if (err != TRDP_NO_ERR)
+        {
+            printf("tau_marshall returns error %d\n", err);
+            return 1;
+        }
+        err = tau_unmarshall(gpRefCon, 1002, pBuf, bufSize[j], (UINT8 *) &gMyDataSet1002Copy[j], &bufSize2[j], NULL);
+        if (err != TRDP_NO_ERR)
+        {
+            printf("tau_unmarshall returns error %d\n", err);
+            return 1;
+        }
+    }
+
+    if ((bufSize[0] != bufSize[1]) || (memcmp(gDstDataBuffer, gDstDataBuffer2, bufSize[0]) != 0) ||
+        (bufSize2[0] != bufSize2[1]) || (memcmp(&gMyDataSet1002Copy[0], &gMyDataSet1002Copy[1], bufSize2[0]) != 0))
+    {
+        printf("Compiled plan and interpreter differ for ComId %d!\n", 1002);
+        return 1;
+    }
+    if ((bufSize2[1] != sizeof(gMyDataSet1002)) || (memcmp(&gMyDataSet1002, &gMyDataSet1002Copy[1], bufSize2[1]) != 0))
+    {
+        printf("Something's wrong in the state of Marshalling (ComId %d)!\n", 1002);
+        return 1;
+    }
+    printf("Compiled plan and interpreter matched (%u bytes marshalled, %u bytes unmarshalled)\n",
+           bufSize[1], bufSize2[1]);
+
+    /*  Throughput  */
+    for (j = 0; j < 2; j++)
+    {
+        tau_enableMarshallPlans((BOOL8) j);
+
+        vos_getTime(&start);
+        for (i = 0; i < loops; i++)
+        {
+            bufSize[j] = 1500;
+            (void) tau_marshall(gpRefCon, 1002, (UINT8 *) &gMyDataSet1002, sizeof(gMyDataSet1002),
+                                gDstDataBuffer, &bufSize[j], NULL);
+        }
+        usec[j][0] = elapsedUs(&start);
+
+        vos_getTime(&start);
+        for (i = 0; i < loops; i++)
+        {
+            bufSize2[j] = sizeof(gMyDataSet1002Copy[j]);
+            (void) tau_unmarshall(gpRefCon, 1002, gDstDataBuffer, bufSize[j],
+                                  (UINT8 *) &gMyDataSet1002Copy[j], &bufSize2[j], NULL);
+        }
+        usec[j][1] = elapsedUs(&start);
+    }
+    tau_enableMarshallPlans(TRUE);
+
+    printf("%u x ComId %d:   marshall   unmarshall\n", loops, 1002);
+    printf("  interpreter   %8u us %8u us\n", usec[0][0], usec[0][1]);
+    printf("  compiled plan %8u us %8u us\n", usec[1][0], usec[1][1]);
+
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*  A second configuration using the same ComId and dataset id with another layout, e.g. of another consist  */
+
+TRDP_DATASET_T  gDataSet1000b =
+{
+    1000,       /*    dataset/com ID  */
+    0,          /*    reserved        */
+    2,          /*    No of elements  */
+    {'\0'},     /*    name */
+    {           /*    TRDP_DATASET_ELEMENT_T[]    */
+        {
+            TRDP_UINT32,
+            1,
+            NULL, NULL, 0, 0, NULL
+        },
+        {
+            TRDP_UINT16,
+            2,
+            NULL, NULL, 0, 0, NULL
+        }
+    }
+};
+
+TRDP_COMID_DSID_MAP_T   gComIdMap2[] =
+{
+    {1000, 1000}
+};
+
+TRDP_DATASET_T  *gDataSets2[] =
+{
+    &gDataSet1000b
+};
+
+static int test4()
+{
+    TRDP_ERR_T  err;
+    void        *pRefCon2 = NULL;
+    UINT32      bufSize, bufSize2, bufSize1;
+    struct
+    {
+        UINT32  a;
+        UINT16  b[2];
+    } ds1000b = {0x12345678u, {0xABCDu, 0x0102u}}, ds1000bCopy;
+    const UINT8 wire1000b[] = {0x12, 0x34, 0x56, 0x78, 0xAB, 0xCD, 0x01, 0x02};
+
+    bufSize1 = sizeof(gDstDataBuffer2);
+    err = tau_marshall(gpRefCon, 1000, (UINT8 *) &gMyDataSet1000, sizeof(gMyDataSet1000), gDstDataBuffer2, &bufSize1,
+                       NULL);
+    if (err != TRDP_NO_ERR)
+    {
+        printf("tau_marshall (1st database) returns error %d\n", err);
+        return 1;
+    }
+
+    err = tau_initMarshall(&pRefCon2, 1, gComIdMap2, 1, gDataSets2);
+    if ((err != TRDP_NO_ERR) || (pRefCon2 == NULL) || (pRefCon2 == (void *) gpRefCon))
+    {
+        printf("tau_initMarshall (2nd database) returns error %d\n", err);
+        return 1;
+    }
+
+    /*  ComId 1000 of the second database  */
+    bufSize = sizeof(gDstDataBuffer);
+    err = tau_marshall(pRefCon2, 1000, (UINT8 *) &ds1000b, sizeof(ds1000b), gDstDataBuffer, &bufSize, NULL);
+    if ((err != TRDP_NO_ERR) || (bufSize != sizeof(wire1000b)) || (memcmp(gDstDataBuffer, wire1000b, bufSize) != 0))
+    {
+        printf("tau_marshall (2nd database) returns error %d, size %u\n", err, bufSize);
+        return 1;
+    }
+    bufSize2 = sizeof(ds1000bCopy);
+    err = tau_unmarshall(pRefCon2, 1000, gDstDataBuffer, bufSize, (UINT8 *) &ds1000bCopy, &bufSize2, NULL);
+    if ((err != TRDP_NO_ERR) || (bufSize2 != sizeof(ds1000b)) || (memcmp(&ds1000b, &ds1000bCopy, bufSize2) != 0))
+    {
+        printf("tau_unmarshall (2nd database) returns error %d, size %u\n", err, bufSize2);
+        return 1;
+    }
+    if ((tau_calcDatasetSizeByComId(pRefCon2, 1000, gDstDataBuffer, bufSize, &bufSize2, NULL) != TRDP_NO_ERR) ||
+        (bufSize2 != sizeof(ds1000b)))
+    {
+        printf("tau_calcDatasetSizeByComId (2nd database) returns size %u\n", bufSize2);
+        return 1;
+    }
+    if (tau_marshall(pRefCon2, 1001, (UINT8 *) &gMyDataSet1001, sizeof(gMyDataSet1001), gDstDataBuffer, &bufSize,
+                     NULL) != TRDP_COMID_ERR)
+    {
+        printf("ComId 1001 must be unknown in the 2nd database\n");
+        return 1;
+    }
+
+    /*  ComId 1000 of the first database is unchanged  */
+    bufSize = sizeof(gDstDataBuffer);
+    err = tau_marshall(gpRefCon, 1000, (UINT8 *) &gMyDataSet1000, sizeof(gMyDataSet1000), gDstDataBuffer, &bufSize,
+                       NULL);
+    if ((err != TRDP_NO_ERR) || (bufSize != bufSize1) || (memcmp(gDstDataBuffer, gDstDataBuffer2, bufSize) != 0))
+    {
+        printf("tau_marshall (1st database) returns error %d, size %u\n", err, bufSize);
+        return 1;
+    }
+
+    /*  An application pointer which is no database selects the last initialised one, without being read  */
+    bufSize = sizeof(gDstDataBuffer);
+    err = tau_marshall(&bufSize2, 1000, (UINT8 *) &ds1000b, sizeof(ds1000b), gDstDataBuffer, &bufSize, NULL);
+    if ((err != TRDP_NO_ERR) || (bufSize != sizeof(wire1000b)))
+    {
+        printf("tau_marshall (foreign pRefCon) returns error %d, size %u\n", err, bufSize);
+        return 1;
+    }
+
+    /*  Re-initialising with the same reference replaces the database  */
+    {
+        void *pOldRefCon = pRefCon2;
+
+        err = tau_initMarshall(&pRefCon2, 1, gComIdMap2, 1, gDataSets2);
+        if ((err != TRDP_NO_ERR) || (pRefCon2 == pOldRefCon) || (tau_deInitMarshall(pOldRefCon) != TRDP_PARAM_ERR))
+        {
+            printf("tau_initMarshall did not replace the database, error %d\n", err);
+            return 1;
+        }
+    }
+
+    if ((tau_deInitMarshall(pRefCon2) != TRDP_NO_ERR) || (tau_deInitMarshall(NULL) != TRDP_PARAM_ERR) ||
+        (tau_deInitMarshall(pRefCon2) != TRDP_PARAM_ERR))
+    {
+        printf("tau_deInitMarshall failed\n");
+        return 1;
+    }
+    printf("Two marshalling databases used side by side\n");
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*  Field access into marshalled data, without unmarshalling the dataset  */
+
+TRDP_DATASET_T  gDataSet3001 =
+{
+    3001,       /*    dataset/com ID  */
+    0,          /*    reserved        */
+    2,          /*    No of elements  */
+    {'\0'},     /*    name */
+    {           /*    TRDP_DATASET_ELEMENT_T[]    */
+        {
+            TRDP_INT32,
+            1,
+            "lat", NULL, 0, 0, NULL
+        },
+        {
+            TRDP_INT32,
+            1,
+            "lon", NULL, 0, 0, NULL
+        }
+    }
+};
+
+TRDP_DATASET_T  gDataSet3000 =
+{
+    3000,       /*    dataset/com ID  */
+    0,          /*    reserved        */
+    4,          /*    No of elements  */
+    {'\0'},     /*    name */
+    {           /*    TRDP_DATASET_ELEMENT_T[]    */
+        {
+            TRDP_UINT8,
+            1,
+            "count", NULL, 0, 0, NULL
+        },
+        {
+            TRDP_UINT16,
+            0,
+            "values", NULL, 0, 0, NULL
+        },
+        {
+            3001,
+            2,
+            "pos", NULL, 0, 0, NULL
+        },
+        {
+            TRDP_CHAR8,
+            8,
+            "name", NULL, 0, 0, NULL
+        }
+    }
+};
+
+TRDP_COMID_DSID_MAP_T   gComIdMap3[] =
+{
+    {3000, 3000}
+};
+
+TRDP_DATASET_T  *gDataSets3[] =
+{
+    &gDataSet3001,
+    &gDataSet3000
+};
+
+static int test5()
+{
+    TRDP_ERR_T  err;
+    void        *pRefCon3 = NULL;
+    TAU_FIELD_T field;
+    UINT64      uValue = 0u;
+    INT64       iValue = 0;
+    REAL64      rValue = 0.0;
+    UINT32      bufSize, offset = 0u, noOfItems = 0u, i, usec[2];
+    VOS_TIMEVAL_T   start;
+    const UINT32    loops = 100000;
+    const UINT8 wire3000[] = {3, 0x00, 0x01, 0x00, 0x02, 0xFF, 0xFE,
+                              0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xF6,
+                              0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1E,
+                              'T', 'R', 'D', 'P', 0, 0, 0, 0};
+
+    /*  Named elements behind a variable sized array  */
+    err = tau_initMarshall(&pRefCon3, 1, gComIdMap3, 2, gDataSets3);
+    if (err != TRDP_NO_ERR)
+    {
+        printf("tau_initMarshall (3rd database) returns error %d\n", err);
+        return 1;
+    }
+    if ((tau_initFieldAccess(pRefCon3, 3000, "count", &field) != TRDP_NO_ERR) || (field.fixedOffset != TRUE) ||
+        (tau_readFieldUInt(&field, wire3000, sizeof(wire3000), 0, &uValue) != TRDP_NO_ERR) || (uValue != 3u))
+    {
+        printf("Field count wrong\n");
+        return 1;
+    }
+    if ((tau_initFieldAccess(pRefCon3, 3000, "values", &field) != TRDP_NO_ERR) ||
+        (tau_readFieldUInt(&field, wire3000, sizeof(wire3000), 2, &uValue) != TRDP_NO_ERR) || (uValue != 0xFFFEu) ||
+        (tau_readFieldInt(&field, wire3000, sizeof(wire3000), 3, &iValue) != TRDP_PARAM_ERR))
+    {
+        printf("Field values wrong\n");
+        return 1;
+    }
+    if ((tau_initFieldAccess(pRefCon3, 3000, "pos[0].lon", &field) != TRDP_NO_ERR) || (field.fixedOffset != FALSE) ||
+        (tau_readFieldInt(&field, wire3000, sizeof(wire3000), 0, &iValue) != TRDP_NO_ERR) || (iValue != -10) ||
+        (tau_initFieldAccess(pRefCon3, 3000, "POS[1].lon", &field) != TRDP_NO_ERR) ||
+        (tau_readFieldReal(&field, wire3000, sizeof(wire3000), 0, &rValue) != TRDP_NO_ERR) || (rValue != 30.0))
+    {
+        printf("Field pos.lon wrong\n");
+        return 1;
+    }
+    if ((tau_initFieldAccess(pRefCon3, 3000, "name", &field) != TRDP_NO_ERR) ||
+        (tau_locateField(&field, wire3000, sizeof(wire3000), &offset, &noOfItems) != TRDP_NO_ERR) ||
+        (offset != 23u) || (noOfItems != 8u) || (strcmp((const char *) &wire3000[offset], "TRDP") != 0) ||
+        (tau_locateField(&field, wire3000, 30, &offset, &noOfItems) != TRDP_MARSHALLING_ERR))
+    {
+        printf("Field name wrong\n");
+        return 1;
+    }
+    if ((tau_initFieldAccess(pRefCon3, 3000, "pos[2].lat", &field) != TRDP_PARAM_ERR) ||
+        (tau_initFieldAccess(pRefCon3, 3000, "position", &field) != TRDP_PARAM_ERR) ||
+        (tau_initFieldAccess(pRefCon3, 3000, "count.lat", &field) != TRDP_PARAM_ERR) ||
+        (tau_initFieldAccess(pRefCon3, 3000, "pos[1", &field) != TRDP_PARAM_ERR) ||
+        (tau_initFieldAccess(pRefCon3, 3002, "count", &field) != TRDP_COMID_ERR))
+    {
+        printf("Invalid field paths accepted\n");
+        return 1;
+    }
+    (void) tau_deInitMarshall(pRefCon3);
+
+    /*  Elements of dataset 1000 by number, before and behind its variable sized elements  */
+    bufSize = sizeof(gDstDataBuffer);
+    err = tau_marshall(gpRefCon, 1000, (UINT8 *) &gMyDataSet1000, sizeof(gMyDataSet1000), gDstDataBuffer, &bufSize,
+                       NULL);
+    if (err != TRDP_NO_ERR)
+    {
+        printf("tau_marshall returns error %d\n", err);
+        return 1;
+    }
+    if ((tau_initFieldAccess(gpRefCon, 1000, "6", &field) != TRDP_NO_ERR) || (field.fixedOffset != TRUE) ||
+        (tau_readFieldInt(&field, gDstDataBuffer, bufSize, 0, &iValue) != TRDP_NO_ERR) ||
+        (iValue != gMyDataSet1000.int32_1) ||
+        (tau_initFieldAccess(gpRefCon, 1000, "21", &field) != TRDP_NO_ERR) ||
+        (tau_readFieldInt(&field, gDstDataBuffer, bufSize, 2, &iValue) != TRDP_NO_ERR) ||
+        (iValue != gMyDataSet1000.int16_4[2]) ||
+        (tau_initFieldAccess(gpRefCon, 1000, "12", &field) != TRDP_NO_ERR) ||
+        (tau_readFieldReal(&field, gDstDataBuffer, bufSize, 0, &rValue) != TRDP_NO_ERR) ||
+        (rValue != gMyDataSet1000.float32_1) ||
+        (tau_initFieldAccess(gpRefCon, 1000, "13", &field) != TRDP_NO_ERR) ||
+        (tau_readFieldReal(&field, gDstDataBuffer, bufSize, 0, &rValue) != TRDP_NO_ERR) ||
+        (rValue != gMyDataSet1000.float64_1))
+    {
+        printf("Fixed offset fields of dataset 1000 wrong\n");
+        return 1;
+    }
+    if ((tau_initFieldAccess(gpRefCon, 1000, "52", &field) != TRDP_NO_ERR) || (field.fixedOffset != FALSE) ||
+        (tau_readFieldUInt(&field, gDstDataBuffer, bufSize, 3, &uValue) != TRDP_NO_ERR) ||
+        (uValue != gMyDataSet1000.uint32_0[3]) ||
+        (tau_initFieldAccess(gpRefCon, 1000, "58", &field) != TRDP_NO_ERR) ||
+        (tau_readFieldReal(&field, gDstDataBuffer, bufSize, 1, &rValue) != TRDP_NO_ERR) ||
+        (rValue != gMyDataSet1000.float64_0[1]) ||
+        (tau_initFieldAccess(gpRefCon, 1000, "65.2.2.1", &field) != TRDP_NO_ERR) ||
+        (tau_readFieldUInt(&field, gDstDataBuffer, bufSize, 0, &uValue) != TRDP_NO_ERR) ||
+        (uValue != gMyDataSet1000.ds.ds.ds.level) ||
+        (tau_initFieldAccess(gpRefCon, 1000, "65.2.2.2.2", &field) != TRDP_NO_ERR) ||
+        (tau_locateField(&field, gDstDataBuffer, bufSize, &offset, &noOfItems) != TRDP_NO_ERR) ||
+        (noOfItems != 16u) ||
+        (memcmp(&gDstDataBuffer[offset], gMyDataSet1000.ds.ds.ds.ds.string, 16) != 0))
+    {
+        printf("Variable offset fields of dataset 1000 wrong\n");
+        return 1;
+    }
+
+    /*  Reading three signals compared to unmarshalling the whole dataset  */
+    vos_getTime(&start);
+    for (i = 0; i < loops; i++)
+    {
+        UINT32 bufSize2 = sizeof(gMyDataSet1000Copy);
+
+        (void) tau_unmarshall(gpRefCon, 1000, gDstDataBuffer, bufSize, (UINT8 *) &gMyDataSet1000Copy, &bufSize2,
+                              NULL);
+    }
+    usec[0] = elapsedUs(&start);
+    {
+        TAU_FIELD_T fields[3];
+
+        (void) tau_initFieldAccess(gpRefCon, 1000, "6", &fields[0]);
+        (void) tau_initFieldAccess(gpRefCon, 1000, "13", &fields[1]);
+        (void) tau_initFieldAccess(gpRefCon, 1000, "52", &fields[2]);
+        vos_getTime(&start);
+        for (i = 0; i < loops; i++)
+        {
+            (void) tau_readFieldInt(&fields[0], gDstDataBuffer, bufSize, 0, &iValue);
+            (void) tau_readFieldReal(&fields[1], gDstDataBuffer, bufSize, 0, &rValue);
+            (void) tau_readFieldUInt(&fields[2], gDstDataBuffer, bufSize, 3, &uValue);
+        }
+        usec[1] = elapsedUs(&start);
+    }
+    printf("Field access matched, %u x dataset 1000: unmarshall %u us, 3 fields %u us\n", loops, usec[0], usec[1]);
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*  Size calculation from the plans (fixed datasets) and from the first variable element (variable datasets)  */
+
+static int test6()
+{
+    static UINT64   aligned[1600 / 8];
+    UINT8           *pBuf = (UINT8 *) aligned;
+    const UINT32    comIds[] = {1000, 1001, 1002, 2003};
+    const UINT8     *pHost[] = {(UINT8 *) &gMyDataSet1000, (UINT8 *) &gMyDataSet1001, (UINT8 *) &gMyDataSet1002,
+                                (UINT8 *) &gMyDataSet2003};
+    const UINT32    hostSize[] = {sizeof(gMyDataSet1000), sizeof(gMyDataSet1001), sizeof(gMyDataSet1002),
+                                  sizeof(gMyDataSet2003)};
+    UINT32          c, shift, srcSize, wireSize, size[2], i, usec[2];
+    TRDP_ERR_T      err[2];
+    VOS_TIMEVAL_T   start;
+    const UINT32    loops = 100000;
+
+    for (c = 0; c < sizeof(comIds) / sizeof(comIds[0]); c++)
+    {
+        for (shift = 0; shift < 2; shift++)
+        {
+            wireSize = sizeof(aligned) - shift;
+            if (tau_marshall(gpRefCon, comIds[c], (UINT8 *) pHost[c], hostSize[c], pBuf + shift, &wireSize,
+                             NULL) != TRDP_NO_ERR)
+            {
+                printf("tau_marshall of ComId %u failed\n", comIds[c]);
+                return 1;
+            }
+            for (srcSize = 1; srcSize <= wireSize; srcSize++)
+            {
+                for (i = 0; i < 2; i++)
+                {
+                    tau_enableMarshallPlans((i == 0) ? FALSE : TRUE);
+                    size[i] = 0;
+                    err[i]  = tau_calcDatasetSizeByComId(gpRefCon, comIds[c], pBuf + shift, srcSize, &size[i], NULL);
+                }
+                if ((err[0] != err[1]) || (size[0] != size[1]))
+                {
+                    printf("ComId %u, %u of %u bytes at +%u: size %u (err %d) instead of %u (err %d)\n", comIds[c],
+                           srcSize, wireSize, shift, size[1], err[1], size[0], err[0]);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    wireSize = sizeof(aligned);
+    (void) tau_marshall(gpRefCon, 1000, (UINT8 *) &gMyDataSet1000, sizeof(gMyDataSet1000), pBuf, &wireSize, NULL);
+    for (i = 0; i < 2; i++)
+    {
+        tau_enableMarshallPlans((i == 0) ? FALSE : TRUE);
+        vos_getTime(&start);
+        for (c = 0; c < loops; c++)
+        {
+            (void) tau_calcDatasetSizeByComId(gpRefCon, 1000, pBuf, wireSize, &size[i], NULL);
+        }
+        usec[i] = elapsedUs(&start);
+    }
+    printf("Dataset sizes matched the interpreter, %u x ComId 1000: interpreter %u us, from first variable element %u us\n",
+           loops, usec[0], usec[1]);
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*  Databases of a deleted VOS memory area are forgotten (must be the last test)  */
+
+static int test7()
+{
+    void    *pRefCon = NULL;
+    UINT32  bufSize;
+
+    if ((vos_memInit(NULL, 200000, NULL) != VOS_NO_ERR) ||
+        (tau_initMarshall(&pRefCon, 1, gComIdMap2, 1, gDataSets2) != TRDP_NO_ERR))
+    {
+        printf("tau_initMarshall in VOS memory failed\n");
+        return 1;
+    }
+    vos_memDelete(NULL);
+    if (vos_memInit(NULL, 200000, NULL) != VOS_NO_ERR)
+    {
+        return 1;
+    }
+
+    bufSize = sizeof(gDstDataBuffer);
+    if ((tau_marshall(NULL, 1000, (UINT8 *) &gMyDataSet1000, sizeof(gMyDataSet1000), gDstDataBuffer, &bufSize,
+                      NULL) != TRDP_COMID_ERR) ||
+        (tau_marshall(pRefCon, 1000, (UINT8 *) &gMyDataSet1000, sizeof(gMyDataSet1000), gDstDataBuffer, &bufSize,
+                      NULL) != TRDP_COMID_ERR) ||
+        (tau_deInitMarshall(pRefCon) != TRDP_PARAM_ERR))
+    {
+        printf("Database of the deleted memory area still used\n");
+        return 1;
+    }
+    vos_memDelete(NULL);
+    printf("Databases forgotten after vos_memDelete\n");
+    return 0;
+}
+
 /******/
 int main ()
 {
     TRDP_ERR_T  err;
 
-    err = tau_initMarshall((void *)&gpRefCon, sizeof(gComIdMap)/sizeof(TRDP_COMID_DSID_MAP_T), gComIdMap, 8, gDataSets);
+    err = tau_initMarshall((void *)&gpRefCon, sizeof(gComIdMap)/sizeof(TRDP_COMID_DSID_MAP_T), gComIdMap, sizeof(gDataSets)/sizeof(TRDP_DATASET_T *), gDataSets);
 
     if (err == TRDP_NO_ERR)
     {
-        return test1();
+        if (test1() != 0)
+        {
+            return 1;
+        }
+        if (test3() != 0)
+        {
+            return 1;
+        }
+        if (test4() != 0)
+        {
+            return 1;
+        }
+        if (test5() != 0)
+        {
+            return 1;
+        }
+        if (test6() != 0)
+        {
+            return 1;
+        }
+        return test7();
         //return test2();
     }
     return 1;
@@ -0,0 +1,642 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-marshall-gen.c
+ *
+ * @brief           Code generator for specialised marshalling functions
+ *
+ * @details         Reads the dataset configuration of a TRDP XML file (like tau_readXmlDatasetConfig) and writes a
+ *                  C header and source file containing, for every dataset of fixed layout,
+ *                    - the host structure,
+ *                    - its marshalled (wire) size,
+ *                    - straight-line marshalling and unmarshalling functions with constant offsets,
+ *                  and a table of these functions to be registered by tau_registerMarshallFuncs().
+ *                  Datasets with variable sized elements are left to the generic marshaller.
+ *
+ *                  usage: trdp-marshall-gen <xml file> <output base name>
+ *                  writes <output base name>.h and <output base name>.c, the file name of the output is used as
+ *                  prefix of all generated symbols.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          TCNOpen
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ *      AG 2026-10-16: Created
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "tau_xml.h"
+#include "tau_marshall.h"
+
+/* --- defines ---------------------------------------------------------------*/
+
+#define GEN_MAX_NAME    64u             /* max. length of generated identifiers */
+
+/* --- globals ---------------------------------------------------------------*/
+
+static UINT32           numDataset = 0u;
+static apTRDP_DATASET_T apDataset = NULL;
+static UINT8            *pEmitted = NULL;       /* per dataset: structure and functions written */
+static char             prefix[GEN_MAX_NAME];   /* lower case prefix of functions               */
+static char             PREFIX[GEN_MAX_NAME];   /* upper case prefix of types and macros        */
+
+/* --- dataset helpers -------------------------------------------------------*/
+
+static TRDP_DATASET_T *findDataset (
+    UINT32 id)
+{
+    UINT32 i;
+
+    for (i = 0u; i < numDataset; i++)
+    {
+        if (apDataset[i]->id == id)
+        {
+            return apDataset[i];
+        }
+    }
+    return NULL;
+}
+
+static UINT32 datasetIndex (
+    const TRDP_DATASET_T *pDataset)
+{
+    UINT32 i;
+
+    for (i = 0u; (i < numDataset) && (apDataset[i] != pDataset); i++)
+    {
+        ;
+    }
+    return i;
+}
+
+/**********************************************************************************************************************/
+/** Return the wire size of a primitive type, 0 for unknown types */
+static UINT32 wireSizeOfType (
+    UINT32 type)
+{
+    switch (type)
+    {
+       case TRDP_BOOL8:
+       case TRDP_CHAR8:
+       case TRDP_INT8:
+       case TRDP_UINT8:
+           return 1u;
+       case TRDP_UTF16:
+       case TRDP_INT16:
+       case TRDP_UINT16:
+           return 2u;
+       case TRDP_INT32:
+       case TRDP_UINT32:
+       case TRDP_REAL32:
+       case TRDP_TIMEDATE32:
+           return 4u;
+       case TRDP_TIMEDATE48:
+           return 6u;
+       case TRDP_INT64:
+       case TRDP_UINT64:
+       case TRDP_REAL64:
+       case TRDP_TIMEDATE64:
+           return 8u;
+       default:
+           return 0u;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Return the C type of a primitive type */
+static const char *cTypeOfType (
+    UINT32 type)
+{
+    static const char *cTypes[] =
+    {
+        "UINT8", "BOOL8", "CHAR8", "UTF16", "INT8", "INT16", "INT32", "INT64", "UINT8", "UINT16", "UINT32", "UINT64",
+        "REAL32", "REAL64", "TIMEDATE32", "TIMEDATE48", "TIMEDATE64"
+    };
+
+    return (type <= TRDP_TIMEDATE64) ? cTypes[type] : "UINT8";
+}
+
+/**********************************************************************************************************************/
+/** Return the wire size of a dataset, 0 if it has variable size, unknown or too deeply nested elements */
+static UINT32 wireSizeOfDataset (
+    const TRDP_DATASET_T    *pDataset,
+    INT32                   level)
+{
+    UINT32 lIndex, size = 0u, itemSize;
+
+    if ((NULL == pDataset) || (level > TAU_MAX_DS_LEVEL))
+    {
+        return 0u;
+    }
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        const TRDP_DATASET_ELEMENT_T *pElement = &pDataset->pElement[lIndex];
+
+        if (pElement->size == TRDP_VAR_SIZE)
+        {
+            return 0u;
+        }
+        itemSize = (pElement->type > (UINT32) TRDP_TYPE_MAX) ?
+            wireSizeOfDataset(findDataset(pElement->type), level + 1) : wireSizeOfType(pElement->type);
+        if (itemSize == 0u)
+        {
+            return 0u;
+        }
+        size += itemSize * pElement->size;
+    }
+    return size;
+}
+
+/**********************************************************************************************************************/
+/** Make a C identifier of an element name, unnamed or duplicate elements are numbered */
+static void memberName (
+    const TRDP_DATASET_T    *pDataset,
+    UINT32                  lIndex,
+    char                    *pName)
+{
+    const CHAR8 *pSrc = pDataset->pElement[lIndex].name;
+    UINT32      i = 0u, j;
+
+    if ((pSrc != NULL) && !isalpha((unsigned char) pSrc[0]) && (pSrc[0] != '_') && (pSrc[0] != '\0'))
+    {
+        pName[i++] = '_';
+    }
+    while ((pSrc != NULL) && (*pSrc != '\0') && (i < (GEN_MAX_NAME - 8u)))
+    {
+        pName[i++] = (isalnum((unsigned char) *pSrc)) ? *pSrc : '_';
+        pSrc++;
+    }
+    pName[i] = '\0';
+
+    for (j = 0u; (j < lIndex) && (i != 0u); j++)
+    {
+        const CHAR8 *pOther = pDataset->pElement[j].name;
+
+        if ((pOther != NULL) && (strcmp(pOther, pDataset->pElement[lIndex].name) == 0))
+        {
+            i = 0u;
+        }
+    }
+    if (i == 0u)
+    {
+        sprintf(pName, "e%u", lIndex);
+    }
+}
+
+/* --- code output -----------------------------------------------------------*/
+
+/**********************************************************************************************************************/
+/** Write the structure of a dataset, nested datasets first */
+static void emitStruct (
+    FILE                    *pH,
+    const TRDP_DATASET_T    *pDataset)
+{
+    UINT32  lIndex;
+    char    name[GEN_MAX_NAME];
+
+    if (pEmitted[datasetIndex(pDataset)] != 0u)
+    {
+        return;
+    }
+    pEmitted[datasetIndex(pDataset)] = 1u;
+
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        if (pDataset->pElement[lIndex].type > (UINT32) TRDP_TYPE_MAX)
+        {
+            emitStruct(pH, findDataset(pDataset->pElement[lIndex].type));
+        }
+    }
+
+    fprintf(pH, "/** Dataset %u %s */\ntypedef struct\n{\n", pDataset->id, pDataset->name);
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        const TRDP_DATASET_ELEMENT_T    *pElement = &pDataset->pElement[lIndex];
+        char                            type[GEN_MAX_NAME];
+
+        memberName(pDataset, lIndex, name);
+        if (pElement->type > (UINT32) TRDP_TYPE_MAX)
+        {
+            sprintf(type, "%s_DS%u_T", PREFIX, pElement->type);
+        }
+        else
+        {
+            sprintf(type, "%s", cTypeOfType(pElement->type));
+        }
+        if (pElement->size > 1u)
+        {
+            fprintf(pH, "    %-20s %s[%u];\n", type, name, pElement->size);
+        }
+        else
+        {
+            fprintf(pH, "    %-20s %s;\n", type, name);
+        }
+    }
+    fprintf(pH, "} %s_DS%u_T;\n\n", PREFIX, pDataset->id);
+    fprintf(pH, "#define %s_DS%u_WIRE_SIZE  %uu\n\n", PREFIX, pDataset->id, wireSizeOfDataset(pDataset, 1));
+}
+
+/**********************************************************************************************************************/
+/** Write the conversion of one primitive value
+ *
+ *  @param[in]      pC              Output file
+ *  @param[in]      marshall        TRUE: host to wire, FALSE: wire to host
+ *  @param[in]      bits            8, 16, 32, 64
+ *  @param[in]      isReal          value is floating point
+ *  @param[in]      pCType          C type of the value
+ *  @param[in]      pValue          lvalue in the host structure
+ *  @param[in]      pWire           offset expression into the wire buffer
+ */
+static void emitValue (
+    FILE        *pC,
+    BOOL8       marshall,
+    UINT32      bits,
+    BOOL8       isReal,
+    const char  *pCType,
+    const char  *pValue,
+    const char  *pWire)
+{
+    if (bits == 8u)
+    {
+        if (marshall)
+        {
+            fprintf(pC, "pDst[%s] = (UINT8) %s;\n", pWire, pValue);
+        }
+        else
+        {
+            fprintf(pC, "%s = (%s) pSrc[%s];\n", pValue, pCType, pWire);
+        }
+    }
+    else if (isReal)
+    {
+        if (marshall)
+        {
+            fprintf(pC, "put%u(pDst + %s, bitsOfReal%u(%s));\n", bits, pWire, bits, pValue);
+        }
+        else
+        {
+            fprintf(pC, "%s = realOfBits%u(get%u(pSrc + %s));\n", pValue, bits, bits, pWire);
+        }
+    }
+    else
+    {
+        if (marshall)
+        {
+            fprintf(pC, "put%u(pDst + %s, (UINT%u) %s);\n", bits, pWire, bits, pValue);
+        }
+        else
+        {
+            fprintf(pC, "%s = (%s) get%u(pSrc + %s);\n", pValue, pCType, bits, pWire);
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/** Write the conversion of one item of an element */
+static void emitItem (
+    FILE                            *pC,
+    BOOL8                           marshall,
+    const TRDP_DATASET_ELEMENT_T    *pElement,
+    const char                      *pValue,
+    const char                      *pWire,
+    const char                      *pIndent)
+{
+    char value[2u * GEN_MAX_NAME], wire[2u * GEN_MAX_NAME];
+
+    fputs(pIndent, pC);
+    switch (pElement->type)
+    {
+       case TRDP_BOOL8:
+       case TRDP_CHAR8:
+       case TRDP_INT8:
+       case TRDP_UINT8:
+           emitValue(pC, marshall, 8u, FALSE, cTypeOfType(pElement->type), pValue, pWire);
+           break;
+       case TRDP_UTF16:
+       case TRDP_INT16:
+       case TRDP_UINT16:
+           emitValue(pC, marshall, 16u, FALSE, cTypeOfType(pElement->type), pValue, pWire);
+           break;
+       case TRDP_INT32:
+       case TRDP_UINT32:
+       case TRDP_TIMEDATE32:
+           emitValue(pC, marshall, 32u, FALSE, cTypeOfType(pElement->type), pValue, pWire);
+           break;
+       case TRDP_REAL32:
+           emitValue(pC, marshall, 32u, TRUE, "REAL32", pValue, pWire);
+           break;
+       case TRDP_INT64:
+       case TRDP_UINT64:
+           emitValue(pC, marshall, 64u, FALSE, cTypeOfType(pElement->type), pValue, pWire);
+           break;
+       case TRDP_REAL64:
+           emitValue(pC, marshall, 64u, TRUE, "REAL64", pValue, pWire);
+           break;
+       case TRDP_TIMEDATE48:
+           sprintf(value, "%s.sec", pValue);
+           emitValue(pC, marshall, 32u, FALSE, "UINT32", value, pWire);
+           sprintf(value, "%s.ticks", pValue);
+           sprintf(wire, "%s + 4u", pWire);
+           fputs(pIndent, pC);
+           emitValue(pC, marshall, 16u, FALSE, "UINT16", value, wire);
+           break;
+       case TRDP_TIMEDATE64:
+           sprintf(value, "%s.tv_sec", pValue);
+           emitValue(pC, marshall, 32u, FALSE, "UINT32", value, pWire);
+           sprintf(value, "%s.tv_usec", pValue);
+           sprintf(wire, "%s + 4u", pWire);
+           fputs(pIndent, pC);
+           emitValue(pC, marshall, 32u, FALSE, "INT32", value, wire);
+           break;
+       default:     /* nested dataset */
+           if (marshall)
+           {
+               fprintf(pC, "%s_marshall%u((const UINT8 *) &%s, pDst + %s);\n", prefix, pElement->type, pValue, pWire);
+           }
+           else
+           {
+               fprintf(pC, "%s_unmarshall%u(pSrc + %s, (UINT8 *) &%s);\n", prefix, pElement->type, pWire, pValue);
+           }
+           break;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Write the marshalling or unmarshalling function of a dataset */
+static void emitFunction (
+    FILE                    *pC,
+    const TRDP_DATASET_T    *pDataset,
+    BOOL8                   marshall)
+{
+    UINT32  lIndex, wire = 0u;
+    BOOL8   needIndex = FALSE;
+    char    name[GEN_MAX_NAME], value[2u * GEN_MAX_NAME], wireExpr[2u * GEN_MAX_NAME];
+
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        if ((pDataset->pElement[lIndex].size > 1u) && (wireSizeOfType(pDataset->pElement[lIndex].type) != 1u))
+        {
+            needIndex = TRUE;
+        }
+    }
+
+    if (marshall)
+    {
+        fprintf(pC, "static void %s_marshall%u (\n    const UINT8 *pSrc,\n    UINT8       *pDst)\n{\n", prefix,
+                pDataset->id);
+        fprintf(pC, "    const %s_DS%u_T *p = (const %s_DS%u_T *) pSrc;\n", PREFIX, pDataset->id, PREFIX, pDataset->id);
+    }
+    else
+    {
+        fprintf(pC, "static void %s_unmarshall%u (\n    const UINT8 *pSrc,\n    UINT8       *pDst)\n{\n", prefix,
+                pDataset->id);
+        fprintf(pC, "    %s_DS%u_T *p = (%s_DS%u_T *) pDst;\n", PREFIX, pDataset->id, PREFIX, pDataset->id);
+    }
+    if (needIndex)
+    {
+        fprintf(pC, "    UINT32 i;\n");
+    }
+    fprintf(pC, "\n");
+
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        const TRDP_DATASET_ELEMENT_T    *pElement = &pDataset->pElement[lIndex];
+        UINT32                          itemSize = (pElement->type > (UINT32) TRDP_TYPE_MAX) ?
+            wireSizeOfDataset(findDataset(pElement->type), 1) : wireSizeOfType(pElement->type);
+
+        memberName(pDataset, lIndex, name);
+        if (pElement->size == 1u)
+        {
+            sprintf(value, "p->%s", name);
+            sprintf(wireExpr, "%uu", wire);
+            emitItem(pC, marshall, pElement, value, wireExpr, "    ");
+        }
+        else if (itemSize == 1u)
+        {
+            if (marshall)
+            {
+                fprintf(pC, "    memcpy(pDst + %uu, p->%s, %uu);\n", wire, name, pElement->size);
+            }
+            else
+            {
+                fprintf(pC, "    memcpy(p->%s, pSrc + %uu, %uu);\n", name, wire, pElement->size);
+            }
+        }
+        else
+        {
+            fprintf(pC, "    for (i = 0u; i < %uu; i++)\n    {\n", pElement->size);
+            sprintf(value, "p->%s[i]", name);
+            sprintf(wireExpr, "%uu + %uu * i", wire, itemSize);
+            emitItem(pC, marshall, pElement, value, wireExpr, "        ");
+            fprintf(pC, "    }\n");
+        }
+        wire += itemSize * pElement->size;
+    }
+    fprintf(pC, "}\n\n");
+}
+
+/**********************************************************************************************************************/
+/** Write the functions of a dataset, nested datasets first */
+static void emitFunctions (
+    FILE                    *pC,
+    const TRDP_DATASET_T    *pDataset)
+{
+    UINT32 lIndex;
+
+    if (pEmitted[datasetIndex(pDataset)] != 0u)
+    {
+        return;
+    }
+    pEmitted[datasetIndex(pDataset)] = 1u;
+
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        if (pDataset->pElement[lIndex].type > (UINT32) TRDP_TYPE_MAX)
+        {
+            emitFunctions(pC, findDataset(pDataset->pElement[lIndex].type));
+        }
+    }
+    emitFunction(pC, pDataset, TRUE);
+    emitFunction(pC, pDataset, FALSE);
+}
+
+static const char cHelpers[] =
+    "static INLINE void put16 (UINT8 *pDst, UINT16 val)\n"
+    "{\n"
+    "    pDst[0] = (UINT8) (val >> 8);\n"
+    "    pDst[1] = (UINT8) val;\n"
+    "}\n\n"
+    "static INLINE void put32 (UINT8 *pDst, UINT32 val)\n"
+    "{\n"
+    "    pDst[0] = (UINT8) (val >> 24);\n"
+    "    pDst[1] = (UINT8) (val >> 16);\n"
+    "    pDst[2] = (UINT8) (val >> 8);\n"
+    "    pDst[3] = (UINT8) val;\n"
+    "}\n\n"
+    "static INLINE void put64 (UINT8 *pDst, UINT64 val)\n"
+    "{\n"
+    "    put32(pDst, (UINT32) (val >> 32));\n"
+    "    put32(pDst + 4, (UINT32) val);\n"
+    "}\n\n"
+    "static INLINE UINT16 get16 (const UINT8 *pSrc)\n"
+    "{\n"
+    "    return (UINT16) (((UINT32) pSrc[0] << 8) | pSrc[1]);\n"
+    "}\n\n"
+    "static INLINE UINT32 get32 (const UINT8 *pSrc)\n"
+    "{\n"
+    "    return ((UINT32) pSrc[0] << 24) | ((UINT32) pSrc[1] << 16) | ((UINT32) pSrc[2] << 8) | pSrc[3];\n"
+    "}\n\n"
+    "static INLINE UINT64 get64 (const UINT8 *pSrc)\n"
+    "{\n"
+    "    return ((UINT64) get32(pSrc) << 32) | get32(pSrc + 4);\n"
+    "}\n\n"
+    "static INLINE UINT32 bitsOfReal32 (REAL32 val)\n"
+    "{\n"
+    "    union { REAL32 r; UINT32 u; } x;\n"
+    "    x.r = val;\n"
+    "    return x.u;\n"
+    "}\n\n"
+    "static INLINE UINT64 bitsOfReal64 (REAL64 val)\n"
+    "{\n"
+    "    union { REAL64 r; UINT64 u; } x;\n"
+    "    x.r = val;\n"
+    "    return x.u;\n"
+    "}\n\n"
+    "static INLINE REAL32 realOfBits32 (UINT32 val)\n"
+    "{\n"
+    "    union { REAL32 r; UINT32 u; } x;\n"
+    "    x.u = val;\n"
+    "    return x.r;\n"
+    "}\n\n"
+    "static INLINE REAL64 realOfBits64 (UINT64 val)\n"
+    "{\n"
+    "    union { REAL64 r; UINT64 u; } x;\n"
+    "    x.u = val;\n"
+    "    return x.r;\n"
+    "}\n\n";
+
+/**********************************************************************************************************************/
+/** Write header and source file */
+static int generate (
+    const char  *pXmlFile,
+    const char  *pBase)
+{
+    FILE        *pH, *pC;
+    char        fileName[FILENAME_MAX];
+    const char  *pBaseName = strrchr(pBase, '/');
+    UINT32      i, numFuncs = 0u;
+
+    pBaseName = (pBaseName != NULL) ? pBaseName + 1 : pBase;
+    for (i = 0u; (pBaseName[i] != '\0') && (i < GEN_MAX_NAME - 1u); i++)
+    {
+        prefix[i] = isalnum((unsigned char) pBaseName[i]) ? (char) tolower((unsigned char) pBaseName[i]) : '_';
+        PREFIX[i] = (char) toupper((unsigned char) prefix[i]);
+    }
+    prefix[i] = PREFIX[i] = '\0';
+
+    sprintf(fileName, "%s.h", pBase);
+    pH = fopen(fileName, "w");
+    sprintf(fileName, "%s.c", pBase);
+    pC = fopen(fileName, "w");
+    if ((pH == NULL) || (pC == NULL))
+    {
+        printf("Cannot write %s.h/.c\n", pBase);
+        return 1;
+    }
+
+    fprintf(pH, "/* Generated by trdp-marshall-gen from %s - do not edit */\n\n", pXmlFile);
+    fprintf(pH, "#ifndef %s_H\n#define %s_H\n\n#include \"tau_marshall.h\"\n\n", PREFIX, PREFIX);
+    fprintf(pH, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+    memset(pEmitted, 0, numDataset);
+    for (i = 0u; i < numDataset; i++)
+    {
+        if (wireSizeOfDataset(apDataset[i], 1) != 0u)
+        {
+            emitStruct(pH, apDataset[i]);
+            numFuncs++;
+        }
+        else
+        {
+            fprintf(pH, "/* Dataset %u %s has variable size and is marshalled generically */\n\n", apDataset[i]->id,
+                    apDataset[i]->name);
+        }
+    }
+    fprintf(pH, "/** Table for tau_registerMarshallFuncs() */\n");
+    fprintf(pH, "extern const TAU_MARSHALL_FUNCS_T %s_funcs[];\n", prefix);
+    fprintf(pH, "extern const UINT32 %s_numFuncs;\n\n", prefix);
+    fprintf(pH, "#ifdef __cplusplus\n}\n#endif\n\n#endif /* %s_H */\n", PREFIX);
+
+    fprintf(pC, "/* Generated by trdp-marshall-gen from %s - do not edit */\n\n", pXmlFile);
+    fprintf(pC, "#include <string.h>\n\n#include \"%s.h\"\n\n", pBaseName);
+    fputs(cHelpers, pC);
+    memset(pEmitted, 0, numDataset);
+    for (i = 0u; i < numDataset; i++)
+    {
+        if (wireSizeOfDataset(apDataset[i], 1) != 0u)
+        {
+            emitFunctions(pC, apDataset[i]);
+        }
+    }
+    fprintf(pC, "const TAU_MARSHALL_FUNCS_T %s_funcs[] =\n{\n", prefix);
+    for (i = 0u; i < numDataset; i++)
+    {
+        if (wireSizeOfDataset(apDataset[i], 1) != 0u)
+        {
+            fprintf(pC, "    {%uu, %s_DS%u_WIRE_SIZE, sizeof(%s_DS%u_T), %s_marshall%u, %s_unmarshall%u},\n",
+                    apDataset[i]->id, PREFIX, apDataset[i]->id, PREFIX, apDataset[i]->id,
+                    prefix, apDataset[i]->id, prefix, apDataset[i]->id);
+        }
+    }
+    if (numFuncs == 0u)
+    {
+        fprintf(pC, "    {0u, 0u, 0u, NULL, NULL}\n");
+    }
+    fprintf(pC, "};\n\nconst UINT32 %s_numFuncs = %uu;\n", prefix, numFuncs);
+
+    fclose(pH);
+    fclose(pC);
+    printf("%s: %u of %u datasets generated into %s.c\n", pXmlFile, numFuncs, numDataset, pBase);
+    return 0;
+}
+
+/******/
+int main (
+    int     argc,
+    char    *argv[])
+{
+    TRDP_XML_DOC_HANDLE_T   docHandle;
+    UINT32                  numComId = 0u;
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap = NULL;
+    int                     ret;
+
+    if (argc != 3)
+    {
+        printf("usage: %s <xml file> <output base name>\n", argv[0]);
+        return 1;
+    }
+
+    if ((tau_prepareXmlDoc(argv[1], &docHandle) != TRDP_NO_ERR) ||
+        (tau_readXmlDatasetConfig(&docHandle, &numComId, &pComIdDsIdMap, &numDataset, &apDataset) != TRDP_NO_ERR))
+    {
+        printf("Failed to read the dataset configuration of %s\n", argv[1]);
+        return 1;
+    }
+
+    pEmitted = (UINT8 *) calloc(numDataset + 1u, 1u);
+    ret = (pEmitted != NULL) ? generate(argv[1], argv[2]) : 1;
+
+    free(pEmitted);
+    tau_freeXmlDatasetConfig(numComId, pComIdDsIdMap, numDataset, apDataset);
+    tau_freeXmlDoc(&docHandle);
+    return ret;
+}
@@ -0,0 +1,234 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-pd-bench.c
+ *
+ * @brief           Benchmark for batched PD transmission
+ *
+ * @details         Publishes the PUSH pattern of trdp-pd-test-fast several times to the own address and reports
+ *                  the number of sent telegrams and send calls (system calls) per second.
+ *                  Built against libtrdp, every telegram needs one send call; built against the high performance
+ *                  library (HIGH_PERF_INDEXED), the telegrams of an index table slot share one sendmmsg() call.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          TCNOpen
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ *      AG 2026-10-16: Created
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/* --- defines ---------------------------------------------------------------*/
+
+#define BENCH_DEFAULT_SECONDS   10u                     /* default run time                             */
+#define BENCH_DEFAULT_COPIES    64u                     /* default number of copies of the pattern      */
+#define BENCH_MAX_COPIES        256u
+#define BENCH_PATTERNS          4u                      /* 256b/1432b x fast/slow cycle                 */
+#define BENCH_CYCLE_TIME        1000u                   /* process cycle in us                          */
+
+/* --- globals ---------------------------------------------------------------*/
+
+static TRDP_APP_SESSION_T   apph;
+static VOS_THREAD_T         rcvThread;
+static VOS_THREAD_T         sndThread;
+
+static const UINT32 size[2] = { 256u, TRDP_MAX_PD_DATA_SIZE };   /* medium/big dataset */
+
+#ifdef HIGH_PERF_BASE2
+static const UINT32 period[2] = { 128u, 256u };                 /* fast / slow cycle upon base 2 index  */
+#else
+static const UINT32 period[2] = { 100u, 250u };                 /* fast / slow cycle upon base 10 index */
+#endif
+
+static UINT8 buffer[TRDP_MAX_PD_DATA_SIZE];
+
+/* --- debug log -------------------------------------------------------------*/
+
+static void printLog (
+    void        *pRefCon,
+    VOS_LOG_T   category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      line,
+    const CHAR8 *pMsgStr)
+{
+    if (category <= VOS_LOG_ERROR)
+    {
+        printf("%s %s:%d %s", pTime, pFile, line, pMsgStr);
+    }
+}
+
+/* --- sender thread, called every process cycle -----------------------------*/
+
+static void *senderThread (void *pArg)
+{
+    TRDP_ERR_T result = tlp_processSend((TRDP_APP_SESSION_T) pArg);
+
+    if ((result != TRDP_NO_ERR) && (result != TRDP_BLOCK_ERR))
+    {
+        printf("tlp_processSend failed: %d\n", result);
+    }
+    return NULL;
+}
+
+/* --- receiver thread, drains the own telegrams -----------------------------*/
+
+static void *receiverThread (void *pArg)
+{
+    TRDP_APP_SESSION_T  apphandle   = (TRDP_APP_SESSION_T) pArg;
+    TRDP_TIME_T         interval    = {0, 0};
+    TRDP_FDS_T          fileDesc;
+    INT32               noDesc      = 0;
+
+    while (vos_threadDelay(0u) == VOS_NO_ERR)   /* this is a cancelation point! */
+    {
+        FD_ZERO(&fileDesc);
+        (void) tlp_getInterval(apphandle, &interval, &fileDesc, (TRDP_SOCK_T *) &noDesc);
+        noDesc = vos_select(noDesc, &fileDesc, NULL, NULL, &interval);
+        (void) tlp_processReceive(apphandle, &fileDesc, &noDesc);
+    }
+    return NULL;
+}
+
+/* --- main ------------------------------------------------------------------*/
+
+int main (int argc, char *argv[])
+{
+    TRDP_MEM_CONFIG_T           memcfg;
+    TRDP_PD_CONFIG_T            pdcfg;
+    TRDP_PROCESS_CONFIG_T       proccfg;
+    TRDP_STATISTICS_T           stats;
+    TRDP_PD_BATCH_STATISTICS_T  batchStats;
+    TRDP_PUB_T                  pubHandle[BENCH_MAX_COPIES * BENCH_PATTERNS];
+    TRDP_SUB_T                  subHandle[BENCH_MAX_COPIES * BENCH_PATTERNS];
+    TRDP_IP_ADDR_T              ownIp;
+    TRDP_ERR_T                  err;
+    UINT32  seconds = BENCH_DEFAULT_SECONDS;
+    UINT32  copies  = BENCH_DEFAULT_COPIES;
+    UINT32  numSendCalls;
+    UINT32  i;
+
+    if (argc < 2)
+    {
+        printf("usage: %s <localip> [<seconds>] [<copies>]\n", argv[0]);
+        printf("  <localip>  .. own IP address (ie. 10.2.24.1)\n");
+        printf("  <seconds>  .. run time (default %u)\n", BENCH_DEFAULT_SECONDS);
+        printf("  <copies>   .. copies of the 4 PUSH telegrams of trdp-pd-test-fast (default %u, max %u)\n",
+               BENCH_DEFAULT_COPIES, BENCH_MAX_COPIES);
+        return 1;
+    }
+
+    ownIp = vos_dottedIP(argv[1]);
+    if (argc >= 3)
+    {
+        seconds = (UINT32) strtoul(argv[2], NULL, 10);
+    }
+    if (argc >= 4)
+    {
+        copies = (UINT32) strtoul(argv[3], NULL, 10);
+    }
+    if ((ownIp == 0u) || (seconds == 0u) || (copies == 0u) || (copies > BENCH_MAX_COPIES))
+    {
+        printf("invalid input arguments\n");
+        return 1;
+    }
+
+    memset(&memcfg, 0, sizeof(memcfg));
+    memset(&proccfg, 0, sizeof(proccfg));
+    memset(&pdcfg, 0, sizeof(pdcfg));
+    memset(buffer, '_', sizeof(buffer));
+
+    proccfg.cycleTime   = BENCH_CYCLE_TIME;
+
+    pdcfg.sendParam.qos = 5u;
+    pdcfg.sendParam.ttl = 64u;
+    pdcfg.flags         = TRDP_FLAGS_NONE;
+    pdcfg.timeout       = 10000000u;
+    pdcfg.toBehavior    = TRDP_TO_SET_TO_ZERO;
+    pdcfg.port          = TRDP_PD_UDP_PORT;
+
+    err = tlc_init(printLog, NULL, &memcfg);
+    if (err != TRDP_NO_ERR)
+    {
+        printf("tlc_init() failed, err: %d\n", err);
+        return 1;
+    }
+
+    err = tlc_openSession(&apph, ownIp, 0u, NULL, &pdcfg, NULL, &proccfg);
+    if (err != TRDP_NO_ERR)
+    {
+        printf("tlc_openSession() failed, err: %d\n", err);
+        return 1;
+    }
+
+    /* publish and subscribe the PUSH pattern: 256b/1432b, fast/slow cycle */
+    for (i = 0u; i < copies * BENCH_PATTERNS; i++)
+    {
+        UINT32 comId    = 10000u + i;
+        UINT32 sz       = size[i % 2u];
+        UINT32 per      = period[(i / 2u) % 2u];
+
+        err = tlp_publish(apph, &pubHandle[i], NULL, NULL, 0u, comId, 0u, 0u, 0u, ownIp, per * 1000u, 0u,
+                          TRDP_FLAGS_NONE, NULL, buffer, sz);
+        if (err == TRDP_NO_ERR)
+        {
+            err = tlp_subscribe(apph, &subHandle[i], NULL, NULL, 0u, comId, 0u, 0u, 0u, 0u, 0u,
+                                TRDP_FLAGS_NONE, NULL, per * 4000u, TRDP_TO_SET_TO_ZERO);
+        }
+        if (err != TRDP_NO_ERR)
+        {
+            printf("publish/subscribe of comId %u failed, err: %d\n", comId, err);
+            return 1;
+        }
+    }
+
+    err = tlc_updateSession(apph);
+    if (err != TRDP_NO_ERR)
+    {
+        printf("tlc_updateSession() failed, err: %d\n", err);
+        return 1;
+    }
+
+    (void) vos_threadCreate(&rcvThread, "Receiver Task", VOS_THREAD_POLICY_OTHER, 0, 0u, 0u,
+                            (VOS_THREAD_FUNC_T) receiverThread, (void *) apph);
+    (void) vos_threadCreate(&sndThread, "Sender Task", VOS_THREAD_POLICY_OTHER, 0, proccfg.cycleTime, 0u,
+                            (VOS_THREAD_FUNC_T) senderThread, (void *) apph);
+
+    printf("Publishing %u telegrams for %u s ...\n", copies * BENCH_PATTERNS, seconds);
+    vos_threadDelay(seconds * 1000000u);
+
+    (void) vos_threadTerminate(sndThread);
+    (void) vos_threadTerminate(rcvThread);
+
+    (void) tlc_getStatistics(apph, &stats);
+    (void) tlc_getPdBatchStatistics(apph, &batchStats);
+
+    /* Without batched sending, every telegram is one send call */
+    numSendCalls = (batchStats.numTxBatches != 0u) ? batchStats.numTxBatches : stats.pd.numSend;
+
+    printf("telegrams sent:          %10u (%u/s)\n", stats.pd.numSend, stats.pd.numSend / seconds);
+    printf("send calls:              %10u (%u/s)\n", numSendCalls, numSendCalls / seconds);
+    if (numSendCalls != 0u)
+    {
+        UINT32 perCall = (UINT32) (((UINT64) stats.pd.numSend * 100u) / numSendCalls);
+        printf("telegrams per send call: %7u.%02u\n", perCall / 100u, perCall % 100u);
+    }
+    printf("telegrams received:      %10u, receive calls: %u\n", batchStats.numRxPackets, batchStats.numRxBatches);
+
+    (void) tlc_closeSession(apph);
+    (void) tlc_terminate();
+    return 0;
+}
@@ -0,0 +1,271 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-xml-bench.c
+ *
+ * @brief           Startup benchmark of the XML configuration parser
+ *
+ * @details         Repeats the configuration steps of a TRDP application at startup for each provided XML file:
+ *                  tau_prepareXmlDoc, tau_readXmlDeviceConfig, tau_readXmlInterfaceConfig for every interface and
+ *                  tau_readXmlDatasetConfig. Reports the average time per startup and the share of
+ *                  tau_prepareXmlDoc (loading and indexing the document).
+ *                  With -c, the configuration is taken from the binary configuration cache (tau_loadXmlCache),
+ *                  the share reported is the one of tau_loadXmlCache.
+ *
+ *                  usage: trdp-xml-bench [-c] [-n <loops>] [<xml file> ...]
+ *                  Without files, test/xml/speedtest1.xml and test/xml/speedtest2.xml are used.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          TCNOpen
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright TCNOpen, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ *      AG 2026-10-16: Option -c: startup from the binary configuration cache
+ *      AG 2026-10-16: Created
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tau_xml.h"
+#include "vos_mem.h"
+#include "vos_utils.h"
+
+/* --- defines ---------------------------------------------------------------*/
+
+#define BENCH_DEFAULT_LOOPS     200u                    /* default number of startups per file  */
+
+/* --- globals ---------------------------------------------------------------*/
+
+static const char *cDefaultFiles[] = {"test/xml/speedtest1.xml", "test/xml/speedtest2.xml"};
+
+/**********************************************************************************************************************/
+/** Elapsed time since start in us */
+static UINT32 elapsed (
+    const VOS_TIMEVAL_T *pStart)
+{
+    VOS_TIMEVAL_T now;
+
+    vos_getTime(&now);
+    vos_subTime(&now, pStart);
+    return (UINT32) (now.tv_sec * 1000000 + now.tv_usec);
+}
+
+/**********************************************************************************************************************/
+/** One startup: read the complete configuration of the file and free it again
+ *
+ *  @param[in]      pFileName       XML file
+ *  @param[out]     pPrepareTime    Time spent in tau_prepareXmlDoc
+ *  @param[out]     pTelegrams      Number of telegrams over all interfaces
+ *  @param[out]     pDatasets       Number of datasets
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ */
+static TRDP_ERR_T startup (
+    const char  *pFileName,
+    UINT32      *pPrepareTime,
+    UINT32      *pTelegrams,
+    UINT32      *pDatasets)
+{
+    TRDP_XML_DOC_HANDLE_T   docHandle;
+    TRDP_MEM_CONFIG_T       memConfig;
+    TRDP_DBG_CONFIG_T       dbgConfig;
+    UINT32                  numComPar       = 0u;
+    TRDP_COM_PAR_T          *pComPar        = NULL;
+    UINT32                  numIfConfig     = 0u;
+    TRDP_IF_CONFIG_T        *pIfConfig      = NULL;
+    UINT32                  numComId        = 0u;
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap  = NULL;
+    UINT32                  numDataset      = 0u;
+    apTRDP_DATASET_T        apDataset       = NULL;
+    UINT32                  i;
+    VOS_TIMEVAL_T           start;
+    TRDP_ERR_T              err;
+
+    vos_getTime(&start);
+    err = tau_prepareXmlDoc(pFileName, &docHandle);
+    *pPrepareTime = elapsed(&start);
+    if (err != TRDP_NO_ERR)
+    {
+        return err;
+    }
+
+    err = tau_readXmlDeviceConfig(&docHandle, &memConfig, &dbgConfig, &numComPar, &pComPar,
+                                  &numIfConfig, &pIfConfig);
+
+    *pTelegrams = 0u;
+    for (i = 0u; (err == TRDP_NO_ERR) && (i < numIfConfig); i++)
+    {
+        TRDP_PROCESS_CONFIG_T   processConfig;
+        TRDP_PD_CONFIG_T        pdConfig;
+        TRDP_MD_CONFIG_T        mdConfig;
+        UINT32                  numExchgPar = 0u;
+        TRDP_EXCHG_PAR_T        *pExchgPar  = NULL;
+
+        err = tau_readXmlInterfaceConfig(&docHandle, pIfConfig[i].ifName, &processConfig, &pdConfig, &mdConfig,
+                                         &numExchgPar, &pExchgPar);
+        if (err == TRDP_NO_ERR)
+        {
+            *pTelegrams += numExchgPar;
+            tau_freeTelegrams(numExchgPar, pExchgPar);
+        }
+    }
+
+    if (err == TRDP_NO_ERR)
+    {
+        err = tau_readXmlDatasetConfig(&docHandle, &numComId, &pComIdDsIdMap, &numDataset, &apDataset);
+        if (err == TRDP_NO_ERR)
+        {
+            *pDatasets = numDataset;
+            tau_freeXmlDatasetConfig(numComId, pComIdDsIdMap, numDataset, apDataset);
+        }
+    }
+
+    if (pComPar != NULL)
+    {
+        vos_memFree(pComPar);
+    }
+    if (pIfConfig != NULL)
+    {
+        vos_memFree(pIfConfig);
+    }
+    tau_freeXmlDoc(&docHandle);
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** One startup from the binary configuration cache, built on the first call
+ *
+ *  @param[in]      pFileName       XML file
+ *  @param[out]     pPrepareTime    Time spent in tau_loadXmlCache
+ *  @param[out]     pTelegrams      Number of telegrams over all interfaces
+ *  @param[out]     pDatasets       Number of datasets
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ */
+static TRDP_ERR_T startupCached (
+    const char  *pFileName,
+    UINT32      *pPrepareTime,
+    UINT32      *pTelegrams,
+    UINT32      *pDatasets)
+{
+    TAU_XML_CACHE_T         *pCache;
+    TRDP_MEM_CONFIG_T       memConfig;
+    TRDP_DBG_CONFIG_T       dbgConfig;
+    UINT32                  numComPar       = 0u;
+    TRDP_COM_PAR_T          *pComPar        = NULL;
+    UINT32                  numIfConfig     = 0u;
+    TRDP_IF_CONFIG_T        *pIfConfig      = NULL;
+    UINT32                  numComId        = 0u;
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap  = NULL;
+    UINT32                  numDataset      = 0u;
+    apTRDP_DATASET_T        apDataset       = NULL;
+    UINT32                  i;
+    VOS_TIMEVAL_T           start;
+    TRDP_ERR_T              err;
+
+    vos_getTime(&start);
+    err = tau_loadXmlCache(pFileName, NULL, &pCache);
+    *pPrepareTime = elapsed(&start);
+    if (err != TRDP_NO_ERR)
+    {
+        return err;
+    }
+
+    err = tau_readXmlCacheDeviceConfig(pCache, &memConfig, &dbgConfig, &numComPar, &pComPar,
+                                       &numIfConfig, &pIfConfig);
+
+    *pTelegrams = 0u;
+    for (i = 0u; (err == TRDP_NO_ERR) && (i < numIfConfig); i++)
+    {
+        TRDP_PROCESS_CONFIG_T   processConfig;
+        TRDP_PD_CONFIG_T        pdConfig;
+        TRDP_MD_CONFIG_T        mdConfig;
+        UINT32                  numExchgPar = 0u;
+        TRDP_EXCHG_PAR_T        *pExchgPar  = NULL;
+
+        err = tau_readXmlCacheInterfaceConfig(pCache, pIfConfig[i].ifName, &processConfig, &pdConfig, &mdConfig,
+                                              &numExchgPar, &pExchgPar);
+        *pTelegrams += numExchgPar;
+    }
+
+    if (err == TRDP_NO_ERR)
+    {
+        err = tau_readXmlCacheDatasetConfig(pCache, &numComId, &pComIdDsIdMap, &numDataset, &apDataset);
+        *pDatasets = numDataset;
+    }
+
+    tau_freeXmlCache(pCache);
+    return err;
+}
+
+/******/
+int main (
+    int     argc,
+    char    *argv[])
+{
+    UINT32      loops = BENCH_DEFAULT_LOOPS;
+    int         first = 1;
+    int         numFiles;
+    const char  **ppFiles;
+    int         f;
+    TRDP_ERR_T  (*pStartup)(const char *, UINT32 *, UINT32 *, UINT32 *) = startup;
+
+    if ((argc > first) && (strcmp(argv[first], "-c") == 0))
+    {
+        pStartup = startupCached;
+        first++;
+    }
+    if ((argc > first + 1) && (strcmp(argv[first], "-n") == 0))
+    {
+        loops   = (UINT32) strtoul(argv[first + 1], NULL, 10);
+        first   += 2;
+    }
+    if ((loops == 0u) || ((argc > first) && (argv[first][0] == '-')))
+    {
+        printf("usage: %s [-c] [-n <loops>] [<xml file> ...]\n", argv[0]);
+        return 1;
+    }
+
+    if (argc > first)
+    {
+        ppFiles     = (const char **) &argv[first];
+        numFiles    = argc - first;
+    }
+    else
+    {
+        ppFiles     = cDefaultFiles;
+        numFiles    = (int) (sizeof(cDefaultFiles) / sizeof(cDefaultFiles[0]));
+    }
+
+    printf("%u startups per file%s:%*s startup  of which %s  telegrams  datasets\n", loops,
+           (pStartup == startup) ? "" : " (cached)", (pStartup == startup) ? 17 : 8, "",
+           (pStartup == startup) ? "prepare" : "   load");
+    for (f = 0; f < numFiles; f++)
+    {
+        UINT32          i, total, prepareTime, prepareSum = 0u, telegrams = 0u, datasets = 0u;
+        VOS_TIMEVAL_T   start;
+
+        vos_getTime(&start);
+        for (i = 0u; i < loops; i++)
+        {
+            if (pStartup(ppFiles[f], &prepareTime, &telegrams, &datasets) != TRDP_NO_ERR)
+            {
+                printf("Failed to read the configuration of %s\n", ppFiles[f]);
+                return 1;
+            }
+            prepareSum += prepareTime;
+        }
+        total = elapsed(&start);
+
+        printf("  %-32s %9u us %13u us %10u %9u\n", ppFiles[f], total / loops, prepareSum / loops, telegrams,
+               datasets);
+    }
+    return 0;
+}